@@ -0,0 +1,98 @@
+#pragma once
+
+#include "objects/object.h"
+
+#include <functional>
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace love
+{
+    /*
+    ** Byte storage for Data that gets cloned (ImageData, SoundData).
+    ** A copy shares the bytes of its source. Writes go through WriteBlock,
+    ** which only copies the block being written to when it's shared, so a
+    ** clone that changes a few pixels doesn't pay for the whole image.
+    **
+    ** The buffer is one allocation until a shared buffer is written to,
+    ** then it is split into blocks. The Contiguous getters join it again.
+    ** Not thread-safe by itself, the owner locks around it.
+    */
+    class CowBuffer
+    {
+      public:
+        typedef std::function<void(uint8_t*)> Deleter;
+
+        CowBuffer();
+
+        CowBuffer(size_t size, size_t blockSize);
+
+        /* take over @memory, it's freed with @deleter */
+        CowBuffer(uint8_t* memory, size_t size, size_t blockSize, const Deleter& deleter);
+
+        CowBuffer(const CowBuffer& other);
+
+        CowBuffer& operator=(const CowBuffer& other);
+
+        ~CowBuffer();
+
+        size_t GetSize() const;
+
+        size_t GetBlockSize() const;
+
+        /* start of the block holding @offset */
+        const uint8_t* ReadBlock(size_t offset) const;
+
+        uint8_t* WriteBlock(size_t offset);
+
+        const uint8_t* ReadContiguous();
+
+        uint8_t* WriteContiguous();
+
+        bool IsShared() const;
+
+        /* bytes held by every buffer, and what they would take without sharing */
+        static int64_t GetAllocatedBytes();
+
+        static int64_t GetLogicalBytes();
+
+      private:
+        class Chunk : public Object
+        {
+          public:
+            Chunk(size_t size);
+
+            Chunk(uint8_t* memory, size_t size, const Deleter& deleter);
+
+            virtual ~Chunk();
+
+            uint8_t* memory;
+            size_t size;
+
+            Deleter deleter;
+        };
+
+        struct Block
+        {
+            StrongReference<Chunk> chunk;
+            uint8_t* data;
+
+            /* points into a flat chunk, always copied before writing */
+            bool view;
+        };
+
+        size_t size;
+        size_t blockSize;
+
+        /* the whole buffer, while it isn't split */
+        StrongReference<Chunk> flat;
+
+        /* set once split */
+        std::vector<Block> blocks;
+
+        void Split();
+
+        void Join();
+    };
+} // namespace love
@@ -18,6 +18,12 @@ namespace love
 
         virtual void* GetData() const = 0;
 
+        /* for readers, so Data sharing its bytes with a clone can keep sharing them */
+        virtual const void* ReadData() const
+        {
+            return this->GetData();
+        }
+
         virtual size_t GetSize() const = 0;
     };
 } // namespace love
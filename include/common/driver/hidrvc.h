@@ -2,8 +2,10 @@
 
 #if defined(__3DS__)
     #include <3ds.h>
-#else
+#elif defined(__SWITCH__)
     #include <switch.h>
+#elif defined(__HOST__)
+    #include "host.h"
 #endif
 
 #include <array>
@@ -3,7 +3,7 @@
 #if defined(__3DS__)
     #include <citro2d.h>
 typedef C3D_Mtx Elements;
-#elif defined(__SWITCH__)
+#else
 typedef float Elements[16];
 #endif
 
@@ -91,7 +91,7 @@ namespace love
         static void Multiply(const Matrix4& a, const Matrix4& b, Elements& c);
     };
 
-#if defined(__SWITCH__)
+#if not defined(__3DS__)
     template<typename Vdst, typename Vsrc>
     void Matrix4::TransformXY(Vdst* dst, const Vsrc* src, int size) const
     {
@@ -126,7 +126,7 @@ namespace love
             dst[i].z = z;
         }
     }
-#elif defined(__3DS__)
+#else
     template<typename Vdst, typename Vsrc>
     void Matrix4::TransformXY(Vdst* dst, const Vsrc* src, int size) const
     {
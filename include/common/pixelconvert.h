@@ -0,0 +1,30 @@
+#pragma once
+
+#include "common/pixelformat.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+** Row converters between the uncompressed ImageData formats, using
+** integer math only. 8 bit <-> 16 bit channels are scaled exactly
+** (v * 257 and round(v / 257)), so going 8 -> 16 -> 8 is lossless.
+** Missing channels are filled in as green = blue = 0, alpha = 1.
+*/
+namespace love
+{
+    typedef void (*PixelRowConverter)(const void* src, void* dst, size_t count);
+
+    /* nullptr when either format has no converter */
+    PixelRowConverter GetPixelRowConverter(PixelFormat source, PixelFormat destination);
+
+    inline uint16_t WidenChannel(uint8_t value)
+    {
+        return uint16_t(value * 0x101);
+    }
+
+    inline uint8_t NarrowChannel(uint16_t value)
+    {
+        return uint8_t((uint32_t(value) * 0xFF + 0x807F) >> 16);
+    }
+} // namespace love
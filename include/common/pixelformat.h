@@ -69,6 +69,10 @@ namespace love
         PIXELFORMAT_ASTC_12x10,
         PIXELFORMAT_ASTC_12x12,
 
+        // 3DS ETC1, tiled and little endian
+        PIXELFORMAT_TEX3DS_ETC1,
+        PIXELFORMAT_TEX3DS_ETC1A4,
+
         PIXELFORMAT_MAX_ENUM
     };
 
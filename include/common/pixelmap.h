@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+** The built-in ImageData:mapPixels operations, on rows of RGBA16 pixels.
+** Integer math only. With NEON, eight pixels are done at a time, giving
+** the same results as the scalar loops that finish the row.
+*/
+namespace love::pixelmap
+{
+    enum Operation
+    {
+        MAP_TINT,        //< multiply by a color
+        MAP_THRESHOLD,   //< each color channel becomes 0 or 1, alpha is kept
+        MAP_PREMULTIPLY, //< multiply the color channels by alpha
+        MAP_GRAYSCALE,   //< Rec. 601 luma in every color channel
+        MAP_MAX_ENUM
+    };
+
+    /* @x * @y / 65535, rounded to nearest */
+    inline uint16_t Multiply(uint32_t x, uint32_t y)
+    {
+        uint32_t product = x * y + 0x8000;
+        return uint16_t((product + (product >> 16)) >> 16);
+    }
+
+    /* @value is the tint color, or the threshold in its red channel, on the same scale */
+    void MapRow(Operation operation, const uint16_t value[4], uint16_t* row, size_t count);
+} // namespace love::pixelmap
@@ -7,6 +7,9 @@
 #elif defined(__3DS__)
     #include <3ds.h>
     #define __CONSOLE_ABORT(res_expr) svcBreak(USERBREAK_PANIC)
+#elif defined(__HOST__)
+    #include "host.h"
+    #define __CONSOLE_ABORT(res_expr) abort()
 #endif
 
 #include <string>
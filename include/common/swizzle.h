@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+** 3DS textures are made of 8x8 tiles stored left to right, top to bottom.
+** The 64 pixels of a tile are in Morton (Z) order, so every tile is one
+** contiguous block of memory. These kernels move whole rows and tiles with
+** plain integer copies -- no per-pixel format conversion. Tiled widths
+** must be multiples of 8 and pixels must be 1, 2 or 4 bytes large.
+*/
+namespace love::swizzle
+{
+    static constexpr unsigned TILE_SIZE   = 8;
+    static constexpr unsigned TILE_PIXELS = TILE_SIZE * TILE_SIZE;
+
+    bool IsPixelSizeSupported(size_t pixelSize);
+
+    /* index of pixel (@x, @y) in a tiled image @width pixels wide */
+    unsigned GetTiledIndex(unsigned width, unsigned x, unsigned y);
+
+    /*
+    ** Copy a @width x @height linear image (@srcPitch bytes per row)
+    ** to (@dx, @dy) of a tiled image @dstWidth pixels wide.
+    */
+    void LinearToTiled(const void* src, size_t srcPitch, void* dst, unsigned dstWidth, unsigned dx,
+                       unsigned dy, unsigned width, unsigned height, size_t pixelSize);
+
+    /*
+    ** Copy a @width x @height rectangle at (@sx, @sy) of a tiled image
+    ** @srcWidth pixels wide to a linear image (@dstPitch bytes per row).
+    */
+    void TiledToLinear(const void* src, unsigned srcWidth, unsigned sx, unsigned sy, void* dst,
+                       size_t dstPitch, unsigned width, unsigned height, size_t pixelSize);
+
+    /*
+    ** Copy a rectangle between two tiled images of possibly different widths.
+    ** When the rectangle is tile-aligned in both, runs of whole tiles are
+    ** copied with a single memcpy, and the rest pixel by pixel through
+    ** lookup tables made once per call.
+    */
+    void CopyTiled(const void* src, unsigned srcWidth, unsigned sx, unsigned sy, void* dst,
+                   unsigned dstWidth, unsigned dx, unsigned dy, unsigned width, unsigned height,
+                   size_t pixelSize);
+} // namespace love::swizzle
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+namespace love
+{
+    /*
+    ** Two-level segregated fit allocator (Masmano et al., "TLSF: a New
+    ** Dynamic Memory Allocator for Real-Time Systems") over a region we
+    ** don't own. Free blocks are binned by the power of two of their size,
+    ** then by SL_COUNT linear steps inside it. A bitmap per level finds a
+    ** non-empty bin big enough in constant time, and freeing merges with
+    ** the physical neighbours in constant time.
+    **
+    ** Block nodes live outside the region. The only thing written into it
+    ** is a tag in front of each handed out address, pointing back at its
+    ** node, so freeing is a read instead of a lookup. The tag carries the
+    ** allocation's generation and a check word, so a stray or stale free
+    ** is turned away before its pointer is followed. It takes as many
+    ** units as it needs, and every block is a multiple of the alignment
+    ** given to Init, which keeps every address aligned.
+    ** Not thread-safe by itself, the owner locks around it.
+    */
+    class TLSF
+    {
+      public:
+        struct Stats
+        {
+            size_t size;
+            size_t used;
+            size_t largestFree;
+
+            int usedBlocks;
+            int freeBlocks;
+
+            /* 0 when all the free space is one block, towards 1 as it splinters */
+            float fragmentation;
+        };
+
+        TLSF();
+
+        ~TLSF();
+
+        /* @alignment is a power of two, @base is rounded up to it */
+        void Init(void* base, size_t size, size_t alignment);
+
+        bool IsReady() const
+        {
+            return this->alignment != 0;
+        }
+
+        /* nullptr when there's no room, @allocated is what was handed out */
+        void* Allocate(size_t size, size_t& allocated);
+
+        void Free(void* address);
+
+        Stats GetStats() const;
+
+      private:
+        static constexpr int SL_COUNT_LOG2 = 4;
+        static constexpr int SL_COUNT      = 1 << SL_COUNT_LOG2;
+        static constexpr int FL_COUNT      = 48;
+
+        struct Block
+        {
+            uint8_t* base;
+            size_t units;
+
+            Block* prevPhysical;
+            Block* nextPhysical;
+
+            Block* prevFree;
+            Block* nextFree;
+
+            bool free;
+
+            /* of the allocation handed out from it */
+            uint32_t generation;
+        };
+
+        struct Tag
+        {
+            Block* block;
+            uint32_t generation;
+            uint32_t check;
+        };
+
+        static constexpr uint32_t TAG_MAGIC = 0x544C5346;
+
+        static uint32_t Check(const Tag& tag);
+
+        static void Mapping(size_t units, int& fl, int& sl);
+
+        Block* NewBlock();
+
+        void DeleteBlock(Block* block);
+
+        void InsertFree(Block* block);
+
+        void RemoveFree(Block* block);
+
+        Block* FindFree(size_t units);
+
+        size_t alignment;
+        int alignmentShift;
+
+        /* the aligned region, frees outside it are ignored */
+        uint8_t* start;
+        uint8_t* end;
+
+        /* units in front of every allocation holding its tag */
+        size_t tagUnits;
+
+        size_t totalUnits;
+        size_t usedUnits;
+        int usedBlocks;
+        int freeBlocks;
+
+        uint32_t generation;
+
+        uint64_t flBitmap;
+        uint32_t slBitmap[FL_COUNT];
+        Block* bins[FL_COUNT][SL_COUNT];
+
+        /* every node ever made, recycled through @spare */
+        std::vector<Block*> nodes;
+        Block* spare;
+    };
+} // namespace love
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <bitset>
 #include <unordered_map>
 
@@ -7,6 +8,8 @@
     #include <3ds.h>
 #elif defined(__SWITCH__)
     #include <switch.h>
+#elif defined(__HOST__)
+    #include "host.h"
 #endif
 
 namespace love
@@ -30,6 +33,13 @@ namespace love
 
         static Type* ByName(const char* name);
 
+        /* live objects of exactly this type, see Object::SetLiveType */
+        int GetLiveCount() const;
+
+        void AddLive(int delta);
+
+        static const std::unordered_map<std::string, love::Type*>& GetTypes();
+
       private:
         const char* const name;
         Type* const parent;
@@ -37,6 +47,8 @@ namespace love
         uint32_t id;
         bool initialized;
 
+        std::atomic<int> live;
+
         std::bitset<MAX_TYPES> m_bits;
 
         static inline std::unordered_map<std::string, love::Type*> m_types = {};
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "common/module.h"
+#include "modules/audio/audiocache.h"
 #include "objects/source/source.h"
 
 #include "modules/audio/pool/pool.h"
@@ -58,8 +59,11 @@ namespace love
 
         float GetVolume() const;
 
+        AudioCache& GetCache();
+
       private:
         Pool* pool;
+        AudioCache cache;
 
         class PoolThread : public Threadable
         {
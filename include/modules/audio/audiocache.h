@@ -0,0 +1,119 @@
+#pragma once
+
+#include "common/strongref.h"
+
+#include "objects/sounddata/sounddata.h"
+#include "objects/source/sourcec.h"
+
+#include "modules/thread/types/lock.h"
+
+#include <list>
+#include <string>
+#include <unordered_map>
+
+namespace love
+{
+    /*
+    ** Static Sources made from the same samples share one driver buffer,
+    ** found by the SoundData's content id. Static Sources made from the
+    ** same, unchanged file share the decoded SoundData, so it's only
+    ** decoded once.
+    **
+    ** Entries nothing else holds on to stay around until their part of the
+    ** cache goes over its budget, then the least recently used ones are let
+    ** go. Decoded sounds live in main memory and driver buffers in audio
+    ** memory, so each has its own budget.
+    */
+    class AudioCache
+    {
+      public:
+        /* buffers are kept well under the Switch's 16 MiB AudioPool, for what's playing */
+#if defined(__3DS__)
+        static constexpr size_t DEFAULT_SOUND_BUDGET  = 0x200000;
+        static constexpr size_t DEFAULT_BUFFER_BUDGET = 0x200000;
+#else
+        static constexpr size_t DEFAULT_SOUND_BUDGET  = 0x2000000;
+        static constexpr size_t DEFAULT_BUFFER_BUDGET = 0x800000;
+#endif
+
+        struct Stats
+        {
+            size_t soundBytes;
+            size_t soundBudget;
+
+            size_t bufferBytes;
+            size_t bufferBudget;
+
+            int buffers;
+            int sounds;
+
+            int64_t hits;
+            int64_t misses;
+            int64_t evictions;
+        };
+
+        AudioCache();
+
+        ~AudioCache();
+
+        /* retained, the caller releases it */
+        StaticDataBuffer* GetBuffer(SoundData* sound);
+
+        /* retained, nullptr unless @path was decoded while it had this @modtime and @size */
+        SoundData* GetSoundData(const std::string& path, int64_t modtime, int64_t size);
+
+        void AddSoundData(const std::string& path, int64_t modtime, int64_t size,
+                          SoundData* sound);
+
+        void SetBudgets(size_t soundBudget, size_t bufferBudget);
+
+        void Clear();
+
+        Stats GetStats();
+
+      private:
+        template<typename Key, typename T>
+        struct Entry
+        {
+            Key key;
+            StrongReference<T> object;
+
+            /* the file's, for decoded sounds */
+            int64_t modtime;
+            int64_t size;
+        };
+
+        /* most recently used first, with a lookup into the list */
+        template<typename Key, typename T>
+        struct Entries
+        {
+            std::list<Entry<Key, T>> list;
+            std::unordered_map<Key, typename std::list<Entry<Key, T>>::iterator> lookup;
+        };
+
+        /* drops unused entries from the cold end until @bytes is within @budget */
+        template<typename Key, typename T>
+        void Trim(Entries<Key, T>& entries, size_t& bytes, size_t budget);
+
+        /* returns the entry after @it */
+        template<typename Key, typename T>
+        typename std::list<Entry<Key, T>>::iterator Erase(
+            Entries<Key, T>& entries, typename std::list<Entry<Key, T>>::iterator it,
+            size_t& bytes);
+
+        thread::MutexRef mutex;
+
+        Entries<uint64_t, StaticDataBuffer> buffers;
+        Entries<std::string, SoundData> sounds;
+
+        size_t soundBytes;
+        size_t soundBudget;
+
+        size_t bufferBytes;
+        size_t bufferBudget;
+
+        int64_t hits;
+        int64_t misses;
+        int64_t evictions;
+    };
+} // namespace love
@@ -10,8 +10,14 @@
 
 namespace Wrap_Audio
 {
+    int ClearCache(lua_State* L);
+
     int GetActiveSourceCount(lua_State* L);
 
+    int GetCacheStats(lua_State* L);
+
+    int GetResampleQuality(lua_State* L);
+
     int GetVolume(lua_State* L);
 
     int NewSource(lua_State* L);
@@ -20,6 +26,10 @@ namespace Wrap_Audio
 
     int Play(lua_State* L);
 
+    int SetCacheBudget(lua_State* L);
+
+    int SetResampleQuality(lua_State* L);
+
     int SetVolume(lua_State* L);
 
     int Stop(lua_State* L);
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "common/luax.h"
+
+#include "modules/data/compressor/compressor.h"
+#include "objects/data/byte/bytedata.h"
+
+namespace love
+{
+    namespace data
+    {
+        /*
+        ** Binary encoding for save states: nil, booleans, numbers, strings and
+        ** tables of those, nested to any depth short of a cycle. A string seen
+        ** before is written as a reference to its first copy, so the keys of a
+        ** thousand similar tables cost one byte or two each.
+        **
+        ** Encoded data starts with a header naming the compression format, or
+        ** FORMAT_MAX_ENUM for none.
+        */
+
+        /* encodes the value at @index */
+        ByteData* _Serialize(lua_State* L, int index,
+                             Compressor::Format format = Compressor::FORMAT_MAX_ENUM,
+                             int level                 = -1);
+
+        /* pushes the value in @data, decoded in one pass straight onto the stack */
+        void _Deserialize(lua_State* L, const char* data, size_t size);
+    } // namespace data
+} // namespace love
@@ -1,7 +1,9 @@
 #pragma once
 
+#include "common/cowbuffer.h"
 #include "common/luax.h"
 #include "modules/data/datamodule.h"
+#include "modules/data/serializer.h"
 
 #include "objects/data/wrap_data.h"
 
@@ -37,5 +39,11 @@ namespace Wrap_DataModule
 
     int Unpack(lua_State* L);
 
+    int Serialize(lua_State* L);
+
+    int Deserialize(lua_State* L);
+
+    int GetSharedMemoryStats(lua_State* L);
+
     int Register(lua_State* L);
 } // namespace Wrap_DataModule
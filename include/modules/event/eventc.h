@@ -9,6 +9,8 @@
 
 #include "common/message.h"
 
+#include "modules/event/eventlog.h"
+#include "modules/event/eventring.h"
 #include "modules/joystick/joystick.h"
 
 #include "modules/thread/types/lock.h"
@@ -17,7 +19,6 @@
 #include "driver/hidrv.h"
 
 #include <memory>
-#include <queue>
 #include <vector>
 
 struct LOVE_Event;
@@ -34,6 +35,8 @@ namespace love::common
       public:
         Event();
 
+        virtual ~Event();
+
         ModuleType GetModuleType() const
         {
             return M_EVENT;
@@ -46,32 +49,74 @@ namespace love::common
 
         void InternalClear();
 
+        /* converts what the driver has into records, merging stick and finger motion */
         void Pump();
 
-        Message* Wait();
+        bool Wait(EventRecord& record);
 
         void Clear();
 
         void Push(Message* message);
 
-        bool Poll(Message*& message);
+        /* the caller owns what @record references, see EventRecord::Release */
+        bool Poll(EventRecord& record);
 
         void ExceptionIfInRenderPass(const char* name);
 
         std::unique_ptr<love::driver::Hidrv>& GetDriver();
 
+        /* keep every event the driver gives from here on */
+        void Record(const std::string& filename);
+
+        /*
+        ** Feed the game a recording instead of the driver, stepping the timer
+        ** by the recording's mean delta and profiling each frame. The game is
+        ** sent "quit" once the recording runs out.
+        */
+        void Replay(const std::string& filename);
+
+        /* saves the recording, or the replay's profile next to it as .csv */
+        void Stop();
+
+        bool IsRecording() const;
+
+        bool IsReplaying() const;
+
       protected:
         love::thread::MutexRef mutex;
 
         std::unique_ptr<love::driver::Hidrv> driver;
 
       private:
-        std::queue<Message*> queue;
+        enum LogMode
+        {
+            LOG_NONE,
+            LOG_RECORD,
+            LOG_REPLAY
+        };
+
+        /* compared by address when merging, so it's the one pointer used */
+        static constexpr const char* NAME_TOUCHMOVED = "touchmoved";
+
+        EventRing ring;
+
+        bool PollDriver(driver::Hidrv::LOVE_Event& event);
+
+        std::unique_ptr<EventLog> log;
+        LogMode logMode;
+        std::string logFilename;
+
+        uint32_t frame;
+        double logStart;
+        bool replayEnded;
+
+        bool Convert(const driver::Hidrv::LOVE_Event& event, EventRecord& record);
 
-        Message* Convert(const driver::Hidrv::LOVE_Event& event);
+        bool ConvertJoystickEvent(const driver::Hidrv::LOVE_Event& event,
+                                  EventRecord& record) const;
 
-        Message* ConvertJoystickEvent(const driver::Hidrv::LOVE_Event& event) const;
+        bool ConvertWindowEvent(const driver::Hidrv::LOVE_Event& event, EventRecord& record);
 
-        Message* ConvertWindowEvent(const driver::Hidrv::LOVE_Event& event);
+        bool Coalesce(const EventRecord& record, size_t first);
     };
 } // namespace love::common
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "driver/hidrv.h"
+
+#include <set>
+#include <string>
+#include <vector>
+
+namespace love
+{
+    /*
+    ** The raw driver events of a play session, tagged with the frame they
+    ** were pumped on, so the same session can be fed back to the game.
+    **
+    ** Little-endian: a 20 byte header (magic, version, frame count and the
+    ** mean frame delta as a double), then per event the frames since the
+    ** last one and the type as varints, followed by only the fields that
+    ** type uses.
+    */
+    class EventLog
+    {
+      public:
+        using LOVE_Event = driver::Hidrv::LOVE_Event;
+
+        static constexpr uint32_t MAGIC   = 0x5645504C; //< "LPEV"
+        static constexpr uint16_t VERSION = 1;
+
+        static constexpr size_t HEADER_SIZE = 20;
+
+        /* an empty log to record into */
+        EventLog();
+
+        /* a recorded log to replay, throws if it isn't one */
+        EventLog(const void* data, size_t size);
+
+        void Write(uint32_t frame, const LOVE_Event& event);
+
+        /* the next event if it was pumped on @frame */
+        bool Next(uint32_t frame, LOVE_Event& event);
+
+        /* @frame is past the end of the recording */
+        bool IsFinished(uint32_t frame) const
+        {
+            return frame > this->frames;
+        }
+
+        /* the log as written to disk, @frames long at @delta seconds each */
+        const std::vector<uint8_t>& Finish(uint32_t frames, double delta);
+
+        double GetDelta() const
+        {
+            return this->delta;
+        }
+
+        uint32_t GetFrameCount() const
+        {
+            return this->frames;
+        }
+
+      private:
+        void WriteVarint(uint64_t value);
+        void WriteBytes(const void* data, size_t size);
+        void WriteString(const char* string);
+
+        uint64_t ReadVarint();
+        void ReadBytes(void* data, size_t size);
+        const char* ReadString();
+
+        void ReadNextFrame();
+
+        std::vector<uint8_t> buffer;
+        size_t offset;
+
+        uint32_t frames;
+        double delta;
+
+        uint32_t lastFrame;
+        uint32_t nextFrame;
+        bool hasNext;
+
+        /* button and axis names handed out by Next stay alive with the log */
+        std::set<std::string> names;
+    };
+} // namespace love
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "common/message.h"
+
+#include "objects/gamepad/gamepad.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace love
+{
+    /*
+    ** A queued event, in the form it's handed to Lua. Driver events are
+    ** stored by value; only events pushed from Lua or other threads carry
+    ** a Message. Objects and messages hold a reference until popped.
+    */
+    struct EventRecord
+    {
+        enum Kind : uint8_t
+        {
+            KIND_NAME,    //< the name and nothing else, e.g. "quit"
+            KIND_MESSAGE, //< love.event.push and friends
+            KIND_TOUCH,
+            KIND_GAMEPAD_BUTTON,
+            KIND_GAMEPAD_AXIS,
+            KIND_JOYSTICK,
+            KIND_FOCUS,
+            KIND_RESIZE
+        };
+
+        struct Touch
+        {
+            int64_t id;
+            float x, y;
+            float dx, dy;
+            float pressure;
+        };
+
+        struct Input
+        {
+            Gamepad* stick;
+            const char* name;
+            float value;
+        };
+
+        struct Size
+        {
+            int width;
+            int height;
+        };
+
+        Kind kind;
+        const char* name;
+
+        union
+        {
+            Message* message;
+            Touch touch;
+            Input input;
+            Size size;
+            bool focus;
+        };
+
+        /* drops the reference this record holds */
+        void Release();
+    };
+
+    /*
+    ** FIFO of EventRecords in one block of memory. It only allocates when
+    ** it has to grow, which a game that polls every frame never makes it.
+    */
+    class EventRing
+    {
+      public:
+        static constexpr size_t INITIAL_CAPACITY = 256;
+
+        EventRing();
+
+        /* the slot at the back, after growing if the ring is full */
+        EventRecord& Append();
+
+        bool Pop(EventRecord& record);
+
+        /* @index from the front, 0 to GetCount() - 1 */
+        EventRecord& At(size_t index)
+        {
+            return this->records[(this->head + index) & (this->records.size() - 1)];
+        }
+
+        size_t GetCount() const
+        {
+            return this->count;
+        }
+
+        /* releases every record */
+        void Clear();
+
+      private:
+        void Grow();
+
+        std::vector<EventRecord> records;
+
+        size_t head;
+        size_t count;
+    };
+} // namespace love
@@ -6,12 +6,24 @@ namespace Wrap_Event
 {
     int Clear(lua_State* L);
 
+    int IsRecording(lua_State* L);
+
+    int IsReplaying(lua_State* L);
+
+    int PollAll(lua_State* L);
+
     int Pump(lua_State* L);
 
     int Push(lua_State* L);
 
     int Quit(lua_State* L);
 
+    int Record(lua_State* L);
+
+    int Replay(lua_State* L);
+
+    int Stop(lua_State* L);
+
     int Wait(lua_State* L);
 
     int Register(lua_State* L);
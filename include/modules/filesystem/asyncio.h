@@ -0,0 +1,113 @@
+#pragma once
+
+#include "objects/future/future.h"
+
+#include "modules/thread/types/conditional.h"
+#include "modules/thread/types/lock.h"
+#include "modules/thread/types/mutex.h"
+#include "modules/thread/types/threadable.h"
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+namespace love
+{
+    class Filesystem;
+
+    namespace common
+    {
+        class Event;
+    }
+
+    /*
+    ** One thread doing file work in the order it was queued, so a read
+    ** queued after a write sees what was written. What a write carries is
+    ** copied into a staging buffer when it's queued; the thread swaps that
+    ** buffer for its own and takes every request queued so far in one go,
+    ** so queueing never waits on the card, and a run of appends to one file
+    ** is written with a single open.
+    **
+    ** Every request hands back a Future. Once it's done an "iocomplete"
+    ** event carrying the Future is pushed, if love.event was loaded when it
+    ** was queued. The module is held on to until the thread is stopped, so
+    ** it can't be torn down under a push.
+    */
+    class AsyncIO : public Threadable
+    {
+      public:
+        enum Operation
+        {
+            OPERATION_READ,
+            OPERATION_WRITE,
+            OPERATION_APPEND,
+            OPERATION_MOUNT,
+            OPERATION_BARRIER
+        };
+
+        AsyncIO(Filesystem* filesystem);
+
+        virtual ~AsyncIO();
+
+        Future* Read(const std::string& filename, int64_t size);
+
+        Future* Write(const std::string& filename, const void* data, size_t size);
+
+        Future* Append(const std::string& filename, const void* data, size_t size);
+
+        Future* Mount(const std::string& archive, const std::string& mountpoint,
+                      bool appendToPath);
+
+        /* blocks until everything queued before it is done */
+        void Flush();
+
+        /* finishes what's queued, joins the thread and lets go of love.event */
+        void Stop();
+
+        /* requests queued or running */
+        int GetPendingCount() const;
+
+        void ThreadFunction() override;
+
+      private:
+        struct Request
+        {
+            Operation operation;
+
+            std::string filename;
+            std::string mountpoint;
+
+            int64_t size;
+            size_t offset; //< of what's written, in the staging buffer
+            bool appendToPath;
+
+            StrongReference<Future> future;
+        };
+
+        struct Batch
+        {
+            std::vector<Request> requests;
+            std::vector<char> staging;
+        };
+
+        Future* Queue(Request& request, const void* data = nullptr, size_t size = 0);
+
+        /* runs the request at @first, and any after it up to @last done along with it */
+        std::vector<Variant> Perform(const Batch& batch, size_t first, size_t& last);
+
+        /* pushes "iocomplete" for @request, if love.event was loaded */
+        void Complete(const Request& request);
+
+        Filesystem* filesystem;
+        StrongReference<common::Event> event;
+
+        thread::MutexRef mutex;
+        thread::ConditionalRef condition;
+
+        Batch front; //< filled by whoever queues
+        Batch back;  //< worked through by the thread
+
+        std::atomic<int> pending;
+        bool stopping;
+    };
+} // namespace love
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "objects/filedata/filedata.h"
+
+#include "modules/thread/types/lock.h"
+#include "modules/thread/types/mutex.h"
+
+#include <list>
+#include <string>
+#include <unordered_map>
+
+namespace love
+{
+    /*
+    ** Whole entries read out of mounted archives, so reading one again
+    ** skips PhysFS inflating it a second time. Entries are keyed by the
+    ** archive and the name in it, kept up to a byte budget, and evicted
+    ** least recently read first. Files in the save directory or in plain
+    ** directories are never cached, since they can change underneath it.
+    */
+    class EntryCache
+    {
+      public:
+#if defined(__3DS__)
+        static constexpr int64_t DEFAULT_BUDGET = 0x100000;
+#else
+        static constexpr int64_t DEFAULT_BUDGET = 0x800000;
+#endif
+
+        /* an entry bigger than this much of the budget is streamed instead */
+        static constexpr int ENTRY_FRACTION = 8;
+
+        struct Stats
+        {
+            uint64_t hits;
+            uint64_t misses;
+
+            int entries;
+            int64_t bytes;
+        };
+
+        static EntryCache& Instance();
+
+        /*
+        ** Hands back @filename whole if it lives in an archive and is small
+        ** enough, reading and keeping it on a miss. False means open it as
+        ** usual.
+        */
+        bool Get(const std::string& filename, StrongReference<FileData>& data);
+
+        /* 0 turns the cache off */
+        void SetBudget(int64_t bytes);
+
+        int64_t GetBudget() const;
+
+        Stats GetStats() const;
+
+        /* after @archive is unmounted, when its name may come to mean another one */
+        void Invalidate(const std::string& archive);
+
+        /* every entry, from every archive */
+        void Clear();
+
+      private:
+        EntryCache();
+
+        struct Entry
+        {
+            std::string key;
+            std::string archive;
+            StrongReference<FileData> data;
+        };
+
+        bool IsArchive(const std::string& directory);
+
+        FileData* Load(const std::string& filename);
+
+        void Evict(int64_t budget);
+
+        mutable thread::MutexRef mutex;
+
+        std::list<Entry> entries; //< most recently read first
+        std::unordered_map<std::string, std::list<Entry>::iterator> lookup;
+        std::unordered_map<std::string, bool> archives;
+
+        int64_t budget;
+        int64_t bytes;
+
+        uint64_t hits;
+        uint64_t misses;
+    };
+} // namespace love
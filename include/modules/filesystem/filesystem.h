@@ -7,9 +7,13 @@
 
 #include "common/module.h"
 
+#include "modules/filesystem/asyncio.h"
+
 #include "objects/file/file.h"
 #include "objects/filedata/filedata.h"
 
+#include "modules/thread/types/lock.h"
+
 #include <vector>
 
 #define MAX_STAMP 0x20000000000000LL
@@ -115,6 +119,9 @@ namespace love
 
         std::string GetRealDirectory(const char* filename) const;
 
+        /* the I/O thread, started the first time it's asked for */
+        AsyncIO* GetAsyncIO();
+
         // std::vector<std::string> & GetCRequirePath() override;
 
         /* Helper Functions */
@@ -141,6 +148,11 @@ namespace love
 
         std::map<std::string, StrongReference<Data>> mountedData;
 
+        StrongReference<AsyncIO> asyncIO;
+
+        /* what the I/O thread touches: save paths, source, fused, mount permissions, mountedData */
+        thread::MutexRef stateMutex;
+
         bool fused;
         bool fusedSet;
 
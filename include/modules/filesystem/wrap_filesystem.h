@@ -83,5 +83,25 @@ namespace Wrap_Filesystem
 
     int Write(lua_State* L);
 
+    int SetCacheBudget(lua_State* L);
+
+    int GetCacheBudget(lua_State* L);
+
+    int GetCacheStats(lua_State* L);
+
+    int ReadAsync(lua_State* L);
+
+    int WriteOrAppendAsync(lua_State* L, love::File::Mode mode);
+
+    int WriteAsync(lua_State* L);
+
+    int AppendAsync(lua_State* L);
+
+    int MountAsync(lua_State* L);
+
+    int Flush(lua_State* L);
+
+    int GetPendingCount(lua_State* L);
+
     std::string Redirect(const char* path);
 } // namespace Wrap_Filesystem
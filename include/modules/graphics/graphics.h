@@ -32,6 +32,9 @@
 #include "objects/text/text.h"
 #include "objects/text/wrap_text.h"
 
+#include "objects/mesh/mesh.h"
+#include "objects/mesh/wrap_mesh.h"
+
 #include "modules/font/fontmodule.h"
 
 #include "objects/imagedata/imagedata.h"
@@ -266,7 +269,7 @@ namespace love
 
         /* Objects */
 
-        Image* NewImage(const Image::Slices& data);
+        Image* NewImage(const Image::Slices& data, const Image::Settings& settings);
 
         virtual Font* NewFont(Rasterizer* rasterizer,
                               const Texture::Filter& filter = Texture::defaultFilter) = 0;
@@ -286,6 +289,12 @@ namespace love
 
         Text* NewText(Font* font, const std::vector<Font::ColoredString>& text = {});
 
+        Mesh* NewMesh(const std::vector<Mesh::AttribFormat>& format, const void* data, size_t size,
+                      Mesh::DrawMode mode, Mesh::Usage usage);
+
+        Mesh* NewMesh(const std::vector<Mesh::AttribFormat>& format, int vertexCount,
+                      Mesh::DrawMode mode, Mesh::Usage usage);
+
         void SetFont(Font* font);
 
         Font* GetFont();
@@ -548,9 +557,11 @@ namespace love
             Graphics* gfx;
         };
 
+        /* renderer counts are for the last presented frame, -1 if not known */
         struct Stats
         {
             int drawCalls;
+            int64_t vertices;
             int canvasSwitches;
             int shaderSwitches;
             int canvases;
@@ -558,6 +569,9 @@ namespace love
             int fonts;
         };
 
+        /* the object counts; subclasses add what their renderer counts */
+        virtual Stats GetStats() const;
+
         void PushTransform();
 
         void PopTransform();
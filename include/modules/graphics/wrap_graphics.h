@@ -91,8 +91,12 @@ namespace Wrap_Graphics
 
     int NewImage(lua_State* L);
 
+    int NewAtlas(lua_State* L);
+
     int NewFont(lua_State* L);
 
+    int NewMesh(lua_State* L);
+
     int NewQuad(lua_State* L);
 
     int NewText(lua_State* L);
@@ -117,6 +121,8 @@ namespace Wrap_Graphics
 
     int GetRendererInfo(lua_State* L);
 
+    int GetStats(lua_State* L);
+
     int GetBackgroundColor(lua_State* L);
 
     int GetCanvas(lua_State* L);
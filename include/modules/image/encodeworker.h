@@ -0,0 +1,59 @@
+#pragma once
+
+#include "modules/thread/types/conditional.h"
+#include "modules/thread/types/threadable.h"
+
+#include "objects/imagedata/imagedata.h"
+#include "objects/imagedata/types/formathandler.h"
+
+#include <deque>
+#include <string>
+
+namespace love
+{
+    class EncodeWorker : public Threadable
+    {
+      public:
+        /* how many row bands one image is deflated in at most */
+#if defined(__3DS__)
+        static constexpr size_t MAX_BANDS = 2;
+#else
+        static constexpr size_t MAX_BANDS = 3;
+#endif
+
+        struct Job
+        {
+            /* handed back with the result, so the callback can be found */
+            StrongReference<ImageData> source;
+            int id;
+
+            /* linear RGBA8 or RGBA16 copy of the pixels, owned by the job */
+            FormatHandler::DecodedImage snapshot;
+            FormatHandler::EncodedFormat format;
+
+            /* names the FileData, writing it out is left to the main thread */
+            std::string filename;
+        };
+
+        EncodeWorker();
+
+        virtual ~EncodeWorker();
+
+        void ThreadFunction();
+
+        void AddJob(const Job& job);
+
+        /* finishes the queued jobs first */
+        void Stop();
+
+      private:
+        std::deque<Job> jobs;
+
+        thread::MutexRef mutex;
+        thread::ConditionalRef condition;
+
+        bool stopping;
+
+        void Encode(Job& job);
+    };
+} // namespace love
@@ -6,6 +6,7 @@
 #include "modules/data/wrap_datamodule.h"
 #include "modules/filesystem/wrap_filesystem.h"
 
+#include "objects/atlasdata/atlasdata.h"
 #include "objects/compressedimagedata/compressedimagedata.h"
 #include "objects/imagedata/imagedata.h"
 
@@ -16,6 +17,8 @@
 
 namespace love
 {
+    class EncodeWorker;
+
     class ImageModule : public Module
     {
       public:
@@ -35,9 +38,9 @@ namespace love
 
         ImageData* NewImageData(Data* data);
 
-#if defined(__SWITCH__)
+#if not defined(__3DS__)
         ImageData* NewImageData(int width, int height, PixelFormat format = PIXELFORMAT_RGBA8);
-#elif defined(__3DS__)
+#else
         ImageData* NewImageData(int width, int height,
                                 PixelFormat format = PIXELFORMAT_TEX3DS_RGBA8);
 #endif
@@ -48,13 +51,23 @@ namespace love
 
         bool IsCompressed(Data* data);
 
+        AtlasData* NewAtlasData(const std::vector<AtlasData::Source>& sources,
+                                const AtlasData::Settings& settings);
+
+        AtlasData* NewAtlasData(Data* data);
+
         const std::list<FormatHandler*>& GetFormatHandlers() const;
 
+        /* started on first use, most games never encode anything */
+        EncodeWorker* GetEncodeWorker();
+
         static bool GetConstant(PixelFormat in, const char*& out);
 
         static bool GetConstant(const char* in, PixelFormat& out);
 
       private:
         std::list<FormatHandler*> formatHandlers;
+
+        EncodeWorker* encodeWorker;
     };
 } // namespace love
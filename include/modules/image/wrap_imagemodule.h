@@ -12,5 +12,7 @@ namespace Wrap_ImageModule
 
     int IsCompressed(lua_State* L);
 
+    int NewAtlasData(lua_State* L);
+
     int Register(lua_State* L);
 } // namespace Wrap_ImageModule
@@ -4,12 +4,25 @@
 #include "objects/filedata/filedata.h"
 #include "objects/sounddata/sounddata.h"
 
-#include "flacdecoder.h"
-#include "modplugdecoder.h"
-#include "mp3decoder.h"
-#include "vorbisdecoder.h"
 #include "wavedecoder.h"
 
+/* LOVE_NO_* leave out a decoder whose library a build doesn't have */
+#if !defined(LOVE_NO_FLAC)
+    #include "flacdecoder.h"
+#endif
+
+#if !defined(LOVE_NO_MODPLUG)
+    #include "modplugdecoder.h"
+#endif
+
+#if !defined(LOVE_NO_MP3)
+    #include "mp3decoder.h"
+#endif
+
+#if !defined(LOVE_NO_VORBIS)
+    #include "vorbisdecoder.h"
+#endif
+
 #include "common/module.h"
 
 namespace love
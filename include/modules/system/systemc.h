@@ -2,6 +2,8 @@
 
 #include "common/module.h"
 
+#include <vector>
+
 using namespace std::literals::string_literals;
 
 #define OS_NAME "Horizon"
@@ -10,6 +12,8 @@ using namespace std::literals::string_literals;
     #define LANGUAGE_COUNT 12
 #elif defined(__SWITCH__)
     #define LANGUAGE_COUNT 17
+#elif defined(__HOST__)
+    #define LANGUAGE_COUNT 1
 #endif
 
 namespace love::common
@@ -41,6 +45,14 @@ namespace love::common
             THEME_MAX_ENUM
         };
 
+        /* a fixed region the platform carves allocations out of */
+        struct MemoryPool
+        {
+            const char* name;
+            uint64_t size;
+            uint64_t used;
+        };
+
         System();
 
         ModuleType GetModuleType() const
@@ -81,6 +93,9 @@ namespace love::common
 
         /* end pure virtual methods */
 
+        virtual void GetMemoryPools(std::vector<MemoryPool>& pools) const
+        {}
+
         static bool GetConstant(const char* in, PowerState& out);
         static bool GetConstant(PowerState in, const char*& out);
 
@@ -3,6 +3,7 @@
 #include "modules/thread/types/mutex.h"
 #include "objects/channel/channel.h"
 #include "objects/thread/luathread.h"
+#include "objects/threadpool/threadpool.h"
 
 #include "common/data.h"
 #include "common/module.h"
@@ -32,6 +33,8 @@ namespace love
 
         LuaThread* NewThread(const std::string& name, love::Data* data);
 
+        ThreadPool* NewPool(const std::string& name, love::Data* data, int workers);
+
       private:
         std::map<std::string, StrongReference<Channel>> namedChannels;
         thread::MutexRef namedChannelMutex;
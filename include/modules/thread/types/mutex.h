@@ -16,6 +16,14 @@ typedef Mutex LOVE_Mutex;
     #define LOVE_mutexInit   mutexInit
     #define LOVE_mutexLock   mutexLock
     #define LOVE_mutexUnlock mutexUnlock
+#elif defined(__HOST__)
+    #include "host.h"
+
+typedef pthread_mutex_t LOVE_Mutex;
+
+    #define LOVE_mutexInit(mutex) pthread_mutex_init(mutex, nullptr)
+    #define LOVE_mutexLock        pthread_mutex_lock
+    #define LOVE_mutexUnlock      pthread_mutex_unlock
 #endif
 
 namespace love::thread
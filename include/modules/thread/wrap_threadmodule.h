@@ -4,6 +4,8 @@ namespace Wrap_ThreadModule
 {
     int NewThread(lua_State* L);
 
+    int NewPool(lua_State* L);
+
     int NewChannel(lua_State* L);
 
     int GetChannel(lua_State* L);
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <array>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace love
+{
+    /*
+    ** Holds frames to a target rate on a nanosecond clock. Each frame has a
+    ** deadline one period after the last; the pacer sleeps until a margin
+    ** short of it and spins the rest, since a sleep can overshoot by the
+    ** scheduler's granularity. The clock is handed in, so the pacing can be
+    ** driven by a fake one.
+    */
+    class FramePacer
+    {
+      public:
+        using NowFunction   = uint64_t (*)();
+        using SleepFunction = void (*)(int64_t nanoseconds);
+
+        /* frames the percentiles are taken over */
+        static constexpr size_t HISTORY_SIZE = 256;
+
+        static constexpr int64_t DEFAULT_SPIN_MARGIN = 1000000;
+
+        struct Stats
+        {
+            double p50; //< seconds
+            double p95;
+            double p99;
+
+            uint64_t frames;
+            uint64_t dropped; //< whole periods missed
+        };
+
+        FramePacer(NowFunction now, SleepFunction sleep);
+
+        /* frames per second, 0 to stop pacing */
+        void SetTargetRate(double rate);
+
+        double GetTargetRate() const;
+
+        /* how long before a deadline the pacer stops sleeping and spins */
+        void SetSpinMargin(int64_t nanoseconds);
+
+        int64_t GetSpinMargin() const;
+
+        /* returns at this frame's deadline, or straight away if it's past */
+        void Wait();
+
+        /* until Wait would start spinning, or -1 when not pacing */
+        int64_t GetIdleTime() const;
+
+        Stats GetStats() const;
+
+        void Reset();
+
+      private:
+        void Record(uint64_t time);
+
+        NowFunction now;
+        SleepFunction sleep;
+
+        double rate;
+        int64_t period;
+        int64_t spinMargin;
+
+        bool started;
+        uint64_t deadline;
+        uint64_t lastFrame;
+
+        std::array<int64_t, HISTORY_SIZE> history;
+        size_t historyCount;
+        size_t historyNext;
+
+        uint64_t frames;
+        uint64_t dropped;
+    };
+} // namespace love
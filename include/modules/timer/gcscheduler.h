@@ -0,0 +1,73 @@
+#pragma once
+
+#include "common/luax.h"
+
+#include <stdint.h>
+
+namespace love
+{
+    /*
+    ** Moves Lua's garbage collection out of update and draw. Once it has a
+    ** budget, Collect starts each cycle itself when memory has doubled, pays
+    ** off what the frame allocated at Lua's own step rate, then keeps
+    ** stepping in small slices while the frame has idle time. Whoever turns
+    ** it on has to call Collect every frame.
+    **
+    ** Lua's own collector is never stopped. Between cycles it's left with a
+    ** pause of BACKSTOP_PAUSE, and while one is under way between frames it
+    ** steps at BACKSTOP_STEPMUL, so a frame that allocates far more than
+    ** usual, or code that runs without frames, still gets collected.
+    */
+    class GCScheduler
+    {
+      public:
+        using NowFunction = uint64_t (*)();
+
+        /* kilobytes of work per idle slice */
+        static constexpr int SLICE_SIZE = 16;
+
+        /* Lua's default for setpause: a cycle starts once memory has doubled */
+        static constexpr int PAUSE = 200;
+
+        /* when Lua's own collector steps in instead */
+        static constexpr int BACKSTOP_PAUSE = 400;
+
+        /* half of Lua's default, for its own steps in the middle of a cycle */
+        static constexpr int BACKSTOP_STEPMUL = 100;
+
+        struct Stats
+        {
+            double last; //< seconds, in the last Collect
+            double max;
+
+            uint64_t cycles;
+        };
+
+        GCScheduler(NowFunction now);
+
+        /* hands the collector of @L to the frame, or back to Lua at 0 */
+        void SetBudget(lua_State* L, int64_t nanoseconds);
+
+        int64_t GetBudget() const;
+
+        /* steps for as long as the frame owes, then for up to @available more */
+        void Collect(lua_State* L, int64_t available);
+
+        Stats GetStats() const;
+
+      private:
+        void Step(lua_State* L, int kilobytes);
+
+        NowFunction now;
+
+        int64_t budget;
+        int savedPause;
+        int savedStepMul;
+
+        bool cycling;
+        int threshold; //< kilobytes in use that start the next cycle
+        int lastCount;
+
+        Stats stats;
+    };
+} // namespace love
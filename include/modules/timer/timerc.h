@@ -6,6 +6,12 @@
 #pragma once
 
 #include "common/module.h"
+#include "modules/timer/framepacer.h"
+#include "modules/timer/gcscheduler.h"
+
+#include <array>
+#include <string>
+#include <vector>
 
 namespace love::common
 {
@@ -14,6 +20,17 @@ namespace love::common
       public:
         static constexpr auto SLEEP_DURATION = 1000000ULL;
 
+        /* the parts of a love.run frame, in the order they happen */
+        enum Phase
+        {
+            PHASE_EVENTS,
+            PHASE_UPDATE,
+            PHASE_DRAW,
+            PHASE_PRESENT,
+            PHASE_SLEEP,
+            PHASE_MAX_ENUM
+        };
+
         Timer();
 
         ModuleType GetModuleType() const
@@ -30,18 +47,63 @@ namespace love::common
 
         static double GetTime();
 
+        /* monotonic, since the timer was created */
+        static uint64_t GetTimeNs();
+
         double GetAverageDelta();
 
         double GetDelta();
 
         int GetFPS();
 
-        void Sleep(float seconds);
+        void Sleep(double seconds);
 
         double Step();
 
         // End Löve2D Functions
 
+        /* Step returns @delta instead of the real time passed, 0 to turn it off */
+        void SetFixedDelta(double delta);
+
+        double GetFixedDelta() const;
+
+        /*
+        ** @phase starts now and the one before it ends. Starting PHASE_EVENTS
+        ** closes the frame. Nothing is kept unless profiling is on.
+        */
+        void Mark(Phase phase);
+
+        void SetProfiling(bool enable);
+
+        bool IsProfiling() const;
+
+        /* one line per frame, in milliseconds */
+        std::string GetProfileCSV() const;
+
+        /* frames per second love.run paces to, 0 to leave it unpaced */
+        void SetTargetRate(double rate);
+
+        double GetTargetRate() const;
+
+        /* waits out the rest of the frame at the target rate */
+        void Pace();
+
+        FramePacer::Stats GetFrameStats() const;
+
+        /* seconds of idle time a frame may spend collecting, 0 for Lua's own collector */
+        void SetCollectorBudget(lua_State* L, double seconds);
+
+        double GetCollectorBudget() const;
+
+        /* runs this frame's collection, up to the pacer's deadline when there is one */
+        void Collect(lua_State* L);
+
+        GCScheduler::Stats GetCollectorStats() const;
+
+        static bool GetConstant(const char* in, Phase& out);
+        static bool GetConstant(Phase in, const char*& out);
+        static std::vector<const char*> GetConstants(Phase);
+
       protected:
         double currentTime;
         double lastTime;
@@ -54,6 +116,17 @@ namespace love::common
         int frames;
 
         double dt;
+        double fixedDelta;
+
+        bool profiling;
+        Phase phase;
+        double phaseStart;
+
+        std::array<float, PHASE_MAX_ENUM> frameTimes;
+        std::vector<std::array<float, PHASE_MAX_ENUM>> profile;
+
+        FramePacer pacer;
+        GCScheduler collector;
 
         static uint64_t reference;
     };
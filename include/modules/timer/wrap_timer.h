@@ -4,6 +4,8 @@
 #include "modules/timer/timer.h"
 namespace Wrap_Timer
 {
+    int Collect(lua_State* L);
+
     int GetAverageDelta(lua_State* L);
 
     int GetDelta(lua_State* L);
@@ -12,6 +14,24 @@ namespace Wrap_Timer
 
     int GetTime(lua_State* L);
 
+    int GetCollectorBudget(lua_State* L);
+
+    int GetFixedDelta(lua_State* L);
+
+    int GetFrameStats(lua_State* L);
+
+    int GetTargetRate(lua_State* L);
+
+    int Mark(lua_State* L);
+
+    int Pace(lua_State* L);
+
+    int SetCollectorBudget(lua_State* L);
+
+    int SetFixedDelta(lua_State* L);
+
+    int SetTargetRate(lua_State* L);
+
     int Sleep(lua_State* L);
 
     int Step(lua_State* L);
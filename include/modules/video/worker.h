@@ -13,6 +13,9 @@ namespace love
     class Worker : public Threadable
     {
       public:
+        /* wake up now and then to let go of streams nobody uses anymore */
+        static constexpr int64_t IDLE_TIMEOUT_NS = 250000000LL;
+
         Worker();
 
         virtual ~Worker();
@@ -21,14 +24,22 @@ namespace love
 
         void AddStream(TheoraStream* stream);
 
+        /* called by streams when a frame slot frees up or they need to seek */
+        void Notify();
+
         void Stop();
 
       private:
         std::vector<StrongReference<TheoraStream>> streams;
 
+        /* streams to decode this round, decoded without holding the mutex */
+        std::vector<StrongReference<TheoraStream>> pending;
+
         thread::MutexRef mutex;
         thread::ConditionalRef condition;
 
         bool stopping;
+
+        bool HasWork();
     };
 } // namespace love
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "common/data.h"
+#include "common/strongref.h"
+
+#include "objects/imagedata/imagedata.h"
+#include "objects/object.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace love
+{
+    /*
+    ** Many small images packed into a few large pages. The layout and the
+    ** pages' pixels serialize to one file, loading it skips the packing.
+    */
+    class AtlasData : public Object
+    {
+      public:
+        static love::Type type;
+
+#if defined(__3DS__)
+        static constexpr int DEFAULT_MAX_SIZE    = 1024;
+        static constexpr PixelFormat PAGE_FORMAT = PIXELFORMAT_TEX3DS_RGBA8;
+#else
+        static constexpr int DEFAULT_MAX_SIZE    = 4096;
+        static constexpr PixelFormat PAGE_FORMAT = PIXELFORMAT_RGBA8;
+#endif
+
+        struct Settings
+        {
+            int maxSize = DEFAULT_MAX_SIZE;
+            int padding = 1;
+        };
+
+        struct Source
+        {
+            std::string name;
+            StrongReference<ImageData> imageData;
+        };
+
+        struct Entry
+        {
+            std::string name;
+
+            int page;
+            int x;
+            int y;
+            int width;
+            int height;
+        };
+
+        AtlasData(const std::vector<Source>& sources, const Settings& settings);
+
+        /* from what Serialize wrote */
+        AtlasData(Data* data);
+
+        virtual ~AtlasData();
+
+        int GetPageCount() const;
+
+        ImageData* GetPage(int index) const;
+
+        const std::vector<Entry>& GetEntries() const;
+
+        /* nullptr when there's no such entry */
+        const Entry* GetEntry(const std::string& name) const;
+
+        void Serialize(std::vector<uint8_t>& out) const;
+
+        void Save(const char* filename) const;
+
+      private:
+        struct Header
+        {
+            uint8_t identifier[4];
+            uint32_t version;
+            uint32_t pageCount;
+            uint32_t entryCount;
+        };
+
+        struct PageHeader
+        {
+            uint32_t width;
+            uint32_t height;
+            uint32_t format;
+            uint32_t size;
+        };
+
+        struct EntryHeader
+        {
+            uint32_t page;
+            uint32_t x;
+            uint32_t y;
+            uint32_t width;
+            uint32_t height;
+            uint32_t nameLength;
+        };
+
+        static constexpr uint8_t IDENTIFIER[] = { 'L', 'P', 'A', 'T' };
+        static constexpr uint32_t VERSION     = 1;
+
+        void Pack(const std::vector<Source>& sources, const Settings& settings);
+
+        void Deserialize(const uint8_t* data, size_t size);
+
+        std::vector<StrongReference<ImageData>> pages;
+        std::vector<Entry> entries;
+
+        std::unordered_map<std::string, size_t> names;
+    };
+} // namespace love
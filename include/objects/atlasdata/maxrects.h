@@ -0,0 +1,62 @@
+#pragma once
+
+#include <vector>
+
+/*
+** MaxRects bin packer (Jukka Jylänki, "A Thousand Ways to Pack the Bin").
+** Free space is kept as a list of maximal, possibly overlapping rectangles.
+** Each insert takes the free rectangle that leaves the shortest leftover
+** side, then every free rectangle it touches is split and the ones that
+** end up inside another are dropped.
+*/
+namespace love
+{
+    class MaxRects
+    {
+      public:
+        struct Rect
+        {
+            int x;
+            int y;
+            int width;
+            int height;
+        };
+
+        MaxRects(int width, int height);
+
+        /* false when there's no room for @width x @height */
+        bool Insert(int width, int height, Rect& out);
+
+        int GetWidth() const
+        {
+            return this->width;
+        }
+
+        int GetHeight() const
+        {
+            return this->height;
+        }
+
+        /* bottom right corner of everything placed so far */
+        void GetUsedSize(int& width, int& height) const;
+
+        /* placed area over the bin's area */
+        float GetOccupancy() const;
+
+      private:
+        int width;
+        int height;
+
+        int usedWidth;
+        int usedHeight;
+        long usedArea;
+
+        std::vector<Rect> freeRects;
+
+        void Place(const Rect& rect);
+
+        bool Split(const Rect& free, const Rect& used);
+
+        void Prune();
+    };
+} // namespace love
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "common/luax.h"
+#include "objects/atlasdata/atlasdata.h"
+
+namespace Wrap_AtlasData
+{
+    int GetPageCount(lua_State* L);
+
+    int GetPage(lua_State* L);
+
+    int GetEntry(lua_State* L);
+
+    int GetNames(lua_State* L);
+
+    int Save(lua_State* L);
+
+    love::AtlasData* CheckAtlasData(lua_State* L, int index);
+
+    int Register(lua_State* L);
+} // namespace Wrap_AtlasData
@@ -171,6 +171,9 @@ namespace love
 
         World* GetWorld() const;
 
+        /* stable slot of this Body in its World's body states, zero-based */
+        size_t GetIndex() const;
+
         int GetFixtures(lua_State* L) const;
 
         int GetJoints(lua_State* L) const;
@@ -193,5 +196,7 @@ namespace love
       private:
         World* world;
         BodyUserdata* userdata;
+
+        size_t index;
     };
 } // namespace love
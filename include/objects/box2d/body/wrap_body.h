@@ -120,6 +120,8 @@ namespace Wrap_Body
 
     int GetWorld(lua_State* L);
 
+    int GetIndex(lua_State* L);
+
     int GetFixtures(lua_State* L);
 
     int GetJoints(lua_State* L);
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <box2d/box2d.h>
+
+#include <vector>
+
+namespace love
+{
+    class World;
+    class Fixture;
+
+    /*
+    ** Records contact events into a flat array during b2World::Step
+    ** instead of calling into Lua for every contact. The events are
+    ** read back in one batch once the step is over.
+    */
+    class ContactBuffer
+    {
+      public:
+        enum EventType
+        {
+            EVENT_BEGIN,
+            EVENT_END,
+            EVENT_POSTSOLVE,
+            EVENT_MAX_ENUM
+        };
+
+        struct Event
+        {
+            EventType type;
+
+            /*
+            ** Retained until the buffer is cleared. A fixture destroyed since
+            ** is still here, and reports itself as destroyed to Lua, just
+            ** like one handed to an end callback as its body goes away.
+            */
+            Fixture* fixtureA;
+            Fixture* fixtureB;
+
+            /* world manifold normal, only valid for touching contacts */
+            b2Vec2 normal;
+
+            int pointCount;
+            float normalImpulses[b2_maxManifoldPoints];
+            float tangentImpulses[b2_maxManifoldPoints];
+        };
+
+        ContactBuffer(World* world);
+
+        ~ContactBuffer();
+
+        void Record(EventType type, b2Contact* contact, const b2ContactImpulse* impulse = nullptr);
+
+        void Clear();
+
+        /* moves the events of @other to the end of this buffer */
+        void Take(ContactBuffer& other);
+
+        size_t GetCount() const;
+
+        const Event& GetEvent(size_t index) const;
+
+        static bool GetConstant(const char* in, EventType& out);
+        static bool GetConstant(EventType in, const char*& out);
+        static std::vector<const char*> GetConstants(EventType);
+
+      private:
+        World* world;
+
+        /* capacity is kept between steps so recording doesn't allocate */
+        std::vector<Event> events;
+    };
+} // namespace love
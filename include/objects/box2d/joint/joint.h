@@ -51,6 +51,8 @@ namespace love
 
         bool IsValid() const;
 
+        World* GetWorld() const;
+
         Joint::Type GetType() const;
 
         virtual Body* GetBodyA() const;
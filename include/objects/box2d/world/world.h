@@ -4,9 +4,15 @@
 #include "common/reference.h"
 #include "objects/object.h"
 
+#include "modules/thread/types/conditional.h"
+#include "modules/thread/types/mutex.h"
+#include "modules/thread/types/threadable.h"
+
+#include <atomic>
 #include <unordered_map>
 #include <vector>
 
+#include "contactbuffer.h"
 #include "contactcallback.h"
 #include "contactfilter.h"
 #include "querycallback.h"
@@ -35,6 +41,15 @@ namespace love
 
         static love::Type type;
 
+        enum MutationType
+        {
+            MUTATION_TRANSFORM,
+            MUTATION_VELOCITY,
+            MUTATION_FORCE,
+            MUTATION_IMPULSE,
+            MUTATION_MAX_ENUM
+        };
+
         World();
 
         World(b2Vec2 gravity, bool sleep);
@@ -71,6 +86,17 @@ namespace love
 
         int GetContactFilter(lua_State* L);
 
+        /*
+        ** When buffering, begin/end/postSolve events are recorded natively
+        ** during Update instead of calling their Lua callbacks. The preSolve
+        ** callback still runs immediately since it may modify the contact.
+        */
+        void SetContactBuffering(bool enable);
+
+        bool IsContactBuffering() const;
+
+        const ContactBuffer& GetContactBuffer() const;
+
         void SetGravity(float x, float y);
 
         int GetGravity(lua_State* L);
@@ -95,6 +121,64 @@ namespace love
 
         int GetContacts(lua_State* L);
 
+        /*
+        ** Body states are BODY_STATE_COMPONENTS values per body: index
+        ** (one-based), x, y, angle, x velocity, y velocity and angular
+        ** velocity. Bodies are ordered by their stable index. The index is a
+        ** uint32 so it stays exact past 2^24 bodies, the rest are floats.
+        */
+        static constexpr size_t BODY_STATE_COMPONENTS = 7;
+
+        struct BodyState
+        {
+            uint32_t index;
+            float values[BODY_STATE_COMPONENTS - 1];
+        };
+
+        static_assert(sizeof(BodyState) == BODY_STATE_COMPONENTS * sizeof(float));
+
+        size_t GetBodyStateCount(bool awakeOnly) const;
+
+        /* writes up to @maxBodies states to @out, returns how many were written */
+        size_t GetBodyStates(BodyState* out, size_t maxBodies, bool awakeOnly) const;
+
+        /* applies @count states in the same layout as kinematic states */
+        void SetTransforms(const BodyState* in, size_t count);
+
+        Body* GetBodyByIndex(size_t index) const;
+
+        /*
+        ** A queued change to a Body, applied right before the next step.
+        ** @values holds the same fields as a body state, minus the index:
+        ** transform uses all six, velocity the last three, force and
+        ** impulse the first two.
+        */
+        struct Mutation
+        {
+            MutationType type;
+            size_t index;
+            float values[BODY_STATE_COMPONENTS - 1];
+        };
+
+        void QueueMutation(const Mutation& mutation);
+
+        /*
+        ** Threaded worlds step at a fixed @timestep on their own thread.
+        ** While threaded, contacts are always buffered, body states are read
+        ** from an interpolated snapshot and setTransforms is queued. Lua
+        ** can't be called from the step thread, so a contact filter or
+        ** preSolve callback is an error, set before or after. Update only
+        ** hands the buffered contacts over to the caller. Anything else
+        ** that touches the world, its bodies, fixtures or joints is an error
+        ** until threading is disabled, and contacts handed out before are
+        ** invalidated.
+        */
+        void SetThreaded(bool enable, float timestep);
+
+        bool IsThreaded() const;
+
+        float GetTimestep() const;
+
         b2Body* GetGroundBody() const;
 
         int QueryBoundingBox(lua_State* L);
@@ -109,6 +193,10 @@ namespace love
 
         love::Object* FindObject(void* b2Object) const;
 
+        static bool GetConstant(const char* in, MutationType& out);
+        static bool GetConstant(MutationType in, const char*& out);
+        static std::vector<const char*> GetConstants(MutationType);
+
       private:
         b2World* world;
         b2Body* groundBody;
@@ -122,6 +210,77 @@ namespace love
         ContactCallback begin, end, presolve, postsolve;
         ContactFilter filter;
 
+        bool bufferContacts;
+        ContactBuffer contactBuffer;
+
+        class StepThread : public Threadable
+        {
+          public:
+            StepThread(World* world);
+
+            virtual ~StepThread();
+
+            void SetFinish();
+
+            void ThreadFunction();
+
+          protected:
+            World* world;
+            std::atomic<bool> finish;
+
+            /* signalled by SetFinish, so the wait for the next step ends early */
+            thread::MutexRef mutex;
+            thread::ConditionalRef wake;
+        };
+
+        /* don't fall further and further behind when a step is slow */
+        static constexpr int MAX_STEPS_PER_UPDATE = 4;
+
+        StepThread* stepThread;
+        float timestep;
+
+        /* held by the step thread for the duration of a step */
+        thread::MutexRef stepMutex;
+
+        /* contacts recorded by the step thread, waiting for Update */
+        ContactBuffer pendingContacts;
+
+        thread::MutexRef mutationMutex;
+        std::vector<Mutation> mutations;
+        std::vector<Mutation> appliedMutations;
+
+        /* double-buffered body states, in the GetBodyStates layout */
+        thread::MutexRef snapshotMutex;
+        std::vector<BodyState> snapshotPrevious;
+        std::vector<BodyState> snapshotCurrent;
+        std::vector<BodyState> snapshotBack;
+        double snapshotTime;
+
+        /* whether each body in the matching snapshot was awake */
+        std::vector<uint8_t> snapshotAwake;
+        std::vector<uint8_t> snapshotAwakeBack;
+
+        ContactBuffer& GetRecordingBuffer();
+
+        void Step(float dt, int velocityIterations, int positionIterations);
+
+        void ApplyMutations();
+
+        void ThreadedStep();
+
+        size_t WriteBodyStates(BodyState* out, size_t maxBodies, bool awakeOnly,
+                               uint8_t* awake = nullptr) const;
+
+        size_t GetInterpolatedStates(BodyState* out, size_t maxBodies, bool awakeOnly) const;
+
         std::unordered_map<void*, love::Object*> box2dObjectMap;
+
+        /* Body slots by stable index, freed slots are reused */
+        std::vector<Body*> bodySlots;
+        std::vector<size_t> freeBodySlots;
+
+        size_t RegisterBody(Body* body);
+
+        void UnRegisterBody(size_t index);
     };
 } // namespace love
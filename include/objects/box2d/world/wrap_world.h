@@ -15,6 +15,14 @@ namespace Wrap_World
 
     int GetContactFilter(lua_State* L);
 
+    int SetContactBuffering(lua_State* L);
+
+    int IsContactBuffering(lua_State* L);
+
+    int GetContactEventCount(lua_State* L);
+
+    int GetContactEvents(lua_State* L);
+
     int SetGravity(lua_State* L);
 
     int GetGravity(lua_State* L);
@@ -39,6 +47,16 @@ namespace Wrap_World
 
     int GetContacts(lua_State* L);
 
+    int GetBodyStates(lua_State* L);
+
+    int SetTransforms(lua_State* L);
+
+    int QueueMutation(lua_State* L);
+
+    int SetThreaded(lua_State* L);
+
+    int IsThreaded(lua_State* L);
+
     int QueryBoundingBox(lua_State* L);
 
     int RayCast(lua_State* L);
@@ -49,5 +67,7 @@ namespace Wrap_World
 
     love::World* CheckWorld(lua_State* L, int index);
 
+    love::World* CheckUnthreadedWorld(lua_State* L, int index);
+
     int Register(lua_State* L);
 } // namespace Wrap_World
@@ -7,6 +7,7 @@
 #include "objects/imagedata/types/formathandler.h"
 
 #include <list>
+#include <string>
 #include <vector>
 
 namespace love
@@ -54,5 +55,40 @@ namespace love
         std::vector<StrongReference<CompressedSlice>> images;
 
         void CheckSliceExists(int slice, int mipLevel) const;
+
+#if defined(__3DS__)
+      public:
+        /* where transcoded textures are kept, inside the save directory */
+        static constexpr const char* CACHE_DIRECTORY = "texturecache";
+
+        /* bump whenever the transcoder's output changes */
+        static constexpr uint32_t CACHE_VERSION = 1;
+
+      private:
+        struct CacheHeader
+        {
+            uint8_t identifier[4];
+            uint32_t version;
+            uint32_t format;
+            uint32_t mipmapCount;
+        };
+
+        struct CacheLevel
+        {
+            uint32_t width;
+            uint32_t height;
+            uint32_t size;
+        };
+
+        static constexpr uint8_t CACHE_IDENTIFIER[] = { 'L', 'P', 'T', 'C' };
+
+        /* turn the parsed data into something the GPU can sample */
+        void Transcode(Data* fileData);
+
+        /* false unless every level matches what transcoding to @tiledFormat would give */
+        bool LoadCache(const std::string& filename, PixelFormat tiledFormat);
+
+        void SaveCache(const std::string& filename) const;
+#endif
     };
 } // namespace love
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "common/pixelformat.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+** CPU transcoder for block compressed textures the 3DS GPU can't sample.
+** ETC1, ETC2 (RGB, RGBA, RGBA1), DXT1, DXT3 and DXT5 are turned into the
+** 3DS' own ETC1 or ETC1A4: 4x4 blocks stored little endian, four to an
+** 8x8 tile in Z order, tiles left to right, top to bottom.
+**
+** ETC1 blocks (and ETC2 blocks that only use ETC1 modes) are repacked as
+** they are. Everything else is decoded and encoded again as ETC1.
+*/
+namespace love::transcoder
+{
+    static constexpr int BLOCK_SIZE = 4;
+
+    bool CanDecode(PixelFormat format);
+
+    /* bytes per 4x4 block of @format */
+    size_t GetBlockBytes(PixelFormat format);
+
+    /* decode one block of @format to 16 RGBA8 pixels, left to right, top to bottom */
+    void DecodeBlock(PixelFormat format, const uint8_t* block, uint8_t* pixels);
+
+    /* encode 16 RGBA8 pixels as an ETC1 block, as a big endian 64 bit value */
+    uint64_t EncodeETC1(const uint8_t* pixels);
+
+    /*
+    ** PIXELFORMAT_TEX3DS_ETC1 or PIXELFORMAT_TEX3DS_ETC1A4 depending on
+    ** whether @data has any alpha, PIXELFORMAT_UNKNOWN if it can't be decoded.
+    */
+    PixelFormat GetTiledFormat(PixelFormat format, const uint8_t* data, size_t size);
+
+    /* size of a @width x @height texture in @tiledFormat, padded to a power of two */
+    size_t GetTiledSize(PixelFormat tiledFormat, int width, int height);
+
+    /* the padded texture is @width x @height, blocks outside of the source are zeroed */
+    void Transcode(PixelFormat format, const uint8_t* data, int width, int height,
+                   PixelFormat tiledFormat, uint8_t* output);
+} // namespace love::transcoder
@@ -26,6 +26,9 @@ namespace love
 
         size_t GetSize() const override;
 
+        /* compressed bytes held by every CompressedData alive */
+        static int64_t GetTotalBytes();
+
       private:
         Compressor::Format format;
 
@@ -16,6 +16,8 @@ namespace love
 
         DataView* Clone() const override;
         void* GetData() const override;
+
+        const void* ReadData() const override;
         size_t GetSize() const override;
 
       private:
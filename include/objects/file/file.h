@@ -89,6 +89,10 @@ namespace love
         PHYSFS_file* file;
         Mode mode;
 
+        /* set instead of file when the whole entry came from the EntryCache */
+        StrongReference<FileData> cached;
+        int64_t cachedPosition;
+
         BufferMode bufferMode;
         int64_t bufferSize;
     };
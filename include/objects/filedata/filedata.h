@@ -29,6 +29,9 @@ namespace love
 
         const std::string& GetName() const;
 
+        /* bytes held by every FileData alive */
+        static int64_t GetTotalBytes();
+
       private:
         char* data;
         uint64_t size;
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "common/variant.h"
+#include "objects/object.h"
+
+#include "modules/thread/types/conditional.h"
+#include "modules/thread/types/lock.h"
+#include "modules/thread/types/mutex.h"
+
+#include <string>
+#include <vector>
+
+namespace love
+{
+    /* the results of a ThreadPool job, filled in once by whichever worker ran it */
+    class Future : public Object
+    {
+      public:
+        static love::Type type;
+
+        Future();
+
+        virtual ~Future();
+
+        void SetResults(std::vector<Variant>&& results);
+
+        void SetError(const std::string& error);
+
+        bool IsDone() const;
+
+        /* blocks until done, or for at most @timeout seconds if it's positive */
+        bool Wait(double timeout = -1.0);
+
+        /* empty until done or if the job failed */
+        std::vector<Variant> GetResults() const;
+
+        std::string GetError() const;
+
+      private:
+        void Finish();
+
+        thread::MutexRef mutex;
+        thread::ConditionalRef condition;
+
+        std::vector<Variant> results;
+        std::string error;
+
+        bool done;
+    };
+} // namespace love
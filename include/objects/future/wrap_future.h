@@ -0,0 +1,19 @@
+#pragma once
+
+#include "common/luax.h"
+#include "objects/future/future.h"
+
+namespace Wrap_Future
+{
+    int IsDone(lua_State* L);
+
+    int Wait(lua_State* L);
+
+    int GetResults(lua_State* L);
+
+    int GetError(lua_State* L);
+
+    love::Future* CheckFuture(lua_State* L, int index);
+
+    int Register(lua_State* L);
+} // namespace Wrap_Future
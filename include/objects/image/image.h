@@ -4,6 +4,8 @@
 #include "modules/filesystem/wrap_filesystem.h"
 #include "objects/texture/texture.h"
 
+#include "objects/image/mipmaps.h"
+
 #include "objects/compressedimagedata/compressedimagedata.h"
 #include "objects/imagedata/imagedata.h"
 
@@ -21,6 +23,12 @@ namespace love
             MIPMAPS_GENERATED,
         };
 
+        struct Settings
+        {
+            bool mipmaps                 = false;
+            mipmaps::Filter mipmapFilter = mipmaps::FILTER_BOX;
+        };
+
         struct Slices
         {
           public:
@@ -63,12 +71,27 @@ namespace love
 
         Image(const Slices& data);
 
+        Image(const Slices& data, const Settings& settings);
+
+        MipmapsType GetMipmapsType() const
+        {
+            return this->mipmapsType;
+        }
+
+        static bool GetConstant(const char* in, mipmaps::Filter& out);
+        static bool GetConstant(mipmaps::Filter in, const char*& out);
+        static std::vector<const char*> GetConstants(mipmaps::Filter);
+
       protected:
         PixelFormat format;
         Slices data;
         MipmapsType mipmapsType;
+        mipmaps::Filter mipmapFilter;
         bool sRGB;
 
+        /* picks up the settings once the slices are validated */
+        void SetupMipmaps(const Settings& settings);
+
       private:
         Image(const Slices& data, bool validate);
 
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+/*
+** Mipmap chain generation for 8 bit, four channel pixels.
+** The channel order doesn't matter, so RGBA8 and TEX3DS_RGBA8 both work.
+** Every level is half the size of the last one, rounded down, to 1x1.
+*/
+namespace love::mipmaps
+{
+    enum Filter
+    {
+        FILTER_BOX,
+        FILTER_KAISER,
+        FILTER_MAX_ENUM
+    };
+
+    /* levels smaller than this are made on the calling thread alone */
+    static constexpr int MIN_THREADED_ROWS = 128;
+
+    int GetLevelSize(int size, int level);
+
+    /*
+    ** Rows [@first, @last) of the level below @src, which is @width x @height
+    ** and tightly packed. @dst points to the start of the whole level.
+    */
+    void Downsample(Filter filter, const uint8_t* src, int width, int height, uint8_t* dst,
+                    int first, int last);
+
+    /*
+    ** Fill @levels with the levels after @src, @levels[0] being level 1.
+    ** Stops at 1x1 or when there are @count levels in total.
+    */
+    void Generate(Filter filter, const uint8_t* src, int width, int height, int count,
+                  std::vector<std::vector<uint8_t>>& levels);
+} // namespace love::mipmaps
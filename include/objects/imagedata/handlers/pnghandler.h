@@ -15,6 +15,14 @@ namespace love
 
         virtual EncodedImage Encode(const DecodedImage& image, EncodedFormat format);
 
+        /*
+        ** Encode RGBA8 or RGBA16 pixels, deflating the image in up to
+        ** @bandCount row bands on their own threads. Each band is primed
+        ** with the end of the previous one, so the output stays about as
+        ** small as a single-threaded encode. Free with delete[].
+        */
+        static EncodedImage EncodeBands(const DecodedImage& image, size_t bandCount);
+
         virtual void FreeRawPixels(unsigned char* memory);
 
         virtual const char* GetName()
@@ -1,8 +1,10 @@
 #pragma once
 
 #include "common/colors.h"
+#include "common/cowbuffer.h"
 #include "common/data.h"
 #include "common/pixelformat.h"
+#include "common/pixelmap.h"
 
 #include "objects/filedata/filedata.h"
 #include "objects/imagedata/imagedatabase.h"
@@ -11,6 +13,7 @@
 
 #include "thread/types/mutex.h"
 
+#include <atomic>
 #include <vector>
 
 namespace love
@@ -18,6 +21,13 @@ namespace love
     class ImageData : public ImageDataBase
     {
       public:
+        /* rows per copy-on-write block, a row of tiles on 3DS */
+#if defined(__3DS__)
+        static constexpr int BLOCK_ROWS = 8;
+#else
+        static constexpr int BLOCK_ROWS = 16;
+#endif
+
         union Pixel
         {
             uint8_t rgba8[4];
@@ -28,6 +38,10 @@ namespace love
             uint32_t packed32;
         };
 
+        /* built-in ImageData:mapPixels operations, done on integer pixels */
+        using MapOperation = pixelmap::Operation;
+        using enum pixelmap::Operation;
+
         typedef void (*PixelSetFunction)(const Colorf& c, Pixel* p);
         typedef void (*PixelGetFunction)(const Pixel* p, Colorf& c);
 
@@ -35,19 +49,28 @@ namespace love
 
         ImageData(Data* data);
 
-#if defined(__SWITCH__)
+#if not defined(__3DS__)
         ImageData(int width, int height, PixelFormat format = PIXELFORMAT_RGBA8);
-#elif defined(__3DS__)
+#else
         ImageData(int width, int height, PixelFormat format = PIXELFORMAT_TEX3DS_RGBA8);
 #endif
         ImageData(int width, int height, PixelFormat format, void* data, bool own);
 
+        /* shares the pixels until either side writes to them */
         ImageData(const ImageData& other);
 
         virtual ~ImageData();
 
         void Paste(ImageData* source, int dx, int dy, int sx, int sy, int sw, int sh);
 
+        /*
+        ** Apply @operation to a rectangle of pixels, row by row. The mutex
+        ** is held once for the whole rectangle. @value is the tint color,
+        ** or the threshold in its red channel.
+        */
+        void MapPixels(MapOperation operation, const Colorf& value, int x, int y, int width,
+                       int height);
+
         bool Inside(int x, int y) const;
 
         /* TODO: SetPixel and GetPixel differ between 3DS and Switch! */
@@ -70,12 +93,29 @@ namespace love
         FileData* Encode(FormatHandler::EncodedFormat encodedFormat, const char* filename,
                          bool writefile) const;
 
+        /*
+        ** Copy the pixels and encode them on love.image's worker thread.
+        ** The result arrives as an "imageencoded" event carrying @id, and
+        ** is only written to @filename by whoever handles that event.
+        */
+        void EncodeAsync(FormatHandler::EncodedFormat encodedFormat, const char* filename, int id);
+
         thread::Mutex* GetMutex() const;
 
+        /*
+        ** Set by _performAtomic to the Lua state running under the mutex,
+        ** so a clone from inside mapPixel is refused rather than deadlocking.
+        */
+        void SetAtomicOwner(const void* owner);
+
+        const void* GetAtomicOwner() const;
+
         ImageData* Clone() const override;
 
         void* GetData() const override;
 
+        const void* ReadData() const override;
+
         size_t GetSize() const override;
 
         bool IsSRGB() const override;
@@ -92,26 +132,36 @@ namespace love
 
         static std::vector<const char*> GetConstants(FormatHandler::EncodedFormat);
 
+        static bool GetConstant(const char* in, MapOperation& out);
+
+        static bool GetConstant(MapOperation in, const char*& out);
+
+        static std::vector<const char*> GetConstants(MapOperation);
+
         static PixelSetFunction GetPixelSetFunction(PixelFormat format);
 
         static PixelGetFunction GetPixelGetFunction(PixelFormat format);
 
       private:
-        union Row
-        {
-            uint8_t* u8;
-            uint16_t* u16;
-        };
-
         void Create(int width, int height, PixelFormat format, void* data = nullptr);
 
         void Decode(Data* data);
 
-        uint8_t* data = nullptr;
+        size_t GetBlockSize() const;
 
-        thread::MutexRef mutex;
+        /* start of the block holding row @y */
+        const uint8_t* ReadRows(int y) const;
 
-        StrongReference<FormatHandler> decodeHandler;
+        uint8_t* WriteRows(int y);
+
+        /* where pixel (@x, @y) is inside its block */
+        size_t GetPixelOffset(int x, int y) const;
+
+        /* GetData() hands out a writable pointer, which joins the blocks */
+        mutable CowBuffer storage;
+
+        thread::MutexRef mutex;
+        std::atomic<const void*> atomicOwner { nullptr };
 
         PixelSetFunction pixelSetFunction;
         PixelGetFunction pixelGetFunction;
@@ -21,10 +21,14 @@ namespace Wrap_ImageData
 
     int _MapPixelUnsafe(lua_State* L);
 
+    int MapPixels(lua_State* L);
+
     int Paste(lua_State* L);
 
     int Encode(lua_State* L);
 
+    int _EncodeAsync(lua_State* L);
+
     int _PerformAtomic(lua_State* L);
 
     love::ImageData* CheckImageData(lua_State* L, int index);
@@ -0,0 +1,191 @@
+#pragma once
+
+#include "common/colors.h"
+#include "common/exception.h"
+#include "common/strongref.h"
+#include "common/vector.h"
+
+#include "objects/drawable/drawable.h"
+#include "objects/mesh/vertexformat.h"
+#include "objects/texture/texture.h"
+
+#include <string>
+#include <vector>
+
+namespace love
+{
+    class Graphics;
+
+    namespace common
+    {
+        /*
+        ** A Mesh holds user-defined vertices in a packed, interleaved
+        ** CPU-side buffer. The standard attributes (VertexPosition,
+        ** VertexTexCoord and VertexColor) are decoded by the platform
+        ** Mesh when it (re-)uploads to the GPU. Packing and decoding
+        ** are in vertexformat.h, which doesn't need a renderer.
+        */
+        class Mesh : public Drawable
+        {
+          public:
+            static love::Type type;
+
+            enum DrawMode
+            {
+                DRAWMODE_FAN,
+                DRAWMODE_STRIP,
+                DRAWMODE_TRIANGLES,
+                DRAWMODE_POINTS,
+                DRAWMODE_MAX_ENUM
+            };
+
+            enum Usage
+            {
+                USAGE_STREAM,
+                USAGE_DYNAMIC,
+                USAGE_STATIC,
+                USAGE_MAX_ENUM
+            };
+
+            using DataType          = vertexformat::DataType;
+            using StandardAttribute = vertexformat::StandardAttribute;
+            using AttribFormat      = vertexformat::AttribFormat;
+            using AttribInfo        = vertexformat::AttribInfo;
+
+            using enum vertexformat::DataType;
+            using enum vertexformat::StandardAttribute;
+
+            static constexpr int MAX_ATTRIBUTE_COMPONENTS = vertexformat::MAX_ATTRIBUTE_COMPONENTS;
+
+            Mesh(const std::vector<AttribFormat>& format, const void* data, size_t size,
+                 DrawMode mode, Usage usage);
+
+            Mesh(const std::vector<AttribFormat>& format, int vertexCount, DrawMode mode,
+                 Usage usage);
+
+            virtual ~Mesh();
+
+            /* Vertices */
+
+            void SetVertices(size_t startVertex, const void* data, size_t size);
+
+            void SetVertex(size_t index, const void* data, size_t size);
+
+            size_t GetVertex(size_t index, void* data, size_t size) const;
+
+            void* GetVertexScratchBuffer();
+
+            void SetVertexAttribute(size_t index, int attribIndex, const void* data, size_t size);
+
+            size_t GetVertexAttribute(size_t index, int attribIndex, void* data,
+                                      size_t size) const;
+
+            size_t GetVertexCount() const;
+
+            size_t GetVertexStride() const;
+
+            const std::vector<AttribFormat>& GetVertexFormat() const;
+
+            const AttribInfo& GetAttributeInfo(int attribIndex) const;
+
+            /* Vertex Map */
+
+            void SetVertexMap(const std::vector<uint32_t>& map);
+
+            void SetVertexMap();
+
+            bool GetVertexMap(std::vector<uint32_t>& map) const;
+
+            size_t GetIndexCount() const;
+
+            /* Draw State */
+
+            virtual void SetTexture(love::Texture* texture);
+
+            void SetTexture();
+
+            love::Texture* GetTexture() const;
+
+            void SetDrawMode(DrawMode mode);
+
+            DrawMode GetDrawMode() const;
+
+            void SetDrawRange(int start, int count);
+
+            void SetDrawRange();
+
+            bool GetDrawRange(int& start, int& count) const;
+
+            Usage GetUsage() const;
+
+            /*
+            ** Pushes pending vertex modifications to the renderer.
+            ** Platforms with GPU-resident buffers override this.
+            */
+            virtual void Flush();
+
+            virtual void Draw(Graphics* gfx, const Matrix4& localTransform) = 0;
+
+            /*
+            ** Decode the standard attributes for @count vertices starting at @first.
+            ** Missing attributes are filled with LÖVE's defaults:
+            ** (0, 0) for positions and texcoords, opaque white for colors.
+            ** Any output pointer may be null to skip that attribute.
+            */
+            void GetStandardAttributes(size_t first, size_t count, Vector2* positions,
+                                       Vector2* texCoords, Colorf* colors) const;
+
+            /*
+            ** Resolve the vertex map and draw range into the final list of
+            ** vertex indices to be drawn. Returns false if nothing is drawn.
+            */
+            bool GetDrawIndices(std::vector<uint32_t>& indices) const;
+
+            static std::vector<AttribFormat> GetDefaultVertexFormat();
+
+            static bool GetConstant(const char* in, DrawMode& out);
+            static bool GetConstant(DrawMode in, const char*& out);
+            static std::vector<const char*> GetConstants(DrawMode);
+
+            static bool GetConstant(const char* in, Usage& out);
+            static bool GetConstant(Usage in, const char*& out);
+            static std::vector<const char*> GetConstants(Usage);
+
+            static bool GetConstant(const char* in, DataType& out);
+            static bool GetConstant(DataType in, const char*& out);
+            static std::vector<const char*> GetConstants(DataType);
+
+          protected:
+            std::vector<AttribFormat> vertexFormat;
+            vertexformat::Layout layout;
+
+            std::vector<uint8_t> vertexData;
+            std::vector<uint8_t> vertexScratch;
+
+            size_t vertexCount;
+
+            std::vector<uint32_t> vertexMap;
+            bool useVertexMap;
+
+            DrawMode drawMode;
+            Usage usage;
+
+            int rangeStart;
+            int rangeCount;
+
+            StrongReference<love::Texture> texture;
+
+            /* modified vertex range, in vertices -- empty when end <= start */
+            size_t modifiedStart;
+            size_t modifiedEnd;
+
+            bool vertexMapModified;
+
+            void MarkModified(size_t start, size_t count);
+
+            void ClearModified();
+
+            bool IsModified() const;
+        };
+    } // namespace common
+} // namespace love
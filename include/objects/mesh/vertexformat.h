@@ -0,0 +1,85 @@
+#pragma once
+
+#include "common/colors.h"
+#include "common/vector.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+/*
+** Vertex formats for Mesh: where each attribute sits in an interleaved
+** vertex, and packing them to and from floats. Attributes are packed at
+** their declared sizes with no padding, so byte data from the user lines
+** up; the renderers convert to their own layout and never read it as is.
+*/
+namespace love::vertexformat
+{
+    enum DataType
+    {
+        DATA_UNORM8,
+        DATA_UNORM16,
+        DATA_FLOAT,
+        DATA_MAX_ENUM
+    };
+
+    enum StandardAttribute
+    {
+        ATTRIB_POSITION,
+        ATTRIB_TEXCOORD,
+        ATTRIB_COLOR,
+        ATTRIB_MAX_ENUM
+    };
+
+    struct AttribFormat
+    {
+        std::string name;
+        DataType type;
+        int components;
+    };
+
+    struct AttribInfo
+    {
+        size_t offset;
+        DataType type;
+        int components;
+    };
+
+    static constexpr int MAX_ATTRIBUTE_COMPONENTS = 4;
+
+    struct Layout
+    {
+        /* throws when @format is empty, repeats a name or has a bad size */
+        explicit Layout(const std::vector<AttribFormat>& format);
+
+        std::vector<AttribInfo> attributes;
+
+        /* index into attributes for each StandardAttribute, or -1 */
+        int standard[ATTRIB_MAX_ENUM];
+
+        size_t stride;
+    };
+
+    size_t GetDataTypeSize(DataType type);
+
+    /* normalized types are clamped to [0, 1] and rounded */
+    void Pack(DataType type, int components, const float* in, void* out);
+
+    void Unpack(DataType type, int components, const void* in, float* out);
+
+    /* zero, except for colors, which are opaque white */
+    void FillDefaults(const Layout& layout, uint8_t* vertices, size_t count);
+
+    /*
+    ** Decode the standard attributes of @count @vertices. Missing ones are
+    ** LÖVE's defaults: (0, 0) for positions and texcoords, opaque white for
+    ** colors. Any output pointer may be null to skip that attribute.
+    */
+    void GetStandardAttributes(const Layout& layout, const uint8_t* vertices, size_t count,
+                               Vector2* positions, Vector2* texCoords, Colorf* colors);
+
+    bool GetConstant(const char* in, StandardAttribute& out);
+    bool GetConstant(StandardAttribute in, const char*& out);
+} // namespace love::vertexformat
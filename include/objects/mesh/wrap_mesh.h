@@ -0,0 +1,54 @@
+#pragma once
+
+#include "common/luax.h"
+#include "objects/mesh/mesh.h"
+
+namespace Wrap_Mesh
+{
+    int SetVertices(lua_State* L);
+
+    int SetVertex(lua_State* L);
+
+    int GetVertex(lua_State* L);
+
+    int SetVertexAttribute(lua_State* L);
+
+    int GetVertexAttribute(lua_State* L);
+
+    int GetVertexCount(lua_State* L);
+
+    int GetVertexFormat(lua_State* L);
+
+    int SetVertexMap(lua_State* L);
+
+    int GetVertexMap(lua_State* L);
+
+    int SetTexture(lua_State* L);
+
+    int GetTexture(lua_State* L);
+
+    int SetDrawMode(lua_State* L);
+
+    int GetDrawMode(lua_State* L);
+
+    int SetDrawRange(lua_State* L);
+
+    int GetDrawRange(lua_State* L);
+
+    int Flush(lua_State* L);
+
+    /* Helpers for newMesh */
+
+    int CheckVertexFormat(lua_State* L, int index,
+                          std::vector<love::Mesh::AttribFormat>& format);
+
+    char* WriteAttributeData(lua_State* L, int startIndex, love::Mesh::DataType type,
+                             int components, char* data);
+
+    const char* ReadAttributeData(lua_State* L, love::Mesh::DataType type, int components,
+                                  const char* data);
+
+    love::Mesh* CheckMesh(lua_State* L, int index);
+
+    int Register(lua_State* L);
+} // namespace Wrap_Mesh
@@ -24,7 +24,18 @@ namespace love
 
         void Release();
 
+        /*
+        ** Counts this object toward @type's live count until it's destroyed.
+        ** Only the first call counts; Luax does it when it first wraps the
+        ** object, which is when its exact type is known.
+        */
+        void SetLiveType(love::Type& type);
+
+        /* every Object alive, whether Lua has seen it or not */
+        static int64_t GetLiveCount();
+
       private:
         std::atomic<int> count;
+        std::atomic<love::Type*> liveType;
     };
 } // namespace love
@@ -1,6 +1,10 @@
 #pragma once
 
+#include "common/cowbuffer.h"
 #include "objects/decoder/decoder.h"
+
+#include "modules/thread/types/mutex.h"
+
 #include <limits>
 
 namespace love
@@ -10,10 +14,14 @@ namespace love
       public:
         static love::Type type;
 
+        /* bytes per copy-on-write block, a whole number of samples */
+        static constexpr size_t BLOCK_SIZE = 0x1000;
+
         SoundData(Decoder* decoder);
         SoundData(int samples, int sampleRate, int bitDepth, int channels);
         SoundData(void* data, int samples, int sampleRate, int bitDepth, int channels);
 
+        /* shares the samples until either side writes to them */
         SoundData(const SoundData& other);
 
         ~SoundData();
@@ -22,6 +30,9 @@ namespace love
 
         void* GetData() const;
 
+        /* doesn't unshare the samples like GetData does */
+        const void* ReadData() const override;
+
         size_t GetSize() const;
 
         int GetChannelCount() const;
@@ -42,14 +53,29 @@ namespace love
 
         float GetSample(int i, int channel) const;
 
+        /*
+        ** The same for SoundData holding the same samples, a clone included,
+        ** and new after every write. 0 once GetData has handed out a pointer,
+        ** since the samples can then change without us knowing.
+        */
+        uint64_t GetContentId() const;
+
       private:
-        uint8_t* data;
+        /* GetData() hands out a writable pointer, which joins the blocks */
+        mutable CowBuffer storage;
         size_t size;
 
+        /* reads can split or join the storage too, so they're locked as well */
+        thread::MutexRef mutex;
+
         int sampleRate;
         int bitDepth;
         int channels;
 
+        mutable uint64_t contentId;
+
+        static uint64_t NextContentId();
+
         void Load(int samples, int sampleRate, int bitDepth, int channels, void* newData = 0);
     };
 } // namespace love
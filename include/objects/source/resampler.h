@@ -0,0 +1,99 @@
+#pragma once
+
+#include <atomic>
+#include <stdint.h>
+#include <vector>
+
+namespace love
+{
+    /*
+    ** Polyphase windowed sinc resampler for 16-bit PCM. Input is pushed as
+    ** it's decoded and output is pulled at the rate the hardware mixes at,
+    ** so streams play at the same speed and quality on every console.
+    **
+    ** The Kaiser windowed kernel is tabulated at PHASES offsets between two
+    ** input frames. Each output frame is the dot product of the nearest
+    ** phase with the frames around it, so pitch only changes the step.
+    */
+    class Resampler
+    {
+      public:
+        enum Quality
+        {
+            QUALITY_FAST,
+            QUALITY_MEDIUM,
+            QUALITY_BEST,
+            QUALITY_MAX_ENUM
+        };
+
+        static constexpr int PHASES       = 256;
+        static constexpr int MAX_CHANNELS = 2;
+
+        Resampler(int channels, double inputRate, double outputRate, Quality quality);
+
+        /* input frames per output frame are scaled by @pitch */
+        void SetPitch(double pitch);
+
+        double GetPitch() const
+        {
+            return this->pitch;
+        }
+
+        Quality GetQuality() const
+        {
+            return this->quality;
+        }
+
+        /* interleaved */
+        void Push(const int16_t* samples, int frames);
+
+        /* zeros after the last frame so the end of the input comes out */
+        void Flush();
+
+        bool IsFlushed() const
+        {
+            return this->flushed;
+        }
+
+        /* interleaved, returns how many frames were made */
+        int Pull(int16_t* out, int frames);
+
+        void Reset();
+
+        /* input frames played for @frames output frames at the current pitch */
+        double ToInputFrames(double frames) const;
+
+        static void SetDefaultQuality(Quality quality);
+
+        static Quality GetDefaultQuality();
+
+        static bool GetConstant(const char* in, Quality& out);
+        static bool GetConstant(Quality in, const char*& out);
+        static std::vector<const char*> GetConstants(Quality);
+
+      private:
+        void UpdateStep();
+
+        void BuildTable(double cutoff);
+
+        int channels;
+        int taps;
+
+        double inputRate;
+        double outputRate;
+        double pitch;
+        double cutoff;
+
+        Quality quality;
+        bool flushed;
+
+        /* 32.32 fixed point, in frames from the start of @history */
+        uint64_t position;
+        uint64_t step;
+
+        std::vector<int16_t> table;
+        std::vector<int16_t> history[MAX_CHANNELS];
+
+        static std::atomic<Quality> defaultQuality;
+    };
+} // namespace love
@@ -5,7 +5,9 @@
 
 #include "modules/audio/pool/pool.h"
 #include "objects/object.h"
+#include "objects/source/resampler.h"
 
+#include <memory>
 #include <vector>
 
 namespace love
@@ -13,7 +15,7 @@ namespace love
     class StaticDataBuffer : public Object
     {
       public:
-        StaticDataBuffer(void* data, size_t size);
+        StaticDataBuffer(const void* data, size_t size);
 
         virtual ~StaticDataBuffer();
 
@@ -22,13 +24,15 @@ namespace love
             return this->buffer.first;
         }
 
+        /* bytes of samples, the allocation may be bigger */
         inline size_t GetSize() const
         {
-            return this->buffer.second;
+            return this->size;
         }
 
       private:
         std::pair<s16*, size_t> buffer;
+        size_t size;
     };
 
     namespace common
@@ -53,7 +57,8 @@ namespace love
                 UNIT_MAX_ENUM
             };
 
-            Source(Pool* pool, SoundData* sound);
+            /* plays @buffer, which holds @sound's samples */
+            Source(Pool* pool, SoundData* sound, StaticDataBuffer* buffer);
 
             Source(Pool* pool, Decoder* decoder);
 
@@ -95,6 +100,10 @@ namespace love
 
             void SetVolumeLimits(float min, float max);
 
+            void SetPitch(float pitch);
+
+            float GetPitch() const;
+
             void SetMinVolume(float volume);
 
             void SetMaxVolume(float volume);
@@ -143,12 +152,22 @@ namespace love
             float minVolume = 0.0f;
             float maxVolume = 1.0f;
 
+            /* where the last seek went, in input frames */
             std::atomic<int> offsetSamples = 0;
 
             int sampleRate = 0;
             int channels   = 0;
             int bitDepth   = 0;
 
+            float pitch = 1.0f;
+
+            /* 16-bit streams are brought to the output rate before the hardware sees them */
+            std::unique_ptr<Resampler> resampler;
+
+            /* output frames played when the pitch last changed, and the input frames they were */
+            double pitchOutputFrames = 0.0;
+            double pitchInputFrames  = 0.0;
+
             Pool* pool = nullptr;
 
             size_t channel = 0;
@@ -174,8 +193,19 @@ namespace love
 
             virtual void ResumeAtomic() = 0;
 
+            /* frames the channel played since it was last reset */
             virtual double GetSampleOffset() = 0;
 
+            /* hardware pitch, for what isn't resampled */
+            virtual void ApplyPitch() = 0;
+
+            /* one stream buffer's worth, resampled when there's a resampler */
+            int DecodeStream(s16* buffer);
+
+            double GetChannelRate() const;
+
+            float GetChannelPitch() const;
+
             void TeardownAtomic();
         };
     } // namespace common
@@ -13,6 +13,8 @@ namespace Wrap_Source
 
     int GetFreeBufferCount(lua_State* L);
 
+    int GetPitch(lua_State* L);
+
     int GetType(lua_State* L);
 
     int GetVolume(lua_State* L);
@@ -31,6 +33,8 @@ namespace Wrap_Source
 
     int SetLooping(lua_State* L);
 
+    int SetPitch(lua_State* L);
+
     int SetVolume(lua_State* L);
 
     int SetVolumeLimits(lua_State* L);
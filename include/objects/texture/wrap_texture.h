@@ -16,11 +16,17 @@ namespace Wrap_Texture
 
     int GetFilter(lua_State* L);
 
+    int SetMipmapFilter(lua_State* L);
+
+    int GetMipmapFilter(lua_State* L);
+
+    int GetMipmapCount(lua_State* L);
+
     int SetWrap(lua_State* L);
 
     int GetWrap(lua_State* L);
 
-    extern const luaL_Reg functions[9];
+    extern const luaL_Reg functions[12];
 
     love::Texture* CheckTexture(lua_State* L, int index);
 
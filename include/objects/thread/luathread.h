@@ -23,6 +23,9 @@ namespace love
 
         bool Start(const std::vector<Variant>& args);
 
+        /* a state with love, love.thread and love.filesystem loaded */
+        static lua_State* NewState();
+
       private:
         void OnError();
 
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "common/data.h"
+#include "common/variant.h"
+
+#include "objects/future/future.h"
+#include "objects/object.h"
+
+#include "modules/thread/types/conditional.h"
+#include "modules/thread/types/lock.h"
+#include "modules/thread/types/mutex.h"
+#include "modules/thread/types/threadable.h"
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace love
+{
+    /*
+    ** A fixed set of worker threads, each with a Lua state that lives as
+    ** long as the pool. The pool's code runs once per worker and returns
+    ** the function every job calls, so jobs pay for a function call rather
+    ** than a new state with love loaded into it.
+    **
+    ** Jobs are dealt round-robin onto per-worker queues. A worker takes
+    ** from the front of its own queue and, once that's empty, steals from
+    ** the back of the others before it sleeps.
+    */
+    class ThreadPool : public Object
+    {
+      public:
+        static love::Type type;
+
+        static constexpr int MAX_WORKERS = 16;
+
+        ThreadPool(const std::string& name, love::Data* code, int workers);
+
+        virtual ~ThreadPool();
+
+        Future* Submit(const std::vector<Variant>& args);
+
+        int GetWorkerCount() const;
+
+        /* jobs queued and not yet taken by a worker */
+        int GetPendingCount() const;
+
+      private:
+        struct Job
+        {
+            std::vector<Variant> args;
+            StrongReference<Future> future;
+        };
+
+        class Worker : public Threadable
+        {
+          public:
+            Worker(ThreadPool* pool, int index);
+
+            void ThreadFunction() override;
+
+          private:
+            void Run(lua_State* L, Job& job, int traceback);
+
+            ThreadPool* pool;
+            int index;
+        };
+
+        struct Queue
+        {
+            thread::MutexRef mutex;
+            std::deque<Job> jobs;
+        };
+
+        /* wakes and joins the workers, then fails any job left queued */
+        void Stop();
+
+        bool Take(int index, Job& job);
+
+        bool Steal(int index, Job& job);
+
+        /* false once the pool is stopping */
+        bool WaitForJob();
+
+        StrongReference<love::Data> code;
+        std::string name;
+
+        std::vector<std::unique_ptr<Queue>> queues;
+        std::vector<StrongReference<Worker>> workers;
+
+        thread::MutexRef sleepMutex;
+        thread::ConditionalRef sleepCondition;
+
+        /* changed only with a queue's mutex held, along with the push or pop */
+        std::atomic<int> pending;
+        std::atomic<unsigned> nextQueue;
+
+        bool stopping;
+    };
+} // namespace love
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "common/luax.h"
+#include "objects/threadpool/threadpool.h"
+
+namespace Wrap_ThreadPool
+{
+    int Submit(lua_State* L);
+
+    int GetWorkerCount(lua_State* L);
+
+    int GetPendingCount(lua_State* L);
+
+    love::ThreadPool* CheckThreadPool(lua_State* L, int index);
+
+    int Register(lua_State* L);
+} // namespace Wrap_ThreadPool
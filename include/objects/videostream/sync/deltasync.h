@@ -14,8 +14,6 @@ namespace love
 
         virtual double GetPosition() const override;
 
-        virtual void Update(double dt) override;
-
         virtual void Play() override;
 
         virtual void Pause() override;
@@ -25,9 +23,14 @@ namespace love
         virtual bool IsPlaying() const override;
 
       private:
+        /*
+        ** The position is derived from the clock, so nothing has to tick
+        ** the sync while the decoder thread is asleep.
+        */
         bool playing;
         double position;
         double speed;
+        double startTime;
 
         thread::MutexRef mutex;
     };
@@ -10,11 +10,31 @@
 #include "objects/videostream/theora/oggdemuxer.h"
 #include "objects/videostream/videostream.h"
 
+#include <deque>
+#include <vector>
+
+namespace love
+{
+    class Worker;
+}
+
 namespace love::common
 {
     class TheoraStream : public VideoStream
     {
       public:
+        /* how many frames the worker may decode ahead of the shown one */
+        static constexpr size_t MAX_QUEUED_FRAMES = 3;
+
+        /* the queued frames plus the one being shown */
+        static constexpr size_t FRAME_COUNT = MAX_QUEUED_FRAMES + 1;
+
+        /* seeking forward further than this flushes the queue instead of decoding through */
+        static constexpr double MAX_DECODE_THROUGH = 1.0;
+
+        /* going back less than this (e.g. audio clock jitter) doesn't seek */
+        static constexpr double SEEK_TOLERANCE = 0.1;
+
         TheoraStream(File* file);
 
         ~TheoraStream();
@@ -37,15 +57,51 @@ namespace love::common
 
         bool IsPlaying() const;
 
-        void ThreadedFillBackBuffer(double dt);
+        FrameStats GetFrameStats() const override;
+
+        /* Worker side */
+
+        void SetWorker(Worker* worker);
+
+        /* whether there is a free frame to decode into or a seek to do */
+        bool NeedsDecode() const;
+
+        /*
+        ** Decodes a single frame into a free slot of the queue.
+        ** Only the worker thread touches the decoder, so this runs
+        ** without holding the buffer lock.
+        */
+        bool DecodeNext();
 
         virtual void SetupBuffers() = 0;
 
-        virtual void FillBufferData(th_ycbcr_buffer bufferInfo) = 0;
+        virtual void FillBufferData(IFrame* frame, th_ycbcr_buffer bufferInfo) = 0;
 
       protected:
+        struct QueuedFrame
+        {
+            IFrame* frame;
+            double time;
+        };
+
+        /* owns every frame, allocated by the subclass */
+        std::vector<IFrame*> frames;
+
         IFrame* frontBuffer;
-        IFrame* backBuffer;
+        double frontTime;
+
+        std::deque<QueuedFrame> decodedFrames;
+        std::vector<IFrame*> freeFrames;
+
+        /* time of the newest decoded frame */
+        double decodedTime;
+        double seekTarget;
+        bool endOfStream;
+
+        size_t decodedCount;
+        size_t droppedCount;
+
+        Worker* worker;
 
         OggDemuxer demuxer;
         bool headerParsed;
@@ -55,8 +111,7 @@ namespace love::common
         th_info info;
         th_dec_ctx* decoder;
 
-        thread::MutexRef bufferMutex;
-        bool frameReady;
+        mutable thread::MutexRef bufferMutex;
 
         double lastFrame;
         double nextFrame;
@@ -71,5 +126,10 @@ namespace love::common
         void ParseHeader();
 
         void SeekDecoder(double target);
+
+        /* hand the allocated frames out, call once after SetupBuffers */
+        void InitFrames();
+
+        void DeleteFrames();
     };
 } // namespace love::common
@@ -17,10 +17,22 @@ namespace love
             IFrame()
             {}
 
-            ~IFrame()
+            virtual ~IFrame()
             {}
         };
 
+        struct FrameStats
+        {
+            /* frames decoded since the stream was created */
+            size_t decoded;
+
+            /* frames that were never shown because playback was ahead */
+            size_t dropped;
+
+            /* frames decoded ahead of the one being shown */
+            size_t queued;
+        };
+
         virtual ~VideoStream()
         {}
 
@@ -42,6 +54,8 @@ namespace love
 
         virtual bool IsPlaying() const;
 
+        virtual FrameStats GetFrameStats() const;
+
         /* sync stuff */
 
         virtual void SetSync(FrameSync* sync);
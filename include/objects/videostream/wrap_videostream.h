@@ -21,6 +21,8 @@ namespace Wrap_VideoStream
 
     int IsPlaying(lua_State* L);
 
+    int GetFrameStats(lua_State* L);
+
     love::VideoStream* CheckVideoStream(lua_State* L, int index);
 
     int Register(lua_State* L);
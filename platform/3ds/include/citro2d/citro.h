@@ -20,7 +20,7 @@ class citro2d
         GPU_TEXTURE_FILTER_PARAM min;
         GPU_TEXTURE_FILTER_PARAM mag;
 
-        GPU_PROCTEX_FILTER mipMap;
+        GPU_TEXTURE_FILTER_PARAM mipMap;
     };
 
     static citro2d& Instance();
@@ -99,7 +99,22 @@ class citro2d
 
     static bool GetConstant(GPU_TEXCOLOR in, love::PixelFormat& out);
 
+    /* citro2d batches draws itself and doesn't say how many it made */
+    struct FrameStats
+    {
+        int canvasSwitches;
+    };
+
+    /* counted over the last presented frame */
+    const FrameStats& GetFrameStats() const
+    {
+        return this->lastFrameStats;
+    }
+
   private:
+    FrameStats frameStats {};
+    FrameStats lastFrameStats {};
+
     GPUFilter filter;
 
     std::vector<std::function<void()>> deferredFunctions;
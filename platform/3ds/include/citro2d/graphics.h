@@ -19,6 +19,8 @@ namespace love::citro2d
 
         RendererInfo GetRendererInfo() const override;
 
+        Stats GetStats() const override;
+
         void Clear(std::optional<Colorf> color, std::optional<int> stencil,
                    std::optional<double> depth) override;
 
@@ -8,6 +8,9 @@ namespace love::driver
     class Audrv : public common::driver::Audrv
     {
       public:
+        /* what NDSP mixes at, 268111856 / 8192 Hz */
+        static constexpr double OUTPUT_RATE = 32728.498046875;
+
         static Audrv& Instance()
         {
             static Audrv instance;
@@ -35,6 +35,8 @@ namespace love
 
         const std::string& GetFriendCode() override;
 
+        void GetMemoryPools(std::vector<MemoryPool>& pools) const override;
+
         int GetPlayCoins() const;
 
         void SetPlayCoins(int);
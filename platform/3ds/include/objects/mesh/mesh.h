@@ -0,0 +1,36 @@
+#pragma once
+
+#include "objects/mesh/meshc.h"
+
+#include <citro2d.h>
+
+namespace love
+{
+    class Mesh : public common::Mesh
+    {
+      public:
+        Mesh(const std::vector<AttribFormat>& format, const void* data, size_t size,
+             DrawMode mode, Usage usage);
+
+        Mesh(const std::vector<AttribFormat>& format, int vertexCount, DrawMode mode,
+             Usage usage);
+
+        virtual ~Mesh()
+        {}
+
+        using common::Mesh::SetTexture;
+
+        void SetTexture(love::Texture* texture) override;
+
+        void Draw(Graphics* gfx, const Matrix4& localTransform) override;
+
+      private:
+        /* decoded positions & packed colors, refreshed when modified */
+        std::vector<Vector2> positions;
+        std::vector<u32> colors;
+
+        Colorf cachedColor;
+
+        void RefreshCache(size_t first, size_t count, const Colorf& color);
+    };
+} // namespace love
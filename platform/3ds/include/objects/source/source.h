@@ -7,7 +7,7 @@ namespace love
     class Source : public common::Source
     {
       public:
-        Source(Pool* pool, SoundData* sound);
+        Source(Pool* pool, SoundData* sound, StaticDataBuffer* buffer);
 
         Source(Pool* pool, Decoder* decoder);
 
@@ -34,9 +34,14 @@ namespace love
 
         void ClearChannel() override;
 
+        void ApplyPitch() override;
+
       private:
         ndspWaveBuf sources[Source::MAX_BUFFERS];
 
+        /* in the buffers that finished since the channel was reset */
+        int playedSamples = 0;
+
         void Reset() override;
 
         void InitializeStreamBuffers(Decoder* decoder) override;
@@ -105,6 +105,8 @@ void citro2d::BindFramebuffer(love::Canvas* canvas)
     else
         this->current = this->targets[love::Graphics::ACTIVE_SCREEN];
 
+    this->frameStats.canvasSwitches++;
+
     C2D_SceneBegin(this->current);
 }
 
@@ -121,6 +123,9 @@ void citro2d::Present()
         this->inFrame = false;
     }
 
+    this->lastFrameStats = this->frameStats;
+    this->frameStats     = FrameStats {};
+
     for (size_t i = this->deferredFunctions.size(); i > 0; i--)
     {
         this->deferredFunctions[i - 1]();
@@ -158,25 +163,10 @@ void citro2d::SetTextureFilter(const love::Texture::Filter& filter)
     GPU_TEXTURE_FILTER_PARAM mag =
         (filter.min == love::Texture::FILTER_NEAREST) ? GPU_NEAREST : GPU_LINEAR;
 
-    GPU_PROCTEX_FILTER mipFilter = GPU_PT_LINEAR;
+    GPU_TEXTURE_FILTER_PARAM mipFilter = GPU_NEAREST;
 
-    if (filter.mipmap != love::Texture::FILTER_NONE)
-    {
-        if (filter.min == love::Texture::FILTER_NEAREST &&
-            filter.mipmap == love::Texture::FILTER_NEAREST)
-            mipFilter = GPU_PT_NEAREST;
-        else if (filter.min == love::Texture::FILTER_NEAREST &&
-                 filter.mipmap == love::Texture::FILTER_LINEAR)
-            mipFilter = GPU_PT_LINEAR;
-        else if (filter.min == love::Texture::FILTER_LINEAR &&
-                 filter.mipmap == love::Texture::FILTER_NEAREST)
-            mipFilter = GPU_PT_NEAREST;
-        else if (filter.min == love::Texture::FILTER_LINEAR &&
-                 filter.mipmap == love::Texture::FILTER_LINEAR)
-            mipFilter = GPU_PT_LINEAR;
-        else
-            mipFilter = GPU_PT_LINEAR;
-    }
+    if (filter.mipmap == love::Texture::FILTER_LINEAR)
+        mipFilter = GPU_LINEAR;
 
     this->filter.min = min;
     this->filter.mag = mag;
@@ -190,6 +180,14 @@ void citro2d::SetTextureFilter(love::Texture* texture, const love::Texture::Filt
 
     const C2D_Image& image = texture->GetHandle();
     C3D_TexSetFilter(image.tex, this->filter.mag, this->filter.min);
+
+    C3D_TexSetFilterMipmap(image.tex, this->filter.mipMap);
+
+    /* there's no mipmap filter for "none", keeping the GPU on level 0 does the same */
+    if (filter.mipmap == love::Texture::FILTER_NONE)
+        image.tex->maxLevel = 0;
+    else
+        image.tex->maxLevel = texture->GetMipmapCount() - 1;
 }
 
 void citro2d::SetTextureWrap(const love::Texture::Wrap& wrap)
@@ -261,12 +259,13 @@ GPU_TEXTURE_WRAP_PARAM citro2d::GetCitroWrapMode(love::Texture::WrapMode wrap)
 
 // clang-format off
 constexpr auto pixelFormats = BidirectionalMap<>::Create(
-    PIXELFORMAT_TEX3DS_RGBA8, GPU_RGBA8,
-    PIXELFORMAT_RGBA8,        GPU_RGBA8,
-    PIXELFORMAT_RGB8,         GPU_RGB8,
-    PIXELFORMAT_RGB565,       GPU_RGB565,
-    PIXELFORMAT_LA8,          GPU_LA8,
-    PIXELFORMAT_ETC1,         GPU_ETC1
+    PIXELFORMAT_TEX3DS_RGBA8,  GPU_RGBA8,
+    PIXELFORMAT_RGBA8,         GPU_RGBA8,
+    PIXELFORMAT_RGB8,          GPU_RGB8,
+    PIXELFORMAT_RGB565,        GPU_RGB565,
+    PIXELFORMAT_LA8,           GPU_LA8,
+    PIXELFORMAT_TEX3DS_ETC1,   GPU_ETC1,
+    PIXELFORMAT_TEX3DS_ETC1A4, GPU_ETC1A4
 );
 // clang-format on
 
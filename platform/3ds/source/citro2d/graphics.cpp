@@ -595,4 +595,15 @@ Graphics::RendererInfo love::citro2d::Graphics::GetRendererInfo() const
     return info;
 }
 
+Graphics::Stats love::citro2d::Graphics::GetStats() const
+{
+    Stats stats = love::Graphics::GetStats();
+
+    const auto& frame = ::citro2d::Instance().GetFrameStats();
+
+    stats.canvasSwitches = frame.canvasSwitches;
+
+    return stats;
+}
+
 /* 2D Screens */
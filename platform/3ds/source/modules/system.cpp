@@ -6,6 +6,11 @@
 
 using namespace love;
 
+/* set up by libctru before main, the linear heap never changes size after */
+extern "C" u32 __ctru_linear_heap_size;
+
+static constexpr uint64_t VRAM_SIZE = 0x600000;
+
 int System::GetProcessorCount()
 {
     if (this->systemInfo.processors != 0)
@@ -176,6 +181,15 @@ const std::string& System::GetSystemTheme()
     return THEME_NAME;
 }
 
+void System::GetMemoryPools(std::vector<MemoryPool>& pools) const
+{
+    uint64_t linearFree = linearSpaceFree();
+    uint64_t vramFree   = vramSpaceFree();
+
+    pools.push_back({ "linear", __ctru_linear_heap_size, __ctru_linear_heap_size - linearFree });
+    pools.push_back({ "vram", VRAM_SIZE, VRAM_SIZE - vramFree });
+}
+
 Handle System::OpenPlayCoinsFile()
 {
     Handle playCoinsFile;
@@ -10,8 +10,13 @@ Timer::Timer()
     this->prevFPSUpdate = currentTime = this->GetTime();
 }
 
-double common::Timer::GetTime()
+static constexpr uint64_t NS_PER_SEC = 1000000000ULL;
+
+/* split so the multiply can't overflow however long the console's been on */
+uint64_t common::Timer::GetTimeNs()
 {
-    counter.elapsed = svcGetSystemTick() - counter.reference;
-    return osTickCounterRead(&counter) / 1000.0;
+    uint64_t ticks = svcGetSystemTick() - counter.reference;
+
+    return (ticks / SYSCLOCK_ARM11) * NS_PER_SEC +
+           (ticks % SYSCLOCK_ARM11) * NS_PER_SEC / SYSCLOCK_ARM11;
 }
\ No newline at end of file
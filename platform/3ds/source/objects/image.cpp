@@ -3,21 +3,91 @@
 
 #include "citro2d/citro.h"
 #include "common/pixelformat.h"
+#include "common/swizzle.h"
+
+#include <algorithm>
 
 using namespace love;
 
+namespace
+{
+    /*
+    ** Levels of the slices are only used while their size matches the texture's
+    ** own level. Padding to a power of two can make them smaller than that.
+    */
+    int copyMipmaps(C3D_Tex* tex, const Image::Slices& slices, int maxLevel)
+    {
+        for (int level = 1; level <= maxLevel; level++)
+        {
+            uint32_t size = 0;
+            void* dst     = C3D_TexGetImagePtr(tex, tex->data, level, &size);
+
+            ImageDataBase* slice = slices.Get(0, level);
+
+            if (slice->GetSize() != size)
+                return level - 1;
+
+            memcpy(dst, slice->ReadData(), size);
+        }
+
+        return maxLevel;
+    }
+
+    /*
+    ** Level 0 is untiled without its padding, so the padding doesn't bleed
+    ** into the edges, and every level is tiled back into the top left corner.
+    */
+    void generateMipmaps(C3D_Tex* tex, ImageDataBase* base, mipmaps::Filter filter, int maxLevel)
+    {
+        const int width  = base->GetWidth();
+        const int height = base->GetHeight();
+
+        const unsigned texWidth = tex->width;
+        const size_t pixelSize  = GetPixelFormatSize(base->GetFormat());
+
+        std::vector<uint8_t> linear(width * height * pixelSize);
+        swizzle::TiledToLinear(base->ReadData(), texWidth, 0, 0, linear.data(), width * pixelSize,
+                               width, height, pixelSize);
+
+        std::vector<std::vector<uint8_t>> levels;
+        mipmaps::Generate(filter, linear.data(), width, height, maxLevel + 1, levels);
+
+        for (int level = 1; level <= maxLevel; level++)
+        {
+            uint32_t size = 0;
+            void* dst     = C3D_TexGetImagePtr(tex, tex->data, level, &size);
+
+            memset(dst, 0, size);
+
+            if (level > (int)levels.size())
+                continue;
+
+            int levelWidth  = mipmaps::GetLevelSize(width, level);
+            int levelHeight = mipmaps::GetLevelSize(height, level);
+
+            swizzle::LinearToTiled(levels[level - 1].data(), levelWidth * pixelSize, dst,
+                                   texWidth >> level, 0, 0, levelWidth, levelHeight, pixelSize);
+        }
+    }
+} // namespace
+
 Image::Image(const Slices& slices, bool validate) :
     Texture(data.GetTextureType()),
     data(slices),
     mipmapsType(MIPMAPS_NONE),
+    mipmapFilter(mipmaps::FILTER_BOX),
     sRGB(false)
 {
     if (validate && this->data.Validate() == MIPMAPS_DATA)
         mipmapsType = MIPMAPS_DATA;
 }
 
-Image::Image(const Slices& slices) : Image(slices, true)
+Image::Image(const Slices& slices) : Image(slices, Settings())
+{}
+
+Image::Image(const Slices& slices, const Settings& settings) : Image(slices, true)
 {
+    this->SetupMipmaps(settings);
     this->Init(slices.Get(0, 0));
 }
 
@@ -47,15 +117,49 @@ void Image::Init(PixelFormat format, int width, int height)
     GPU_TEXCOLOR color;
     ::citro2d::GetConstant(format, color);
 
-    if (!C3D_TexInit(this->texture.tex, copyWidth, copyHeight, color))
+    /* levels smaller than a tile can't be sampled */
+    int maxLevel = 0;
+
+    if (this->mipmapsType != MIPMAPS_NONE)
+    {
+        int levels = Texture::GetTotalMipmapCount(copyWidth, copyHeight);
+
+        if (this->mipmapsType == MIPMAPS_DATA)
+            levels = std::min(levels, this->data.GetMipmapCount());
+
+        while (maxLevel + 1 < levels && std::min(copyWidth, copyHeight) >> (maxLevel + 1) >= 8)
+            maxLevel++;
+    }
+
+    C3D_TexInitParams params {};
+    params.width    = copyWidth;
+    params.height   = copyHeight;
+    params.maxLevel = maxLevel;
+    params.format   = color;
+    params.type     = GPU_TEX_2D;
+    params.onVram   = false;
+
+    if (!C3D_TexInitWithParams(this->texture.tex, nullptr, params))
         throw love::Exception("Failed to initialize texture!");
 
-    size_t copySize = copyWidth * copyHeight * GetPixelFormatSize(format);
+    /* the texture knows its own size, which also works for the ETC1 formats */
+    uint32_t copySize = 0;
+    void* level0 = C3D_TexGetImagePtr(this->texture.tex, this->texture.tex->data, 0, &copySize);
 
     if (this->data.Get(0, 0))
-        memcpy(this->texture.tex->data, this->data.Get(0, 0)->GetData(), copySize);
+    {
+        ImageDataBase* base = this->data.Get(0, 0);
+        memcpy(level0, base->ReadData(), std::min<size_t>(copySize, base->GetSize()));
+
+        if (this->mipmapsType == MIPMAPS_DATA)
+            maxLevel = copyMipmaps(this->texture.tex, this->data, maxLevel);
+        else if (this->mipmapsType == MIPMAPS_GENERATED)
+            generateMipmaps(this->texture.tex, base, this->mipmapFilter, maxLevel);
+    }
     else
-        memset(this->texture.tex->data, 0, copySize);
+        memset(level0, 0, copySize);
+
+    this->mipmapCount = maxLevel + 1;
 
     C3D_TexFlush(this->texture.tex);
 
@@ -87,31 +191,10 @@ void Image::ReplacePixels(const void* data, size_t size, const Rect& rect)
         return;
     }
 
-    /* love::Rect should be Po2 already */
-
-    auto getFunction = ImageData::GetPixelGetFunction(this->format);
-    auto setFunction = ImageData::GetPixelSetFunction(this->format);
-
-    for (int y = 0; y < rect.h; y++)
-    {
-        for (int x = 0; x < rect.w; x++)
-        {
-            unsigned srcIndex = coordToIndex(srcPowTwoWidth, x, y);
-            unsigned dstIndex = coordToIndex(this->texture.tex->width, x, y);
-
-            Colorf color {};
-
-            /* grab the pixel data from our source */
-            const ImageData::Pixel* srcPixel =
-                reinterpret_cast<const ImageData::Pixel*>((uint32_t*)data + srcIndex);
-            getFunction(srcPixel, color);
-
-            /* set the pixel we got to ours */
-            ImageData::Pixel* dstPixel =
-                reinterpret_cast<ImageData::Pixel*>((uint32_t*)this->texture.tex->data + dstIndex);
-            setFunction(color, dstPixel);
-        }
-    }
+    /* both sides are tiled, so copy whole tiles where we can */
+    swizzle::CopyTiled(data, srcPowTwoWidth, 0, 0, this->texture.tex->data,
+                       this->texture.tex->width, rect.x, rect.y, rect.w, rect.h,
+                       GetPixelFormatSize(this->format));
 
     C3D_TexFlush(this->texture.tex);
 }
@@ -0,0 +1,116 @@
+#include "objects/mesh/mesh.h"
+
+#include "modules/graphics/graphics.h"
+
+using namespace love;
+
+Mesh::Mesh(const std::vector<AttribFormat>& format, const void* data, size_t size,
+           DrawMode mode, Usage usage) :
+    common::Mesh(format, data, size, mode, usage),
+    cachedColor(1.0f, 1.0f, 1.0f, 1.0f)
+{}
+
+Mesh::Mesh(const std::vector<AttribFormat>& format, int vertexCount, DrawMode mode,
+           Usage usage) :
+    common::Mesh(format, vertexCount, mode, usage),
+    cachedColor(1.0f, 1.0f, 1.0f, 1.0f)
+{}
+
+/*
+** citro2d has no public way to draw arbitrary textured
+** triangles, so only vertex-colored Meshes are supported
+*/
+void Mesh::SetTexture(love::Texture* /* texture */)
+{
+    throw love::Exception("Textured Meshes are not supported on this console.");
+}
+
+void Mesh::RefreshCache(size_t first, size_t count, const Colorf& color)
+{
+    if (this->positions.size() != this->vertexCount)
+    {
+        this->positions.resize(this->vertexCount);
+        this->colors.resize(this->vertexCount);
+
+        first = 0;
+        count = this->vertexCount;
+    }
+
+    std::vector<Colorf> decoded(count);
+
+    this->GetStandardAttributes(first, count, this->positions.data() + first, nullptr,
+                                decoded.data());
+
+    for (size_t index = 0; index < count; index++)
+    {
+        Colorf vertexColor = decoded[index];
+        vertexColor *= color;
+
+        this->colors[first + index] =
+            C2D_Color32f(vertexColor.r, vertexColor.g, vertexColor.b, vertexColor.a);
+    }
+
+    this->cachedColor = color;
+}
+
+void Mesh::Draw(Graphics* gfx, const Matrix4& localTransform)
+{
+    std::vector<uint32_t> indices;
+    if (!this->GetDrawIndices(indices))
+        return;
+
+    const Colorf color = gfx->GetColor();
+
+    if (this->positions.size() != this->vertexCount || color != this->cachedColor)
+        this->RefreshCache(0, this->vertexCount, color);
+    else if (this->IsModified())
+        this->RefreshCache(this->modifiedStart, this->modifiedEnd - this->modifiedStart, color);
+
+    this->ClearModified();
+
+    Matrix4 t(gfx->GetTransform(), localTransform);
+    C2D_ViewRestore(&t.GetElements());
+
+    const float depth = Graphics::CURRENT_DEPTH;
+
+    const auto drawTriangle = [&](uint32_t a, uint32_t b, uint32_t c) {
+        C2D_DrawTriangle(this->positions[a].x, this->positions[a].y, this->colors[a],
+                         this->positions[b].x, this->positions[b].y, this->colors[b],
+                         this->positions[c].x, this->positions[c].y, this->colors[c], depth);
+    };
+
+    size_t count = indices.size();
+
+    switch (this->drawMode)
+    {
+        case DRAWMODE_FAN:
+            for (size_t index = 2; index < count; index++)
+                drawTriangle(indices[0], indices[index - 1], indices[index]);
+
+            break;
+        case DRAWMODE_STRIP:
+            for (size_t index = 2; index < count; index++)
+                drawTriangle(indices[index - 2], indices[index - 1], indices[index]);
+
+            break;
+        case DRAWMODE_TRIANGLES:
+            for (size_t index = 2; index < count; index += 3)
+                drawTriangle(indices[index - 2], indices[index - 1], indices[index]);
+
+            break;
+        case DRAWMODE_POINTS:
+        {
+            float size = gfx->GetPointSize();
+
+            for (size_t index = 0; index < count; index++)
+            {
+                const Vector2& point = this->positions[indices[index]];
+                C2D_DrawCircleSolid(point.x, point.y, depth, size, this->colors[indices[index]]);
+            }
+
+            break;
+        }
+        default:
+            break;
+    }
+}
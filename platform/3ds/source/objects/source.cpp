@@ -2,11 +2,14 @@
 
 using namespace love;
 
-StaticDataBuffer::StaticDataBuffer(void* data, size_t size)
+StaticDataBuffer::StaticDataBuffer(const void* data, size_t size) : size(size)
 {
     this->buffer.first  = (s16*)linearAlloc(size);
     this->buffer.second = size;
 
+    if (!this->buffer.first)
+        throw love::Exception("Not enough audio memory for %zu bytes.", size);
+
     memcpy(this->buffer.first, data, size);
 }
 
@@ -17,7 +20,8 @@ StaticDataBuffer::~StaticDataBuffer()
 
 /* SOURCE IMPLEMENTATION */
 
-Source::Source(Pool* pool, SoundData* sound) : common::Source(pool, sound)
+Source::Source(Pool* pool, SoundData* sound, StaticDataBuffer* buffer) :
+    common::Source(pool, sound, buffer)
 {
     this->sources[0]          = ndspWaveBuf();
     this->sources[0].nsamples = sound->GetSampleCount();
@@ -80,6 +84,7 @@ void Source::SetVolume(float volume)
 void Source::Reset()
 {
     ndspChnReset(this->channel);
+    this->playedSamples = 0;
 
     u16 format = NDSP_FORMAT_STEREO_PCM16;
 
@@ -106,7 +111,7 @@ void Source::Reset()
     ndspInterpType interpType = (this->channels == 2) ? NDSP_INTERP_POLYPHASE : NDSP_INTERP_LINEAR;
 
     ndspChnSetFormat(this->channel, format);
-    ndspChnSetRate(this->channel, this->sampleRate);
+    ndspChnSetRate(this->channel, this->GetChannelRate() * this->GetChannelPitch());
     ndspChnSetInterp(this->channel, interpType);
     this->SetVolume(this->GetVolume());
 }
@@ -129,7 +134,7 @@ bool Source::Update()
             {
                 if (this->sources[which].status == NDSP_WBUF_DONE)
                 {
-                    this->offsetSamples += this->sources[which].nsamples;
+                    this->playedSamples += this->sources[which].nsamples;
 
                     int decoded = this->StreamAtomic(which);
 
@@ -152,9 +157,14 @@ bool Source::Update()
     return false;
 }
 
+void Source::ApplyPitch()
+{
+    ndspChnSetRate(this->channel, this->GetChannelRate() * this->GetChannelPitch());
+}
+
 double Source::GetSampleOffset()
 {
-    return ndspChnGetSamplePos(this->channel);
+    return this->playedSamples + ndspChnGetSamplePos(this->channel);
 }
 
 void Source::PrepareAtomic()
@@ -186,7 +196,7 @@ void Source::PrepareAtomic()
 int Source::StreamAtomic(size_t which)
 {
     auto buffer = this->sources[which].data_pcm16;
-    int decoded = std::max(decoder->Decode(buffer), 0);
+    int decoded = std::max(this->DecodeStream(buffer), 0);
 
     if (decoded > 0)
         DSP_FlushDataCache(buffer, decoded);
@@ -26,7 +26,8 @@ bool Texture::SetWrap(const Wrap& wrap)
 
 void Texture::SetFilter(const Filter& filter)
 {
-    ::citro2d::Instance().SetTextureFilter(filter);
+    this->filter = filter;
+    ::citro2d::Instance().SetTextureFilter(this, filter);
 }
 
 void Texture::Draw(Graphics* gfx, love::Quad* quad, const Matrix4& localTransform)
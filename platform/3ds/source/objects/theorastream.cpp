@@ -21,19 +21,19 @@ TheoraStream::Frame::~Frame()
 
 TheoraStream::TheoraStream(File* file) : common::TheoraStream(file)
 {
-    this->frontBuffer = new Frame();
-    this->backBuffer  = new Frame();
+    for (size_t index = 0; index < FRAME_COUNT; index++)
+        this->frames.push_back(new Frame());
 
     th_info_init(&this->info);
 
     try
     {
         this->ParseHeader();
+        this->InitFrames();
     }
     catch (love::Exception& exception)
     {
-        delete this->frontBuffer;
-        delete this->backBuffer;
+        this->DeleteFrames();
 
         th_info_clear(&this->info);
 
@@ -76,19 +76,18 @@ void TheoraStream::SetupBuffers()
     int powTwoWidth  = NextPO2(calcWidth);
     int powTwoHeight = NextPO2(calcHeight);
 
-    Frame* buffers[2] = { (Frame*)this->backBuffer, (Frame*)this->frontBuffer };
-
-    for (int index = 0; index < 2; index++)
+    for (IFrame* buffer : this->frames)
     {
-        C3D_Tex* texture = buffers[index]->buffer;
+        Frame* frame     = (Frame*)buffer;
+        C3D_Tex* texture = frame->buffer;
 
         C3D_TexInit(texture, powTwoWidth, powTwoHeight, GPU_RGB8);
         C3D_TexSetFilter(texture, GPU_LINEAR, GPU_LINEAR);
 
         memset(texture->data, 0, texture->size);
 
-        buffers[index]->width  = calcWidth;
-        buffers[index]->height = calcHeight;
+        frame->width  = calcWidth;
+        frame->height = calcHeight;
     }
 }
 
@@ -103,7 +102,7 @@ void TheoraStream::SetPostProcessingLevel()
     }
 }
 
-void TheoraStream::FillBufferData(th_ycbcr_buffer bufferInfo)
+void TheoraStream::FillBufferData(IFrame* target, th_ycbcr_buffer bufferInfo)
 {
     bool isBusy = true;
 
@@ -144,13 +143,15 @@ void TheoraStream::FillBufferData(th_ycbcr_buffer bufferInfo)
     Y2RU_SetSendingV(bufferInfo[2].data, (this->width / 2) * (this->height / 2), this->width / 2,
                      bufferInfo[2].stride - (this->width >> 1));
 
+    C3D_Tex* texture = ((Frame*)target)->buffer;
+
     PixelFormat format;
-    ::citro2d::GetConstant(((Frame*)this->backBuffer)->buffer->fmt, format);
+    ::citro2d::GetConstant(texture->fmt, format);
 
     size_t formatSize = GetPixelFormatSize(format);
 
-    Y2RU_SetReceiving(((Frame*)this->backBuffer)->buffer->data,
-                      this->width * this->height * formatSize, this->width * 8 * formatSize,
+    Y2RU_SetReceiving(texture->data, this->width * this->height * formatSize,
+                      this->width * 8 * formatSize,
                       (NextPO2(this->width) - this->width) * 8 * formatSize);
 
     /* convert the data */
@@ -0,0 +1,222 @@
+#include "bench.h"
+
+#include "common/exception.h"
+#include "modules/event/event.h"
+#include "modules/filesystem/filesystem.h"
+#include "modules/timer/timer.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using namespace love;
+
+/*
+** AsyncIO's four calls, done with POSIX in a scratch directory. Each write
+** is synced before it returns, the way a save has to be on an SD card, and
+** can be made to take @cardDelay longer, for a card slower than this disk.
+*/
+namespace
+{
+    std::string root;
+
+    int cardDelay = 0; //< in milliseconds
+
+    void put(const char* filename, const void* data, int64_t size, int flags)
+    {
+        int file = open((root + filename).c_str(), O_WRONLY | O_CREAT | flags, 0644);
+
+        if (file < 0)
+            throw love::Exception("Could not open file %s.", filename);
+
+        bool written = write(file, data, size) == size;
+
+        fsync(file);
+        close(file);
+
+        if (cardDelay > 0)
+            usleep(cardDelay * 1000);
+
+        if (!written)
+            throw love::Exception("Data could not be written.");
+    }
+
+    /* never constructed, AsyncIO only needs somewhere to call */
+    Filesystem* filesystem = nullptr;
+
+    double milliseconds(int64_t start)
+    {
+        return (bench::Now() - start) / 1000000.0;
+    }
+
+    void reportSorted(const char* label, std::vector<double>& times)
+    {
+        std::sort(times.begin(), times.end());
+
+        char line[96];
+
+        snprintf(line, sizeof(line), "%s, p50", label);
+        bench::Report(line, times[times.size() / 2], "ms");
+
+        snprintf(line, sizeof(line), "%s, max", label);
+        bench::Report(line, times.back(), "ms");
+    }
+
+    void setup()
+    {
+        if (!root.empty())
+            return;
+
+        char scratch[] = "/tmp/asyncio-XXXXXX";
+
+        if (mkdtemp(scratch) == nullptr)
+            abort();
+
+        root = std::string(scratch) + "/";
+        atexit([] { std::filesystem::remove_all(root); });
+    }
+} // namespace
+
+FileData* Filesystem::Read(const char* filename, int64_t)
+{
+    int file = open((root + filename).c_str(), O_RDONLY);
+
+    if (file < 0)
+        throw love::Exception("Could not open file %s.", filename);
+
+    off_t size = lseek(file, 0, SEEK_END);
+    lseek(file, 0, SEEK_SET);
+
+    FileData* data = new FileData(size, filename);
+    bool read      = ::read(file, data->GetData(), size) == size;
+
+    close(file);
+
+    if (!read)
+    {
+        data->Release();
+        throw love::Exception("Could not read file %s.", filename);
+    }
+
+    return data;
+}
+
+void Filesystem::Write(const char* filename, const void* data, int64_t size)
+{
+    put(filename, data, size, O_TRUNC);
+}
+
+void Filesystem::Append(const char* filename, const void* data, int64_t size)
+{
+    put(filename, data, size, O_APPEND);
+}
+
+bool Filesystem::Mount(const char*, const char*, bool)
+{
+    return true;
+}
+
+void common::Event::Push(Message*)
+{}
+
+double common::Timer::GetTime()
+{
+    return bench::Now() / 1000000000.0;
+}
+
+/* a 256 KiB save, twenty times: what love.update waits for either way */
+static void saves(int delay)
+{
+    setup();
+    cardDelay = delay;
+
+    constexpr int SAVES = 20;
+    std::vector<char> save(0x40000, 'x');
+
+    std::vector<double> direct, queued;
+
+    for (int index = 0; index < SAVES; index++)
+    {
+        int64_t start = bench::Now();
+        filesystem->Write("direct.sav", save.data(), save.size());
+        direct.push_back(milliseconds(start));
+    }
+
+    StrongReference<AsyncIO> io(new AsyncIO(filesystem), Acquire::NORETAIN);
+    io->Start();
+
+    int64_t total = bench::Now();
+
+    for (int index = 0; index < SAVES; index++)
+    {
+        int64_t start = bench::Now();
+        io->Write("queued.sav", save.data(), save.size())->Release();
+        queued.push_back(milliseconds(start));
+    }
+
+    io->Flush();
+    double drained = milliseconds(total);
+
+    char label[64];
+
+    snprintf(label, sizeof(label), "+%d ms, write", delay);
+    reportSorted(label, direct);
+
+    snprintf(label, sizeof(label), "+%d ms, writeAsync", delay);
+    reportSorted(label, queued);
+
+    snprintf(label, sizeof(label), "+%d ms, writeAsync on disk", delay);
+    bench::Report(label, drained, "ms");
+
+    io->Stop();
+    cardDelay = 0;
+}
+
+BENCH(save_latency)
+{
+    saves(0);
+    saves(20);
+}
+
+/* a frame logging 1000 lines, appended one call at a time */
+BENCH(log_lines)
+{
+    setup();
+
+    constexpr int LINES = 1000;
+    char line[32];
+
+    int64_t start = bench::Now();
+
+    for (int index = 0; index < LINES; index++)
+    {
+        int length = snprintf(line, sizeof(line), "line %d\n", index);
+        filesystem->Append("direct.log", line, length);
+    }
+
+    bench::Report("append", milliseconds(start), "ms");
+
+    StrongReference<AsyncIO> io(new AsyncIO(filesystem), Acquire::NORETAIN);
+    io->Start();
+
+    start = bench::Now();
+
+    for (int index = 0; index < LINES; index++)
+    {
+        int length = snprintf(line, sizeof(line), "line %d\n", index);
+        io->Append("queued.log", line, length)->Release();
+    }
+
+    bench::Report("appendAsync, queued in", milliseconds(start), "ms");
+
+    io->Flush();
+    bench::Report("appendAsync, all on disk after", milliseconds(start), "ms");
+
+    io->Stop();
+}
@@ -0,0 +1,149 @@
+#include "bench.h"
+
+#include "modules/audio/audiocache.h"
+
+#include "../test/staticbuffer.h"
+
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+
+using namespace love;
+
+namespace
+{
+    /* 200 half-second 22050 Hz mono effects, each made into a Source five times */
+    constexpr int EFFECTS  = 200;
+    constexpr int SAMPLES  = 11025;
+    constexpr int COPIES   = 5;
+    constexpr int MODTIME  = 1;
+    constexpr size_t BYTES = SAMPLES * 2;
+
+    /*
+    ** What newSource("sfx/n.wav", "static") ends up holding. Decoding is a
+    ** copy of the samples here, as WAV is; compressed formats cost more.
+    */
+    struct Loaded
+    {
+        StrongReference<SoundData> sound;
+        StrongReference<StaticDataBuffer> buffer;
+    };
+
+    std::vector<std::vector<int16_t>> files()
+    {
+        std::vector<std::vector<int16_t>> files(EFFECTS, std::vector<int16_t>(SAMPLES));
+
+        for (int effect = 0; effect < EFFECTS; effect++)
+        {
+            for (int sample = 0; sample < SAMPLES; sample++)
+                files[effect][sample] = int16_t((sample * (effect + 1)) & 0x7FFF);
+        }
+
+        return files;
+    }
+
+    SoundData* decode(std::vector<int16_t>& file)
+    {
+        return new SoundData(file.data(), SAMPLES, 22050, 16, 1);
+    }
+
+    Loaded load(AudioCache* cache, std::vector<int16_t>& file, const std::string& path)
+    {
+        Loaded loaded;
+
+        if (cache == nullptr)
+        {
+            loaded.sound.Set(decode(file), Acquire::NORETAIN);
+            loaded.buffer.Set(new StaticDataBuffer(file.data(), BYTES), Acquire::NORETAIN);
+
+            return loaded;
+        }
+
+        SoundData* sound = cache->GetSoundData(path, MODTIME, BYTES);
+
+        if (sound == nullptr)
+        {
+            sound = decode(file);
+            cache->AddSoundData(path, MODTIME, BYTES, sound);
+        }
+
+        loaded.sound.Set(sound, Acquire::NORETAIN);
+        loaded.buffer.Set(cache->GetBuffer(sound), Acquire::NORETAIN);
+
+        return loaded;
+    }
+
+    void report(const char* label, int64_t start, size_t soundBytes)
+    {
+        char line[64];
+
+        snprintf(line, sizeof(line), "%s, load", label);
+        bench::Report(line, (bench::Now() - start) / 1e6, "ms");
+
+        snprintf(line, sizeof(line), "%s, decoded", label);
+        bench::Report(line, soundBytes / 1048576.0, "MiB");
+
+        snprintf(line, sizeof(line), "%s, buffers", label);
+        bench::Report(line, staticbuffer::bytes / 1048576.0, "MiB");
+    }
+} // namespace
+
+/* every Source kept alive, as a level that loads its effects up front */
+BENCH(sfx_200)
+{
+    auto data = files();
+
+    std::vector<std::string> paths;
+
+    for (int effect = 0; effect < EFFECTS; effect++)
+        paths.push_back("sfx/" + std::to_string(effect) + ".wav");
+
+    for (bool cached : { false, true })
+    {
+        AudioCache cache;
+        std::vector<Loaded> sources;
+
+        int64_t start = bench::Now();
+
+        for (int copy = 0; copy < COPIES; copy++)
+        {
+            for (int effect = 0; effect < EFFECTS; effect++)
+                sources.push_back(load(cached ? &cache : nullptr, data[effect], paths[effect]));
+        }
+
+        size_t soundBytes = cached ? cache.GetStats().soundBytes : sources.size() * BYTES;
+        report(cached ? "cached" : "uncached", start, soundBytes);
+    }
+}
+
+/*
+** Fire and forget under the 3DS budgets, Sources let go right after
+** playing. All 200 in turn don't fit, so this is the cache at its worst.
+*/
+BENCH(sfx_200_3ds_budget)
+{
+    auto data = files();
+
+    std::vector<std::string> paths;
+
+    for (int effect = 0; effect < EFFECTS; effect++)
+        paths.push_back("sfx/" + std::to_string(effect) + ".wav");
+
+    AudioCache cache;
+    cache.SetBudgets(0x200000, 0x200000);
+
+    int64_t start = bench::Now();
+
+    for (int copy = 0; copy < COPIES; copy++)
+    {
+        for (int effect = 0; effect < EFFECTS; effect++)
+            load(&cache, data[effect], paths[effect]);
+    }
+
+    report("2 MiB budgets", start, cache.GetStats().soundBytes);
+
+    auto stats = cache.GetStats();
+    bench::Report("2 MiB budgets", stats.hits, "hits");
+    bench::Report("2 MiB budgets", stats.evictions, "evictions");
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <vector>
+
+/*
+** The host target's benchmark runner, the counterpart of test/check.h.
+** Every BENCH linked into a program is run once by main.cpp, in the order
+** they were written, and prints its own results through Report. Numbers
+** are from whatever machine runs them, so they only mean something next
+** to each other.
+*/
+namespace love::bench
+{
+    struct Case
+    {
+        const char* name;
+        void (*function)();
+    };
+
+    std::vector<Case>& GetCases();
+
+    /* nanoseconds on a monotonic clock */
+    int64_t Now();
+
+    void Report(const char* label, double value, const char* unit);
+
+    struct Register
+    {
+        Register(const char* name, void (*function)())
+        {
+            GetCases().push_back({ name, function });
+        }
+    };
+} // namespace love::bench
+
+#define BENCH(name)                                                       \
+    static void bench_##name();                                           \
+    static love::bench::Register register_##name(#name, bench_##name);    \
+    static void bench_##name()
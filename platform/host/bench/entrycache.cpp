@@ -0,0 +1,69 @@
+#include "bench.h"
+
+#include "../test/archive.h"
+
+#include "modules/filesystem/entrycache.h"
+#include "objects/file/file.h"
+
+#include <stdio.h>
+
+using namespace love;
+
+namespace
+{
+    std::string text(size_t size)
+    {
+        std::string content;
+
+        while (content.size() < size)
+            content += "greeting_" + std::to_string(content.size() % 977) + " = \"Hello\"\n";
+
+        content.resize(size);
+
+        return content;
+    }
+
+    /* reads @filename whole @count times, in microseconds per read */
+    double read(const char* filename, int count)
+    {
+        int64_t start = bench::Now();
+
+        for (int index = 0; index < count; index++)
+        {
+            File file(filename);
+            file.Read()->Release();
+        }
+
+        return (bench::Now() - start) / 1000.0 / count;
+    }
+
+    /* the same entry with the cache off, then on */
+    void compare(const char* label, const char* filename, int count)
+    {
+        EntryCache::Instance().SetBudget(0);
+        double off = read(filename, count);
+
+        EntryCache::Instance().SetBudget(EntryCache::DEFAULT_BUDGET);
+        double on = read(filename, count);
+
+        char line[64];
+
+        snprintf(line, sizeof(line), "%s, uncached", label);
+        bench::Report(line, off, "us/read");
+
+        snprintf(line, sizeof(line), "%s, cached", label);
+        bench::Report(line, on, "us/read");
+    }
+} // namespace
+
+/* a localization table, a shader, and a track too big to keep */
+BENCH(archive_reads)
+{
+    archive::Add("lang/en.lua", text(48 * 1024));
+    archive::Add("shaders/blur.glsl", text(6 * 1024));
+    archive::Add("music.ogg", text(2 * 1024 * 1024));
+
+    compare("48 KiB entry", "lang/en.lua", 2000);
+    compare("6 KiB entry", "shaders/blur.glsl", 2000);
+    compare("2 MiB entry (streamed)", "music.ogg", 20);
+}
@@ -0,0 +1,103 @@
+#include "bench.h"
+
+#include "modules/timer/framepacer.h"
+#include "modules/timer/gcscheduler.h"
+
+#include <stdio.h>
+#include <time.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace love;
+
+namespace
+{
+    constexpr int WARMUP = 60;
+    constexpr int FRAMES = 300;
+
+    /* each update makes @count tables of strings and keeps a rolling 20000 alive */
+    constexpr const char* UPDATE = R"(
+        local live, n = {}, 0
+        function update(count)
+            for i = 1, count do
+                n = n + 1
+                live[n % 20000] = { x = i, y = n, name = "e" .. n, tags = { i, i + 1 } }
+            end
+        end
+    )";
+
+    uint64_t now()
+    {
+        return (uint64_t)bench::Now();
+    }
+
+    void sleep(int64_t nanoseconds)
+    {
+        timespec duration { (time_t)(nanoseconds / 1000000000), (long)(nanoseconds % 1000000000) };
+        nanosleep(&duration, nullptr);
+    }
+
+    /* a 60 Hz frame loop, collecting the way love.run does when there's a budget */
+    void run(int count, double budget)
+    {
+        lua_State* L = luaL_newstate();
+        luaL_openlibs(L);
+        luaL_dostring(L, UPDATE);
+
+        FramePacer pacer(now, sleep);
+        pacer.SetTargetRate(60);
+
+        GCScheduler scheduler(now);
+        scheduler.SetBudget(L, (int64_t)(budget * 1000000000));
+
+        std::vector<double> updates;
+        int peak = 0;
+
+        for (int frame = 0; frame < WARMUP + FRAMES; frame++)
+        {
+            int64_t start = bench::Now();
+
+            lua_getglobal(L, "update");
+            lua_pushinteger(L, count);
+            lua_call(L, 1, 0);
+
+            if (frame >= WARMUP)
+                updates.push_back((bench::Now() - start) / 1000000.0);
+
+            int64_t idle = pacer.GetIdleTime();
+            scheduler.Collect(L, (idle < 0) ? scheduler.GetBudget() : idle);
+
+            peak = std::max(peak, lua_gc(L, LUA_GCCOUNT, 0));
+            pacer.Wait();
+        }
+
+        std::sort(updates.begin(), updates.end());
+
+        char label[64];
+        const char* mode = (budget > 0) ? "4 ms budget" : "Lua's collector";
+
+        snprintf(label, sizeof(label), "N=%d, %s, update p99", count, mode);
+        bench::Report(label, updates[updates.size() * 99 / 100], "ms");
+
+        snprintf(label, sizeof(label), "N=%d, %s, update max", count, mode);
+        bench::Report(label, updates.back(), "ms");
+
+        snprintf(label, sizeof(label), "N=%d, %s, collect max", count, mode);
+        bench::Report(label, scheduler.GetStats().max * 1000.0, "ms");
+
+        snprintf(label, sizeof(label), "N=%d, %s, peak heap", count, mode);
+        bench::Report(label, peak / 1024.0, "MB");
+
+        lua_close(L);
+    }
+} // namespace
+
+BENCH(gc_scheduling)
+{
+    for (int count : { 200, 800 })
+    {
+        run(count, 0);
+        run(count, 0.004);
+    }
+}
@@ -0,0 +1,36 @@
+#include "bench.h"
+
+#include <stdio.h>
+#include <time.h>
+
+using namespace love;
+
+std::vector<bench::Case>& bench::GetCases()
+{
+    static std::vector<Case> cases;
+    return cases;
+}
+
+int64_t bench::Now()
+{
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (int64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+void bench::Report(const char* label, double value, const char* unit)
+{
+    printf("    %-32s %12.2f %s\n", label, value, unit);
+}
+
+int main(int, char**)
+{
+    for (const bench::Case& item : bench::GetCases())
+    {
+        printf("  %s\n", item.name);
+        item.function();
+    }
+
+    return 0;
+}
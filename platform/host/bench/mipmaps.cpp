@@ -0,0 +1,57 @@
+#include "bench.h"
+
+#include "objects/image/mipmaps.h"
+
+#include <stdio.h>
+
+#include <random>
+#include <vector>
+
+using namespace love;
+
+namespace
+{
+    constexpr int SIZE   = 1024;
+    constexpr int PASSES = 10;
+
+    /* the whole chain of a @SIZE square image, in milliseconds */
+    double chain(mipmaps::Filter filter, const std::vector<uint8_t>& pixels)
+    {
+        std::vector<std::vector<uint8_t>> levels;
+
+        int64_t start = bench::Now();
+
+        for (int pass = 0; pass < PASSES; pass++)
+            mipmaps::Generate(filter, pixels.data(), SIZE, SIZE, 100, levels);
+
+        return (bench::Now() - start) / 1000000.0 / PASSES;
+    }
+
+    /* just level 1, on this thread alone */
+    double single(mipmaps::Filter filter, const std::vector<uint8_t>& pixels)
+    {
+        std::vector<uint8_t> level((size_t)(SIZE / 2) * (SIZE / 2) * 4);
+
+        int64_t start = bench::Now();
+
+        for (int pass = 0; pass < PASSES; pass++)
+            mipmaps::Downsample(filter, pixels.data(), SIZE, SIZE, level.data(), 0, SIZE / 2);
+
+        return (bench::Now() - start) / 1000000.0 / PASSES;
+    }
+} // namespace
+
+BENCH(rgba8_1024)
+{
+    std::mt19937 random(1234);
+    std::vector<uint8_t> pixels((size_t)SIZE * SIZE * 4);
+
+    for (auto& channel : pixels)
+        channel = uint8_t(random());
+
+    bench::Report("box, whole chain", chain(mipmaps::FILTER_BOX, pixels), "ms");
+    bench::Report("box, level 1 on one thread", single(mipmaps::FILTER_BOX, pixels), "ms");
+
+    bench::Report("kaiser, whole chain", chain(mipmaps::FILTER_KAISER, pixels), "ms");
+    bench::Report("kaiser, level 1 on one thread", single(mipmaps::FILTER_KAISER, pixels), "ms");
+}
@@ -0,0 +1,176 @@
+#include "bench.h"
+
+#include "../test/sandbox.h"
+
+#include "objects/box2d/world/world.h"
+#include "objects/data/byte/bytedata.h"
+
+#include <stdio.h>
+
+#include <chrono>
+#include <thread>
+
+using namespace love;
+
+namespace
+{
+    /*
+    ** 500 circles settling in a box, a second at a time. The callbacks only
+    ** count, so what's timed is getting each contact to Lua and back. A
+    ** threaded world steps on its own, so there only the main thread's
+    ** share is timed.
+    */
+    constexpr const char* SCENE = R"(
+        function scene(buffered, threaded)
+            local physics = love.physics
+            local world   = physics.newWorld(0, 9.81 * 64, false)
+
+            local box = physics.newBody(world, 0, 0, "static")
+            physics.newFixture(box, physics.newChainShape(true, -300, -900, 300, -900, 300, 300,
+                                                          -300, 300))
+
+            local circle = physics.newCircleShape(8)
+
+            for index = 0, 499 do
+                local x = (index % 30) * 18 - 261 + (index % 3)
+                local y = 280 - math.floor(index / 30) * 18
+
+                physics.newFixture(physics.newBody(world, x, y, "dynamic"), circle)
+            end
+
+            events = 0
+
+            local function count()
+                events = events + 1
+            end
+
+            if threaded then
+                world:setThreaded(true, 1 / 60)
+            elseif buffered then
+                world:setContactBuffering(true)
+            else
+                world:setCallbacks(count, count, nil, count)
+            end
+
+            return function()
+                world:update(1 / 60)
+
+                if buffered then
+                    for index, event, a, b in world:getContactEvents() do
+                        count()
+                    end
+                end
+            end
+        end
+    )";
+
+    void run(const char* label, const char* scene, int steps, bool threaded = false)
+    {
+        lua_State* L = sandbox::Open();
+        sandbox::Run(L, SCENE);
+
+        sandbox::Run(L, scene);
+
+        int64_t elapsed = 0;
+
+        for (int index = 0; index < steps; index++)
+        {
+            int64_t start = bench::Now();
+            sandbox::Run(L, "step()");
+            elapsed += bench::Now() - start;
+
+            if (threaded)
+                std::this_thread::sleep_for(std::chrono::microseconds(16667));
+        }
+
+        char line[64];
+
+        snprintf(line, sizeof(line), "%s, per step", label);
+        bench::Report(line, elapsed / 1.0e6 / steps, "ms");
+
+        snprintf(line, sizeof(line), "%s, events", label);
+        bench::Report(line, sandbox::Get(L, "events") / steps, "per step");
+
+        lua_close(L);
+    }
+
+    /* 2,000 bodies in a grid, and every way there is to read or place them */
+    constexpr const char* SYNC = R"(
+        local physics = love.physics
+
+        world  = physics.newWorld(0, 0, false)
+        bodies = {}
+
+        for index = 1, 2000 do
+            bodies[index] = physics.newBody(world, index % 50 * 10, index / 50 * 10, "kinematic")
+        end
+
+        states = {}
+
+        function perBody()
+            for index = 1, #bodies do
+                local x, y = bodies[index]:getPosition()
+                local angle = bodies[index]:getAngle()
+            end
+        end
+
+        function perBodySet()
+            for index = 1, #bodies do
+                bodies[index]:setPosition(index, index)
+                bodies[index]:setAngle(0.5)
+            end
+        end
+
+        function toTable() world:getBodyStates(states) end
+        function fromTable() world:setTransforms(states) end
+
+        function toData() world:getBodyStates(target) end
+        function fromData() world:setTransforms(target, #bodies) end
+    )";
+
+    void sync(lua_State* L, const char* label, const char* function, int frames)
+    {
+        lua_getglobal(L, function);
+
+        int64_t start = bench::Now();
+
+        for (int frame = 0; frame < frames; frame++)
+        {
+            lua_pushvalue(L, -1);
+            lua_call(L, 0, 0);
+        }
+
+        bench::Report(label, (bench::Now() - start) / 1000.0 / frames, "us/frame");
+
+        lua_pop(L, 1);
+    }
+} // namespace
+
+BENCH(contact_events)
+{
+    run("500 bodies, callbacks", "step = scene(false)", 300);
+    run("500 bodies, buffered", "step = scene(true)", 300);
+    run("500 bodies, threaded", "step = scene(true, true)", 120, true);
+}
+
+BENCH(body_sync)
+{
+    lua_State* L = sandbox::Open();
+
+    ByteData* data = new ByteData(2000 * sizeof(World::BodyState));
+    Luax::PushType(L, data);
+    lua_setglobal(L, "target");
+    data->Release();
+
+    sandbox::Run(L, SYNC);
+
+    sync(L, "2000 bodies, getPosition and getAngle", "perBody", 200);
+    sync(L, "2000 bodies, getBodyStates to a table", "toTable", 200);
+    sync(L, "2000 bodies, getBodyStates to Data", "toData", 200);
+
+    sync(L, "2000 bodies, setPosition and setAngle", "perBodySet", 200);
+    sync(L, "2000 bodies, setTransforms from a table", "fromTable", 200);
+    sync(L, "2000 bodies, setTransforms from Data", "fromData", 200);
+
+    lua_close(L);
+}
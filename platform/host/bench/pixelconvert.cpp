@@ -0,0 +1,135 @@
+#include "bench.h"
+
+#include "common/colors.h"
+#include "common/pixelconvert.h"
+#include "common/pixelmap.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace love;
+
+namespace
+{
+    /* a 1024x1024 RGBA8 ImageData, a row at a time as MapPixels goes */
+    constexpr size_t SIZE = 1024;
+    constexpr int PASSES  = 10;
+
+    std::vector<uint8_t> image()
+    {
+        std::vector<uint8_t> pixels(SIZE * SIZE * 4);
+
+        for (size_t index = 0; index < pixels.size(); index++)
+            pixels[index] = uint8_t(index * 2654435761u >> 24);
+
+        return pixels;
+    }
+
+    void report(const char* label, int64_t start)
+    {
+        bench::Report(label, (bench::Now() - start) / 1000000.0 / PASSES, "ms");
+    }
+
+    void mapPixels(pixelmap::Operation operation, const char* label)
+    {
+        auto pixels = image();
+
+        auto toWide   = GetPixelRowConverter(PIXELFORMAT_RGBA8, PIXELFORMAT_RGBA16);
+        auto fromWide = GetPixelRowConverter(PIXELFORMAT_RGBA16, PIXELFORMAT_RGBA8);
+
+        const uint16_t value[4] = { 0xFFFF, 0x8000, 0x4000, 0xC000 };
+        std::vector<uint16_t> wide(SIZE * 4);
+
+        int64_t start = bench::Now();
+
+        for (int pass = 0; pass < PASSES; pass++)
+        {
+            for (size_t row = 0; row < SIZE; row++)
+            {
+                uint8_t* line = pixels.data() + row * SIZE * 4;
+
+                toWide(line, wide.data(), SIZE);
+                pixelmap::MapRow(operation, value, wide.data(), SIZE);
+                fromWide(wide.data(), line, SIZE);
+            }
+        }
+
+        report(label, start);
+    }
+} // namespace
+
+/* a tint through Colorf a pixel at a time, the math of a mapPixels callback without Lua */
+BENCH(map_pixels)
+{
+    auto pixels = image();
+
+    const Colorf tint(1.0f, 0.5f, 0.25f, 0.75f);
+
+    int64_t start = bench::Now();
+
+    for (int pass = 0; pass < PASSES; pass++)
+    {
+        for (size_t index = 0; index < pixels.size(); index += 4)
+        {
+            uint8_t* pixel = pixels.data() + index;
+
+            Colorf color(pixel[0] / 255.0f, pixel[1] / 255.0f, pixel[2] / 255.0f,
+                         pixel[3] / 255.0f);
+
+            color.r *= tint.r;
+            color.g *= tint.g;
+            color.b *= tint.b;
+            color.a *= tint.a;
+
+            pixel[0] = uint8_t(std::clamp(color.r, 0.0f, 1.0f) * 0xFF + 0.5f);
+            pixel[1] = uint8_t(std::clamp(color.g, 0.0f, 1.0f) * 0xFF + 0.5f);
+            pixel[2] = uint8_t(std::clamp(color.b, 0.0f, 1.0f) * 0xFF + 0.5f);
+            pixel[3] = uint8_t(std::clamp(color.a, 0.0f, 1.0f) * 0xFF + 0.5f);
+        }
+    }
+
+    report("tint, float per pixel", start);
+
+    mapPixels(pixelmap::MAP_TINT, "tint");
+    mapPixels(pixelmap::MAP_THRESHOLD, "threshold");
+    mapPixels(pixelmap::MAP_PREMULTIPLY, "premultiply");
+    mapPixels(pixelmap::MAP_GRAYSCALE, "grayscale");
+}
+
+BENCH(conversion)
+{
+    auto pixels = image();
+
+    std::vector<uint16_t> wide(SIZE * SIZE * 4);
+    std::vector<uint8_t> rgb(SIZE * SIZE * 3);
+
+    struct Case
+    {
+        const char* label;
+        PixelFormat source, destination;
+        const void* from;
+        void* to;
+    };
+
+    const Case cases[] = {
+        { "RGBA8 to RGBA16", PIXELFORMAT_RGBA8, PIXELFORMAT_RGBA16, pixels.data(), wide.data() },
+        { "RGBA16 to RGBA8", PIXELFORMAT_RGBA16, PIXELFORMAT_RGBA8, wide.data(), pixels.data() },
+        { "RGBA8 to RGB8", PIXELFORMAT_RGBA8, PIXELFORMAT_RGB8, pixels.data(), rgb.data() },
+        { "RGB8 to RGBA8", PIXELFORMAT_RGB8, PIXELFORMAT_RGBA8, rgb.data(), pixels.data() }
+    };
+
+    for (const Case& test : cases)
+    {
+        auto convert = GetPixelRowConverter(test.source, test.destination);
+
+        if (convert == nullptr)
+            continue;
+
+        int64_t start = bench::Now();
+
+        for (int pass = 0; pass < PASSES; pass++)
+            convert(test.from, test.to, SIZE * SIZE);
+
+        report(test.label, start);
+    }
+}
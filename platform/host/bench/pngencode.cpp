@@ -0,0 +1,116 @@
+#include "bench.h"
+
+#include "common/pixelconvert.h"
+#include "objects/imagedata/handlers/pnghandler.h"
+
+#include <stdio.h>
+
+#include <vector>
+
+using namespace love;
+
+namespace
+{
+    /* a 1080p RGBA8 screenshot: flat panels, gradients and some noise */
+    constexpr int WIDTH  = 1920;
+    constexpr int HEIGHT = 1080;
+    constexpr int PASSES = 5;
+
+    std::vector<uint8_t> screenshot()
+    {
+        std::vector<uint8_t> pixels(WIDTH * HEIGHT * 4);
+        uint32_t noise = 1;
+
+        for (int y = 0; y < HEIGHT; y++)
+        {
+            for (int x = 0; x < WIDTH; x++)
+            {
+                uint8_t* pixel = &pixels[(y * WIDTH + x) * 4];
+                noise          = noise * 1664525u + 1013904223u;
+
+                bool panel = (x / 240 + y / 180) % 3 == 0;
+
+                pixel[0] = panel ? 40 : uint8_t(x * 255 / WIDTH);
+                pixel[1] = panel ? 44 : uint8_t(y * 255 / HEIGHT);
+                pixel[2] = panel ? 52 : uint8_t((noise >> 24) & 0x1F) + 96;
+                pixel[3] = 0xFF;
+            }
+        }
+
+        return pixels;
+    }
+
+    void report(const char* label, int64_t start, size_t size)
+    {
+        char line[64];
+
+        bench::Report(label, (bench::Now() - start) / 1000000.0 / PASSES, "ms");
+
+        snprintf(line, sizeof(line), "%s, output", label);
+        bench::Report(line, size / 1024.0, "KiB");
+    }
+} // namespace
+
+/*
+** What an async encode costs each side: the main thread only takes the
+** snapshot, the worker deflates it in bands. The single-threaded encode
+** is what encode() blocks the main thread for.
+*/
+BENCH(encode_1080p)
+{
+    auto pixels = screenshot();
+
+    FormatHandler::DecodedImage image {};
+
+    image.format = PIXELFORMAT_RGBA8;
+    image.width  = WIDTH;
+    image.height = HEIGHT;
+    image.size   = pixels.size();
+    image.data   = pixels.data();
+
+    std::vector<uint8_t> snapshot(pixels.size());
+    auto convert = GetPixelRowConverter(PIXELFORMAT_RGBA8, PIXELFORMAT_RGBA8);
+
+    int64_t start = bench::Now();
+
+    for (int pass = 0; pass < PASSES; pass++)
+    {
+        for (int y = 0; y < HEIGHT; y++)
+            convert(&pixels[y * WIDTH * 4], &snapshot[y * WIDTH * 4], WIDTH);
+    }
+
+    bench::Report("main thread, snapshot", (bench::Now() - start) / 1000000.0 / PASSES, "ms");
+
+    PNGHandler handler;
+    size_t size = 0;
+
+    start = bench::Now();
+
+    for (int pass = 0; pass < PASSES; pass++)
+    {
+        auto encoded = handler.Encode(image, FormatHandler::ENCODED_PNG);
+        size         = encoded.size;
+
+        delete[] encoded.data;
+    }
+
+    report("libpng, one thread", start, size);
+
+    for (size_t bands = 1; bands <= 3; bands++)
+    {
+        start = bench::Now();
+
+        for (int pass = 0; pass < PASSES; pass++)
+        {
+            auto encoded = PNGHandler::EncodeBands(image, bands);
+            size         = encoded.size;
+
+            delete[] encoded.data;
+        }
+
+        char label[64];
+        snprintf(label, sizeof(label), "EncodeBands, %zu band%s", bands, bands > 1 ? "s" : "");
+
+        report(label, start, size);
+    }
+}
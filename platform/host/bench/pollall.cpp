@@ -0,0 +1,128 @@
+#include "bench.h"
+
+#include "../test/event.h"
+
+#include <stdlib.h>
+
+#include <new>
+
+using namespace love;
+
+namespace
+{
+    constexpr int FRAMES = 1000;
+
+    /* Lua allocations and resizes, and operator new, while counting */
+    bool counting       = false;
+    int64_t luaAllocs   = 0;
+    int64_t nativeAlloc = 0;
+
+    void* allocate(void*, void* pointer, size_t, size_t size)
+    {
+        if (size == 0)
+        {
+            free(pointer);
+            return nullptr;
+        }
+
+        luaAllocs += counting;
+
+        return realloc(pointer, size);
+    }
+
+    /* a stick and a finger in motion on every frame is eight and eight */
+    void queue(int events)
+    {
+        for (int index = 0; index < events; index++)
+            eventqueue::queued.push_back(eventqueue::Touch(index % 8, index * 2.0f, 0));
+    }
+
+    void run(lua_State* L, const char* label, const char* function, int events)
+    {
+        eventqueue::queued.reserve(events);
+
+        /* the first frame fills the pool */
+        for (int frame = 0; frame < FRAMES + 1; frame++)
+        {
+            queue(events);
+
+            if (frame == 1)
+            {
+                luaAllocs   = 0;
+                nativeAlloc = 0;
+                counting    = true;
+            }
+
+            lua_getglobal(L, function);
+            lua_call(L, 0, 0);
+        }
+
+        counting = false;
+
+        char line[64];
+
+        snprintf(line, sizeof(line), "%s, lua", label);
+        bench::Report(line, (double)luaAllocs / FRAMES, "allocs/frame");
+
+        snprintf(line, sizeof(line), "%s, native", label);
+        bench::Report(line, (double)nativeAlloc / FRAMES, "allocs/frame");
+    }
+} // namespace
+
+void* operator new(size_t size)
+{
+    nativeAlloc += counting;
+
+    if (void* pointer = malloc(size ? size : 1))
+        return pointer;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept
+{
+    free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+    free(pointer);
+}
+
+BENCH(pollall_allocations)
+{
+    lua_State* L = eventqueue::Open(lua_newstate(allocate, nullptr));
+
+    eventqueue::Run(L, R"(
+        function poll()
+            love.event.pump()
+            for name, a, b, c, d, e, f in love.event.poll() do end
+        end
+
+        function pollAll()
+            love.event.pump()
+            local events, count = love.event.pollAll()
+            for index = 1, count do local event = events[index] end
+        end
+    )");
+
+    run(L, "poll, 16 a frame", "poll", 16);
+    run(L, "pollAll, 16 a frame", "pollAll", 16);
+
+    /* past the pool, every event after the 64th gets a new table */
+    run(L, "pollAll, 200 a frame", "pollAll", 200);
+
+    int64_t start = bench::Now();
+
+    for (int frame = 0; frame < FRAMES; frame++)
+    {
+        queue(16);
+
+        lua_getglobal(L, "pollAll");
+        lua_call(L, 0, 0);
+    }
+
+    bench::Report("pollAll, 16 a frame", (bench::Now() - start) / (FRAMES * 16.0), "ns/event");
+
+    lua_close(L);
+}
@@ -0,0 +1,68 @@
+#include "bench.h"
+
+#include "objects/source/resampler.h"
+
+#include <stdio.h>
+
+#include <random>
+#include <vector>
+
+using namespace love;
+
+namespace
+{
+    /* ten seconds of input, fed the way Source::DecodeStream does */
+    constexpr int SECONDS = 10;
+    constexpr int CHUNK   = 1024;
+
+    const char* NAMES[Resampler::QUALITY_MAX_ENUM] = { "fast", "medium", "best" };
+
+    void run(const char* label, int channels, double inputRate, double outputRate)
+    {
+        int frames = (int)inputRate * SECONDS;
+
+        std::mt19937 random(channels);
+        std::vector<int16_t> input(frames * channels);
+
+        for (int16_t& sample : input)
+            sample = int16_t(random());
+
+        std::vector<int16_t> output(CHUNK * channels);
+
+        for (int quality = 0; quality < Resampler::QUALITY_MAX_ENUM; quality++)
+        {
+            Resampler resampler(channels, inputRate, outputRate, (Resampler::Quality)quality);
+
+            int64_t made  = 0;
+            int64_t start = bench::Now();
+
+            for (int frame = 0; frame < frames; frame += CHUNK)
+            {
+                resampler.Push(input.data() + frame * channels, std::min(CHUNK, frames - frame));
+
+                int pulled;
+
+                while ((pulled = resampler.Pull(output.data(), CHUNK)) > 0)
+                    made += pulled;
+            }
+
+            int64_t elapsed = bench::Now() - start;
+
+            char line[64];
+
+            snprintf(line, sizeof(line), "%s, %s", label, NAMES[quality]);
+            bench::Report(line, (double)elapsed / made, "ns/frame");
+
+            /* of one core, to keep up with playback */
+            snprintf(line, sizeof(line), "%s, %s, cpu", label, NAMES[quality]);
+            bench::Report(line, elapsed / (SECONDS * 1e9) * 100.0, "%");
+        }
+    }
+} // namespace
+
+BENCH(resample)
+{
+    run("44.1k stereo", 2, 44100, 48000);
+    run("22.05k mono", 1, 22050, 48000);
+    run("48k stereo to 3DS", 2, 48000, 32728.5);
+}
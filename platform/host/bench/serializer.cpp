@@ -0,0 +1,126 @@
+#include "bench.h"
+
+#include "modules/data/serializer.h"
+
+using namespace love;
+
+namespace
+{
+    /* a save file's worth of entities, in the shape games tend to keep them */
+    constexpr const char* MAKE_SAVE = R"(
+        local entities = {}
+        for i = 1, 60000 do
+            entities[i] = {
+                id = i, kind = (i % 3 == 0) and "enemy" or "prop",
+                x = i * 1.5, y = i * 0.25, hp = i % 100, alive = i % 7 ~= 0,
+                tags = { "a", "b", "c" }, stats = { str = i % 20, dex = i % 13 }
+            }
+        end
+        return { version = 3, name = "slot1", entities = entities }
+    )";
+
+    /* what a game would write without love.data.serialize */
+    constexpr const char* LUA_WRITER = R"(
+        local save = ...
+        local out, n = {}, 0
+        local function put(s) n = n + 1; out[n] = s end
+        local function write(value)
+            local kind = type(value)
+            if kind == "table" then
+                put("{")
+                for k, v in pairs(value) do
+                    put("["); write(k); put("]="); write(v); put(",")
+                end
+                put("}")
+            elseif kind == "string" then
+                put(string.format("%q", value))
+            else
+                put(tostring(value))
+            end
+        end
+        write(save)
+        return "return " .. table.concat(out)
+    )";
+
+    double kilobytes(lua_State* L)
+    {
+        return lua_gc(L, LUA_GCCOUNT, 0) + lua_gc(L, LUA_GCCOUNTB, 0) / 1024.0;
+    }
+
+    /* runs @function with the collector stopped, reporting its time and garbage */
+    template<typename F>
+    void measure(lua_State* L, const char* label, F function)
+    {
+        lua_gc(L, LUA_GCCOLLECT, 0);
+        lua_gc(L, LUA_GCSTOP, 0);
+
+        double before = kilobytes(L);
+        int64_t start = bench::Now();
+
+        function();
+
+        int64_t elapsed = bench::Now() - start;
+        double garbage  = kilobytes(L) - before;
+
+        lua_gc(L, LUA_GCRESTART, 0);
+
+        char name[64];
+
+        snprintf(name, sizeof(name), "%s, time", label);
+        bench::Report(name, elapsed / 1000000.0, "ms");
+
+        snprintf(name, sizeof(name), "%s, Lua heap", label);
+        bench::Report(name, garbage / 1024.0, "MB");
+    }
+} // namespace
+
+BENCH(save_table)
+{
+    lua_State* L = luaL_newstate();
+    luaL_openlibs(L);
+
+    luaL_dostring(L, MAKE_SAVE);
+    int save = lua_gettop(L);
+
+    size_t sourceSize = 0;
+
+    measure(L, "lua writer", [&]() {
+        luaL_loadstring(L, LUA_WRITER);
+        lua_pushvalue(L, save);
+        lua_call(L, 1, 1);
+    });
+
+    const char* source = lua_tolstring(L, -1, &sourceSize);
+
+    measure(L, "loadstring", [&]() {
+        luaL_loadbuffer(L, source, sourceSize, "save");
+        lua_call(L, 0, 1);
+    });
+
+    lua_settop(L, save);
+
+    ByteData* data = nullptr;
+
+    measure(L, "serialize", [&]() { data = data::_Serialize(L, save); });
+
+    measure(L, "deserialize", [&]() {
+        data::_Deserialize(L, (const char*)data->GetData(), data->GetSize());
+    });
+
+    lua_settop(L, save);
+
+    ByteData* compressed = nullptr;
+
+    measure(L, "serialize + zlib", [&]() {
+        compressed = data::_Serialize(L, save, Compressor::FORMAT_ZLIB);
+    });
+
+    bench::Report("lua source", sourceSize / 1048576.0, "MB");
+    bench::Report("serialized", data->GetSize() / 1048576.0, "MB");
+    bench::Report("serialized + zlib", compressed->GetSize() / 1048576.0, "MB");
+
+    data->Release();
+    compressed->Release();
+
+    lua_close(L);
+}
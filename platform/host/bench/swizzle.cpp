@@ -0,0 +1,122 @@
+#include "bench.h"
+
+#include "common/colors.h"
+#include "common/swizzle.h"
+
+#include <stdio.h>
+
+#include <algorithm>
+
+#include <vector>
+
+using namespace love;
+
+namespace
+{
+    /* a 3DS-sized upload: 1024x1024, RGBA8 */
+    constexpr unsigned SIZE = 1024;
+    constexpr int PASSES    = 20;
+
+    void report(const char* label, int64_t start)
+    {
+        double milliseconds = (bench::Now() - start) / 1000000.0 / PASSES;
+        bench::Report(label, milliseconds, "ms");
+    }
+
+    /*
+    ** ImageData's 3DS RGBA8 accessors, as Image::ReplacePixels called them
+    ** through their function pointers before CopyTiled: a float round trip
+    ** per pixel.
+    */
+    void getPixelRGBA8(const uint32_t* pixel, Colorf& color)
+    {
+        color.r = ((*pixel & 0xFF000000) >> 0x18) / 255.0f;
+        color.g = ((*pixel & 0x00FF0000) >> 0x10) / 255.0f;
+        color.b = ((*pixel & 0x0000FF00) >> 0x08) / 255.0f;
+        color.a = ((*pixel & 0x000000FF) >> 0x00) / 255.0f;
+    }
+
+    void setPixelRGBA8(const Colorf& color, uint32_t* pixel)
+    {
+        uint8_t r = uint8_t(0xFF * std::clamp(color.r, 0.0f, 1.0f) + 0.5f);
+        uint8_t g = uint8_t(0xFF * std::clamp(color.g, 0.0f, 1.0f) + 0.5f);
+        uint8_t b = uint8_t(0xFF * std::clamp(color.b, 0.0f, 1.0f) + 0.5f);
+        uint8_t a = uint8_t(0xFF * std::clamp(color.a, 0.0f, 1.0f) + 0.5f);
+
+        *pixel = (a | (b << uint32_t(0x08)) | (g << uint32_t(0x10)) | (r << uint32_t(0x18)));
+    }
+
+    /* looked up at run time in ImageData, so not inlined here either */
+    void (*volatile getFunction)(const uint32_t*, Colorf&)  = getPixelRGBA8;
+    void (*volatile setFunction)(const Colorf&, uint32_t*) = setPixelRGBA8;
+
+    void replacePixels(const uint32_t* src, unsigned srcWidth, uint32_t* dst, unsigned dstWidth,
+                       unsigned width, unsigned height)
+    {
+        auto get = getFunction;
+        auto set = setFunction;
+
+        for (unsigned y = 0; y < height; y++)
+        {
+            for (unsigned x = 0; x < width; x++)
+            {
+                unsigned srcIndex = swizzle::GetTiledIndex(srcWidth, x, y);
+                unsigned dstIndex = swizzle::GetTiledIndex(dstWidth, x, y);
+
+                Colorf color {};
+
+                get(src + srcIndex, color);
+                set(color, dst + dstIndex);
+            }
+        }
+    }
+} // namespace
+
+BENCH(full_texture)
+{
+    std::vector<uint32_t> linear(SIZE * SIZE);
+    std::vector<uint32_t> tiled(SIZE * SIZE);
+    std::vector<uint32_t> copy(SIZE * SIZE);
+
+    for (size_t index = 0; index < linear.size(); index++)
+        linear[index] = uint32_t(index * 2654435761u);
+
+    /* tiled to tiled, the way ReplacePixels did it before */
+    int64_t start = bench::Now();
+
+    for (int pass = 0; pass < PASSES; pass++)
+        replacePixels(linear.data(), SIZE, copy.data(), SIZE, SIZE, SIZE);
+
+    report("old float get/set per pixel", start);
+
+    start = bench::Now();
+
+    for (int pass = 0; pass < PASSES; pass++)
+        swizzle::LinearToTiled(linear.data(), SIZE * 4, tiled.data(), SIZE, 0, 0, SIZE, SIZE, 4);
+
+    report("LinearToTiled", start);
+
+    start = bench::Now();
+
+    for (int pass = 0; pass < PASSES; pass++)
+        swizzle::TiledToLinear(tiled.data(), SIZE, 0, 0, linear.data(), SIZE * 4, SIZE, SIZE, 4);
+
+    report("TiledToLinear", start);
+
+    start = bench::Now();
+
+    for (int pass = 0; pass < PASSES; pass++)
+        swizzle::CopyTiled(tiled.data(), SIZE, 0, 0, copy.data(), SIZE, 0, 0, SIZE, SIZE, 4);
+
+    report("CopyTiled, aligned", start);
+
+    start = bench::Now();
+
+    for (int pass = 0; pass < PASSES; pass++)
+    {
+        swizzle::CopyTiled(tiled.data(), SIZE, 3, 5, copy.data(), SIZE, 0, 0, SIZE - 8, SIZE - 8,
+                           4);
+    }
+
+    report("CopyTiled, unaligned", start);
+}
@@ -0,0 +1,105 @@
+#include "bench.h"
+
+#include "../test/threadpool.h"
+
+#include <stdio.h>
+
+#include <vector>
+
+using namespace love;
+
+namespace
+{
+    constexpr int JOBS = 20000;
+
+    /* a Thread's lifetime for every job, the way a game does without a pool */
+    constexpr int THREAD_JOBS = 500;
+    constexpr int BATCH       = 4;
+
+    const char* JOB = "local a, b = ... return a + b";
+
+    /* what LuaThread::ThreadFunction does, less the channel and error plumbing */
+    class OneJob : public Threadable
+    {
+      public:
+        OneJob(Data* code, float a, float b) : code(code), a(a), b(b)
+        {
+            this->threadName = "one job";
+        }
+
+        void ThreadFunction() override
+        {
+            lua_State* L = LuaThread::NewState();
+
+            luaL_loadbuffer(L, (const char*)this->code->GetData(), this->code->GetSize(), "job");
+
+            lua_pushnumber(L, this->a);
+            lua_pushnumber(L, this->b);
+            lua_pcall(L, 2, 1, 0);
+
+            this->result = (float)lua_tonumber(L, -1);
+
+            lua_close(L);
+        }
+
+        Data* code;
+        float a, b;
+        float result = 0;
+    };
+
+    void pool(int workers)
+    {
+        auto code = threadpool::Code("return function(a, b) return a + b end");
+        ThreadPool pool("bench", code.Get(), workers);
+
+        std::vector<StrongReference<Future>> futures;
+        futures.reserve(JOBS);
+
+        int64_t start = bench::Now();
+
+        for (int index = 0; index < JOBS; index++)
+        {
+            Future* future = pool.Submit({ Variant((float)index), Variant(1.0f) });
+            futures.emplace_back(future, Acquire::NORETAIN);
+        }
+
+        for (auto& future : futures)
+            future->Wait();
+
+        double seconds = (bench::Now() - start) / 1e9;
+
+        char line[64];
+        snprintf(line, sizeof(line), "pool, %d worker%s", workers, workers > 1 ? "s" : "");
+
+        bench::Report(line, JOBS / seconds, "jobs/s");
+    }
+} // namespace
+
+BENCH(threadpool_jobs)
+{
+    pool(1);
+    pool(2);
+    pool(4);
+
+    auto code = threadpool::Code(JOB);
+
+    int64_t start = bench::Now();
+
+    for (int index = 0; index < THREAD_JOBS; index += BATCH)
+    {
+        std::vector<StrongReference<OneJob>> jobs;
+
+        for (int job = 0; job < BATCH; job++)
+        {
+            jobs.emplace_back(new OneJob(code.Get(), (float)(index + job), 1), Acquire::NORETAIN);
+            jobs.back()->Start();
+        }
+
+        for (auto& job : jobs)
+            job->Wait();
+    }
+
+    double seconds = (bench::Now() - start) / 1e9;
+
+    bench::Report("thread per job, 4 at a time", THREAD_JOBS / seconds, "jobs/s");
+}
@@ -0,0 +1,268 @@
+#include "bench.h"
+
+#include "common/tlsf.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <random>
+#include <vector>
+
+using namespace love;
+
+namespace
+{
+    /* the Switch AudioPool's size and AUDREN_BUFFER_ALIGNMENT */
+    constexpr size_t POOL_SIZE = 0x1000000;
+    constexpr size_t ALIGNMENT = 0x40;
+
+    constexpr int OPERATIONS = 200000;
+
+    /*
+    ** The allocator AudioPool had before TLSF: a first-fit walk over a
+    ** list of free blocks in address order, which frees walk again to
+    ** find their place and merge. As it was, minus the Switch types.
+    */
+    class ListPool
+    {
+      public:
+        struct Block
+        {
+            Block* prev;
+            Block* next;
+
+            uint8_t* base;
+            size_t size;
+        };
+
+        ~ListPool()
+        {
+            for (Block *block = this->first, *next = nullptr; block != nullptr; block = next)
+            {
+                next = block->next;
+                free(block);
+            }
+        }
+
+        void Init(void* base, size_t size)
+        {
+            this->AddBlock(Create((uint8_t*)base, size));
+        }
+
+        void* Allocate(size_t size, size_t& allocated)
+        {
+            size_t alignMask = ALIGNMENT - 1;
+            size             = (size + alignMask) & ~alignMask;
+
+            for (Block* block = this->first; block != nullptr; block = block->next)
+            {
+                uint8_t* address = block->base;
+                size_t waste     = (size_t)address & alignMask;
+
+                if (waste > 0)
+                    waste = alignMask + 1 - waste;
+
+                if (waste > block->size || block->size - waste < size)
+                    continue;
+
+                address += waste;
+                allocated = size;
+
+                size_t blockSize = block->size - waste;
+
+                if (waste == 0)
+                {
+                    block->base += size;
+                    block->size -= size;
+
+                    if (block->size == 0)
+                        this->DeleteBlock(block);
+                }
+                else
+                {
+                    block->size = waste;
+
+                    if (blockSize > size)
+                        this->InsertAfter(block, Create(address + size, blockSize - size));
+                }
+
+                return address;
+            }
+
+            return nullptr;
+        }
+
+        void Free(void* pointer, size_t size)
+        {
+            uint8_t* address = (uint8_t*)pointer;
+
+            for (Block* block = this->first; block != nullptr; block = block->next)
+            {
+                if (block->base > address)
+                {
+                    if (address + size == block->base)
+                    {
+                        block->base = address;
+                        block->size += size;
+                    }
+                    else
+                        this->InsertBefore(block, Create(address, size));
+
+                    return;
+                }
+                else if (block->base + block->size == address)
+                {
+                    block->size += size;
+                    this->CoalesceRight(block);
+
+                    return;
+                }
+            }
+
+            this->AddBlock(Create(address, size));
+        }
+
+      private:
+        Block* first = nullptr;
+        Block* last  = nullptr;
+
+        static Block* Create(uint8_t* base, size_t size)
+        {
+            Block* block = (Block*)malloc(sizeof(Block));
+            *block       = Block { nullptr, nullptr, base, size };
+
+            return block;
+        }
+
+        void AddBlock(Block* block)
+        {
+            block->prev = this->last;
+
+            if (this->last != nullptr)
+                this->last->next = block;
+
+            if (this->first == nullptr)
+                this->first = block;
+
+            this->last = block;
+        }
+
+        void DeleteBlock(Block* block)
+        {
+            (block->prev ? block->prev->next : this->first) = block->next;
+            (block->next ? block->next->prev : this->last)  = block->prev;
+
+            free(block);
+        }
+
+        void InsertBefore(Block* block, Block* inserted)
+        {
+            (block->prev ? block->prev->next : this->first) = inserted;
+
+            inserted->prev = block->prev;
+            inserted->next = block;
+            block->prev    = inserted;
+        }
+
+        void InsertAfter(Block* block, Block* inserted)
+        {
+            (block->next ? block->next->prev : this->last) = inserted;
+
+            inserted->next = block->next;
+            inserted->prev = block;
+            block->next    = inserted;
+        }
+
+        void CoalesceRight(Block* block)
+        {
+            while (block->next != nullptr && block->next->base == block->base + block->size)
+            {
+                block->size += block->next->size;
+                this->DeleteBlock(block->next);
+            }
+        }
+    };
+
+    struct TLSFPool
+    {
+        TLSF tlsf;
+
+        void Init(void* base, size_t size)
+        {
+            this->tlsf.Init(base, size, ALIGNMENT);
+        }
+
+        void* Allocate(size_t size, size_t& allocated)
+        {
+            return this->tlsf.Allocate(size, allocated);
+        }
+
+        void Free(void* address, size_t)
+        {
+            this->tlsf.Free(address);
+        }
+    };
+
+    struct Live
+    {
+        void* address;
+        size_t size;
+    };
+
+    /* random 1-17 KiB allocations and frees, keeping at most @maxLive around */
+    template<typename Pool>
+    void churn(const char* name, size_t maxLive)
+    {
+        std::vector<uint8_t> memory(POOL_SIZE);
+
+        Pool pool;
+        pool.Init(memory.data(), memory.size());
+
+        std::mt19937 random(1234);
+        std::vector<Live> live;
+
+        int failed    = 0;
+        int64_t start = bench::Now();
+
+        for (int operation = 0; operation < OPERATIONS; operation++)
+        {
+            if (!live.empty() && (live.size() >= maxLive || random() % 2 == 0))
+            {
+                size_t index = random() % live.size();
+                pool.Free(live[index].address, live[index].size);
+
+                live[index] = live.back();
+                live.pop_back();
+
+                continue;
+            }
+
+            size_t allocated = 0;
+            void* address    = pool.Allocate(0x400 + random() % 0x4000, allocated);
+
+            if (address == nullptr)
+                failed++;
+            else
+                live.push_back({ address, allocated });
+        }
+
+        int64_t elapsed = bench::Now() - start;
+
+        char label[64];
+
+        snprintf(label, sizeof(label), "%s, live <= %zu", name, maxLive);
+        bench::Report(label, (double)elapsed / OPERATIONS, "ns/op");
+
+        snprintf(label, sizeof(label), "%s, live <= %zu, failed", name, maxLive);
+        bench::Report(label, failed, "allocations");
+    }
+} // namespace
+
+BENCH(tlsf_churn)
+{
+    for (size_t maxLive : { 50, 600, 1200, 1800 })
+    {
+        churn<ListPool>("list", maxLive);
+        churn<TLSFPool>("TLSF", maxLive);
+    }
+}
@@ -0,0 +1,122 @@
+#include "bench.h"
+
+#include "objects/compressedimagedata/transcoder.h"
+
+#include <string.h>
+
+#include <random>
+#include <vector>
+
+using namespace love;
+
+namespace
+{
+    /* a 1024x1024 texture, random blocks reach every ETC2 mode */
+    constexpr int SIZE   = 1024;
+    constexpr int BLOCKS = (SIZE / 4) * (SIZE / 4);
+    constexpr int PASSES = 5;
+
+    std::vector<uint8_t> blocks(PixelFormat format)
+    {
+        std::mt19937 random(35);
+        std::vector<uint8_t> data(BLOCKS * transcoder::GetBlockBytes(format));
+
+        for (auto& byte : data)
+            byte = uint8_t(random());
+
+        return data;
+    }
+
+    void report(const char* label, int64_t start, double count, const char* unit)
+    {
+        double seconds = (bench::Now() - start) / 1e9 / PASSES;
+        bench::Report(label, count / seconds / 1e6, unit);
+    }
+} // namespace
+
+BENCH(decode_block)
+{
+    const struct
+    {
+        const char* label;
+        PixelFormat format;
+    } formats[] = {
+        { "ETC1", PIXELFORMAT_ETC1 },          { "ETC2 RGB", PIXELFORMAT_ETC2_RGB },
+        { "ETC2 RGBA", PIXELFORMAT_ETC2_RGBA }, { "ETC2 RGBA1", PIXELFORMAT_ETC2_RGBA1 },
+        { "DXT1", PIXELFORMAT_DXT1 },          { "DXT3", PIXELFORMAT_DXT3 },
+        { "DXT5", PIXELFORMAT_DXT5 }
+    };
+
+    uint8_t pixels[16 * 4];
+
+    for (const auto& entry : formats)
+    {
+        auto data    = blocks(entry.format);
+        size_t bytes = transcoder::GetBlockBytes(entry.format);
+
+        int64_t start = bench::Now();
+
+        for (int pass = 0; pass < PASSES; pass++)
+        {
+            for (int block = 0; block < BLOCKS; block++)
+                transcoder::DecodeBlock(entry.format, &data[block * bytes], pixels);
+        }
+
+        report(entry.label, start, BLOCKS * 16.0, "Mpixel/s");
+    }
+}
+
+BENCH(encode_etc1)
+{
+    auto data = blocks(PIXELFORMAT_DXT5);
+    std::vector<uint8_t> pixels(BLOCKS * 16 * 4);
+
+    for (int block = 0; block < BLOCKS; block++)
+        transcoder::DecodeBlock(PIXELFORMAT_DXT5, &data[block * 16], &pixels[block * 64]);
+
+    std::vector<uint64_t> encoded(BLOCKS);
+    int64_t start = bench::Now();
+
+    for (int pass = 0; pass < PASSES; pass++)
+    {
+        for (int block = 0; block < BLOCKS; block++)
+            encoded[block] = transcoder::EncodeETC1(&pixels[block * 64]);
+    }
+
+    report("from DXT5 pixels", start, BLOCKS * 16.0, "Mpixel/s");
+}
+
+/* a whole texture, against the memcpy a cached load comes down to */
+BENCH(transcode_1024)
+{
+    const struct
+    {
+        const char* label;
+        PixelFormat format;
+    } formats[] = { { "ETC1, repacked", PIXELFORMAT_ETC1 },
+                    { "DXT1, to ETC1", PIXELFORMAT_DXT1 },
+                    { "DXT5, to ETC1A4", PIXELFORMAT_DXT5 } };
+
+    for (const auto& entry : formats)
+    {
+        auto data = blocks(entry.format);
+
+        PixelFormat tiled = transcoder::GetTiledFormat(entry.format, data.data(), data.size());
+        std::vector<uint8_t> output(transcoder::GetTiledSize(tiled, SIZE, SIZE));
+
+        int64_t start = bench::Now();
+
+        for (int pass = 0; pass < PASSES; pass++)
+            transcoder::Transcode(entry.format, data.data(), SIZE, SIZE, tiled, output.data());
+
+        bench::Report(entry.label, (bench::Now() - start) / 1e6 / PASSES, "ms");
+
+        std::vector<uint8_t> cached(output.size());
+        start = bench::Now();
+
+        for (int pass = 0; pass < PASSES; pass++)
+            memcpy(cached.data(), output.data(), output.size());
+
+        bench::Report("  cached, memcpy", (bench::Now() - start) / 1e6 / PASSES, "ms");
+    }
+}
@@ -0,0 +1,8 @@
+const unsigned char wrap_event_lua[] = {
+  0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6c, 0x6f, 0x76,
+  0x65, 0x2e, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 0x70, 0x6f, 0x6c, 0x6c,
+  0x28, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+  0x6e, 0x20, 0x6c, 0x6f, 0x76, 0x65, 0x2e, 0x65, 0x76, 0x65, 0x6e, 0x74,
+  0x2e, 0x70, 0x6f, 0x6c, 0x6c, 0x5f, 0x69, 0x0a, 0x65, 0x6e, 0x64, 0x0a
+};
+const unsigned int wrap_event_lua_size = 60;
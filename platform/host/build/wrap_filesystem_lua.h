@@ -0,0 +1,118 @@
+const unsigned char wrap_filesystem_lua[] = {
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x6c, 0x6f, 0x76, 0x65, 0x5f, 0x66,
+  0x69, 0x6c, 0x65, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x20, 0x3d, 0x20,
+  0x2e, 0x2e, 0x2e, 0x0a, 0x0a, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x74,
+  0x79, 0x70, 0x65, 0x2c, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x2c,
+  0x20, 0x75, 0x6e, 0x70, 0x61, 0x63, 0x6b, 0x20, 0x3d, 0x20, 0x74, 0x79,
+  0x70, 0x65, 0x2c, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x2c, 0x20,
+  0x75, 0x6e, 0x70, 0x61, 0x63, 0x6b, 0x0a, 0x0a, 0x2d, 0x2d, 0x20, 0x43,
+  0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b, 0x73, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x73, 0x79, 0x6e, 0x63, 0x20, 0x66,
+  0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2c, 0x20, 0x6b, 0x65,
+  0x79, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68,
+  0x61, 0x6e, 0x64, 0x6c, 0x65, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x72,
+  0x65, 0x74, 0x75, 0x72, 0x6e, 0x65, 0x64, 0x2e, 0x20, 0x54, 0x68, 0x65,
+  0x0a, 0x2d, 0x2d, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x20, 0x63,
+  0x6f, 0x6d, 0x65, 0x73, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x74, 0x68,
+  0x72, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x22, 0x69,
+  0x6f, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 0x65, 0x22, 0x20, 0x65,
+  0x76, 0x65, 0x6e, 0x74, 0x2c, 0x20, 0x73, 0x65, 0x65, 0x20, 0x6c, 0x6f,
+  0x76, 0x65, 0x2e, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x73, 0x2e,
+  0x0a, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x62,
+  0x61, 0x63, 0x6b, 0x73, 0x20, 0x3d, 0x20, 0x7b, 0x7d, 0x0a, 0x0a, 0x2d,
+  0x2d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61,
+  0x63, 0x6b, 0x2c, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65,
+  0x20, 0x69, 0x73, 0x20, 0x6f, 0x6e, 0x65, 0x2c, 0x20, 0x69, 0x73, 0x20,
+  0x61, 0x6c, 0x77, 0x61, 0x79, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c,
+  0x61, 0x73, 0x74, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+  0x0a, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x71, 0x75, 0x65, 0x75, 0x65, 0x28, 0x66, 0x75,
+  0x6e, 0x63, 0x2c, 0x20, 0x2e, 0x2e, 0x2e, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x61, 0x72, 0x67, 0x73, 0x20,
+  0x3d, 0x20, 0x7b, 0x2e, 0x2e, 0x2e, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20,
+  0x3d, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x28, 0x22, 0x23, 0x22,
+  0x2c, 0x20, 0x2e, 0x2e, 0x2e, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63,
+  0x6b, 0x20, 0x3d, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5b, 0x63, 0x6f, 0x75,
+  0x6e, 0x74, 0x5d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+  0x74, 0x79, 0x70, 0x65, 0x28, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63,
+  0x6b, 0x29, 0x20, 0x3d, 0x3d, 0x20, 0x22, 0x66, 0x75, 0x6e, 0x63, 0x74,
+  0x69, 0x6f, 0x6e, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5b, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x5d, 0x20, 0x3d, 0x20, 0x6e, 0x69, 0x6c, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x20, 0x3d, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x2d, 0x20,
+  0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x62,
+  0x61, 0x63, 0x6b, 0x20, 0x3d, 0x20, 0x6e, 0x69, 0x6c, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x65, 0x6e, 0x64, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x20, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x20,
+  0x3d, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x28, 0x75, 0x6e, 0x70, 0x61, 0x63,
+  0x6b, 0x28, 0x61, 0x72, 0x67, 0x73, 0x2c, 0x20, 0x31, 0x2c, 0x20, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63,
+  0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b, 0x73, 0x5b, 0x68, 0x61, 0x6e,
+  0x64, 0x6c, 0x65, 0x5d, 0x20, 0x3d, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x62,
+  0x61, 0x63, 0x6b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74,
+  0x75, 0x72, 0x6e, 0x20, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x0a, 0x65,
+  0x6e, 0x64, 0x0a, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+  0x20, 0x6c, 0x6f, 0x76, 0x65, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x79,
+  0x73, 0x74, 0x65, 0x6d, 0x2e, 0x72, 0x65, 0x61, 0x64, 0x41, 0x73, 0x79,
+  0x6e, 0x63, 0x28, 0x2e, 0x2e, 0x2e, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x71, 0x75, 0x65, 0x75, 0x65,
+  0x28, 0x6c, 0x6f, 0x76, 0x65, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x79,
+  0x73, 0x74, 0x65, 0x6d, 0x2e, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x41, 0x73,
+  0x79, 0x6e, 0x63, 0x2c, 0x20, 0x2e, 0x2e, 0x2e, 0x29, 0x0a, 0x65, 0x6e,
+  0x64, 0x0a, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x6c, 0x6f, 0x76, 0x65, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x79, 0x73,
+  0x74, 0x65, 0x6d, 0x2e, 0x77, 0x72, 0x69, 0x74, 0x65, 0x41, 0x73, 0x79,
+  0x6e, 0x63, 0x28, 0x2e, 0x2e, 0x2e, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x71, 0x75, 0x65, 0x75, 0x65,
+  0x28, 0x6c, 0x6f, 0x76, 0x65, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x79,
+  0x73, 0x74, 0x65, 0x6d, 0x2e, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x65, 0x41,
+  0x73, 0x79, 0x6e, 0x63, 0x2c, 0x20, 0x2e, 0x2e, 0x2e, 0x29, 0x0a, 0x65,
+  0x6e, 0x64, 0x0a, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+  0x20, 0x6c, 0x6f, 0x76, 0x65, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x79,
+  0x73, 0x74, 0x65, 0x6d, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x41,
+  0x73, 0x79, 0x6e, 0x63, 0x28, 0x2e, 0x2e, 0x2e, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x71, 0x75, 0x65,
+  0x75, 0x65, 0x28, 0x6c, 0x6f, 0x76, 0x65, 0x5f, 0x66, 0x69, 0x6c, 0x65,
+  0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x2e, 0x5f, 0x61, 0x70, 0x70, 0x65,
+  0x6e, 0x64, 0x41, 0x73, 0x79, 0x6e, 0x63, 0x2c, 0x20, 0x2e, 0x2e, 0x2e,
+  0x29, 0x0a, 0x65, 0x6e, 0x64, 0x0a, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x6c, 0x6f, 0x76, 0x65, 0x5f, 0x66, 0x69, 0x6c,
+  0x65, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x2e, 0x6d, 0x6f, 0x75, 0x6e,
+  0x74, 0x41, 0x73, 0x79, 0x6e, 0x63, 0x28, 0x2e, 0x2e, 0x2e, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x71,
+  0x75, 0x65, 0x75, 0x65, 0x28, 0x6c, 0x6f, 0x76, 0x65, 0x5f, 0x66, 0x69,
+  0x6c, 0x65, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x2e, 0x5f, 0x6d, 0x6f,
+  0x75, 0x6e, 0x74, 0x41, 0x73, 0x79, 0x6e, 0x63, 0x2c, 0x20, 0x2e, 0x2e,
+  0x2e, 0x29, 0x0a, 0x65, 0x6e, 0x64, 0x0a, 0x0a, 0x66, 0x75, 0x6e, 0x63,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6c, 0x6f, 0x76, 0x65, 0x5f, 0x66, 0x69,
+  0x6c, 0x65, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x2e, 0x5f, 0x69, 0x6f,
+  0x43, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 0x65, 0x28, 0x68, 0x61, 0x6e,
+  0x64, 0x6c, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63,
+  0x61, 0x6c, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b, 0x20,
+  0x3d, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b, 0x73, 0x5b,
+  0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x5d, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x69, 0x66, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b,
+  0x20, 0x3d, 0x3d, 0x20, 0x6e, 0x69, 0x6c, 0x20, 0x74, 0x68, 0x65, 0x6e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74,
+  0x75, 0x72, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6e, 0x64, 0x0a,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63,
+  0x6b, 0x73, 0x5b, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x5d, 0x20, 0x3d,
+  0x20, 0x6e, 0x69, 0x6c, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x20, 0x65, 0x72, 0x72, 0x20, 0x3d, 0x20, 0x68, 0x61,
+  0x6e, 0x64, 0x6c, 0x65, 0x3a, 0x67, 0x65, 0x74, 0x45, 0x72, 0x72, 0x6f,
+  0x72, 0x28, 0x29, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+  0x65, 0x72, 0x72, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
+  0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b, 0x28, 0x6e, 0x69, 0x6c,
+  0x2c, 0x20, 0x65, 0x72, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x65,
+  0x6e, 0x64, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75,
+  0x72, 0x6e, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b, 0x28,
+  0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x3a, 0x67, 0x65, 0x74, 0x52, 0x65,
+  0x73, 0x75, 0x6c, 0x74, 0x73, 0x28, 0x29, 0x29, 0x0a, 0x65, 0x6e, 0x64,
+  0x0a
+};
+const unsigned int wrap_filesystem_lua_size = 1369;
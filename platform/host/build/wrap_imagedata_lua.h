@@ -0,0 +1,242 @@
+const unsigned char wrap_imagedata_lua[] = {
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x49, 0x6d, 0x61, 0x67, 0x65, 0x44,
+  0x61, 0x74, 0x61, 0x5f, 0x6d, 0x74, 0x20, 0x3d, 0x20, 0x2e, 0x2e, 0x2e,
+  0x0a, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x49, 0x6d, 0x61, 0x67, 0x65,
+  0x44, 0x61, 0x74, 0x61, 0x20, 0x3d, 0x20, 0x49, 0x6d, 0x61, 0x67, 0x65,
+  0x44, 0x61, 0x74, 0x61, 0x5f, 0x6d, 0x74, 0x2e, 0x5f, 0x5f, 0x69, 0x6e,
+  0x64, 0x65, 0x78, 0x0a, 0x0a, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x74,
+  0x6f, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x2c, 0x20, 0x61, 0x73, 0x73,
+  0x65, 0x72, 0x74, 0x2c, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x3d,
+  0x20, 0x74, 0x6f, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x2c, 0x20, 0x61,
+  0x73, 0x73, 0x65, 0x72, 0x74, 0x2c, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72,
+  0x0a, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x74, 0x79, 0x70, 0x65, 0x2c,
+  0x20, 0x70, 0x63, 0x61, 0x6c, 0x6c, 0x20, 0x3d, 0x20, 0x74, 0x79, 0x70,
+  0x65, 0x2c, 0x20, 0x70, 0x63, 0x61, 0x6c, 0x6c, 0x0a, 0x6c, 0x6f, 0x63,
+  0x61, 0x6c, 0x20, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x20, 0x3d, 0x20, 0x6d,
+  0x61, 0x74, 0x68, 0x2e, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x0a, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x20, 0x6d, 0x69, 0x6e, 0x2c, 0x20, 0x6d, 0x61, 0x78,
+  0x20, 0x3d, 0x20, 0x6d, 0x61, 0x74, 0x68, 0x2e, 0x6d, 0x69, 0x6e, 0x2c,
+  0x20, 0x6d, 0x61, 0x74, 0x68, 0x2e, 0x6d, 0x61, 0x78, 0x0a, 0x0a, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x69, 0x6e, 0x73, 0x69, 0x64, 0x65, 0x28, 0x78, 0x2c, 0x20,
+  0x79, 0x2c, 0x20, 0x77, 0x2c, 0x20, 0x68, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x78, 0x20, 0x3e, 0x3d,
+  0x20, 0x30, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x78, 0x20, 0x3c, 0x20, 0x77,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x79, 0x20, 0x3e, 0x3d, 0x20, 0x30, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x79, 0x20, 0x3c, 0x20, 0x68, 0x0a, 0x65, 0x6e,
+  0x64, 0x0a, 0x0a, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x66, 0x75, 0x6e,
+  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63, 0x6c, 0x61, 0x6d, 0x70, 0x30,
+  0x31, 0x28, 0x78, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74,
+  0x75, 0x72, 0x6e, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x6d, 0x61, 0x78, 0x28,
+  0x78, 0x2c, 0x20, 0x30, 0x29, 0x2c, 0x20, 0x31, 0x29, 0x0a, 0x65, 0x6e,
+  0x64, 0x0a, 0x0a, 0x2d, 0x2d, 0x20, 0x49, 0x6d, 0x70, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x2d, 0x73,
+  0x61, 0x66, 0x65, 0x20, 0x49, 0x6d, 0x61, 0x67, 0x65, 0x44, 0x61, 0x74,
+  0x61, 0x3a, 0x6d, 0x61, 0x70, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x20, 0x72,
+  0x65, 0x67, 0x61, 0x72, 0x64, 0x6c, 0x65, 0x73, 0x73, 0x20, 0x6f, 0x66,
+  0x20, 0x77, 0x68, 0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x46, 0x46, 0x49, 0x20, 0x69, 0x73, 0x0a, 0x2d, 0x2d, 0x20, 0x75,
+  0x73, 0x65, 0x64, 0x20, 0x6f, 0x72, 0x20, 0x6e, 0x6f, 0x74, 0x2e, 0x0a,
+  0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x49, 0x6d, 0x61,
+  0x67, 0x65, 0x44, 0x61, 0x74, 0x61, 0x3a, 0x6d, 0x61, 0x70, 0x50, 0x69,
+  0x78, 0x65, 0x6c, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x2c, 0x20, 0x69, 0x78,
+  0x2c, 0x20, 0x69, 0x79, 0x2c, 0x20, 0x69, 0x77, 0x2c, 0x20, 0x69, 0x68,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20,
+  0x69, 0x64, 0x77, 0x2c, 0x20, 0x69, 0x64, 0x68, 0x20, 0x3d, 0x20, 0x73,
+  0x65, 0x6c, 0x66, 0x3a, 0x67, 0x65, 0x74, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+  0x73, 0x69, 0x6f, 0x6e, 0x73, 0x28, 0x29, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x69, 0x78, 0x20, 0x3d, 0x20, 0x69, 0x78, 0x20, 0x6f, 0x72, 0x20,
+  0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x79, 0x20, 0x3d, 0x20, 0x69,
+  0x79, 0x20, 0x6f, 0x72, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
+  0x77, 0x20, 0x3d, 0x20, 0x69, 0x77, 0x20, 0x6f, 0x72, 0x20, 0x69, 0x64,
+  0x77, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x68, 0x20, 0x3d, 0x20, 0x69,
+  0x68, 0x20, 0x6f, 0x72, 0x20, 0x69, 0x64, 0x68, 0x0a, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x69, 0x78,
+  0x29, 0x20, 0x7e, 0x3d, 0x20, 0x22, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72,
+  0x22, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72,
+  0x28, 0x22, 0x62, 0x61, 0x64, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
+  0x6e, 0x74, 0x20, 0x23, 0x32, 0x20, 0x74, 0x6f, 0x20, 0x49, 0x6d, 0x61,
+  0x67, 0x65, 0x44, 0x61, 0x74, 0x61, 0x3a, 0x6d, 0x61, 0x70, 0x50, 0x69,
+  0x78, 0x65, 0x6c, 0x20, 0x28, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65,
+  0x64, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x29, 0x22, 0x2c, 0x20,
+  0x32, 0x29, 0x20, 0x65, 0x6e, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
+  0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x69, 0x79, 0x29, 0x20, 0x7e,
+  0x3d, 0x20, 0x22, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x22, 0x20, 0x74,
+  0x68, 0x65, 0x6e, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x22, 0x62,
+  0x61, 0x64, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x23, 0x33, 0x20, 0x74, 0x6f, 0x20, 0x49, 0x6d, 0x61, 0x67, 0x65, 0x44,
+  0x61, 0x74, 0x61, 0x3a, 0x6d, 0x61, 0x70, 0x50, 0x69, 0x78, 0x65, 0x6c,
+  0x20, 0x28, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x6e,
+  0x75, 0x6d, 0x62, 0x65, 0x72, 0x29, 0x22, 0x2c, 0x20, 0x32, 0x29, 0x20,
+  0x65, 0x6e, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74,
+  0x79, 0x70, 0x65, 0x28, 0x69, 0x77, 0x29, 0x20, 0x7e, 0x3d, 0x20, 0x22,
+  0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6e,
+  0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x22, 0x62, 0x61, 0x64, 0x20,
+  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x23, 0x34, 0x20,
+  0x74, 0x6f, 0x20, 0x49, 0x6d, 0x61, 0x67, 0x65, 0x44, 0x61, 0x74, 0x61,
+  0x3a, 0x6d, 0x61, 0x70, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x20, 0x28, 0x65,
+  0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x6e, 0x75, 0x6d, 0x62,
+  0x65, 0x72, 0x29, 0x22, 0x2c, 0x20, 0x32, 0x29, 0x20, 0x65, 0x6e, 0x64,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65,
+  0x28, 0x69, 0x68, 0x29, 0x20, 0x7e, 0x3d, 0x20, 0x22, 0x6e, 0x75, 0x6d,
+  0x62, 0x65, 0x72, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x65, 0x72,
+  0x72, 0x6f, 0x72, 0x28, 0x22, 0x62, 0x61, 0x64, 0x20, 0x61, 0x72, 0x67,
+  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x23, 0x35, 0x20, 0x74, 0x6f, 0x20,
+  0x49, 0x6d, 0x61, 0x67, 0x65, 0x44, 0x61, 0x74, 0x61, 0x3a, 0x6d, 0x61,
+  0x70, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x20, 0x28, 0x65, 0x78, 0x70, 0x65,
+  0x63, 0x74, 0x65, 0x64, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x29,
+  0x22, 0x2c, 0x20, 0x32, 0x29, 0x20, 0x65, 0x6e, 0x64, 0x0a, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x66,
+  0x75, 0x6e, 0x63, 0x29, 0x20, 0x7e, 0x3d, 0x20, 0x22, 0x66, 0x75, 0x6e,
+  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20,
+  0x65, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x22, 0x62, 0x61, 0x64, 0x20, 0x61,
+  0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x23, 0x31, 0x20, 0x74,
+  0x6f, 0x20, 0x49, 0x6d, 0x61, 0x67, 0x65, 0x44, 0x61, 0x74, 0x61, 0x3a,
+  0x6d, 0x61, 0x70, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x20, 0x28, 0x65, 0x78,
+  0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74,
+  0x69, 0x6f, 0x6e, 0x29, 0x22, 0x2c, 0x20, 0x32, 0x29, 0x20, 0x65, 0x6e,
+  0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6e, 0x6f, 0x74,
+  0x20, 0x28, 0x69, 0x6e, 0x73, 0x69, 0x64, 0x65, 0x28, 0x69, 0x78, 0x2c,
+  0x20, 0x69, 0x79, 0x2c, 0x20, 0x69, 0x64, 0x77, 0x2c, 0x20, 0x69, 0x64,
+  0x68, 0x29, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x6e, 0x73, 0x69, 0x64,
+  0x65, 0x28, 0x69, 0x78, 0x20, 0x2b, 0x20, 0x69, 0x77, 0x20, 0x2d, 0x20,
+  0x31, 0x2c, 0x20, 0x69, 0x79, 0x20, 0x2b, 0x20, 0x69, 0x68, 0x20, 0x2d,
+  0x20, 0x31, 0x2c, 0x20, 0x69, 0x64, 0x77, 0x2c, 0x20, 0x69, 0x64, 0x68,
+  0x29, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x65, 0x72, 0x72, 0x6f,
+  0x72, 0x28, 0x22, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x72,
+  0x65, 0x63, 0x74, 0x61, 0x6e, 0x67, 0x6c, 0x65, 0x20, 0x64, 0x69, 0x6d,
+  0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x22, 0x2c, 0x20, 0x32, 0x29,
+  0x20, 0x65, 0x6e, 0x64, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d,
+  0x20, 0x70, 0x65, 0x72, 0x66, 0x6f, 0x72, 0x6d, 0x41, 0x74, 0x6f, 0x6d,
+  0x69, 0x63, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6d, 0x61, 0x70, 0x50, 0x69,
+  0x78, 0x65, 0x6c, 0x55, 0x6e, 0x73, 0x61, 0x66, 0x65, 0x20, 0x68, 0x61,
+  0x76, 0x65, 0x20, 0x4c, 0x75, 0x61, 0x2d, 0x43, 0x20, 0x41, 0x50, 0x49,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x46, 0x46, 0x49, 0x20, 0x76, 0x65, 0x72,
+  0x73, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73,
+  0x65, 0x6c, 0x66, 0x3a, 0x5f, 0x70, 0x65, 0x72, 0x66, 0x6f, 0x72, 0x6d,
+  0x41, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x28, 0x73, 0x65, 0x6c, 0x66, 0x2e,
+  0x5f, 0x6d, 0x61, 0x70, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x55, 0x6e, 0x73,
+  0x61, 0x66, 0x65, 0x2c, 0x20, 0x73, 0x65, 0x6c, 0x66, 0x2c, 0x20, 0x66,
+  0x75, 0x6e, 0x63, 0x2c, 0x20, 0x69, 0x78, 0x2c, 0x20, 0x69, 0x79, 0x2c,
+  0x20, 0x69, 0x77, 0x2c, 0x20, 0x69, 0x68, 0x29, 0x0a, 0x65, 0x6e, 0x64,
+  0x0a, 0x0a, 0x2d, 0x2d, 0x20, 0x43, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63,
+  0x6b, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x6e,
+  0x61, 0x6d, 0x65, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x49, 0x6d, 0x61,
+  0x67, 0x65, 0x44, 0x61, 0x74, 0x61, 0x3a, 0x65, 0x6e, 0x63, 0x6f, 0x64,
+  0x65, 0x41, 0x73, 0x79, 0x6e, 0x63, 0x2c, 0x20, 0x6b, 0x65, 0x79, 0x65,
+  0x64, 0x20, 0x62, 0x79, 0x20, 0x6a, 0x6f, 0x62, 0x20, 0x69, 0x64, 0x2e,
+  0x20, 0x54, 0x68, 0x65, 0x0a, 0x2d, 0x2d, 0x20, 0x72, 0x65, 0x73, 0x75,
+  0x6c, 0x74, 0x20, 0x63, 0x6f, 0x6d, 0x65, 0x73, 0x20, 0x62, 0x61, 0x63,
+  0x6b, 0x20, 0x74, 0x68, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x22, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x65, 0x64, 0x22, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2c, 0x20,
+  0x73, 0x65, 0x65, 0x20, 0x6c, 0x6f, 0x76, 0x65, 0x2e, 0x68, 0x61, 0x6e,
+  0x64, 0x6c, 0x65, 0x72, 0x73, 0x2e, 0x0a, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x4a, 0x6f, 0x62, 0x73, 0x20,
+  0x3d, 0x20, 0x7b, 0x7d, 0x0a, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x6c,
+  0x61, 0x73, 0x74, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x49, 0x64, 0x20,
+  0x3d, 0x20, 0x30, 0x0a, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x49, 0x6d, 0x61, 0x67, 0x65, 0x44, 0x61, 0x74, 0x61, 0x3a,
+  0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x41, 0x73, 0x79, 0x6e, 0x63, 0x28,
+  0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2c, 0x20, 0x66, 0x69, 0x6c, 0x65,
+  0x6e, 0x61, 0x6d, 0x65, 0x2c, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61,
+  0x63, 0x6b, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74,
+  0x79, 0x70, 0x65, 0x28, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65,
+  0x29, 0x20, 0x3d, 0x3d, 0x20, 0x22, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
+  0x6f, 0x6e, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d,
+  0x65, 0x2c, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b, 0x20,
+  0x3d, 0x20, 0x6e, 0x69, 0x6c, 0x2c, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x6e,
+  0x61, 0x6d, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6e, 0x64, 0x0a,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x63, 0x61, 0x6c, 0x6c,
+  0x62, 0x61, 0x63, 0x6b, 0x20, 0x7e, 0x3d, 0x20, 0x6e, 0x69, 0x6c, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x63, 0x61, 0x6c,
+  0x6c, 0x62, 0x61, 0x63, 0x6b, 0x29, 0x20, 0x7e, 0x3d, 0x20, 0x22, 0x66,
+  0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x20, 0x74, 0x68, 0x65,
+  0x6e, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x22, 0x62, 0x61, 0x64,
+  0x20, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x23, 0x33,
+  0x20, 0x74, 0x6f, 0x20, 0x49, 0x6d, 0x61, 0x67, 0x65, 0x44, 0x61, 0x74,
+  0x61, 0x3a, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x41, 0x73, 0x79, 0x6e,
+  0x63, 0x20, 0x28, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20,
+  0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x29, 0x22, 0x2c, 0x20,
+  0x32, 0x29, 0x20, 0x65, 0x6e, 0x64, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x6c, 0x61, 0x73, 0x74, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x49, 0x64,
+  0x20, 0x3d, 0x20, 0x6c, 0x61, 0x73, 0x74, 0x45, 0x6e, 0x63, 0x6f, 0x64,
+  0x65, 0x49, 0x64, 0x20, 0x2b, 0x20, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x73, 0x65, 0x6c, 0x66, 0x3a, 0x5f, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65,
+  0x41, 0x73, 0x79, 0x6e, 0x63, 0x28, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74,
+  0x2c, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x2c, 0x20,
+  0x6c, 0x61, 0x73, 0x74, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x49, 0x64,
+  0x29, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64,
+  0x65, 0x4a, 0x6f, 0x62, 0x73, 0x5b, 0x6c, 0x61, 0x73, 0x74, 0x45, 0x6e,
+  0x63, 0x6f, 0x64, 0x65, 0x49, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x7b, 0x20,
+  0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x3d, 0x20, 0x63,
+  0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b, 0x2c, 0x20, 0x66, 0x69, 0x6c,
+  0x65, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x66, 0x69, 0x6c, 0x65,
+  0x6e, 0x61, 0x6d, 0x65, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6c, 0x61, 0x73, 0x74, 0x45,
+  0x6e, 0x63, 0x6f, 0x64, 0x65, 0x49, 0x64, 0x0a, 0x65, 0x6e, 0x64, 0x0a,
+  0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x49, 0x6d,
+  0x61, 0x67, 0x65, 0x44, 0x61, 0x74, 0x61, 0x3a, 0x5f, 0x65, 0x6e, 0x63,
+  0x6f, 0x64, 0x65, 0x46, 0x69, 0x6e, 0x69, 0x73, 0x68, 0x65, 0x64, 0x28,
+  0x69, 0x64, 0x2c, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x64, 0x61, 0x74, 0x61,
+  0x2c, 0x20, 0x65, 0x72, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x20, 0x6a, 0x6f, 0x62, 0x20, 0x3d, 0x20, 0x65,
+  0x6e, 0x63, 0x6f, 0x64, 0x65, 0x4a, 0x6f, 0x62, 0x73, 0x5b, 0x69, 0x64,
+  0x5d, 0x20, 0x6f, 0x72, 0x20, 0x7b, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x4a, 0x6f, 0x62, 0x73, 0x5b, 0x69,
+  0x64, 0x5d, 0x20, 0x3d, 0x20, 0x6e, 0x69, 0x6c, 0x0a, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x2d, 0x2d, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6e,
+  0x20, 0x68, 0x65, 0x72, 0x65, 0x2c, 0x20, 0x73, 0x69, 0x6e, 0x63, 0x65,
+  0x20, 0x6c, 0x6f, 0x76, 0x65, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x79,
+  0x73, 0x74, 0x65, 0x6d, 0x20, 0x69, 0x73, 0x6e, 0x27, 0x74, 0x20, 0x73,
+  0x61, 0x66, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x75, 0x73, 0x65, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x65, 0x72, 0x27, 0x73, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x66, 0x69, 0x6c, 0x65,
+  0x64, 0x61, 0x74, 0x61, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6a, 0x6f, 0x62,
+  0x2e, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x74, 0x68,
+  0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69,
+  0x66, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x6c, 0x6f, 0x76, 0x65, 0x2e, 0x66,
+  0x69, 0x6c, 0x65, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x20, 0x74, 0x68,
+  0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x64, 0x61, 0x74, 0x61, 0x2c,
+  0x20, 0x65, 0x72, 0x72, 0x20, 0x3d, 0x20, 0x6e, 0x69, 0x6c, 0x2c, 0x20,
+  0x22, 0x6c, 0x6f, 0x76, 0x65, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x79,
+  0x73, 0x74, 0x65, 0x6d, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65,
+  0x20, 0x6c, 0x6f, 0x61, 0x64, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x6f,
+  0x72, 0x64, 0x65, 0x72, 0x20, 0x74, 0x6f, 0x20, 0x77, 0x72, 0x69, 0x74,
+  0x65, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x64, 0x20, 0x49, 0x6d,
+  0x61, 0x67, 0x65, 0x44, 0x61, 0x74, 0x61, 0x2e, 0x22, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73,
+  0x2c, 0x20, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x20, 0x3d, 0x20,
+  0x6c, 0x6f, 0x76, 0x65, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x79, 0x73,
+  0x74, 0x65, 0x6d, 0x2e, 0x77, 0x72, 0x69, 0x74, 0x65, 0x28, 0x6a, 0x6f,
+  0x62, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x2c, 0x20,
+  0x66, 0x69, 0x6c, 0x65, 0x64, 0x61, 0x74, 0x61, 0x29, 0x0a, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69,
+  0x66, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73,
+  0x73, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66,
+  0x69, 0x6c, 0x65, 0x64, 0x61, 0x74, 0x61, 0x2c, 0x20, 0x65, 0x72, 0x72,
+  0x20, 0x3d, 0x20, 0x6e, 0x69, 0x6c, 0x2c, 0x20, 0x6d, 0x65, 0x73, 0x73,
+  0x61, 0x67, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x65, 0x6e, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x65, 0x6e, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x65, 0x6e, 0x64, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63,
+  0x61, 0x6c, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b, 0x20,
+  0x3d, 0x20, 0x6a, 0x6f, 0x62, 0x2e, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61,
+  0x63, 0x6b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x63,
+  0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x74, 0x68, 0x65, 0x6e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74,
+  0x75, 0x72, 0x6e, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b,
+  0x28, 0x66, 0x69, 0x6c, 0x65, 0x64, 0x61, 0x74, 0x61, 0x2c, 0x20, 0x65,
+  0x72, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65,
+  0x69, 0x66, 0x20, 0x65, 0x72, 0x72, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6f,
+  0x72, 0x28, 0x65, 0x72, 0x72, 0x2c, 0x20, 0x30, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x65, 0x6e, 0x64, 0x0a, 0x65, 0x6e, 0x64, 0x0a
+};
+const unsigned int wrap_imagedata_lua_size = 2866;
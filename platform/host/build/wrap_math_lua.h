@@ -0,0 +1,117 @@
+const unsigned char wrap_math_lua[] = {
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x6c, 0x6f, 0x76, 0x65, 0x5f, 0x6d,
+  0x61, 0x74, 0x68, 0x20, 0x3d, 0x20, 0x2e, 0x2e, 0x2e, 0x0a, 0x0a, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x20, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x20, 0x3d,
+  0x20, 0x6d, 0x61, 0x74, 0x68, 0x2e, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x0a,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x6d, 0x69, 0x6e, 0x2c, 0x20, 0x6d,
+  0x61, 0x78, 0x20, 0x3d, 0x20, 0x6d, 0x61, 0x74, 0x68, 0x2e, 0x6d, 0x69,
+  0x6e, 0x2c, 0x20, 0x6d, 0x61, 0x74, 0x68, 0x2e, 0x6d, 0x61, 0x78, 0x0a,
+  0x0a, 0x2d, 0x2d, 0x20, 0x20, 0x52, 0x41, 0x4e, 0x44, 0x4f, 0x4d, 0x20,
+  0x47, 0x45, 0x4e, 0x45, 0x52, 0x41, 0x54, 0x4f, 0x52, 0x20, 0x2d, 0x2d,
+  0x0a, 0x0a, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x72, 0x6e, 0x67, 0x20,
+  0x3d, 0x20, 0x6c, 0x6f, 0x76, 0x65, 0x5f, 0x6d, 0x61, 0x74, 0x68, 0x2e,
+  0x5f, 0x67, 0x65, 0x74, 0x52, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x47, 0x65,
+  0x6e, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x28, 0x29, 0x0a, 0x0a, 0x66,
+  0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6c, 0x6f, 0x76, 0x65,
+  0x5f, 0x6d, 0x61, 0x74, 0x68, 0x2e, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d,
+  0x28, 0x6c, 0x6f, 0x77, 0x2c, 0x20, 0x68, 0x69, 0x67, 0x68, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x72,
+  0x6e, 0x67, 0x3a, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x28, 0x6c, 0x6f,
+  0x77, 0x2c, 0x20, 0x68, 0x69, 0x67, 0x68, 0x29, 0x0a, 0x65, 0x6e, 0x64,
+  0x0a, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6c,
+  0x6f, 0x76, 0x65, 0x5f, 0x6d, 0x61, 0x74, 0x68, 0x2e, 0x72, 0x61, 0x6e,
+  0x64, 0x6f, 0x6d, 0x4e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x28, 0x73, 0x74,
+  0x64, 0x64, 0x65, 0x76, 0x2c, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x72,
+  0x6e, 0x67, 0x3a, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x4e, 0x6f, 0x72,
+  0x6d, 0x61, 0x6c, 0x28, 0x73, 0x74, 0x64, 0x64, 0x65, 0x76, 0x2c, 0x20,
+  0x6d, 0x65, 0x61, 0x6e, 0x29, 0x0a, 0x65, 0x6e, 0x64, 0x0a, 0x0a, 0x66,
+  0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6c, 0x6f, 0x76, 0x65,
+  0x5f, 0x6d, 0x61, 0x74, 0x68, 0x2e, 0x73, 0x65, 0x74, 0x52, 0x61, 0x6e,
+  0x64, 0x6f, 0x6d, 0x53, 0x65, 0x65, 0x64, 0x28, 0x6c, 0x6f, 0x77, 0x2c,
+  0x20, 0x68, 0x69, 0x67, 0x68, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72,
+  0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x6e, 0x67, 0x3a, 0x73, 0x65,
+  0x74, 0x53, 0x65, 0x65, 0x64, 0x28, 0x6c, 0x6f, 0x77, 0x2c, 0x20, 0x68,
+  0x69, 0x67, 0x68, 0x29, 0x0a, 0x65, 0x6e, 0x64, 0x0a, 0x0a, 0x66, 0x75,
+  0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6c, 0x6f, 0x76, 0x65, 0x5f,
+  0x6d, 0x61, 0x74, 0x68, 0x2e, 0x67, 0x65, 0x74, 0x52, 0x61, 0x6e, 0x64,
+  0x6f, 0x6d, 0x53, 0x65, 0x65, 0x64, 0x28, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x6e, 0x67, 0x3a,
+  0x67, 0x65, 0x74, 0x53, 0x65, 0x65, 0x64, 0x28, 0x29, 0x0a, 0x65, 0x6e,
+  0x64, 0x0a, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x6c, 0x6f, 0x76, 0x65, 0x5f, 0x6d, 0x61, 0x74, 0x68, 0x2e, 0x73, 0x65,
+  0x74, 0x52, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x53, 0x74, 0x61, 0x74, 0x65,
+  0x28, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x6e, 0x67, 0x3a, 0x73,
+  0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x65, 0x28, 0x73, 0x74, 0x61, 0x74,
+  0x65, 0x29, 0x0a, 0x65, 0x6e, 0x64, 0x0a, 0x0a, 0x66, 0x75, 0x6e, 0x63,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6c, 0x6f, 0x76, 0x65, 0x5f, 0x6d, 0x61,
+  0x74, 0x68, 0x2e, 0x67, 0x65, 0x74, 0x52, 0x61, 0x6e, 0x64, 0x6f, 0x6d,
+  0x53, 0x74, 0x61, 0x74, 0x65, 0x28, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x6e, 0x67, 0x3a, 0x67,
+  0x65, 0x74, 0x53, 0x74, 0x61, 0x74, 0x65, 0x28, 0x29, 0x0a, 0x65, 0x6e,
+  0x64, 0x0a, 0x0a, 0x2d, 0x2d, 0x20, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x20,
+  0x54, 0x4f, 0x20, 0x2f, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x42, 0x59,
+  0x54, 0x45, 0x53, 0x20, 0x2d, 0x2d, 0x0a, 0x0a, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63,
+  0x6c, 0x61, 0x6d, 0x70, 0x30, 0x31, 0x28, 0x78, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6d, 0x69, 0x6e,
+  0x28, 0x6d, 0x61, 0x78, 0x28, 0x78, 0x2c, 0x20, 0x30, 0x29, 0x2c, 0x20,
+  0x31, 0x29, 0x0a, 0x65, 0x6e, 0x64, 0x0a, 0x0a, 0x66, 0x75, 0x6e, 0x63,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6c, 0x6f, 0x76, 0x65, 0x5f, 0x6d, 0x61,
+  0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x54, 0x6f, 0x42, 0x79,
+  0x74, 0x65, 0x73, 0x28, 0x72, 0x2c, 0x20, 0x67, 0x2c, 0x20, 0x62, 0x2c,
+  0x20, 0x61, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74,
+  0x79, 0x70, 0x65, 0x28, 0x72, 0x29, 0x20, 0x3d, 0x3d, 0x20, 0x22, 0x74,
+  0x61, 0x62, 0x6c, 0x65, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x2c, 0x20, 0x67, 0x2c,
+  0x20, 0x62, 0x2c, 0x20, 0x61, 0x20, 0x3d, 0x20, 0x72, 0x5b, 0x31, 0x5d,
+  0x2c, 0x20, 0x72, 0x5b, 0x32, 0x5d, 0x2c, 0x20, 0x72, 0x5b, 0x33, 0x5d,
+  0x2c, 0x20, 0x72, 0x5b, 0x34, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x65,
+  0x6e, 0x64, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x20, 0x3d, 0x20,
+  0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x28, 0x63, 0x6c, 0x61, 0x6d, 0x70, 0x30,
+  0x31, 0x28, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x35, 0x35, 0x20, 0x2b,
+  0x20, 0x30, 0x2e, 0x35, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x67, 0x20,
+  0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x28, 0x63, 0x6c, 0x61, 0x6d,
+  0x70, 0x30, 0x31, 0x28, 0x67, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x35, 0x35,
+  0x20, 0x2b, 0x20, 0x30, 0x2e, 0x35, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x62, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x28, 0x63, 0x6c,
+  0x61, 0x6d, 0x70, 0x30, 0x31, 0x28, 0x62, 0x29, 0x20, 0x2a, 0x20, 0x32,
+  0x35, 0x35, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x35, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x61, 0x20, 0x3d, 0x20, 0x28, 0x61, 0x20, 0x7e, 0x3d, 0x20,
+  0x6e, 0x69, 0x6c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x66, 0x6c, 0x6f, 0x6f,
+  0x72, 0x28, 0x63, 0x6c, 0x61, 0x6d, 0x70, 0x30, 0x31, 0x28, 0x61, 0x29,
+  0x20, 0x2a, 0x20, 0x32, 0x35, 0x35, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x35,
+  0x29, 0x29, 0x20, 0x6f, 0x72, 0x20, 0x6e, 0x69, 0x6c, 0x0a, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x2c,
+  0x20, 0x67, 0x2c, 0x20, 0x62, 0x2c, 0x20, 0x61, 0x0a, 0x65, 0x6e, 0x64,
+  0x0a, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6c,
+  0x6f, 0x76, 0x65, 0x5f, 0x6d, 0x61, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x46, 0x72, 0x6f, 0x6d, 0x42, 0x79, 0x74, 0x65, 0x73, 0x28,
+  0x72, 0x2c, 0x20, 0x67, 0x2c, 0x20, 0x62, 0x2c, 0x20, 0x61, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28,
+  0x72, 0x29, 0x20, 0x3d, 0x3d, 0x20, 0x22, 0x74, 0x61, 0x62, 0x6c, 0x65,
+  0x22, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x72, 0x2c, 0x20, 0x67, 0x2c, 0x20, 0x62, 0x2c, 0x20,
+  0x61, 0x20, 0x3d, 0x20, 0x72, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x72, 0x5b,
+  0x32, 0x5d, 0x2c, 0x20, 0x72, 0x5b, 0x33, 0x5d, 0x2c, 0x20, 0x72, 0x5b,
+  0x34, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6e, 0x64, 0x0a, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x72, 0x20, 0x3d, 0x20, 0x63, 0x6c, 0x61, 0x6d,
+  0x70, 0x30, 0x31, 0x28, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x28, 0x72, 0x20,
+  0x2b, 0x20, 0x30, 0x2e, 0x35, 0x29, 0x20, 0x2f, 0x20, 0x32, 0x35, 0x35,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x67, 0x20, 0x3d, 0x20, 0x63, 0x6c,
+  0x61, 0x6d, 0x70, 0x30, 0x31, 0x28, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x28,
+  0x67, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x35, 0x29, 0x20, 0x2f, 0x20, 0x32,
+  0x35, 0x35, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x20, 0x3d, 0x20,
+  0x63, 0x6c, 0x61, 0x6d, 0x70, 0x30, 0x31, 0x28, 0x66, 0x6c, 0x6f, 0x6f,
+  0x72, 0x28, 0x62, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x35, 0x29, 0x20, 0x2f,
+  0x20, 0x32, 0x35, 0x35, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x61, 0x20,
+  0x3d, 0x20, 0x28, 0x61, 0x20, 0x7e, 0x3d, 0x20, 0x6e, 0x69, 0x6c, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x63, 0x6c, 0x61, 0x6d, 0x70, 0x30, 0x31, 0x28,
+  0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x28, 0x61, 0x20, 0x2b, 0x20, 0x30, 0x2e,
+  0x35, 0x29, 0x20, 0x2f, 0x20, 0x32, 0x35, 0x35, 0x29, 0x29, 0x20, 0x6f,
+  0x72, 0x20, 0x6e, 0x69, 0x6c, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72,
+  0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x2c, 0x20, 0x67, 0x2c, 0x20,
+  0x62, 0x2c, 0x20, 0x61, 0x0a, 0x65, 0x6e, 0x64, 0x0a
+};
+const unsigned int wrap_math_lua_size = 1365;
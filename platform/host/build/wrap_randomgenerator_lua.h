@@ -0,0 +1,72 @@
+const unsigned char wrap_randomgenerator_lua[] = {
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x72, 0x6e, 0x67, 0x5f, 0x6d, 0x74,
+  0x20, 0x3d, 0x20, 0x2e, 0x2e, 0x2e, 0x0a, 0x0a, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x20, 0x52, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x47, 0x65, 0x6e, 0x65,
+  0x72, 0x61, 0x74, 0x6f, 0x72, 0x20, 0x3d, 0x20, 0x72, 0x6e, 0x67, 0x5f,
+  0x6d, 0x74, 0x2e, 0x5f, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x0a, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x20, 0x5f, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d,
+  0x20, 0x3d, 0x20, 0x52, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x47, 0x65, 0x6e,
+  0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x2e, 0x5f, 0x72, 0x61, 0x6e, 0x64,
+  0x6f, 0x6d, 0x0a, 0x0a, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x74, 0x79,
+  0x70, 0x65, 0x2c, 0x20, 0x74, 0x6f, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72,
+  0x2c, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x3d, 0x20, 0x74, 0x79,
+  0x70, 0x65, 0x2c, 0x20, 0x74, 0x6f, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72,
+  0x2c, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x0a, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x20, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x20, 0x3d, 0x20, 0x6d, 0x61,
+  0x74, 0x68, 0x2e, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x0a, 0x0a, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+  0x20, 0x67, 0x65, 0x74, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x28, 0x72,
+  0x2c, 0x20, 0x6c, 0x2c, 0x20, 0x75, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x69, 0x66, 0x20, 0x75, 0x20, 0x7e, 0x3d, 0x20, 0x6e, 0x69, 0x6c, 0x20,
+  0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x72, 0x29, 0x20,
+  0x7e, 0x3d, 0x20, 0x22, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x22, 0x20,
+  0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x22,
+  0x62, 0x61, 0x64, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x23, 0x31, 0x20, 0x74, 0x6f, 0x20, 0x27, 0x72, 0x61, 0x6e, 0x64,
+  0x6f, 0x6d, 0x27, 0x20, 0x28, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20,
+  0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x29, 0x22, 0x2c, 0x20,
+  0x32, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65,
+  0x6e, 0x64, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x6c, 0x29, 0x20, 0x7e,
+  0x3d, 0x20, 0x22, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x22, 0x20, 0x74,
+  0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x22, 0x62,
+  0x61, 0x64, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x23, 0x32, 0x20, 0x74, 0x6f, 0x20, 0x27, 0x72, 0x61, 0x6e, 0x64, 0x6f,
+  0x6d, 0x27, 0x20, 0x28, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x65,
+  0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x29, 0x22, 0x2c, 0x20, 0x32,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6e,
+  0x64, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72,
+  0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x28,
+  0x72, 0x20, 0x2a, 0x20, 0x28, 0x75, 0x20, 0x2d, 0x20, 0x6c, 0x20, 0x2b,
+  0x20, 0x31, 0x29, 0x29, 0x20, 0x2b, 0x20, 0x6c, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x65, 0x6c, 0x73, 0x65, 0x69, 0x66, 0x20, 0x6c, 0x20, 0x7e, 0x3d,
+  0x20, 0x6e, 0x69, 0x6c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x79, 0x70,
+  0x65, 0x28, 0x6c, 0x29, 0x20, 0x7e, 0x3d, 0x20, 0x22, 0x6e, 0x75, 0x6d,
+  0x62, 0x65, 0x72, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72,
+  0x72, 0x6f, 0x72, 0x28, 0x22, 0x62, 0x61, 0x64, 0x20, 0x61, 0x72, 0x67,
+  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x23, 0x31, 0x20, 0x74, 0x6f, 0x20,
+  0x27, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x27, 0x20, 0x28, 0x6e, 0x75,
+  0x6d, 0x62, 0x65, 0x72, 0x20, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65,
+  0x64, 0x29, 0x22, 0x2c, 0x20, 0x32, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x65, 0x6e, 0x64, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
+  0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x28, 0x72, 0x20, 0x2a, 0x20, 0x6c, 0x29,
+  0x20, 0x2b, 0x20, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73,
+  0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
+  0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x65,
+  0x6e, 0x64, 0x0a, 0x65, 0x6e, 0x64, 0x0a, 0x0a, 0x66, 0x75, 0x6e, 0x63,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x52, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x47,
+  0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x3a, 0x72, 0x61, 0x6e,
+  0x64, 0x6f, 0x6d, 0x28, 0x6c, 0x2c, 0x20, 0x75, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x72, 0x20, 0x3d, 0x20,
+  0x5f, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x28, 0x73, 0x65, 0x6c, 0x66,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+  0x20, 0x67, 0x65, 0x74, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x28, 0x72,
+  0x2c, 0x20, 0x6c, 0x2c, 0x20, 0x75, 0x29, 0x0a, 0x65, 0x6e, 0x64, 0x0a
+};
+const unsigned int wrap_randomgenerator_lua_size = 828;
@@ -0,0 +1,50 @@
+const unsigned char wrap_video_lua[] = {
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x56, 0x69, 0x64, 0x65, 0x6f, 0x5f,
+  0x6d, 0x74, 0x20, 0x3d, 0x20, 0x2e, 0x2e, 0x2e, 0x0a, 0x6c, 0x6f, 0x63,
+  0x61, 0x6c, 0x20, 0x56, 0x69, 0x64, 0x65, 0x6f, 0x20, 0x3d, 0x20, 0x56,
+  0x69, 0x64, 0x65, 0x6f, 0x5f, 0x6d, 0x74, 0x2e, 0x5f, 0x5f, 0x69, 0x6e,
+  0x64, 0x65, 0x78, 0x0a, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x56, 0x69, 0x64, 0x65, 0x6f, 0x3a, 0x73, 0x65, 0x74, 0x53,
+  0x6f, 0x75, 0x72, 0x63, 0x65, 0x28, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x5f,
+  0x73, 0x65, 0x74, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x28, 0x73, 0x6f,
+  0x75, 0x72, 0x63, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65,
+  0x6c, 0x66, 0x3a, 0x67, 0x65, 0x74, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d,
+  0x28, 0x29, 0x3a, 0x73, 0x65, 0x74, 0x53, 0x79, 0x6e, 0x63, 0x28, 0x73,
+  0x6f, 0x75, 0x72, 0x63, 0x65, 0x29, 0x0a, 0x65, 0x6e, 0x64, 0x0a, 0x0a,
+  0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x56, 0x69, 0x64,
+  0x65, 0x6f, 0x3a, 0x70, 0x6c, 0x61, 0x79, 0x28, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x73, 0x65, 0x6c,
+  0x66, 0x3a, 0x67, 0x65, 0x74, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x28,
+  0x29, 0x3a, 0x70, 0x6c, 0x61, 0x79, 0x28, 0x29, 0x0a, 0x65, 0x6e, 0x64,
+  0x0a, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x56,
+  0x69, 0x64, 0x65, 0x6f, 0x3a, 0x70, 0x61, 0x75, 0x73, 0x65, 0x28, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
+  0x73, 0x65, 0x6c, 0x66, 0x3a, 0x67, 0x65, 0x74, 0x53, 0x74, 0x72, 0x65,
+  0x61, 0x6d, 0x28, 0x29, 0x3a, 0x70, 0x61, 0x75, 0x73, 0x65, 0x28, 0x29,
+  0x0a, 0x65, 0x6e, 0x64, 0x0a, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x56, 0x69, 0x64, 0x65, 0x6f, 0x3a, 0x73, 0x65, 0x65,
+  0x6b, 0x28, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x73, 0x65, 0x6c,
+  0x66, 0x3a, 0x67, 0x65, 0x74, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x28,
+  0x29, 0x3a, 0x73, 0x65, 0x65, 0x6b, 0x28, 0x6f, 0x66, 0x66, 0x73, 0x65,
+  0x74, 0x29, 0x0a, 0x65, 0x6e, 0x64, 0x0a, 0x0a, 0x66, 0x75, 0x6e, 0x63,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x56, 0x69, 0x64, 0x65, 0x6f, 0x3a, 0x72,
+  0x65, 0x77, 0x69, 0x6e, 0x64, 0x28, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x73, 0x65, 0x6c, 0x66, 0x3a,
+  0x67, 0x65, 0x74, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x28, 0x29, 0x3a,
+  0x72, 0x65, 0x77, 0x69, 0x6e, 0x64, 0x28, 0x29, 0x0a, 0x65, 0x6e, 0x64,
+  0x0a, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x56,
+  0x69, 0x64, 0x65, 0x6f, 0x3a, 0x74, 0x65, 0x6c, 0x6c, 0x28, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x73,
+  0x65, 0x6c, 0x66, 0x3a, 0x67, 0x65, 0x74, 0x53, 0x74, 0x72, 0x65, 0x61,
+  0x6d, 0x28, 0x29, 0x3a, 0x74, 0x65, 0x6c, 0x6c, 0x28, 0x29, 0x0a, 0x65,
+  0x6e, 0x64, 0x0a, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+  0x20, 0x56, 0x69, 0x64, 0x65, 0x6f, 0x3a, 0x69, 0x73, 0x50, 0x6c, 0x61,
+  0x79, 0x69, 0x6e, 0x67, 0x28, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72,
+  0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x73, 0x65, 0x6c, 0x66, 0x3a, 0x67,
+  0x65, 0x74, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x28, 0x29, 0x3a, 0x69,
+  0x73, 0x50, 0x6c, 0x61, 0x79, 0x69, 0x6e, 0x67, 0x28, 0x29, 0x0a, 0x65,
+  0x6e, 0x64, 0x0a
+};
+const unsigned int wrap_video_lua_size = 555;
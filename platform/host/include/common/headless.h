@@ -0,0 +1,37 @@
+#pragma once
+
+#include "common/luax.h"
+
+#include <stddef.h>
+#include <vector>
+
+namespace love
+{
+    /*
+    ** Runs the boot coroutine with nothing to show it on. Every resume
+    ** after the first is one frame of love.run, and each is timed so a
+    ** game directory doubles as a benchmark:
+    **
+    **     LOVEPotion [--frames N] [--record|--replay FILE] <game>
+    **
+    ** stops after N frames (0 runs until love.event.quit) and prints
+    ** the distribution of frame times on the way out. --record and
+    ** --replay start love.event.record or love.event.replay after
+    ** love.load, for replaying a session captured on hardware.
+    */
+    namespace Headless
+    {
+        /* takes out what's meant for us before love.arg sees it */
+        void ParseArgs(int& argc, char** argv);
+
+        /* resumes @L once, LUA_YIELD while there are frames left */
+        int Resume(lua_State* L);
+
+        void PrintStats();
+
+        void StartLog(lua_State* L);
+
+        /* stands in for the modules that need a screen, see nullmodule.lua */
+        int OpenNullModule(lua_State* L);
+    } // namespace Headless
+} // namespace love
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "common/driver/audiodrvc.h"
+#include "modules/thread/types/mutex.h"
+
+#include <array>
+#include <chrono>
+#include <deque>
+
+namespace love::driver
+{
+    /*
+    ** Null audio driver. Nothing is mixed or heard: each channel plays its
+    ** queue of wave buffers against the wall clock at the channel's rate
+    ** and pitch, so Sources stream, finish and report offsets the way they
+    ** would on hardware.
+    */
+    class Audrv : public common::driver::Audrv
+    {
+      public:
+        static constexpr double OUTPUT_RATE = 48000.0;
+
+        static constexpr size_t MAX_CHANNELS = 24;
+
+        enum WaveBufState
+        {
+            WAVEBUF_STATE_FREE,
+            WAVEBUF_STATE_QUEUED,
+            WAVEBUF_STATE_PLAYING,
+            WAVEBUF_STATE_DONE
+        };
+
+        struct WaveBuf
+        {
+            s16* data_pcm16;
+            size_t size;
+
+            int end_sample_offset;
+            bool is_looping;
+
+            WaveBufState state;
+        };
+
+        ~Audrv();
+
+        static Audrv& Instance()
+        {
+            static Audrv instance;
+            return instance;
+        }
+
+        bool ResetChannel(size_t channel, int channels, int sampleRate);
+
+        void SetMixVolume(int mix, float volume);
+
+        void SetChannelVolume(size_t channel, float volume);
+
+        void SetChannelPitch(size_t channel, float pitch);
+
+        bool IsChannelPlaying(size_t channel);
+
+        bool IsChannelPaused(size_t channel);
+
+        bool AddWaveBuf(size_t channel, WaveBuf* waveBuf);
+
+        void PauseChannel(size_t channel, bool pause);
+
+        void StopChannel(size_t channel);
+
+        u32 GetSampleOffset(size_t channel);
+
+        void Update();
+
+      private:
+        Audrv();
+
+        struct Channel
+        {
+            std::deque<WaveBuf*> queue;
+
+            int sampleRate;
+            float pitch;
+
+            bool paused;
+
+            /* frames into the front buffer, and played since the last reset */
+            double position;
+            u32 played;
+        };
+
+        thread::MutexRef mutex;
+
+        std::array<Channel, MAX_CHANNELS> channels;
+        std::chrono::steady_clock::time_point lastUpdate;
+    };
+} // namespace love::driver
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "common/driver/hidrvc.h"
+
+/*
+** HID backend for the headless host. There's no device to read, events
+** come from the common queue (quit, focus) and the host gamepad's state.
+*/
+namespace love::driver
+{
+    class Hidrv : public common::driver::Hidrv
+    {
+      public:
+        Hidrv();
+
+        bool Poll(LOVE_Event* event) override;
+    };
+} // namespace love::driver
@@ -0,0 +1,67 @@
+#pragma once
+
+/*
+** The pieces of libctru/libnx the common code leans on, for building it
+** as a plain Linux program. Nothing here touches hardware: romfs mounts
+** nothing and the game directory on the command line is all there is.
+*/
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+
+typedef int8_t s8;
+typedef int16_t s16;
+typedef int32_t s32;
+typedef int64_t s64;
+
+typedef u32 Result;
+typedef u32 Handle;
+
+#define R_SUCCEEDED(res) ((res) == 0)
+#define R_FAILED(res)    ((res) != 0)
+
+#define CUR_THREAD_HANDLE 0xFFFF8000
+
+typedef pthread_cond_t CondVar;
+
+struct Thread
+{
+    pthread_t handle;
+};
+
+inline void svcSleepThread(s64 nanoseconds)
+{
+    if (nanoseconds <= 0)
+        return;
+
+    timespec duration { (time_t)(nanoseconds / 1000000000LL), (long)(nanoseconds % 1000000000LL) };
+
+    while (nanosleep(&duration, &duration) != 0 && errno == EINTR)
+        continue;
+}
+
+/* threads all run at the same priority as far as the common code cares */
+inline Result svcGetThreadPriority(s32* priority, Handle)
+{
+    *priority = 0x2C;
+
+    return 0;
+}
+
+inline Result romfsInit()
+{
+    return 0;
+}
+
+inline Result romfsExit()
+{
+    return 0;
+}
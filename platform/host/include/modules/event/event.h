@@ -0,0 +1,8 @@
+#pragma once
+
+#include "modules/event/eventc.h"
+
+namespace love
+{
+    using Event = common::Event;
+} // namespace love
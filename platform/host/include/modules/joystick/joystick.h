@@ -0,0 +1,8 @@
+#pragma once
+
+#include "modules/joystick/joystickc.h"
+
+namespace love
+{
+    using Joystick = common::Joystick;
+} // namespace love
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "modules/keyboard/keyboardc.h"
+#include <vector>
+
+namespace love
+{
+    enum class common::Keyboard::KeyboardType : uint8_t
+    {
+        TYPE_NORMAL,
+        TYPE_QWERTY,
+        TYPE_NUMPAD
+    };
+
+    /*
+    ** There's nobody to type anything in, so text input reads a line
+    ** from stdin instead, or comes back empty when that's closed.
+    */
+    class Keyboard : public common::Keyboard
+    {
+      public:
+        static constexpr uint32_t MAX_INPUT_LENGTH = 0x1F4;
+
+        constexpr uint32_t ENCODING_MULTIPLIER() override
+        {
+            return 0x04;
+        }
+
+        Keyboard();
+
+        virtual ~Keyboard()
+        {}
+
+        std::string SetTextInput(const SwkbdOpt& options) override;
+
+        static bool GetConstant(const char* in, KeyboardType& out);
+        static bool GetConstant(KeyboardType in, const char*& out);
+        static std::vector<const char*> GetConstants(KeyboardType);
+    };
+} // namespace love
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "modules/system/systemc.h"
+
+namespace love
+{
+    /* reports the machine it runs on, so numbers from it are read in context */
+    class System : public common::System
+    {
+      public:
+        System();
+
+        virtual ~System() {};
+
+        using common::System::GetPowerInfo;
+
+        using common::System::GetNetworkInfo;
+
+        int GetProcessorCount() override;
+
+        const std::string& GetUsername() override;
+
+        PowerState GetPowerInfo(uint8_t& percent) const override;
+
+        NetworkState GetNetworkInfo(uint8_t& signal) const override;
+
+        const std::string& GetSystemTheme() override;
+
+        const std::string& GetPreferredLocales() override;
+
+        const std::string& GetModel() override;
+
+        const std::string& GetRegion() override;
+
+        const std::string& GetVersion() override;
+
+        const std::string& GetFriendCode() override;
+    };
+} // namespace love
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "objects/gamepad/gamepadc.h"
+
+#include "common/bidirectionalmap.h"
+
+enum class love::common::Gamepad::GamepadAxis : uint64_t
+{
+    GAMEPAD_AXIS_LEFTX,
+    GAMEPAD_AXIS_LEFTY,
+    GAMEPAD_AXIS_RIGHTX,
+    GAMEPAD_AXIS_RIGHTY,
+    GAMEPAD_AXIS_TRIGGERLEFT,
+    GAMEPAD_AXIS_TRIGGERRIGHT
+};
+
+enum class love::common::Gamepad::GamepadButton : uint64_t
+{
+    GAMEPAD_BUTTON_A              = 1 << 0,
+    GAMEPAD_BUTTON_B              = 1 << 1,
+    GAMEPAD_BUTTON_X              = 1 << 2,
+    GAMEPAD_BUTTON_Y              = 1 << 3,
+    GAMEPAD_BUTTON_BACK           = 1 << 4,
+    GAMEPAD_BUTTON_START          = 1 << 5,
+    GAMEPAD_BUTTON_LEFTSTICK      = 1 << 6,
+    GAMEPAD_BUTTON_RIGHTSTICK     = 1 << 7,
+    GAMEPAD_BUTTON_LEFT_SHOULDER  = 1 << 8,
+    GAMEPAD_BUTTON_RIGHT_SHOULDER = 1 << 9,
+    GAMEPAD_BUTTON_DPAD_UP        = 1 << 10,
+    GAMEPAD_BUTTON_DPAD_RIGHT     = 1 << 11,
+    GAMEPAD_BUTTON_DPAD_DOWN      = 1 << 12,
+    GAMEPAD_BUTTON_DPAD_LEFT      = 1 << 13
+};
+
+namespace love
+{
+    /*
+    ** A pad that's always connected and never touched. The buttons are a
+    ** bitmask and the axes plain values, so something other than hardware
+    ** can hold them down.
+    */
+    class Gamepad : public common::Gamepad
+    {
+      public:
+        Gamepad(size_t id);
+
+        Gamepad(size_t id, size_t index);
+
+        virtual ~Gamepad();
+
+        bool Open(size_t id) override;
+
+        void Close() override;
+
+        bool IsConnected() const override;
+
+        const char* GetName() const override;
+
+        size_t GetAxisCount() const override;
+
+        size_t GetButtonCount() const override;
+
+        float GetAxis(size_t axis) const override;
+
+        std::vector<float> GetAxes() const override;
+
+        void Update();
+
+        bool IsDown(size_t index, ButtonMapping& button) override;
+
+        bool IsHeld(size_t index, ButtonMapping& button) const override;
+
+        bool IsUp(size_t index, ButtonMapping& button) override;
+
+        bool IsDown(const std::vector<size_t>& buttons) const override;
+
+        float GetGamepadAxis(GamepadAxis axis) const override;
+
+        bool IsGamepadDown(const std::vector<GamepadButton>& buttons) const override;
+
+        bool IsVibrationSupported() override;
+
+        bool SetVibration(float left, float right, float duration = -1.0f) override;
+
+        bool SetVibration() override;
+
+        void GetVibration(float& left, float& right) override;
+
+        static bool GetConstant(const char* in, GamepadAxis& out);
+        static bool GetConstant(GamepadAxis in, const char*& out);
+
+        static bool GetConstant(const char* in, GamepadButton& out);
+        static bool GetConstant(GamepadButton in, const char*& out);
+
+        static constexpr uint8_t MAX_BUTTONS = 14;
+        static constexpr uint8_t MAX_AXES    = 6;
+
+        const static auto& GetButtonMapping()
+        {
+            return Gamepad::buttons;
+        }
+
+        struct
+        {
+            uint64_t pressed;
+            uint64_t released;
+        } buttonStates;
+
+      private:
+        uint64_t held;
+        uint64_t previous;
+
+        float axisValues[MAX_AXES];
+
+        // clang-format off
+        static constexpr auto axes = BidirectionalMap<>::Create(
+            "leftx",        Gamepad::GamepadAxis::GAMEPAD_AXIS_LEFTX,
+            "lefty",        Gamepad::GamepadAxis::GAMEPAD_AXIS_LEFTY,
+            "rightx",       Gamepad::GamepadAxis::GAMEPAD_AXIS_RIGHTX,
+            "righty",       Gamepad::GamepadAxis::GAMEPAD_AXIS_RIGHTY,
+            "triggerleft",  Gamepad::GamepadAxis::GAMEPAD_AXIS_TRIGGERLEFT,
+            "triggerright", Gamepad::GamepadAxis::GAMEPAD_AXIS_TRIGGERRIGHT
+        );
+
+        static constexpr auto buttons = BidirectionalMap<>::Create(
+            "a",             Gamepad::GamepadButton::GAMEPAD_BUTTON_A,
+            "b",             Gamepad::GamepadButton::GAMEPAD_BUTTON_B,
+            "x",             Gamepad::GamepadButton::GAMEPAD_BUTTON_X,
+            "y",             Gamepad::GamepadButton::GAMEPAD_BUTTON_Y,
+            "back",          Gamepad::GamepadButton::GAMEPAD_BUTTON_BACK,
+            "start",         Gamepad::GamepadButton::GAMEPAD_BUTTON_START,
+            "leftstick",     Gamepad::GamepadButton::GAMEPAD_BUTTON_LEFTSTICK,
+            "rightstick",    Gamepad::GamepadButton::GAMEPAD_BUTTON_RIGHTSTICK,
+            "leftshoulder",  Gamepad::GamepadButton::GAMEPAD_BUTTON_LEFT_SHOULDER,
+            "rightshoulder", Gamepad::GamepadButton::GAMEPAD_BUTTON_RIGHT_SHOULDER,
+            "dpup",          Gamepad::GamepadButton::GAMEPAD_BUTTON_DPAD_UP,
+            "dpdown",        Gamepad::GamepadButton::GAMEPAD_BUTTON_DPAD_DOWN,
+            "dpleft",        Gamepad::GamepadButton::GAMEPAD_BUTTON_DPAD_LEFT,
+            "dpright",       Gamepad::GamepadButton::GAMEPAD_BUTTON_DPAD_RIGHT
+        );
+        // clang-format on
+    };
+} // namespace love
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "thread/threadc.h"
+
+namespace love
+{
+    class Thread : public common::Thread
+    {
+      public:
+        Thread(Threadable* t);
+
+        /* Detach the thread */
+        virtual ~Thread();
+
+        virtual bool Start() override;
+
+        virtual void Wait() override;
+    };
+
+    inline Thread* newThread(Threadable* t)
+    {
+        return new Thread(t);
+    }
+} // namespace love
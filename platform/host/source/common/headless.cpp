@@ -0,0 +1,168 @@
+#include "common/headless.h"
+
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace love;
+
+// clang-format off
+static constexpr char nullmodule_lua[] =
+#include "nullmodule.lua"
+;
+// clang-format on
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    size_t frameLimit = 0;
+
+    /* handed to love.event.record or love.event.replay once the game loads */
+    const char* logCommand  = nullptr;
+    const char* logFilename = nullptr;
+
+    /* the first resume boots, loads and runs love.load, it isn't a frame */
+    bool booted         = false;
+    double startupTime  = 0.0;
+    double runStartTime = 0.0;
+
+    std::vector<double> frameTimes;
+
+    double now()
+    {
+        static const Clock::time_point start = Clock::now();
+
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    double percentile(const std::vector<double>& sorted, double fraction)
+    {
+        size_t index = (size_t)(fraction * (sorted.size() - 1) + 0.5);
+
+        return sorted[std::min(index, sorted.size() - 1)];
+    }
+} // namespace
+
+void Headless::ParseArgs(int& argc, char** argv)
+{
+    int kept = 1;
+
+    for (int index = 1; index < argc; index++)
+    {
+        if (strcmp(argv[index], "--frames") == 0 && index + 1 < argc)
+        {
+            frameLimit = strtoul(argv[++index], nullptr, 10);
+            continue;
+        }
+
+        if ((strcmp(argv[index], "--record") == 0 || strcmp(argv[index], "--replay") == 0) &&
+            index + 1 < argc)
+        {
+            logCommand  = argv[index] + 2;
+            logFilename = argv[++index];
+            continue;
+        }
+
+        argv[kept++] = argv[index];
+    }
+
+    argc = kept;
+
+    if (frameLimit > 0)
+        frameTimes.reserve(frameLimit);
+}
+
+int Headless::Resume(lua_State* L)
+{
+    if (booted && frameLimit > 0 && frameTimes.size() >= frameLimit)
+        return 0;
+
+    double start = now();
+    int status   = Luax::Resume(L, 0);
+    double time  = now() - start;
+
+    if (!booted)
+    {
+        booted       = true;
+        startupTime  = time;
+        runStartTime = now();
+
+        if (status == LUA_YIELD && logCommand != nullptr)
+            StartLog(L);
+    }
+    else
+        frameTimes.push_back(time);
+
+    return status;
+}
+
+/* love.load has run by now, so the log lines up with the first frame */
+void Headless::StartLog(lua_State* L)
+{
+    lua_getglobal(L, "love");
+    lua_getfield(L, -1, "event");
+
+    if (lua_istable(L, -1))
+    {
+        lua_getfield(L, -1, logCommand);
+        lua_pushstring(L, logFilename);
+
+        if (lua_pcall(L, 1, 0, 0) != 0)
+        {
+            printf("headless: %s failed: %s\n", logCommand, lua_tostring(L, -1));
+            lua_pop(L, 1);
+        }
+    }
+
+    lua_pop(L, 2);
+}
+
+void Headless::PrintStats()
+{
+    if (frameTimes.empty())
+    {
+        printf("headless: no frames ran, startup %.2f ms\n", startupTime * 1000.0);
+        return;
+    }
+
+    double elapsed = now() - runStartTime;
+
+    std::vector<double> sorted(frameTimes);
+    std::sort(sorted.begin(), sorted.end());
+
+    double total = 0.0;
+
+    for (double time : sorted)
+        total += time;
+
+    double mean = total / sorted.size();
+
+    printf("headless: %zu frames in %.3f s (%.1f fps), startup %.2f ms\n", sorted.size(), elapsed,
+           sorted.size() / elapsed, startupTime * 1000.0);
+
+    printf("frame ms: mean %.3f  p50 %.3f  p95 %.3f  p99 %.3f  max %.3f\n", mean * 1000.0,
+           percentile(sorted, 0.50) * 1000.0, percentile(sorted, 0.95) * 1000.0,
+           percentile(sorted, 0.99) * 1000.0, sorted.back() * 1000.0);
+
+    fflush(stdout);
+
+    booted = false;
+    frameTimes.clear();
+}
+
+/* require passes the name being loaded, which the script picks its stand-ins by */
+int Headless::OpenNullModule(lua_State* L)
+{
+    const char* name = luaL_checkstring(L, 1);
+
+    if (luaL_loadbuffer(L, nullmodule_lua, sizeof(nullmodule_lua), "=[love \"nullmodule.lua\"]"))
+        return lua_error(L);
+
+    lua_pushstring(L, name);
+    lua_call(L, 1, 1);
+
+    return 1;
+}
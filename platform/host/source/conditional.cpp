@@ -0,0 +1,52 @@
+#include "modules/thread/types/conditional.h"
+
+#include <time.h>
+
+using namespace love::thread;
+
+Conditional::Conditional()
+{
+    pthread_condattr_t attributes;
+
+    pthread_condattr_init(&attributes);
+    pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+
+    pthread_cond_init(&this->condVar, &attributes);
+    pthread_condattr_destroy(&attributes);
+}
+
+Conditional::~Conditional()
+{
+    pthread_cond_destroy(&this->condVar);
+}
+
+void Conditional::Signal()
+{
+    pthread_cond_signal(&this->condVar);
+}
+
+void Conditional::Broadcast()
+{
+    pthread_cond_broadcast(&this->condVar);
+}
+
+/* @timeout is in nanoseconds, like the consoles' */
+bool Conditional::Wait(thread::Mutex* _mutex, s64 timeout)
+{
+    if (timeout < 0)
+        return pthread_cond_wait(&this->condVar, &_mutex->mutex) == 0;
+
+    timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+
+    deadline.tv_sec += timeout / 1000000000LL;
+    deadline.tv_nsec += timeout % 1000000000LL;
+
+    if (deadline.tv_nsec >= 1000000000L)
+    {
+        deadline.tv_sec += 1;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    return pthread_cond_timedwait(&this->condVar, &_mutex->mutex, &deadline) == 0;
+}
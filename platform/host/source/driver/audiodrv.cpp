@@ -0,0 +1,154 @@
+#include "driver/audiodrv.h"
+
+#include <algorithm>
+
+using namespace love::driver;
+
+Audrv::Audrv() : channels {}, lastUpdate(std::chrono::steady_clock::now())
+{
+    for (auto& channel : this->channels)
+    {
+        channel.sampleRate = (int)OUTPUT_RATE;
+        channel.pitch      = 1.0f;
+    }
+
+    this->initialized = true;
+}
+
+Audrv::~Audrv()
+{}
+
+void Audrv::SetMixVolume(int, float)
+{}
+
+bool Audrv::ResetChannel(size_t channel, int, int sampleRate)
+{
+    thread::Lock lock(this->mutex);
+
+    Channel& state = this->channels[channel];
+
+    for (WaveBuf* waveBuf : state.queue)
+        waveBuf->state = WAVEBUF_STATE_DONE;
+
+    state.queue.clear();
+
+    state.sampleRate = sampleRate;
+    state.pitch      = 1.0f;
+    state.paused     = false;
+    state.position   = 0.0;
+    state.played     = 0;
+
+    return true;
+}
+
+void Audrv::SetChannelVolume(size_t, float)
+{}
+
+void Audrv::SetChannelPitch(size_t channel, float pitch)
+{
+    thread::Lock lock(this->mutex);
+
+    this->channels[channel].pitch = pitch;
+}
+
+bool Audrv::IsChannelPlaying(size_t channel)
+{
+    thread::Lock lock(this->mutex);
+
+    return !this->channels[channel].queue.empty();
+}
+
+bool Audrv::IsChannelPaused(size_t channel)
+{
+    thread::Lock lock(this->mutex);
+
+    return this->channels[channel].paused;
+}
+
+bool Audrv::AddWaveBuf(size_t channel, WaveBuf* waveBuf)
+{
+    thread::Lock lock(this->mutex);
+
+    waveBuf->state = WAVEBUF_STATE_QUEUED;
+    this->channels[channel].queue.push_back(waveBuf);
+
+    return true;
+}
+
+void Audrv::PauseChannel(size_t channel, bool pause)
+{
+    thread::Lock lock(this->mutex);
+
+    this->channels[channel].paused = pause;
+}
+
+void Audrv::StopChannel(size_t channel)
+{
+    thread::Lock lock(this->mutex);
+
+    Channel& state = this->channels[channel];
+
+    for (WaveBuf* waveBuf : state.queue)
+        waveBuf->state = WAVEBUF_STATE_DONE;
+
+    state.queue.clear();
+
+    state.position = 0.0;
+    state.played   = 0;
+}
+
+u32 Audrv::GetSampleOffset(size_t channel)
+{
+    thread::Lock lock(this->mutex);
+
+    const Channel& state = this->channels[channel];
+
+    return state.played + (u32)state.position;
+}
+
+/*
+** Play out however many frames the time since the last update is worth,
+** retiring buffers as they run out. Looping buffers wrap in place.
+*/
+void Audrv::Update()
+{
+    thread::Lock lock(this->mutex);
+
+    auto now       = std::chrono::steady_clock::now();
+    double elapsed = std::chrono::duration<double>(now - this->lastUpdate).count();
+
+    this->lastUpdate = now;
+
+    for (Channel& state : this->channels)
+    {
+        if (state.paused || state.queue.empty())
+            continue;
+
+        double frames = elapsed * state.sampleRate * state.pitch;
+
+        while (frames > 0.0 && !state.queue.empty())
+        {
+            WaveBuf* waveBuf = state.queue.front();
+            waveBuf->state   = WAVEBUF_STATE_PLAYING;
+
+            double left = waveBuf->end_sample_offset - state.position;
+
+            if (frames < left)
+            {
+                state.position += frames;
+                break;
+            }
+
+            frames -= left;
+
+            state.played += waveBuf->end_sample_offset;
+            state.position = 0.0;
+
+            if (waveBuf->is_looping && waveBuf->end_sample_offset > 0)
+                continue;
+
+            waveBuf->state = WAVEBUF_STATE_DONE;
+            state.queue.pop_front();
+        }
+    }
+}
@@ -0,0 +1,71 @@
+#include "driver/hidrv.h"
+#include "modules/joystick/joystick.h"
+#include "objects/gamepad/gamepad.h"
+
+#define MODULE() love::Module::GetInstance<love::Joystick>(love::Module::M_JOYSTICK)
+
+using namespace love::driver;
+
+Hidrv::Hidrv()
+{}
+
+bool Hidrv::Poll(LOVE_Event* event)
+{
+    if (!this->events.empty())
+    {
+        *event = this->events.front();
+        this->events.pop_front();
+
+        return true;
+    }
+
+    if (this->hysteresis)
+        return this->hysteresis = false;
+
+    Gamepad* gamepad = (MODULE()) ? MODULE()->GetJoystickFromID(0) : nullptr;
+
+    if (gamepad)
+    {
+        gamepad->Update();
+
+        Gamepad::ButtonMapping button;
+
+        const auto entries = gamepad->GetButtonMapping().GetEntries();
+
+        for (size_t index = 0; index < entries.second; index++)
+        {
+            if (gamepad->IsDown(index, button))
+            {
+                auto& newEvent = this->events.emplace_back();
+
+                newEvent.type = TYPE_GAMEPADDOWN;
+
+                newEvent.button.name   = button.first;
+                newEvent.button.which  = gamepad->GetID();
+                newEvent.button.button = button.second;
+            }
+        }
+
+        for (size_t index = 0; index < entries.second; index++)
+        {
+            if (gamepad->IsUp(index, button))
+            {
+                auto& newEvent = this->events.emplace_back();
+
+                newEvent.type = TYPE_GAMEPADUP;
+
+                newEvent.button.name   = button.first;
+                newEvent.button.which  = gamepad->GetID();
+                newEvent.button.button = button.second;
+            }
+        }
+    }
+
+    if (this->events.empty())
+        return false;
+
+    *event = this->events.front();
+    this->events.pop_front();
+
+    return this->hysteresis = true;
+}
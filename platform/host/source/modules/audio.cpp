@@ -0,0 +1,10 @@
+#include "modules/audio/audio.h"
+#include "driver/audiodrv.h"
+
+using namespace love;
+
+void Audio::SetVolume(float volume)
+{
+    driver::Audrv::Instance().SetMixVolume(0, volume);
+    this->volume = volume;
+}
@@ -0,0 +1,46 @@
+#include "modules/keyboard/keyboard.h"
+#include "common/bidirectionalmap.h"
+
+#include <stdio.h>
+#include <string.h>
+
+using namespace love;
+
+Keyboard::Keyboard() : common::Keyboard((MAX_INPUT_LENGTH * 4) + 1)
+{}
+
+std::string Keyboard::SetTextInput(const Keyboard::SwkbdOpt& options)
+{
+    uint32_t maxLength = this->CalculateEncodingMaxLength(options.maxLength);
+    memset(this->text, 0, maxLength);
+
+    if (fgets(this->text, maxLength, stdin) == nullptr)
+        return std::string();
+
+    this->text[strcspn(this->text, "\r\n")] = '\0';
+
+    return this->text;
+}
+
+// clang-format off
+constexpr auto keyboardTypes = BidirectionalMap<>::Create(
+    "normal", Keyboard::KeyboardType::TYPE_NORMAL,
+    "qwerty", Keyboard::KeyboardType::TYPE_QWERTY,
+    "numpad", Keyboard::KeyboardType::TYPE_NUMPAD
+);
+// clang-format on
+
+bool Keyboard::GetConstant(const char* in, KeyboardType& out)
+{
+    return keyboardTypes.Find(in, out);
+}
+
+bool Keyboard::GetConstant(KeyboardType in, const char*& out)
+{
+    return keyboardTypes.ReverseFind(in, out);
+}
+
+std::vector<const char*> Keyboard::GetConstants(KeyboardType)
+{
+    return keyboardTypes.GetNames();
+}
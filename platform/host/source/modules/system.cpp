@@ -0,0 +1,112 @@
+#include "modules/system/system.h"
+
+#include <pwd.h>
+#include <stdlib.h>
+#include <sys/utsname.h>
+#include <unistd.h>
+
+#include "common/results.h"
+
+using namespace love;
+
+System::System()
+{}
+
+int System::GetProcessorCount()
+{
+    if (this->systemInfo.processors == 0)
+        this->systemInfo.processors = (int)sysconf(_SC_NPROCESSORS_ONLN);
+
+    return this->systemInfo.processors;
+}
+
+const std::string& System::GetUsername()
+{
+    if (!this->systemInfo.username.empty())
+        return this->systemInfo.username;
+
+    passwd* entry = getpwuid(getuid());
+
+    if (entry == nullptr)
+        return LOVE_STRING_EMPTY;
+
+    this->systemInfo.username = entry->pw_name;
+
+    return this->systemInfo.username;
+}
+
+System::PowerState System::GetPowerInfo(uint8_t& percent) const
+{
+    percent = 100;
+
+    return PowerState::POWER_UNKNOWN;
+}
+
+System::NetworkState System::GetNetworkInfo(uint8_t& signal) const
+{
+    signal = 0;
+
+    return NetworkState::NETWORK_UNKNOWN;
+}
+
+const std::string& System::GetPreferredLocales()
+{
+    if (!this->systemInfo.language.empty())
+        return this->systemInfo.language;
+
+    const char* language = getenv("LANG");
+    this->systemInfo.language = (language != nullptr) ? language : "C";
+
+    return this->systemInfo.language;
+}
+
+const std::string& System::GetModel()
+{
+    if (!this->systemInfo.model.empty())
+        return this->systemInfo.model;
+
+    utsname name {};
+
+    if (uname(&name) != 0)
+        return LOVE_STRING_EMPTY;
+
+    this->systemInfo.model = name.machine;
+
+    return this->systemInfo.model;
+}
+
+const std::string& System::GetRegion()
+{
+    if (this->systemInfo.region.empty())
+        this->systemInfo.region = "Unknown";
+
+    return this->systemInfo.region;
+}
+
+const std::string& System::GetVersion()
+{
+    if (!this->systemInfo.version.empty())
+        return this->systemInfo.version;
+
+    utsname name {};
+
+    if (uname(&name) != 0)
+        return LOVE_STRING_EMPTY;
+
+    this->systemInfo.version = std::string(name.sysname) + " " + name.release;
+
+    return this->systemInfo.version;
+}
+
+const std::string& System::GetFriendCode()
+{
+    return LOVE_STRING_EMPTY;
+}
+
+const std::string& System::GetSystemTheme()
+{
+    if (this->systemInfo.colorTheme.empty())
+        this->systemInfo.colorTheme = "dark";
+
+    return this->systemInfo.colorTheme;
+}
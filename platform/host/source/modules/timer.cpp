@@ -0,0 +1,24 @@
+#include "modules/timer/timer.h"
+
+#include <time.h>
+
+using namespace love;
+
+static uint64_t monotonicNs()
+{
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+Timer::Timer()
+{
+    Timer::reference    = monotonicNs();
+    this->prevFPSUpdate = currentTime = this->GetTime();
+}
+
+uint64_t common::Timer::GetTimeNs()
+{
+    return monotonicNs() - Timer::reference;
+}
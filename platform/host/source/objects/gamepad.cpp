@@ -0,0 +1,214 @@
+#include "objects/gamepad/gamepad.h"
+#include "common/bidirectionalmap.h"
+
+using namespace love;
+
+Gamepad::Gamepad(size_t id) :
+    common::Gamepad(id),
+    buttonStates(),
+    held(0),
+    previous(0),
+    axisValues {}
+{}
+
+Gamepad::Gamepad(size_t id, size_t index) : Gamepad(id)
+{
+    this->Open(index);
+}
+
+Gamepad::~Gamepad()
+{
+    this->Close();
+}
+
+bool Gamepad::Open(size_t index)
+{
+    this->Close();
+
+    this->name = "Host Gamepad";
+
+    return this->IsConnected();
+}
+
+void Gamepad::Close()
+{
+    this->instanceID = -1;
+    this->vibration  = Vibration();
+}
+
+bool Gamepad::IsConnected() const
+{
+    return true;
+}
+
+const char* Gamepad::GetName() const
+{
+    return this->name.c_str();
+}
+
+size_t Gamepad::GetAxisCount() const
+{
+    return Gamepad::MAX_AXES;
+}
+
+size_t Gamepad::GetButtonCount() const
+{
+    return Gamepad::MAX_BUTTONS;
+}
+
+/* 1-indexed, like the other consoles */
+float Gamepad::GetAxis(size_t axis) const
+{
+    if (axis < 1 || axis > this->GetAxisCount())
+        return 0.0f;
+
+    return this->axisValues[axis - 1];
+}
+
+std::vector<float> Gamepad::GetAxes() const
+{
+    return std::vector<float>(this->axisValues, this->axisValues + Gamepad::MAX_AXES);
+}
+
+void Gamepad::Update()
+{
+    this->buttonStates.pressed  = this->held & ~this->previous;
+    this->buttonStates.released = this->previous & ~this->held;
+
+    this->previous = this->held;
+}
+
+/* helper functions */
+bool Gamepad::IsDown(size_t index, ButtonMapping& button)
+{
+    if (!this->buttonStates.pressed)
+        return false;
+
+    const auto records = buttons.GetEntries().first;
+    uint64_t hidButton = static_cast<uint64_t>(records[index].second);
+
+    if (hidButton & this->buttonStates.pressed)
+    {
+        this->buttonStates.pressed ^= hidButton;
+        button = std::make_pair(records[index].first, index);
+
+        return true;
+    }
+
+    return false;
+}
+
+bool Gamepad::IsUp(size_t index, ButtonMapping& button)
+{
+    if (!this->buttonStates.released)
+        return false;
+
+    const auto records = buttons.GetEntries().first;
+    uint64_t hidButton = static_cast<uint64_t>(records[index].second);
+
+    if (hidButton & this->buttonStates.released)
+    {
+        this->buttonStates.released ^= hidButton;
+        button = std::make_pair(records[index].first, index);
+
+        return true;
+    }
+
+    return false;
+}
+
+bool Gamepad::IsHeld(size_t index, ButtonMapping& button) const
+{
+    auto recordPair = buttons.GetEntries();
+    auto records    = recordPair.first;
+
+    for (size_t i = 0; i < recordPair.second; i++)
+    {
+        if (static_cast<uint64_t>(records[i].second) & this->held)
+        {
+            button = { records[i].first, i };
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool Gamepad::IsDown(const std::vector<size_t>& buttonsVector) const
+{
+    auto recordPair = buttons.GetEntries();
+    auto records    = recordPair.first;
+
+    for (size_t button : buttonsVector)
+    {
+        if (button >= recordPair.second)
+            continue;
+
+        if (this->held & static_cast<uint64_t>(records[button].second))
+            return true;
+    }
+
+    return false;
+}
+
+bool Gamepad::IsGamepadDown(const std::vector<GamepadButton>& buttonsVector) const
+{
+    for (GamepadButton button : buttonsVector)
+    {
+        if (this->held & static_cast<uint64_t>(button))
+            return true;
+    }
+
+    return false;
+}
+
+float Gamepad::GetGamepadAxis(Gamepad::GamepadAxis axis) const
+{
+    size_t index = static_cast<size_t>(axis);
+
+    if (index >= Gamepad::MAX_AXES)
+        return 0.0f;
+
+    return this->axisValues[index];
+}
+
+bool Gamepad::IsVibrationSupported()
+{
+    return false;
+}
+
+bool Gamepad::SetVibration(float left, float right, float duration)
+{
+    return false;
+}
+
+bool Gamepad::SetVibration()
+{
+    return false;
+}
+
+void Gamepad::GetVibration(float& left, float& right)
+{
+    left  = 0.0f;
+    right = 0.0f;
+}
+
+bool Gamepad::GetConstant(const char* in, Gamepad::GamepadAxis& out)
+{
+    return axes.Find(in, out);
+}
+
+bool Gamepad::GetConstant(Gamepad::GamepadAxis in, const char*& out)
+{
+    return axes.ReverseFind(in, out);
+}
+
+bool Gamepad::GetConstant(const char* in, GamepadButton& out)
+{
+    return buttons.Find(in, out);
+}
+
+bool Gamepad::GetConstant(GamepadButton in, const char*& out)
+{
+    return buttons.ReverseFind(in, out);
+}
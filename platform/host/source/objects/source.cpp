@@ -0,0 +1,258 @@
+#include "objects/source/source.h"
+#include "modules/audio/audio.h"
+
+#include "driver/audiodrv.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+using namespace love;
+
+using WaveBuf = driver::Audrv::WaveBuf;
+
+StaticDataBuffer::StaticDataBuffer(const void* data, size_t size) : size(size)
+{
+    s16* memory = (s16*)malloc(size);
+
+    if (!memory)
+        throw love::Exception("Not enough audio memory for %zu bytes.", size);
+
+    memcpy(memory, data, size);
+
+    this->buffer = { memory, size };
+}
+
+StaticDataBuffer::~StaticDataBuffer()
+{
+    free(this->buffer.first);
+}
+
+/* SOURCE IMPLEMENTATION */
+
+Source::Source(Pool* pool, SoundData* sound, StaticDataBuffer* buffer) :
+    common::Source(pool, sound, buffer)
+{
+    this->sources[0]                   = WaveBuf();
+    this->sources[0].size              = sound->GetSize();
+    this->sources[0].end_sample_offset = sound->GetSampleCount();
+    this->sources[0].state             = driver::Audrv::WAVEBUF_STATE_DONE;
+}
+
+Source::Source(Pool* pool, Decoder* decoder) : common::Source(pool, decoder)
+{
+    this->InitializeStreamBuffers(decoder);
+}
+
+Source::Source(const Source& other) : common::Source(other)
+{
+    this->InitializeStreamBuffers(this->decoder.Get());
+}
+
+love::Source* Source::Clone()
+{
+    return new Source(*this);
+}
+
+Source::~Source()
+{
+    this->Stop();
+    this->FreeBuffer();
+}
+
+void Source::InitializeStreamBuffers(Decoder* decoder)
+{
+    if (!this->sourceBuffer)
+    {
+        this->souceBufferSize = decoder->GetSize() * MAX_BUFFERS;
+        this->sourceBuffer    = malloc(this->souceBufferSize);
+
+        if (!this->sourceBuffer)
+            throw love::Exception("Not enough audio memory for %zu bytes.", this->souceBufferSize);
+    }
+
+    for (size_t i = 0; i < MAX_BUFFERS; i++)
+    {
+        auto buffer = (s16*)(((size_t)this->sourceBuffer) + i * decoder->GetSize());
+
+        this->sources[i] = WaveBuf { .data_pcm16        = buffer,
+                                     .size              = 0,
+                                     .end_sample_offset = 0,
+                                     .is_looping        = false,
+                                     .state             = driver::Audrv::WAVEBUF_STATE_DONE };
+    }
+}
+
+void Source::FreeBuffer()
+{
+    if (this->sourceType != TYPE_STATIC)
+        free(this->sourceBuffer);
+}
+
+double Source::GetSampleOffset()
+{
+    return driver::Audrv::Instance().GetSampleOffset(this->channel);
+}
+
+void Source::SetVolume(float volume)
+{
+    driver::Audrv::Instance().SetChannelVolume(this->channel, volume);
+    this->volume = volume;
+}
+
+void Source::Reset()
+{
+    driver::Audrv::Instance().ResetChannel(this->channel, this->channels,
+                                           (int)this->GetChannelRate());
+
+    this->ApplyPitch();
+    this->SetVolume(this->GetVolume());
+}
+
+void Source::ApplyPitch()
+{
+    driver::Audrv::Instance().SetChannelPitch(this->channel, this->GetChannelPitch());
+}
+
+bool Source::Update()
+{
+    if (!this->valid)
+        return false;
+
+    switch (this->sourceType)
+    {
+        case TYPE_STATIC:
+            return !this->IsFinished();
+        case TYPE_STREAM:
+        {
+            if (this->IsFinished())
+                return false;
+
+            for (int which = 0; which < Source::MAX_BUFFERS; which++)
+            {
+                if (this->sources[which].state == driver::Audrv::WAVEBUF_STATE_DONE)
+                {
+                    int decoded = this->StreamAtomic(which);
+
+                    if (decoded == 0)
+                        return false;
+
+                    driver::Audrv::Instance().AddWaveBuf(this->channel, &this->sources[which]);
+                }
+            }
+
+            return true;
+        }
+        case TYPE_QUEUE:
+            break;
+        case TYPE_MAX_ENUM:
+        default:
+            break;
+    }
+
+    return false;
+}
+
+void Source::PrepareAtomic()
+{
+    this->Reset();
+
+    switch (this->sourceType)
+    {
+        case TYPE_STATIC:
+            this->sources[0].data_pcm16 = this->staticBuffer->GetBuffer();
+            this->sources[0].is_looping = this->IsLooping();
+            break;
+        case TYPE_STREAM:
+            this->StreamAtomic(0);
+            break;
+        case TYPE_QUEUE:
+        default:
+            break;
+    }
+}
+
+int Source::StreamAtomic(size_t which)
+{
+    auto buffer = this->sources[which].data_pcm16;
+    int decoded = std::max(this->DecodeStream(buffer), 0);
+
+    if (this->decoder->IsFinished() && this->IsLooping())
+        this->decoder->Rewind();
+
+    this->sources[which].size = decoded;
+    this->sources[which].end_sample_offset =
+        (int)((decoded / this->channels) / (this->bitDepth / 8));
+
+    return decoded;
+}
+
+/* IS IT DOING STUFF */
+
+bool Source::IsPlaying() const
+{
+    return this->valid && !driver::Audrv::Instance().IsChannelPaused(this->channel);
+}
+
+bool Source::IsFinished() const
+{
+    if (!this->valid)
+        return false;
+
+    if (this->sourceType == TYPE_STREAM && (this->IsLooping() || !this->decoder->IsFinished()))
+        return false;
+
+    if (this->sourceType == TYPE_STATIC)
+        return this->sources[0].state == driver::Audrv::WAVEBUF_STATE_DONE;
+
+    return driver::Audrv::Instance().IsChannelPlaying(this->channel) == false;
+}
+
+/* ATOMIC STATES */
+
+bool Source::PlayAtomic()
+{
+    this->PrepareAtomic();
+
+    /* add the initial wavebuffer */
+    driver::Audrv::Instance().AddWaveBuf(this->channel, &this->sources[0]);
+
+    if (this->sourceType != TYPE_STREAM)
+        this->offsetSamples = 0;
+
+    if (this->sourceType == TYPE_STREAM)
+        this->valid = true;
+
+    return true;
+}
+
+void Source::PauseAtomic()
+{
+    if (this->valid)
+        driver::Audrv::Instance().PauseChannel(this->channel, true);
+}
+
+void Source::ResumeAtomic()
+{
+    if (this->valid && !this->IsPlaying())
+        driver::Audrv::Instance().PauseChannel(this->channel, false);
+}
+
+void Source::ClearChannel()
+{
+    driver::Audrv::Instance().StopChannel(this->channel);
+}
+
+void Source::StopAtomic()
+{
+    if (!this->valid)
+        return;
+
+    this->TeardownAtomic();
+}
+
+void Source::SetLooping(bool should)
+{
+    this->looping = should;
+    if (this->valid && this->sourceType == TYPE_STATIC)
+        this->sources[0].is_looping = should;
+}
@@ -0,0 +1,51 @@
+#include "objects/thread/thread.h"
+#include "thread/types/lock.h"
+
+love::Thread::Thread(Threadable* t) : common::Thread(t)
+{}
+
+love::Thread::~Thread()
+{
+    thread::Lock lock(this->mutex);
+
+    if (this->hasThread)
+        pthread_detach(this->thread.handle);
+}
+
+void love::Thread::Wait()
+{
+    {
+        thread::Lock lock(this->mutex);
+
+        if (!this->hasThread)
+            return;
+    }
+
+    pthread_join(this->thread.handle, nullptr);
+
+    thread::Lock lock(this->mutex);
+
+    this->running   = false;
+    this->hasThread = false;
+}
+
+bool love::Thread::Start()
+{
+    thread::Lock lock(this->mutex);
+
+    if (this->running)
+        return false;
+
+    if (this->hasThread)
+        pthread_join(this->thread.handle, nullptr);
+
+    auto entry = [](void* data) -> void* {
+        Runner(data);
+        return nullptr;
+    };
+
+    this->running   = pthread_create(&this->thread.handle, nullptr, entry, this) == 0;
+    this->hasThread = this->running;
+
+    return this->running;
+}
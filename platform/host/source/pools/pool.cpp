@@ -0,0 +1,11 @@
+#include "modules/audio/pool/pool.h"
+#include "modules/audio/audio.h"
+
+using namespace love;
+
+/* one Switch audio renderer frame */
+void Pool::Sleep()
+{
+    driver::Audrv::Instance().Update();
+    svcSleepThread(5000000);
+}
@@ -0,0 +1,98 @@
+R"luastring"--(
+-- DO NOT REMOVE THE ABOVE LINE. It is used to load this file as a C++ string.
+-- There is a matching delimiter at the bottom of the file.
+
+--[[
+Stands in for love.graphics, love.font, love.video and love.window on the
+headless host, so a game runs its update and draw code against nothing, and
+for love.physics on a host without Box2D.
+
+Anything asked for is made up on first use from its name: new* and setNew*
+hand back another null object, get* returns 0, is* and has* return false and
+the rest do nothing. The few answers love.run and boot.lua rely on are spelled out.
+--]]
+
+local name = ...
+
+local WIDTH, HEIGHT = 1280, 720
+
+local null = {}
+
+local function constant(...)
+    local values = { ... }
+    local count = select("#", ...)
+
+    return function()
+        return unpack(values, 1, count)
+    end
+end
+
+local function stub(key)
+    if key:find("^new") or key:find("^setNew") then
+        local kind = key:match("New(.+)$") or key:sub(4)
+
+        return function()
+            return null.object(kind)
+        end
+    elseif key:find("^get") then
+        return constant(0)
+    elseif key:find("^is") or key:find("^has") then
+        return constant(false)
+    end
+
+    return function() end
+end
+
+local function fill(target, key)
+    local value = stub(key)
+    rawset(target, key, value)
+
+    return value
+end
+
+local objectMeta = { __index = fill }
+
+function null.object(kind)
+    local object = {}
+
+    object.type = constant(kind)
+    object.typeOf = function(_, other)
+        return other == kind or other == "Object"
+    end
+
+    return setmetatable(object, objectMeta)
+end
+
+local known = {
+    ["love.graphics"] = {
+        getScreens = function()
+            return { "default" }
+        end,
+        getBackgroundColor = constant(0, 0, 0, 1),
+        getColor = constant(1, 1, 1, 1),
+        getWidth = constant(WIDTH),
+        getHeight = constant(HEIGHT),
+        getDimensions = constant(WIDTH, HEIGHT),
+        getActiveScreen = constant("default"),
+        isActive = constant(true),
+    },
+    ["love.window"] = {
+        setMode = constant(true),
+        getMode = function()
+            return WIDTH, HEIGHT, {}
+        end,
+        getDimensions = constant(WIDTH, HEIGHT),
+        showMessageBox = constant(true),
+        isOpen = constant(false),
+    },
+}
+
+local module = setmetatable(known[name] or {}, { __index = fill })
+
+local love = require("love")
+love[name:match("^love%.(.+)$")] = module
+
+return module
+
+-- DO NOT REMOVE THE NEXT LINE. It is used to load this file as a C++ string.
+--)luastring"--"
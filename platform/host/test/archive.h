@@ -0,0 +1,210 @@
+#pragma once
+
+#include <physfs.h>
+#include <zlib.h>
+
+#include <string.h>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+/*
+** Just enough PhysFS for File and EntryCache, for test/ and bench/. There
+** is the game's archive and a second one, whose entries are inflated on
+** every open like PhysFS's zip reader does, and loose entries that come
+** from a plain directory.
+** Include it from one file per program; it defines the PHYSFS_ calls.
+*/
+namespace love::archive
+{
+    constexpr const char* PATH  = "/tmp/game.love";
+    constexpr const char* DLC   = "/tmp/dlc.zip";
+    constexpr const char* LOOSE = "/tmp";
+
+    struct Entry
+    {
+        std::vector<uint8_t> packed;
+        size_t size;
+        const char* directory;
+    };
+
+    struct Open
+    {
+        std::vector<uint8_t> bytes;
+        size_t position;
+    };
+
+    inline std::map<std::string, Entry> entries;
+
+    /* PHYSFS_openRead calls, cache hits don't make any */
+    inline int opens = 0;
+
+    /* into @directory, one of the three above */
+    inline void AddTo(const char* directory, const std::string& name, const std::string& content)
+    {
+        Entry entry {};
+
+        uLongf packed = compressBound(content.size());
+        entry.packed.resize(packed);
+
+        compress2(entry.packed.data(), &packed, (const Bytef*)content.data(), content.size(), 6);
+
+        entry.packed.resize(packed);
+        entry.size      = content.size();
+        entry.directory = directory;
+
+        entries[name] = std::move(entry);
+    }
+
+    inline void Add(const std::string& name, const std::string& content, bool loose = false)
+    {
+        AddTo(loose ? LOOSE : PATH, name, content);
+    }
+} // namespace love::archive
+
+int PHYSFS_isInit()
+{
+    return 1;
+}
+
+int PHYSFS_exists(const char* name)
+{
+    return love::archive::entries.count(name) != 0;
+}
+
+const char* PHYSFS_getRealDir(const char* name)
+{
+    auto found = love::archive::entries.find(name);
+
+    if (found == love::archive::entries.end())
+        return nullptr;
+
+    return found->second.directory;
+}
+
+int PHYSFS_stat(const char* name, PHYSFS_Stat* stat)
+{
+    auto found = love::archive::entries.find(name);
+
+    if (found == love::archive::entries.end())
+        return 0;
+
+    stat->filesize = (PHYSFS_sint64)found->second.size;
+    stat->filetype = PHYSFS_FILETYPE_REGULAR;
+
+    return 1;
+}
+
+PHYSFS_File* PHYSFS_openRead(const char* name)
+{
+    auto found = love::archive::entries.find(name);
+
+    if (found == love::archive::entries.end())
+        return nullptr;
+
+    auto* open  = new love::archive::Open { std::vector<uint8_t>(found->second.size), 0 };
+    uLongf size = found->second.size;
+
+    uncompress(open->bytes.data(), &size, found->second.packed.data(),
+               found->second.packed.size());
+
+    love::archive::opens++;
+
+    return new PHYSFS_File { open };
+}
+
+int PHYSFS_close(PHYSFS_File* file)
+{
+    delete (love::archive::Open*)file->opaque;
+    delete file;
+
+    return 1;
+}
+
+PHYSFS_sint64 PHYSFS_readBytes(PHYSFS_File* file, void* destination, PHYSFS_uint64 size)
+{
+    love::archive::Open* open = (love::archive::Open*)file->opaque;
+
+    size = std::min<PHYSFS_uint64>(size, open->bytes.size() - open->position);
+    memcpy(destination, open->bytes.data() + open->position, size);
+
+    open->position += size;
+
+    return (PHYSFS_sint64)size;
+}
+
+PHYSFS_sint64 PHYSFS_fileLength(PHYSFS_File* file)
+{
+    return (PHYSFS_sint64)((love::archive::Open*)file->opaque)->bytes.size();
+}
+
+int PHYSFS_eof(PHYSFS_File* file)
+{
+    love::archive::Open* open = (love::archive::Open*)file->opaque;
+    return open->position >= open->bytes.size();
+}
+
+int PHYSFS_seek(PHYSFS_File* file, PHYSFS_uint64 position)
+{
+    love::archive::Open* open = (love::archive::Open*)file->opaque;
+
+    if (position > open->bytes.size())
+        return 0;
+
+    open->position = position;
+
+    return 1;
+}
+
+PHYSFS_sint64 PHYSFS_tell(PHYSFS_File* file)
+{
+    return (PHYSFS_sint64)((love::archive::Open*)file->opaque)->position;
+}
+
+int PHYSFS_setBuffer(PHYSFS_File*, PHYSFS_uint64)
+{
+    return 1;
+}
+
+/* read only */
+const char* PHYSFS_getWriteDir()
+{
+    return nullptr;
+}
+
+PHYSFS_File* PHYSFS_openWrite(const char*)
+{
+    return nullptr;
+}
+
+PHYSFS_File* PHYSFS_openAppend(const char*)
+{
+    return nullptr;
+}
+
+PHYSFS_sint64 PHYSFS_writeBytes(PHYSFS_File*, const void*, PHYSFS_uint64)
+{
+    return -1;
+}
+
+int PHYSFS_flush(PHYSFS_File*)
+{
+    return 1;
+}
+
+PHYSFS_ErrorCode PHYSFS_getLastErrorCode()
+{
+    return 0;
+}
+
+const char* PHYSFS_getErrorByCode(PHYSFS_ErrorCode)
+{
+    return nullptr;
+}
+
+bool SetupWriteDirectory()
+{
+    return false;
+}
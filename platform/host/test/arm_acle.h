@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+** Scalar stand-ins for the ARMv6 SIMD32 intrinsics the engine uses, as
+** the ACLE describes them, so test/smlad can build the 3DS kernels with
+** __ARM_FEATURE_SIMD32 on the host. As with test/arm_neon.h, only what's
+** used is here.
+*/
+
+/* two 16-bit lanes in one word, the low half first */
+typedef int32_t int16x2_t;
+
+inline int16_t Lane(int16x2_t pair, int lane)
+{
+    return int16_t(uint32_t(pair) >> (lane * 16));
+}
+
+/* both lanes multiplied and added to @accumulator */
+inline int32_t __smlad(int16x2_t a, int16x2_t b, int32_t accumulator)
+{
+    return accumulator + Lane(a, 0) * Lane(b, 0) + Lane(a, 1) * Lane(b, 1);
+}
@@ -0,0 +1,230 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+** Scalar stand-ins for the NEON intrinsics the engine uses, one lane at a
+** time as the Arm reference describes them. There's no Arm compiler or
+** emulator on the host, so test/neon builds the kernels with __ARM_NEON
+** against this header, to check their lane logic against the scalar code.
+** Only what's used is here; a missing one is a compile error, not a guess.
+*/
+
+template<typename T, int N>
+struct NeonVector
+{
+    T lane[N];
+};
+
+using uint16x4_t = NeonVector<uint16_t, 4>;
+using uint16x8_t = NeonVector<uint16_t, 8>;
+using uint32x4_t = NeonVector<uint32_t, 4>;
+
+using int16x4_t = NeonVector<int16_t, 4>;
+using int32x2_t = NeonVector<int32_t, 2>;
+using int32x4_t = NeonVector<int32_t, 4>;
+
+struct uint16x8x4_t
+{
+    uint16x8_t val[4];
+};
+
+inline uint16x8_t vdupq_n_u16(uint16_t value)
+{
+    uint16x8_t result;
+
+    for (int index = 0; index < 8; index++)
+        result.lane[index] = value;
+
+    return result;
+}
+
+inline uint32x4_t vdupq_n_u32(uint32_t value)
+{
+    uint32x4_t result;
+
+    for (int index = 0; index < 4; index++)
+        result.lane[index] = value;
+
+    return result;
+}
+
+inline uint16x4_t vget_low_u16(uint16x8_t vector)
+{
+    uint16x4_t result;
+
+    for (int index = 0; index < 4; index++)
+        result.lane[index] = vector.lane[index];
+
+    return result;
+}
+
+inline uint16x4_t vget_high_u16(uint16x8_t vector)
+{
+    uint16x4_t result;
+
+    for (int index = 0; index < 4; index++)
+        result.lane[index] = vector.lane[index + 4];
+
+    return result;
+}
+
+inline uint16x8_t vcombine_u16(uint16x4_t low, uint16x4_t high)
+{
+    uint16x8_t result;
+
+    for (int index = 0; index < 4; index++)
+    {
+        result.lane[index]     = low.lane[index];
+        result.lane[index + 4] = high.lane[index];
+    }
+
+    return result;
+}
+
+/* de-interleaving load and interleaving store of four channels */
+inline uint16x8x4_t vld4q_u16(const uint16_t* source)
+{
+    uint16x8x4_t result;
+
+    for (int index = 0; index < 8; index++)
+    {
+        for (int channel = 0; channel < 4; channel++)
+            result.val[channel].lane[index] = source[index * 4 + channel];
+    }
+
+    return result;
+}
+
+inline void vst4q_u16(uint16_t* destination, uint16x8x4_t vectors)
+{
+    for (int index = 0; index < 8; index++)
+    {
+        for (int channel = 0; channel < 4; channel++)
+            destination[index * 4 + channel] = vectors.val[channel].lane[index];
+    }
+}
+
+inline uint32x4_t vaddq_u32(uint32x4_t a, uint32x4_t b)
+{
+    uint32x4_t result;
+
+    for (int index = 0; index < 4; index++)
+        result.lane[index] = a.lane[index] + b.lane[index];
+
+    return result;
+}
+
+/* widening multiplies, and the accumulating one */
+inline uint32x4_t vmull_u16(uint16x4_t a, uint16x4_t b)
+{
+    uint32x4_t result;
+
+    for (int index = 0; index < 4; index++)
+        result.lane[index] = uint32_t(a.lane[index]) * b.lane[index];
+
+    return result;
+}
+
+inline uint32x4_t vmull_n_u16(uint16x4_t a, uint16_t b)
+{
+    uint32x4_t result;
+
+    for (int index = 0; index < 4; index++)
+        result.lane[index] = uint32_t(a.lane[index]) * b;
+
+    return result;
+}
+
+inline uint32x4_t vmlal_n_u16(uint32x4_t accumulator, uint16x4_t a, uint16_t b)
+{
+    for (int index = 0; index < 4; index++)
+        accumulator.lane[index] += uint32_t(a.lane[index]) * b;
+
+    return accumulator;
+}
+
+/* @a plus @b shifted right */
+inline uint32x4_t vsraq_n_u32(uint32x4_t a, uint32x4_t b, int shift)
+{
+    for (int index = 0; index < 4; index++)
+        a.lane[index] += b.lane[index] >> shift;
+
+    return a;
+}
+
+/* shifted right, then truncated to the narrower lanes */
+inline uint16x4_t vshrn_n_u32(uint32x4_t a, int shift)
+{
+    uint16x4_t result;
+
+    for (int index = 0; index < 4; index++)
+        result.lane[index] = uint16_t(a.lane[index] >> shift);
+
+    return result;
+}
+
+/* all ones where @a >= @b, zero elsewhere */
+inline uint16x8_t vcgeq_u16(uint16x8_t a, uint16x8_t b)
+{
+    uint16x8_t result;
+
+    for (int index = 0; index < 8; index++)
+        result.lane[index] = (a.lane[index] >= b.lane[index]) ? 0xFFFF : 0;
+
+    return result;
+}
+
+inline int32x4_t vdupq_n_s32(int32_t value)
+{
+    int32x4_t result;
+
+    for (int index = 0; index < 4; index++)
+        result.lane[index] = value;
+
+    return result;
+}
+
+inline int16x4_t vld1_s16(const int16_t* source)
+{
+    int16x4_t result;
+
+    for (int index = 0; index < 4; index++)
+        result.lane[index] = source[index];
+
+    return result;
+}
+
+inline int32x4_t vmlal_s16(int32x4_t accumulator, int16x4_t a, int16x4_t b)
+{
+    for (int index = 0; index < 4; index++)
+        accumulator.lane[index] += int32_t(a.lane[index]) * b.lane[index];
+
+    return accumulator;
+}
+
+inline int32x2_t vget_low_s32(int32x4_t vector)
+{
+    return int32x2_t { { vector.lane[0], vector.lane[1] } };
+}
+
+inline int32x2_t vget_high_s32(int32x4_t vector)
+{
+    return int32x2_t { { vector.lane[2], vector.lane[3] } };
+}
+
+inline int32x2_t vadd_s32(int32x2_t a, int32x2_t b)
+{
+    return int32x2_t { { a.lane[0] + b.lane[0], a.lane[1] + b.lane[1] } };
+}
+
+/* pairwise: the sum of @a's lanes, then the sum of @b's */
+inline int32x2_t vpadd_s32(int32x2_t a, int32x2_t b)
+{
+    return int32x2_t { { a.lane[0] + a.lane[1], b.lane[0] + b.lane[1] } };
+}
+
+inline int32_t vget_lane_s32(int32x2_t vector, int lane)
+{
+    return vector.lane[lane];
+}
@@ -0,0 +1,212 @@
+#include "check.h"
+
+#include "common/exception.h"
+#include "modules/event/event.h"
+#include "modules/filesystem/filesystem.h"
+#include "modules/timer/timer.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <new>
+#include <string.h>
+
+using namespace love;
+
+/*
+** AsyncIO only calls these four, so they stand in for PhysFS with a map.
+** Only the I/O thread touches it; the Futures order that with the test.
+** No love.event is loaded, so nothing is ever pushed.
+*/
+namespace
+{
+    std::map<std::string, std::string> files;
+
+    int appends = 0;
+
+    /* writing "gate" holds the I/O thread until Open() */
+    std::mutex gateMutex;
+    std::condition_variable gateCondition;
+    bool gateOpen = true;
+
+    void Close()
+    {
+        std::lock_guard<std::mutex> lock(gateMutex);
+        gateOpen = false;
+    }
+
+    void Open()
+    {
+        {
+            std::lock_guard<std::mutex> lock(gateMutex);
+            gateOpen = true;
+        }
+
+        gateCondition.notify_all();
+    }
+
+    /* never constructed, AsyncIO only needs somewhere to call */
+    Filesystem* filesystem = nullptr;
+
+    std::string text(Future* future)
+    {
+        auto results = future->GetResults();
+
+        if (results.size() != 1)
+            return "";
+
+        FileData* data = (FileData*)results[0].GetValue<Variant::LOVE_OBJECT>().object;
+        return std::string((const char*)data->GetData(), data->GetSize());
+    }
+} // namespace
+
+FileData* Filesystem::Read(const char* filename, int64_t)
+{
+    auto found = files.find(filename);
+
+    if (found == files.end())
+        throw love::Exception("Could not open file %s.", filename);
+
+    FileData* data = new FileData(found->second.size(), filename);
+    memcpy(data->GetData(), found->second.data(), found->second.size());
+
+    return data;
+}
+
+void Filesystem::Write(const char* filename, const void* data, int64_t size)
+{
+    if (strcmp(filename, "gate") == 0)
+    {
+        std::unique_lock<std::mutex> lock(gateMutex);
+        gateCondition.wait(lock, [] { return gateOpen; });
+    }
+
+    /* what the engine's own allocations throw when the heap runs out */
+    if (strcmp(filename, "full") == 0)
+        throw std::bad_alloc();
+
+    files[filename].assign((const char*)data, size);
+}
+
+void Filesystem::Append(const char* filename, const void* data, int64_t size)
+{
+    files[filename].append((const char*)data, size);
+    appends++;
+}
+
+bool Filesystem::Mount(const char* archive, const char*, bool)
+{
+    return strcmp(archive, "game.zip") == 0;
+}
+
+void common::Event::Push(Message*)
+{}
+
+double common::Timer::GetTime()
+{
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration<double>(now).count();
+}
+
+TEST(read_sees_queued_write)
+{
+    StrongReference<AsyncIO> io(new AsyncIO(filesystem), Acquire::NORETAIN);
+    CHECK(io->Start());
+
+    StrongReference<Future> write(io->Write("save", "hello", 5), Acquire::NORETAIN);
+    StrongReference<Future> read(io->Read("save", -1), Acquire::NORETAIN);
+
+    CHECK(read->Wait());
+    CHECK(write->IsDone());
+    CHECK(text(read) == "hello");
+
+    io->Stop();
+}
+
+TEST(appends_share_one_open)
+{
+    StrongReference<AsyncIO> io(new AsyncIO(filesystem), Acquire::NORETAIN);
+    CHECK(io->Start());
+
+    Close();
+    io->Write("gate", "", 0)->Release();
+
+    for (int index = 0; index < 100; index++)
+        io->Append("log", "line\n", 5)->Release();
+
+    /* a write to another file in between starts a new run */
+    io->Write("other", "x", 1)->Release();
+    io->Append("log", "last\n", 5)->Release();
+
+    appends = 0;
+    Open();
+    io->Flush();
+
+    CHECK(appends == 2);
+    CHECK(files["log"].size() == 101 * 5);
+    CHECK(io->GetPendingCount() == 0);
+
+    io->Stop();
+}
+
+TEST(errors_fail_only_their_future)
+{
+    StrongReference<AsyncIO> io(new AsyncIO(filesystem), Acquire::NORETAIN);
+    CHECK(io->Start());
+
+    StrongReference<Future> full(io->Write("full", "x", 1), Acquire::NORETAIN);
+    StrongReference<Future> missing(io->Read("missing", -1), Acquire::NORETAIN);
+    StrongReference<Future> after(io->Write("after", "y", 1), Acquire::NORETAIN);
+
+    CHECK(after->Wait());
+
+    CHECK(!full->GetError().empty());
+    CHECK(missing->GetError() == "Could not open file missing.");
+    CHECK(after->GetError().empty() && files["after"] == "y");
+
+    io->Stop();
+}
+
+TEST(mount_reports_success)
+{
+    StrongReference<AsyncIO> io(new AsyncIO(filesystem), Acquire::NORETAIN);
+    CHECK(io->Start());
+
+    StrongReference<Future> good(io->Mount("game.zip", "/", true), Acquire::NORETAIN);
+    StrongReference<Future> bad(io->Mount("../etc", "/", true), Acquire::NORETAIN);
+
+    CHECK(bad->Wait());
+
+    CHECK(good->GetResults()[0].GetValue<Variant::BOOLEAN>());
+    CHECK(!bad->GetResults()[0].GetValue<Variant::BOOLEAN>());
+
+    io->Stop();
+}
+
+/* what ~Filesystem counts on to land the last writes before PhysFS goes */
+TEST(stop_finishes_what_is_queued)
+{
+    StrongReference<AsyncIO> io(new AsyncIO(filesystem), Acquire::NORETAIN);
+    CHECK(io->Start());
+
+    Close();
+    io->Write("gate", "", 0)->Release();
+
+    std::vector<StrongReference<Future>> writes;
+
+    for (int index = 0; index < 20; index++)
+    {
+        std::string name = "slot" + std::to_string(index);
+        writes.emplace_back(io->Write(name, name.data(), name.size()), Acquire::NORETAIN);
+    }
+
+    Open();
+    io->Stop();
+
+    for (const auto& write : writes)
+        CHECK(write->IsDone());
+
+    CHECK(files["slot19"] == "slot19");
+    CHECK(io->GetPendingCount() == 0);
+}
@@ -0,0 +1,153 @@
+#include "check.h"
+
+#include "modules/audio/audiocache.h"
+
+#include "staticbuffer.h"
+
+using namespace love;
+
+namespace
+{
+    /* 1000 16-bit mono samples, 2000 bytes */
+    constexpr size_t SOUND_BYTES = 2000;
+
+    StrongReference<SoundData> sound()
+    {
+        return StrongReference<SoundData>(new SoundData(1000, 44100, 16, 1), Acquire::NORETAIN);
+    }
+
+    /* a miss or a hit, the buffer is released straight away */
+    void play(AudioCache& cache, SoundData* sound)
+    {
+        cache.GetBuffer(sound)->Release();
+    }
+} // namespace
+
+TEST(clones_share_one_buffer)
+{
+    AudioCache cache;
+
+    auto original = sound();
+    StrongReference<SoundData> clone(original->Clone(), Acquire::NORETAIN);
+
+    StaticDataBuffer* first  = cache.GetBuffer(original.Get());
+    StaticDataBuffer* second = cache.GetBuffer(clone.Get());
+
+    CHECK(first == second);
+
+    auto stats = cache.GetStats();
+    CHECK(stats.hits == 1 && stats.misses == 1 && stats.buffers == 1);
+    CHECK(stats.bufferBytes == SOUND_BYTES);
+
+    first->Release();
+    second->Release();
+}
+
+TEST(written_sounds_get_their_own_buffer)
+{
+    AudioCache cache;
+
+    auto original = sound();
+    StrongReference<SoundData> clone(original->Clone(), Acquire::NORETAIN);
+
+    clone->SetSample(0, 0.5f);
+
+    StaticDataBuffer* first  = cache.GetBuffer(original.Get());
+    StaticDataBuffer* second = cache.GetBuffer(clone.Get());
+
+    CHECK(first != second);
+    CHECK(cache.GetStats().misses == 2);
+
+    first->Release();
+    second->Release();
+}
+
+TEST(only_unreferenced_entries_are_evicted)
+{
+    AudioCache cache;
+    cache.SetBudgets(AudioCache::DEFAULT_SOUND_BUDGET, SOUND_BYTES * 2);
+
+    auto playing = sound();
+    auto idle    = sound();
+    auto next    = sound();
+
+    /* the oldest entry is still held by a Source */
+    StaticDataBuffer* held = cache.GetBuffer(playing.Get());
+
+    play(cache, idle.Get());
+    play(cache, next.Get());
+
+    auto stats = cache.GetStats();
+    CHECK(stats.evictions == 1 && stats.buffers == 2);
+    CHECK(staticbuffer::live == 2);
+
+    /* the held one was stepped over, the idle one went */
+    play(cache, playing.Get());
+    CHECK(cache.GetStats().hits == 1);
+
+    held->Release();
+    CHECK(staticbuffer::live == 2);
+}
+
+TEST(eviction_follows_use)
+{
+    AudioCache cache;
+    cache.SetBudgets(AudioCache::DEFAULT_SOUND_BUDGET, SOUND_BYTES * 2);
+
+    auto first  = sound();
+    auto second = sound();
+    auto third  = sound();
+
+    play(cache, first.Get());
+    play(cache, second.Get());
+
+    /* used again, so second is now the least recent */
+    play(cache, first.Get());
+    play(cache, third.Get());
+
+    play(cache, first.Get());
+    CHECK(cache.GetStats().hits == 2);
+
+    play(cache, second.Get());
+    CHECK(cache.GetStats().misses == 4);
+}
+
+TEST(changed_files_are_decoded_again)
+{
+    AudioCache cache;
+
+    auto decoded = sound();
+    cache.AddSoundData("sfx/jump.wav", 100, 4096, decoded.Get());
+
+    SoundData* found = cache.GetSoundData("sfx/jump.wav", 100, 4096);
+    CHECK(found == decoded.Get());
+    found->Release();
+
+    CHECK(cache.GetSoundData("sfx/jump.wav", 101, 4096) == nullptr);
+    CHECK(cache.GetStats().sounds == 0 && cache.GetStats().soundBytes == 0);
+
+    /* gone from the cache, not from whoever held it */
+    CHECK(decoded->GetReferenceCount() == 1);
+    CHECK(cache.GetSoundData("sfx/jump.wav", 100, 4096) == nullptr);
+}
+
+TEST(sounds_over_budget_go_oldest_first)
+{
+    AudioCache cache;
+    cache.SetBudgets(SOUND_BYTES * 2, AudioCache::DEFAULT_BUFFER_BUDGET);
+
+    cache.AddSoundData("a.wav", 1, 1, sound().Get());
+    cache.AddSoundData("b.wav", 1, 1, sound().Get());
+
+    SoundData* touched = cache.GetSoundData("a.wav", 1, 1);
+    touched->Release();
+
+    cache.AddSoundData("c.wav", 1, 1, sound().Get());
+
+    SoundData* kept = cache.GetSoundData("a.wav", 1, 1);
+    CHECK(kept != nullptr);
+    kept->Release();
+
+    CHECK(cache.GetSoundData("b.wav", 1, 1) == nullptr);
+    CHECK(cache.GetStats().evictions == 1);
+}
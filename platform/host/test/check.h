@@ -0,0 +1,41 @@
+#pragma once
+
+#include <vector>
+
+/*
+** Just enough of a test framework for the host target. Every TEST linked
+** into a program is run by main.cpp, in the order they were written; a
+** CHECK that fails reports where, fails its test and carries on with it.
+*/
+namespace love::test
+{
+    struct Case
+    {
+        const char* name;
+        void (*function)();
+    };
+
+    std::vector<Case>& GetCases();
+
+    void Fail(const char* file, int line, const char* expression);
+
+    struct Register
+    {
+        Register(const char* name, void (*function)())
+        {
+            GetCases().push_back({ name, function });
+        }
+    };
+} // namespace love::test
+
+#define TEST(name)                                                        \
+    static void test_##name();                                            \
+    static love::test::Register register_##name(#name, test_##name);     \
+    static void test_##name()
+
+#define CHECK(expression)                                                 \
+    do                                                                    \
+    {                                                                     \
+        if (!(expression))                                                \
+            love::test::Fail(__FILE__, __LINE__, #expression);            \
+    } while (0)
@@ -0,0 +1,87 @@
+#include "check.h"
+
+#include "common/cowbuffer.h"
+
+#include <string.h>
+
+using namespace love;
+
+namespace
+{
+    constexpr size_t BLOCK = 0x100;
+    constexpr size_t SIZE  = BLOCK * 4;
+
+    CowBuffer filled()
+    {
+        CowBuffer buffer(SIZE, BLOCK);
+        uint8_t* bytes = buffer.WriteContiguous();
+
+        for (size_t index = 0; index < SIZE; index++)
+            bytes[index] = uint8_t(index);
+
+        return buffer;
+    }
+} // namespace
+
+TEST(copies_share_until_written)
+{
+    CowBuffer original = filled();
+    int64_t allocated  = CowBuffer::GetAllocatedBytes();
+
+    CowBuffer copy(original);
+
+    CHECK(copy.IsShared() && original.IsShared());
+    CHECK(CowBuffer::GetAllocatedBytes() == allocated);
+    CHECK(copy.ReadBlock(0) == original.ReadBlock(0));
+}
+
+TEST(write_copies_one_block)
+{
+    CowBuffer original = filled();
+    int64_t allocated  = CowBuffer::GetAllocatedBytes();
+
+    CowBuffer copy(original);
+    copy.WriteBlock(BLOCK * 2)[0] = 0xFF;
+
+    CHECK(CowBuffer::GetAllocatedBytes() == allocated + (int64_t)BLOCK);
+    CHECK(original.ReadBlock(BLOCK * 2)[0] == uint8_t(BLOCK * 2));
+    CHECK(copy.ReadBlock(BLOCK * 2)[0] == 0xFF);
+
+    /* the blocks it didn't write to are still the original's */
+    CHECK(copy.ReadBlock(0) == original.ReadBlock(0));
+}
+
+TEST(read_contiguous_keeps_sharing)
+{
+    CowBuffer original = filled();
+    CowBuffer copy(original);
+
+    CHECK(copy.ReadContiguous() == original.ReadContiguous());
+    CHECK(copy.IsShared());
+}
+
+TEST(write_contiguous_unshares)
+{
+    CowBuffer original = filled();
+    CowBuffer copy(original);
+
+    uint8_t* bytes = copy.WriteContiguous();
+
+    CHECK(bytes != original.ReadContiguous());
+    CHECK(!copy.IsShared() && !original.IsShared());
+    CHECK(memcmp(bytes, original.ReadContiguous(), SIZE) == 0);
+}
+
+TEST(read_contiguous_joins_written_blocks)
+{
+    CowBuffer original = filled();
+    CowBuffer copy(original);
+
+    copy.WriteBlock(BLOCK)[1] = 0xAB;
+
+    const uint8_t* joined = copy.ReadContiguous();
+
+    CHECK(joined[BLOCK + 1] == 0xAB);
+    CHECK(joined[0] == 0 && joined[SIZE - 1] == uint8_t(SIZE - 1));
+    CHECK(original.ReadContiguous()[BLOCK + 1] == uint8_t(BLOCK + 1));
+}
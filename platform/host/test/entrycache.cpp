@@ -0,0 +1,180 @@
+#include "check.h"
+
+#include "archive.h"
+
+#include "modules/filesystem/entrycache.h"
+#include "objects/file/file.h"
+
+using namespace love;
+
+namespace
+{
+    std::string text(size_t size)
+    {
+        std::string content;
+
+        while (content.size() < size)
+            content += "greeting_" + std::to_string(content.size() % 977) + " = \"Hello\"\n";
+
+        content.resize(size);
+
+        return content;
+    }
+
+    /* each test starts from an empty cache at the default budget */
+    void reset()
+    {
+        EntryCache::Instance().SetBudget(EntryCache::DEFAULT_BUDGET);
+        EntryCache::Instance().Clear();
+    }
+
+    std::string readAll(const char* filename)
+    {
+        File file(filename);
+        StrongReference<FileData> data(file.Read(), Acquire::NORETAIN);
+
+        return std::string((const char*)data->GetData(), data->GetSize());
+    }
+} // namespace
+
+TEST(chunked_reads_match_the_entry)
+{
+    reset();
+
+    std::string content = text(48 * 1024);
+    archive::Add("lang/en.lua", content);
+
+    CHECK(readAll("lang/en.lua") == content);
+
+    File file("lang/en.lua");
+    file.Open(File::MODE_READ);
+
+    std::string chunks;
+    char buffer[1000];
+    int64_t read = 0;
+
+    while ((read = file.Read(buffer, sizeof(buffer))) > 0)
+        chunks.append(buffer, read);
+
+    CHECK(chunks == content);
+    CHECK(file.IsEOF());
+
+    CHECK(file.Seek(10) && file.Tell() == 10);
+    CHECK(file.Read(buffer, 5) == 5 && memcmp(buffer, content.data() + 10, 5) == 0);
+
+    file.Close();
+}
+
+TEST(second_read_skips_the_inflate)
+{
+    reset();
+
+    archive::Add("shaders/blur.glsl", text(6 * 1024));
+
+    int opens   = archive::opens;
+    auto before = EntryCache::Instance().GetStats();
+
+    readAll("shaders/blur.glsl");
+    readAll("shaders/blur.glsl");
+
+    CHECK(archive::opens == opens + 1);
+
+    /* the counts add up over the cache's life, Clear leaves them */
+    auto stats = EntryCache::Instance().GetStats();
+    CHECK(stats.hits == before.hits + 1 && stats.misses == before.misses + 1);
+    CHECK(stats.entries == 1 && stats.bytes == 6 * 1024);
+}
+
+TEST(loose_files_are_read_every_time)
+{
+    reset();
+
+    archive::Add("conf.lua", text(512), true);
+    int opens = archive::opens;
+
+    readAll("conf.lua");
+    readAll("conf.lua");
+
+    CHECK(archive::opens == opens + 2);
+    CHECK(EntryCache::Instance().GetStats().entries == 0);
+}
+
+TEST(big_entries_are_streamed)
+{
+    reset();
+
+    std::string content = text(EntryCache::DEFAULT_BUDGET / EntryCache::ENTRY_FRACTION + 1);
+    archive::Add("music.ogg", content);
+
+    CHECK(readAll("music.ogg") == content);
+    CHECK(EntryCache::Instance().GetStats().entries == 0);
+}
+
+TEST(shrinking_evicts_least_recently_read)
+{
+    reset();
+
+    archive::Add("a", text(4096));
+    archive::Add("b", text(4096));
+    archive::Add("c", text(4096));
+
+    readAll("a");
+    readAll("b");
+    readAll("c");
+    readAll("a");
+
+    EntryCache::Instance().SetBudget(8192);
+
+    auto stats = EntryCache::Instance().GetStats();
+    CHECK(stats.entries == 2 && stats.bytes == 8192);
+
+    /* b went first, a was read after it */
+    int opens = archive::opens;
+
+    readAll("a");
+    CHECK(archive::opens == opens);
+
+    readAll("b");
+    CHECK(archive::opens == opens + 1);
+}
+
+TEST(zero_budget_turns_it_off)
+{
+    reset();
+
+    archive::Add("off", text(1024));
+    EntryCache::Instance().SetBudget(0);
+
+    int opens = archive::opens;
+
+    readAll("off");
+    readAll("off");
+
+    CHECK(archive::opens == opens + 2);
+    CHECK(EntryCache::Instance().GetStats().entries == 0);
+}
+
+/* unmounting one archive leaves what was read out of the others */
+TEST(invalidate_drops_only_that_archive)
+{
+    reset();
+
+    archive::Add("title.png", text(2048));
+    archive::AddTo(archive::DLC, "levels/9.lua", text(3072));
+
+    readAll("title.png");
+    readAll("levels/9.lua");
+
+    EntryCache::Instance().Invalidate(archive::DLC);
+
+    auto stats = EntryCache::Instance().GetStats();
+    CHECK(stats.entries == 1 && stats.bytes == 2048);
+
+    int opens = archive::opens;
+
+    readAll("title.png");
+    CHECK(archive::opens == opens);
+
+    readAll("levels/9.lua");
+    CHECK(archive::opens == opens + 1);
+}
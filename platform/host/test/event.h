@@ -0,0 +1,164 @@
+#pragma once
+
+#include "modules/event/event.h"
+#include "modules/event/wrap_event.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <vector>
+
+/*
+** Stands in for Event, for test/pollall and bench/pollall: Pump moves
+** what the program queued into the real EventRing and the rest behaves
+** as Event does without a driver. wrap_event.cpp is the real one. There
+** are no recordings, so Record and Replay throw, and no joysticks.
+*/
+namespace love::eventqueue
+{
+    inline std::vector<EventRecord> queued;
+
+    inline EventRecord Named(const char* name)
+    {
+        EventRecord record {};
+
+        record.kind = EventRecord::KIND_NAME;
+        record.name = name;
+
+        return record;
+    }
+
+    inline EventRecord Touch(int64_t id, float x, float y)
+    {
+        EventRecord record {};
+
+        record.kind  = EventRecord::KIND_TOUCH;
+        record.name  = "touchmoved";
+        record.touch = { id, x, y, 1, 1, 1 };
+
+        return record;
+    }
+
+    inline EventRecord Resize(int width, int height)
+    {
+        EventRecord record {};
+
+        record.kind = EventRecord::KIND_RESIZE;
+        record.name = "resize";
+        record.size = { width, height };
+
+        return record;
+    }
+
+    /* love.event in @L, with an Event of its own */
+    inline lua_State* Open(lua_State* L = luaL_newstate())
+    {
+        luaL_openlibs(L);
+
+        Wrap_Event::Register(L);
+        lua_pop(L, 1);
+
+        return L;
+    }
+
+    inline void Run(lua_State* L, const char* chunk)
+    {
+        if (luaL_dostring(L, chunk) == 0)
+            return;
+
+        fprintf(stderr, "%s\n", lua_tostring(L, -1));
+        abort();
+    }
+
+    /* a global boolean set by the last chunk */
+    inline bool Get(lua_State* L, const char* name)
+    {
+        lua_getglobal(L, name);
+        bool value = lua_toboolean(L, -1);
+        lua_pop(L, 1);
+
+        return value;
+    }
+} // namespace love::eventqueue
+
+using love::EventRecord;
+
+love::common::Event::Event() : logMode(LOG_NONE), frame(0), logStart(0), replayEnded(false)
+{}
+
+love::common::Event::~Event()
+{
+    this->ring.Clear();
+}
+
+void love::common::Event::Pump()
+{
+    thread::Lock lock(this->mutex);
+
+    for (const EventRecord& record : eventqueue::queued)
+        this->ring.Append() = record;
+
+    eventqueue::queued.clear();
+}
+
+void love::common::Event::Clear()
+{
+    thread::Lock lock(this->mutex);
+
+    this->ring.Clear();
+}
+
+bool love::common::Event::Poll(EventRecord& record)
+{
+    thread::Lock lock(this->mutex);
+
+    return this->ring.Pop(record);
+}
+
+void love::common::Event::Push(Message* message)
+{
+    thread::Lock lock(this->mutex);
+
+    message->Retain();
+
+    EventRecord& record = this->ring.Append();
+
+    record.kind    = EventRecord::KIND_MESSAGE;
+    record.message = message;
+}
+
+bool love::common::Event::Wait(EventRecord& record)
+{
+    return this->Poll(record);
+}
+
+void love::common::Event::Record(const std::string&)
+{
+    throw love::Exception("No recordings in the Event stand-in.");
+}
+
+void love::common::Event::Replay(const std::string&)
+{
+    throw love::Exception("No recordings in the Event stand-in.");
+}
+
+void love::common::Event::Stop()
+{}
+
+bool love::common::Event::IsRecording() const
+{
+    return false;
+}
+
+bool love::common::Event::IsReplaying() const
+{
+    return false;
+}
+
+bool love::driver::Hidrv::Poll(LOVE_Event*)
+{
+    return false;
+}
+
+/* as in gamepadc.cpp, for the joystick events no one here queues */
+love::Type love::common::Gamepad::type("Joystick", &Object::type);
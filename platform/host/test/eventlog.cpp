@@ -0,0 +1,240 @@
+#include "check.h"
+
+#include "common/exception.h"
+#include "modules/event/eventlog.h"
+
+#include <string.h>
+
+#include <utility>
+#include <vector>
+
+using namespace love;
+
+using Hidrv      = driver::Hidrv;
+using LOVE_Event = EventLog::LOVE_Event;
+
+namespace
+{
+    using Recorded = std::vector<std::pair<uint32_t, LOVE_Event>>;
+
+    LOVE_Event button(uint8_t type, size_t which, const char* name, int number)
+    {
+        LOVE_Event event {};
+
+        event.type   = type;
+        event.button = { which, name, number };
+
+        return event;
+    }
+
+    LOVE_Event axis(size_t which, size_t number, const char* name, float value)
+    {
+        LOVE_Event event {};
+
+        event.type = Hidrv::TYPE_GAMEPADAXIS;
+        event.axis = { which, number, name, value };
+
+        return event;
+    }
+
+    LOVE_Event touch(uint8_t type, int64_t id, double x, double y)
+    {
+        LOVE_Event event {};
+
+        event.type  = type;
+        event.touch = { id, x, y, 3, -4, 1 };
+
+        return event;
+    }
+
+    LOVE_Event window(uint8_t subType, int width = 0, int height = 0)
+    {
+        LOVE_Event event {};
+
+        event.type    = Hidrv::TYPE_WINDOWEVENT;
+        event.subType = subType;
+        event.size    = { width, height };
+
+        return event;
+    }
+
+    LOVE_Event status(uint8_t type, size_t which)
+    {
+        LOVE_Event event {};
+
+        event.type      = type;
+        event.padStatus = { which, type == Hidrv::TYPE_GAMEPADADDED };
+
+        return event;
+    }
+
+    /* the fields the type uses, as Write keeps them */
+    bool same(const LOVE_Event& a, const LOVE_Event& b)
+    {
+        if (a.type != b.type)
+            return false;
+
+        switch (a.type)
+        {
+            case Hidrv::TYPE_GAMEPADAXIS:
+                return a.axis.which == b.axis.which && a.axis.number == b.axis.number &&
+                       strcmp(a.axis.axis, b.axis.axis) == 0 && a.axis.value == b.axis.value;
+            case Hidrv::TYPE_GAMEPADDOWN:
+            case Hidrv::TYPE_GAMEPADUP:
+                return a.button.which == b.button.which && a.button.button == b.button.button &&
+                       strcmp(a.button.name, b.button.name) == 0;
+            case Hidrv::TYPE_GAMEPADADDED:
+            case Hidrv::TYPE_GAMEPADREMOVED:
+                return a.padStatus.which == b.padStatus.which &&
+                       a.padStatus.connected == b.padStatus.connected;
+            case Hidrv::TYPE_TOUCHPRESS:
+            case Hidrv::TYPE_TOUCHRELEASE:
+            case Hidrv::TYPE_TOUCHMOVED:
+                return a.touch.id == b.touch.id && a.touch.x == b.touch.x &&
+                       a.touch.y == b.touch.y && a.touch.dx == b.touch.dx &&
+                       a.touch.dy == b.touch.dy && a.touch.pressure == b.touch.pressure;
+            case Hidrv::TYPE_WINDOWEVENT:
+                return a.subType == b.subType && a.size.width == b.size.width &&
+                       a.size.height == b.size.height;
+            default:
+                return true;
+        }
+    }
+
+    std::vector<uint8_t> record(const Recorded& events, uint32_t frames, double delta)
+    {
+        EventLog log;
+
+        for (auto& [frame, event] : events)
+            log.Write(frame, event);
+
+        return log.Finish(frames, delta);
+    }
+
+    /* every event back out, with the frame Next first gave it on */
+    Recorded replay(EventLog& log)
+    {
+        Recorded events;
+        LOVE_Event event {};
+
+        for (uint32_t frame = 0; !log.IsFinished(frame); frame++)
+        {
+            while (log.Next(frame, event))
+                events.push_back({ frame, event });
+        }
+
+        return events;
+    }
+
+    bool throws(const std::vector<uint8_t>& data)
+    {
+        try
+        {
+            EventLog log(data.data(), data.size());
+            replay(log);
+        }
+        catch (love::Exception&)
+        {
+            return true;
+        }
+
+        return false;
+    }
+} // namespace
+
+TEST(mixed_events_round_trip_on_their_frames)
+{
+    const Recorded events = {
+        { 0, status(Hidrv::TYPE_GAMEPADADDED, 0) },
+        { 3, button(Hidrv::TYPE_GAMEPADDOWN, 0, "a", 0) },
+        { 3, axis(0, 2, "leftx", -0.25f) },
+        { 40, button(Hidrv::TYPE_GAMEPADUP, 0, "a", 0) },
+        { 41, touch(Hidrv::TYPE_TOUCHPRESS, 7, 120, 64) },
+        { 42, touch(Hidrv::TYPE_TOUCHMOVED, 7, 123, 60) },
+        { 44, touch(Hidrv::TYPE_TOUCHRELEASE, 7, 123, 60) },
+        { 300, window(Hidrv::TYPE_RESIZE, 1280, 720) },
+        { 301, window(Hidrv::TYPE_FOCUS_LOST) },
+        { 598, status(Hidrv::TYPE_GAMEPADREMOVED, 0) },
+        { 599, { Hidrv::TYPE_QUIT } },
+    };
+
+    auto data = record(events, 600, 1.0 / 60.0);
+
+    EventLog log(data.data(), data.size());
+
+    CHECK(log.GetFrameCount() == 600);
+    CHECK(log.GetDelta() == 1.0 / 60.0);
+
+    auto replayed = replay(log);
+    CHECK(replayed.size() == events.size());
+
+    for (size_t index = 0; index < events.size() && index < replayed.size(); index++)
+    {
+        CHECK(replayed[index].first == events[index].first);
+        CHECK(same(replayed[index].second, events[index].second));
+    }
+}
+
+/* a gap over 127 frames takes a longer varint, which is the only thing that changes */
+TEST(long_gaps_and_big_ids_survive)
+{
+    const Recorded events = {
+        { 5, touch(Hidrv::TYPE_TOUCHPRESS, 0x123456789, 0, 0) },
+        { 200000, button(Hidrv::TYPE_GAMEPADDOWN, 3, "start", 11) },
+    };
+
+    auto data = record(events, 200001, 0.02);
+
+    EventLog log(data.data(), data.size());
+    auto replayed = replay(log);
+
+    CHECK(replayed.size() == 2);
+    CHECK(replayed.size() == 2 && replayed[1].first == 200000);
+    CHECK(replayed.size() == 2 && same(replayed[0].second, events[0].second));
+}
+
+TEST(events_wait_for_their_frame)
+{
+    auto data = record({ { 10, window(Hidrv::TYPE_FOCUS_GAINED) } }, 20, 0.0);
+
+    EventLog log(data.data(), data.size());
+    LOVE_Event event {};
+
+    CHECK(!log.Next(9, event));
+    CHECK(log.Next(10, event));
+    CHECK(!log.Next(10, event));
+
+    CHECK(!log.IsFinished(20));
+    CHECK(log.IsFinished(21));
+}
+
+TEST(input_events_stay_small)
+{
+    auto data = record({ { 1, button(Hidrv::TYPE_GAMEPADDOWN, 0, "a", 0) },
+                         { 2, axis(0, 0, "leftx", 0.5f) } },
+                       2, 0.0);
+
+    /* a byte each for the gap, type, which, name length, "a" and button, then the axis */
+    CHECK(data.size() - EventLog::HEADER_SIZE == 6 + 14);
+}
+
+TEST(bad_logs_throw)
+{
+    auto good = record({ { 1, axis(0, 0, "leftx", 0.5f) } }, 2, 0.0);
+
+    CHECK(!throws(good));
+
+    CHECK(throws({}));
+    CHECK(throws(std::vector<uint8_t>(good.begin(), good.begin() + 10)));
+
+    auto magic = good;
+    magic[0] ^= 0xFF;
+    CHECK(throws(magic));
+
+    auto version = good;
+    version[4]++;
+    CHECK(throws(version));
+
+    /* cut inside the axis value */
+    CHECK(throws(std::vector<uint8_t>(good.begin(), good.end() - 2)));
+}
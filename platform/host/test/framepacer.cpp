@@ -0,0 +1,126 @@
+#include "check.h"
+
+#include "modules/timer/framepacer.h"
+
+#include <cmath>
+
+using namespace love;
+
+namespace
+{
+    constexpr int64_t MS = 1000000;
+
+    /* a fake clock: every read costs a microsecond, every sleep overshoots */
+    uint64_t clock    = 0;
+    int64_t overshoot = 0;
+    int sleeps        = 0;
+
+    uint64_t now()
+    {
+        return clock += 1000;
+    }
+
+    void sleep(int64_t nanoseconds)
+    {
+        clock += nanoseconds + overshoot;
+        sleeps++;
+    }
+
+    FramePacer makePacer(double rate)
+    {
+        clock     = 0;
+        overshoot = 300000;
+        sleeps    = 0;
+
+        FramePacer pacer(now, sleep);
+        pacer.SetTargetRate(rate);
+
+        return pacer;
+    }
+
+    bool near(double seconds, double expected)
+    {
+        return std::abs(seconds - expected) < 0.000005;
+    }
+} // namespace
+
+TEST(steady_frames_hit_the_period)
+{
+    FramePacer pacer = makePacer(60);
+
+    for (int frame = 0; frame < 300; frame++)
+    {
+        clock += 3 * MS;
+        pacer.Wait();
+    }
+
+    FramePacer::Stats stats = pacer.GetStats();
+
+    CHECK(stats.frames == 299);
+    CHECK(stats.dropped == 0);
+    CHECK(near(stats.p50, 1.0 / 60) && near(stats.p99, 1.0 / 60));
+    CHECK(sleeps > 0);
+}
+
+/* the spin takes up whatever the sleep overshoots by, short of the margin */
+TEST(overshoot_is_absorbed_by_the_spin)
+{
+    FramePacer pacer = makePacer(60);
+    overshoot        = 900000;
+
+    for (int frame = 0; frame < 100; frame++)
+        pacer.Wait();
+
+    CHECK(pacer.GetStats().dropped == 0);
+    CHECK(near(pacer.GetStats().p99, 1.0 / 60));
+}
+
+TEST(hitch_counts_dropped_periods)
+{
+    FramePacer pacer = makePacer(60);
+
+    for (int frame = 0; frame < 10; frame++)
+        pacer.Wait();
+
+    clock += 40 * MS;
+    pacer.Wait();
+
+    CHECK(pacer.GetStats().dropped == 1);
+
+    /* 60 ms against a deadline 16.7 ms out is two more whole periods */
+    clock += 60 * MS;
+    pacer.Wait();
+
+    CHECK(pacer.GetStats().dropped == 3);
+
+    /* and the cadence starts again from the late frame */
+    uint64_t late = clock;
+    pacer.Wait();
+
+    CHECK((int64_t)(clock - late) >= 16 * MS && (int64_t)(clock - late) <= 17 * MS);
+}
+
+TEST(no_rate_means_no_pacing)
+{
+    FramePacer pacer = makePacer(0);
+
+    uint64_t before = clock;
+    pacer.Wait();
+
+    CHECK(clock == before);
+    CHECK(pacer.GetIdleTime() == -1);
+    CHECK(pacer.GetStats().frames == 0);
+}
+
+TEST(idle_time_stops_at_the_margin)
+{
+    FramePacer pacer = makePacer(50);
+    pacer.Wait();
+
+    int64_t idle = pacer.GetIdleTime();
+
+    CHECK(idle > 18 * MS && idle < 19 * MS);
+
+    clock += 25 * MS;
+    CHECK(pacer.GetIdleTime() == 0);
+}
@@ -0,0 +1,56 @@
+#include "check.h"
+
+#include "common/luax.h"
+#include "objects/object.h"
+
+using namespace love;
+
+namespace
+{
+    struct Held : public Object
+    {};
+
+    /* a module holding one by value, like Math's RandomGenerator */
+    struct Holder
+    {
+        uint64_t before;
+        Held object;
+    };
+} // namespace
+
+TEST(push_object_held_by_value)
+{
+    lua_State* L   = luaL_newstate();
+    Holder* holder = new Holder();
+
+    CHECK(((uintptr_t)&holder->object & 0x0F) == 8);
+
+    Luax::RegisterType(L, &Object::type, nullptr);
+    lua_pop(L, 1);
+
+    Luax::PushType(L, Object::type, &holder->object);
+    Luax::PushType(L, Object::type, &holder->object);
+
+    /* the second push finds the first proxy under the same key */
+    CHECK(lua_type(L, -1) == LUA_TUSERDATA);
+    CHECK(lua_rawequal(L, -1, -2));
+
+    lua_close(L);
+    delete holder;
+}
+
+TEST(object_keys_are_distinct)
+{
+    lua_State* L    = luaL_newstate();
+    Holder* holders = new Holder[2];
+
+    lua_Number first  = Luax::ComputeObjectKey(L, &holders[0].object);
+    lua_Number second = Luax::ComputeObjectKey(L, &holders[1].object);
+    lua_Number owner  = Luax::ComputeObjectKey(L, (Object*)&holders[1]);
+
+    CHECK(first != second);
+    CHECK(second != owner);
+
+    lua_close(L);
+    delete[] holders;
+}
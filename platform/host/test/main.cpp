@@ -0,0 +1,37 @@
+#include "check.h"
+
+#include <stdio.h>
+
+using namespace love;
+
+static bool failed = false;
+
+std::vector<test::Case>& test::GetCases()
+{
+    static std::vector<Case> cases;
+    return cases;
+}
+
+void test::Fail(const char* file, int line, const char* expression)
+{
+    printf("\n    %s:%d: CHECK(%s)", file, line, expression);
+    failed = true;
+}
+
+int main(int, char**)
+{
+    int failures = 0;
+
+    for (const test::Case& item : test::GetCases())
+    {
+        failed = false;
+
+        printf("  %s", item.name);
+        item.function();
+        printf("%s\n", failed ? "\n  FAILED" : " ... ok");
+
+        failures += failed;
+    }
+
+    return failures == 0 ? 0 : 1;
+}
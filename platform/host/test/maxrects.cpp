@@ -0,0 +1,96 @@
+#include "check.h"
+
+#include "objects/atlasdata/maxrects.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace love;
+
+namespace
+{
+    bool overlaps(const MaxRects::Rect& a, const MaxRects::Rect& b)
+    {
+        return a.x < b.x + b.width && b.x < a.x + a.width && a.y < b.y + b.height &&
+               b.y < a.y + a.height;
+    }
+} // namespace
+
+TEST(exact_fit_fills_the_bin)
+{
+    MaxRects bin(64, 64);
+    MaxRects::Rect rect {};
+
+    for (int index = 0; index < 4; index++)
+        CHECK(bin.Insert(32, 32, rect));
+
+    CHECK(!bin.Insert(1, 1, rect));
+    CHECK(bin.GetOccupancy() == 1.0f);
+}
+
+TEST(too_big_is_refused)
+{
+    MaxRects bin(32, 32);
+    MaxRects::Rect rect {};
+
+    CHECK(!bin.Insert(33, 1, rect));
+    CHECK(!bin.Insert(1, 33, rect));
+    CHECK(bin.Insert(32, 32, rect));
+}
+
+TEST(used_size_covers_placed)
+{
+    MaxRects bin(256, 256);
+    MaxRects::Rect rect {};
+
+    CHECK(bin.Insert(100, 10, rect));
+    CHECK(bin.Insert(10, 50, rect));
+
+    int width = 0, height = 0;
+    bin.GetUsedSize(width, height);
+
+    CHECK(width >= 100 && width <= 110);
+    CHECK(height >= 50 && height <= 60);
+}
+
+/* random sprites, the way love.image.newAtlasData sorts them */
+TEST(random_sprites_never_overlap)
+{
+    std::mt19937 random(1234);
+    std::uniform_int_distribution<int> side(8, 64);
+
+    std::vector<std::pair<int, int>> sizes(600);
+
+    for (auto& size : sizes)
+        size = { side(random), side(random) };
+
+    std::sort(sizes.begin(), sizes.end(), [](const auto& a, const auto& b) {
+        return std::max(a.first, a.second) > std::max(b.first, b.second);
+    });
+
+    MaxRects bin(1024, 1024);
+    std::vector<MaxRects::Rect> placed;
+
+    for (const auto& size : sizes)
+    {
+        MaxRects::Rect rect {};
+
+        if (!bin.Insert(size.first, size.second, rect))
+            continue;
+
+        CHECK(rect.x >= 0 && rect.y >= 0);
+        CHECK(rect.x + rect.width <= 1024 && rect.y + rect.height <= 1024);
+
+        placed.push_back(rect);
+    }
+
+    for (size_t first = 0; first < placed.size(); first++)
+    {
+        for (size_t second = first + 1; second < placed.size(); second++)
+            CHECK(!overlaps(placed[first], placed[second]));
+    }
+
+    CHECK(placed.size() > 300);
+    CHECK(bin.GetOccupancy() > 0.7f);
+}
@@ -0,0 +1,107 @@
+#include "check.h"
+
+#include "objects/image/mipmaps.h"
+
+#include <random>
+#include <vector>
+
+using namespace love;
+
+namespace
+{
+    std::vector<uint8_t> noise(int width, int height, unsigned seed)
+    {
+        std::mt19937 random(seed);
+        std::vector<uint8_t> pixels((size_t)width * height * 4);
+
+        for (auto& channel : pixels)
+            channel = uint8_t(random());
+
+        return pixels;
+    }
+} // namespace
+
+TEST(levels_halve_down_to_one)
+{
+    CHECK(mipmaps::GetLevelSize(256, 1) == 128);
+    CHECK(mipmaps::GetLevelSize(37, 1) == 18);
+    CHECK(mipmaps::GetLevelSize(37, 6) == 1);
+    CHECK(mipmaps::GetLevelSize(1, 1) == 1);
+}
+
+TEST(chain_stops_at_one_by_one)
+{
+    auto pixels = noise(37, 10, 1);
+    std::vector<std::vector<uint8_t>> levels;
+
+    mipmaps::Generate(mipmaps::FILTER_BOX, pixels.data(), 37, 10, 100, levels);
+
+    /* 18x5, 9x2, 4x1, 2x1, 1x1 */
+    CHECK(levels.size() == 5);
+    CHECK(levels[0].size() == 18 * 5 * 4);
+    CHECK(levels[4].size() == 4);
+
+    mipmaps::Generate(mipmaps::FILTER_BOX, pixels.data(), 37, 10, 3, levels);
+    CHECK(levels.size() == 2);
+}
+
+TEST(box_is_the_rounded_average)
+{
+    /* 3x2 halves to 1x1, so the third column isn't read */
+    const uint8_t pixels[3 * 2 * 4] = {
+        0,  10, 255, 1, 1,  20, 255, 2, 100, 0, 0, 0,
+        3,  30, 255, 3, 4,  40, 254, 4, 200, 0, 0, 1,
+    };
+
+    uint8_t level[4] = {};
+    mipmaps::Downsample(mipmaps::FILTER_BOX, pixels, 3, 2, level, 0, 1);
+
+    CHECK(level[0] == 2 && level[1] == 25 && level[2] == 255 && level[3] == 3);
+
+    /* 1x2 has no second column, so the first one counts twice */
+    const uint8_t column[1 * 2 * 4] = { 0, 10, 255, 1, 3, 30, 254, 4 };
+
+    mipmaps::Downsample(mipmaps::FILTER_BOX, column, 1, 2, level, 0, 1);
+
+    CHECK(level[0] == 2 && level[1] == 20 && level[2] == 255 && level[3] == 3);
+}
+
+TEST(flat_color_stays_flat)
+{
+    std::vector<uint8_t> pixels(64 * 64 * 4);
+
+    for (size_t index = 0; index < pixels.size(); index++)
+        pixels[index] = uint8_t(0x10 + (index % 4) * 0x40);
+
+    for (auto filter : { mipmaps::FILTER_BOX, mipmaps::FILTER_KAISER })
+    {
+        std::vector<std::vector<uint8_t>> levels;
+        mipmaps::Generate(filter, pixels.data(), 64, 64, 100, levels);
+
+        CHECK(levels.size() == 6);
+
+        for (const auto& level : levels)
+        {
+            for (size_t index = 0; index < level.size(); index++)
+                CHECK(level[index] == pixels[index % 4]);
+        }
+    }
+}
+
+/* levels tall enough are split across two threads, the result shouldn't change */
+TEST(threaded_levels_match_one_thread)
+{
+    constexpr int size = mipmaps::MIN_THREADED_ROWS * 4;
+    auto pixels        = noise(size, size, 2);
+
+    for (auto filter : { mipmaps::FILTER_BOX, mipmaps::FILTER_KAISER })
+    {
+        std::vector<std::vector<uint8_t>> levels;
+        mipmaps::Generate(filter, pixels.data(), size, size, 2, levels);
+
+        std::vector<uint8_t> single((size_t)(size / 2) * (size / 2) * 4);
+        mipmaps::Downsample(filter, pixels.data(), size, size, single.data(), 0, size / 2);
+
+        CHECK(levels.size() == 1 && levels[0] == single);
+    }
+}
@@ -0,0 +1,32 @@
+#include "check.h"
+
+#include "pixelmap.h"
+#include "resampler.h"
+
+/* built with __ARM_NEON, against the scalar stand-ins in test/arm_neon.h */
+#if !defined(__ARM_NEON)
+    #error "test/neon is meant to build the NEON paths"
+#endif
+
+using namespace love;
+using namespace love::pixelmap;
+
+TEST(map_row_neon_matches_the_reference)
+{
+    const uint16_t tint[4]      = { 0xFFFF, 0x8000, 0x1234, 0 };
+    const uint16_t threshold[4] = { 0x7FFF, 0, 0, 0 };
+
+    for (size_t count : { 8, 9, 15, 16, 67, 1024 })
+    {
+        CHECK(reference::Matches(MAP_TINT, tint, count));
+        CHECK(reference::Matches(MAP_THRESHOLD, threshold, count));
+        CHECK(reference::Matches(MAP_PREMULTIPLY, tint, count));
+        CHECK(reference::Matches(MAP_GRAYSCALE, tint, count));
+    }
+}
+
+TEST(resampler_neon_matches_the_reference)
+{
+    CHECK(love::resampler::reference::Matches(1));
+    CHECK(love::resampler::reference::Matches(2));
+}
@@ -0,0 +1,274 @@
+#include "check.h"
+
+#include "sandbox.h"
+
+#include "objects/box2d/world/world.h"
+#include "objects/data/byte/bytedata.h"
+
+#include <chrono>
+#include <thread>
+
+using namespace love;
+
+namespace
+{
+    /* @count circles dropped into a box, the same every time */
+    constexpr const char* SCENE = R"(
+        function scene(count)
+            local physics = love.physics
+            local world   = physics.newWorld(0, 9.81 * 64, false)
+
+            local box = physics.newBody(world, 0, 0, "static")
+            physics.newFixture(box, physics.newChainShape(true, -200, -600, 200, -600, 200, 200,
+                                                          -200, 200))
+
+            local circle = physics.newCircleShape(8)
+
+            for index = 0, count - 1 do
+                local x = (index % 20) * 18 - 171 + (index % 3)
+                local y = 180 - math.floor(index / 20) * 18
+
+                physics.newFixture(physics.newBody(world, x, y, "dynamic"), circle)
+            end
+
+            return world
+        end
+
+        -- every event in both modes, counted by type
+        function run(buffered)
+            local world = scene(80)
+            local seen  = { begin = 0, ["end"] = 0, postsolve = 0, teardown = 0, destroyed = 0 }
+            local read  = 0
+
+            local destroying = false
+
+            local function count(event, a, b)
+                seen[event] = seen[event] + 1
+
+                if destroying then
+                    seen.teardown = seen.teardown + 1
+                end
+
+                if a:isDestroyed() or b:isDestroyed() then
+                    seen.destroyed = seen.destroyed + 1
+                end
+            end
+
+            local function drain()
+                if not buffered then
+                    return
+                end
+
+                for index, event, a, b in world:getContactEvents() do
+                    if index > read then
+                        count(event, a, b)
+                    end
+                end
+
+                read = world:getContactEventCount()
+            end
+
+            if buffered then
+                world:setContactBuffering(true)
+            else
+                world:setCallbacks(function(a, b) count("begin", a, b) end,
+                                   function(a, b) count("end", a, b) end, nil,
+                                   function(a, b) count("postsolve", a, b) end)
+            end
+
+            for step = 1, 90 do
+                world:update(1 / 60)
+                read = 0
+                drain()
+            end
+
+            -- their contacts end outside a step, as they go
+            destroying = true
+
+            for index, body in ipairs(world:getBodies()) do
+                if body:getType() == "dynamic" and index % 2 == 0 then
+                    body:destroy()
+                end
+            end
+
+            drain()
+            destroying = false
+
+            return seen
+        end
+    )";
+
+    double seconds()
+    {
+        auto now = std::chrono::steady_clock::now().time_since_epoch();
+        return std::chrono::duration<double>(now).count();
+    }
+} // namespace
+
+TEST(buffered_events_match_the_callbacks)
+{
+    lua_State* L = sandbox::Open();
+    sandbox::Run(L, SCENE);
+
+    sandbox::Run(L, R"(
+        local called, buffered = run(false), run(true)
+
+        begins, ends, solves = buffered.begin, buffered["end"], buffered.postsolve
+        same = (called.begin == begins and called["end"] == ends and called.postsolve == solves)
+        same = same and 1 or 0
+    )");
+
+    CHECK(sandbox::Get(L, "same") == 1);
+    CHECK(sandbox::Get(L, "begins") > 0 && sandbox::Get(L, "solves") > 0);
+
+    lua_close(L);
+}
+
+/*
+** The ends a destroy raises are kept. A callback sees the fixture just
+** before it goes, a buffered event just after, so it reads as destroyed.
+*/
+TEST(destroying_a_body_keeps_its_end_events)
+{
+    lua_State* L = sandbox::Open();
+    sandbox::Run(L, SCENE);
+
+    sandbox::Run(L, R"(
+        local called, buffered = run(false), run(true)
+
+        teardown  = buffered.teardown
+        same      = (called.teardown == buffered.teardown) and 1 or 0
+        destroyed = (buffered.destroyed == buffered.teardown) and 1 or 0
+    )");
+
+    CHECK(sandbox::Get(L, "teardown") > 0);
+    CHECK(sandbox::Get(L, "same") == 1);
+    CHECK(sandbox::Get(L, "destroyed") == 1);
+
+    lua_close(L);
+}
+
+/* a Data target holds each index as a uint32, then six floats */
+TEST(body_states_round_trip_through_data)
+{
+    lua_State* L = sandbox::Open();
+    sandbox::Run(L, SCENE);
+
+    using BodyState = World::BodyState;
+
+    ByteData* data = new ByteData(100 * sizeof(BodyState));
+    Luax::PushType(L, data);
+    lua_setglobal(L, "target");
+
+    sandbox::Run(L, R"(
+        world = scene(80)
+        _, count = world:getBodyStates(target)
+
+        local states = world:getBodyStates()
+        integers = (states[1] == 1 and states[8] == 2 and states[7 * 80 + 1] == 81) and 1 or 0
+    )");
+
+    const BodyState* states = (const BodyState*)data->GetData();
+
+    CHECK(sandbox::Get(L, "count") == 81);
+    CHECK(sandbox::Get(L, "integers") == 1);
+
+    for (uint32_t index = 0; index < 81; index++)
+        CHECK(states[index].index == index + 1);
+
+    /* move the last circle through the same Data */
+    ((BodyState*)data->GetData())[80].values[0] = 123.0f;
+
+    sandbox::Run(L, R"(
+        world:setTransforms(target, count)
+
+        local states = world:getBodyStates()
+        x = states[7 * 80 + 2]
+    )");
+
+    /* through meters and back */
+    CHECK(sandbox::Get(L, "x") > 122.999 && sandbox::Get(L, "x") < 123.001);
+
+    data->Release();
+    lua_close(L);
+}
+
+/* Lua can't run on the step thread, so these are errors either way round */
+TEST(threaded_worlds_refuse_lua_filters)
+{
+    lua_State* L = sandbox::Open();
+    sandbox::Run(L, SCENE);
+
+    sandbox::Run(L, R"(
+        local function none() end
+        local world = scene(4)
+
+        world:setContactFilter(none)
+        filterFirst = pcall(world.setThreaded, world, true) and 0 or 1
+
+        world:setContactFilter(nil)
+        world:setCallbacks(nil, nil, none)
+        preSolveFirst = pcall(world.setThreaded, world, true) and 0 or 1
+
+        world:setCallbacks(none, none, nil, none)
+        world:setThreaded(true, 1 / 60)
+
+        filterAfter   = pcall(world.setContactFilter, world, none) and 0 or 1
+        preSolveAfter = pcall(world.setCallbacks, world, none, none, none) and 0 or 1
+
+        world:setThreaded(false)
+    )");
+
+    CHECK(sandbox::Get(L, "filterFirst") == 1);
+    CHECK(sandbox::Get(L, "preSolveFirst") == 1);
+    CHECK(sandbox::Get(L, "filterAfter") == 1);
+    CHECK(sandbox::Get(L, "preSolveAfter") == 1);
+
+    lua_close(L);
+}
+
+/*
+** A body falling freely gains g * dt a step, so its speed counts the steps
+** taken. At 240 Hz that's under 5 ms a step, which whole-ms sleeps missed.
+*/
+TEST(threaded_worlds_keep_their_rate)
+{
+    lua_State* L = sandbox::Open();
+
+    sandbox::Run(L, R"(
+        world = love.physics.newWorld(0, 100, false)
+        love.physics.newBody(world, 0, 0, "dynamic")
+    )");
+
+    double start = seconds();
+    sandbox::Run(L, "world:setThreaded(true, 1 / 240)");
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+    double elapsed = seconds() - start;
+    sandbox::Run(L, "speed = world:getBodyStates()[6] world:setThreaded(false)");
+
+    double steps = sandbox::Get(L, "speed") / (100.0 / 240.0);
+
+    CHECK(steps > elapsed * 240 * 0.95 - 2);
+    CHECK(steps < elapsed * 240 + 1);
+
+    lua_close(L);
+}
+
+/* the step thread is woken to finish, not left to sleep out its step */
+TEST(stopping_a_thread_does_not_wait_out_the_step)
+{
+    lua_State* L = sandbox::Open();
+    sandbox::Run(L, SCENE);
+
+    sandbox::Run(L, "world = scene(4) world:setThreaded(true, 2)");
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    double start = seconds();
+    sandbox::Run(L, "world:setThreaded(false)");
+
+    CHECK(seconds() - start < 0.5);
+
+    lua_close(L);
+}
@@ -0,0 +1,66 @@
+#include "check.h"
+
+#include "common/pixelconvert.h"
+
+#include <vector>
+
+using namespace love;
+
+TEST(channels_round_trip)
+{
+    for (int value = 0; value < 0x100; value++)
+        CHECK(NarrowChannel(WidenChannel(value)) == value);
+}
+
+TEST(narrow_rounds_to_nearest)
+{
+    for (uint32_t value = 0; value < 0x10000; value++)
+        CHECK(NarrowChannel(value) == (value * 2 + 257) / 514);
+}
+
+TEST(rgba8_through_rgba16)
+{
+    auto toWide   = GetPixelRowConverter(PIXELFORMAT_RGBA8, PIXELFORMAT_RGBA16);
+    auto fromWide = GetPixelRowConverter(PIXELFORMAT_RGBA16, PIXELFORMAT_RGBA8);
+
+    CHECK(toWide != nullptr && fromWide != nullptr);
+
+    std::vector<uint8_t> pixels(0x100 * 4);
+
+    for (size_t index = 0; index < pixels.size(); index++)
+        pixels[index] = uint8_t(index * 7);
+
+    std::vector<uint16_t> wide(pixels.size());
+    std::vector<uint8_t> back(pixels.size());
+
+    toWide(pixels.data(), wide.data(), 0x100);
+    fromWide(wide.data(), back.data(), 0x100);
+
+    CHECK(wide[1] == pixels[1] * 0x101);
+    CHECK(back == pixels);
+}
+
+/* the per-pixel functions write TEX3DS_RGBA8 in RGBA8 order off the 3DS */
+TEST(tex3ds_matches_set_pixel)
+{
+    auto convert = GetPixelRowConverter(PIXELFORMAT_RGBA8, PIXELFORMAT_TEX3DS_RGBA8);
+
+    const uint8_t pixel[4] = { 0x11, 0x22, 0x33, 0x44 };
+    uint8_t out[4]         = {};
+
+    convert(pixel, out, 1);
+
+    CHECK(out[0] == 0x11 && out[1] == 0x22 && out[2] == 0x33 && out[3] == 0x44);
+}
+
+TEST(missing_channels_are_filled)
+{
+    auto convert = GetPixelRowConverter(PIXELFORMAT_R8, PIXELFORMAT_RGBA8);
+
+    const uint8_t pixel[1] = { 0x80 };
+    uint8_t out[4]         = {};
+
+    convert(pixel, out, 1);
+
+    CHECK(out[0] == 0x80 && out[1] == 0 && out[2] == 0 && out[3] == 0xFF);
+}
@@ -0,0 +1,30 @@
+#include "check.h"
+
+#include "pixelmap.h"
+
+using namespace love;
+using namespace love::pixelmap;
+
+TEST(multiply_rounds_to_nearest)
+{
+    for (uint32_t y = 0; y <= 0xFFFF; y += (y < 0xFF00) ? 0xFF : 1)
+    {
+        for (uint32_t x = 0; x <= 0xFFFF; x++)
+            CHECK(Multiply(x, y) == reference::Multiply(x, y));
+    }
+}
+
+/* whole groups of eight, and the ones left over, in case the build has NEON */
+TEST(rows_match_the_reference)
+{
+    const uint16_t tint[4]      = { 0xFFFF, 0x8000, 0x1234, 0 };
+    const uint16_t threshold[4] = { 0x7FFF, 0, 0, 0 };
+
+    for (size_t count : { 0, 1, 7, 8, 9, 67 })
+    {
+        CHECK(reference::Matches(MAP_TINT, tint, count));
+        CHECK(reference::Matches(MAP_THRESHOLD, threshold, count));
+        CHECK(reference::Matches(MAP_PREMULTIPLY, tint, count));
+        CHECK(reference::Matches(MAP_GRAYSCALE, tint, count));
+    }
+}
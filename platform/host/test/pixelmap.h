@@ -0,0 +1,64 @@
+#pragma once
+
+#include "common/pixelmap.h"
+
+#include <random>
+#include <vector>
+
+/*
+** mapPixels a pixel at a time in 64-bit math, to hold MapRow to, for
+** test/pixelmap and test/neon.
+*/
+namespace love::pixelmap::reference
+{
+    inline uint16_t Multiply(uint64_t x, uint64_t y)
+    {
+        return uint16_t((x * y * 2 + 0xFFFF) / (2 * 0xFFFF));
+    }
+
+    inline void MapPixel(Operation operation, const uint16_t value[4], uint16_t* pixel)
+    {
+        switch (operation)
+        {
+            case MAP_TINT:
+                for (int channel = 0; channel < 4; channel++)
+                    pixel[channel] = Multiply(pixel[channel], value[channel]);
+                break;
+            case MAP_THRESHOLD:
+                for (int channel = 0; channel < 3; channel++)
+                    pixel[channel] = (pixel[channel] >= value[0]) ? 0xFFFF : 0;
+                break;
+            case MAP_PREMULTIPLY:
+                for (int channel = 0; channel < 3; channel++)
+                    pixel[channel] = Multiply(pixel[channel], pixel[3]);
+                break;
+            case MAP_GRAYSCALE:
+            {
+                uint64_t luma = pixel[0] * 19595ull + pixel[1] * 38470ull + pixel[2] * 7471ull;
+                pixel[0] = pixel[1] = pixel[2] = uint16_t((luma + 0x8000) >> 16);
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    /* whether MapRow agrees with MapPixel on @count random pixels, with the extremes first */
+    inline bool Matches(Operation operation, const uint16_t value[4], size_t count)
+    {
+        std::mt19937 random((unsigned)count);
+        std::vector<uint16_t> row(count * 4);
+
+        for (size_t index = 0; index < row.size(); index++)
+            row[index] = (index < 8) ? ((index & 1) ? 0xFFFF : 0) : uint16_t(random());
+
+        std::vector<uint16_t> expected(row);
+
+        for (size_t pixel = 0; pixel < count; pixel++)
+            MapPixel(operation, value, expected.data() + pixel * 4);
+
+        MapRow(operation, value, row.data(), count);
+
+        return row == expected;
+    }
+} // namespace love::pixelmap::reference
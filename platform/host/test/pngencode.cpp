@@ -0,0 +1,96 @@
+#include "check.h"
+
+#include "objects/data/byte/bytedata.h"
+#include "objects/imagedata/handlers/pnghandler.h"
+
+#include <string.h>
+
+#include <random>
+#include <vector>
+
+using namespace love;
+
+namespace
+{
+    /* noise over flat panels, so each row filter gets picked somewhere */
+    std::vector<uint8_t> pixels(int width, int height, size_t bpp)
+    {
+        std::mt19937 random(7);
+        std::vector<uint8_t> pixels((size_t)width * height * bpp);
+
+        for (size_t index = 0; index < pixels.size(); index++)
+            pixels[index] = ((index / bpp / 13) % 3 == 0) ? uint8_t(index % bpp * 60) : random();
+
+        return pixels;
+    }
+
+    FormatHandler::DecodedImage image(std::vector<uint8_t>& pixels, int width, int height,
+                                      PixelFormat format)
+    {
+        FormatHandler::DecodedImage image {};
+
+        image.format = format;
+        image.width  = width;
+        image.height = height;
+        image.size   = pixels.size();
+        image.data   = pixels.data();
+
+        return image;
+    }
+
+    /* decodes to RGBA8 and frees the encoded data */
+    std::vector<uint8_t> decode(FormatHandler::EncodedImage encoded)
+    {
+        PNGHandler handler;
+        ByteData data(encoded.data, encoded.size, true);
+
+        auto decoded = handler.Decode(&data);
+        std::vector<uint8_t> pixels(decoded.data, decoded.data + decoded.size);
+
+        handler.FreeRawPixels(decoded.data);
+        return pixels;
+    }
+} // namespace
+
+TEST(rgba8_round_trips_through_libpng)
+{
+    auto source = pixels(300, 200, 4);
+
+    auto encoded = PNGHandler().Encode(image(source, 300, 200, PIXELFORMAT_RGBA8),
+                                       FormatHandler::ENCODED_PNG);
+
+    CHECK(decode(encoded) == source);
+}
+
+TEST(rgba8_round_trips_in_bands)
+{
+    auto source = pixels(300, 200, 4);
+
+    for (size_t bands = 1; bands <= 3; bands++)
+        CHECK(decode(PNGHandler::EncodeBands(image(source, 300, 200, PIXELFORMAT_RGBA8), bands)) ==
+              source);
+}
+
+TEST(rgba16_keeps_its_high_bytes)
+{
+    auto source = pixels(64, 130, 8);
+
+    auto encoded = PNGHandler().Encode(image(source, 64, 130, PIXELFORMAT_RGBA16),
+                                       FormatHandler::ENCODED_PNG);
+
+    auto result = decode(encoded);
+    CHECK(result.size() == source.size() / 2);
+
+    /* libpng scales 16 bits down to 8 with rounding, so a step either way */
+    bool close = true;
+
+    for (size_t index = 0; index < result.size(); index++)
+    {
+        uint16_t wide;
+        memcpy(&wide, &source[index * 2], sizeof(wide));
+
+        close = close && std::abs(int(result[index]) - (wide >> 8)) <= 1;
+    }
+
+    CHECK(close);
+}
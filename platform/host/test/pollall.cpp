@@ -0,0 +1,141 @@
+#include "check.h"
+
+#include "event.h"
+
+using namespace love;
+
+namespace
+{
+    void queue(int count)
+    {
+        for (int index = 0; index < count; index++)
+            eventqueue::queued.push_back(eventqueue::Touch(index, index * 2.0f, 0));
+    }
+} // namespace
+
+TEST(events_come_back_in_order)
+{
+    lua_State* L = eventqueue::Open();
+
+    eventqueue::queued = { eventqueue::Named("lowmemory"), eventqueue::Touch(3, 10, 20),
+                           eventqueue::Resize(400, 240) };
+
+    eventqueue::Run(L, R"(
+        love.event.pump()
+        local events, count = love.event.pollAll()
+
+        ok = count == 3 and events[1][1] == "lowmemory" and events[1].n == 1
+        ok = ok and events[2][1] == "touchmoved" and events[2][3] == 10 and events[2].n == 7
+        ok = ok and events[3][1] == "resize" and events[3][2] == 400 and events[3][3] == 240
+    )");
+
+    CHECK(eventqueue::Get(L, "ok"));
+
+    lua_close(L);
+}
+
+/* a busy frame's tables are reused, not remade */
+TEST(tables_are_reused)
+{
+    lua_State* L = eventqueue::Open();
+
+    queue(3);
+    eventqueue::Run(L, "love.event.pump(); first, count = love.event.pollAll(); a = first[2]");
+
+    queue(3);
+    eventqueue::Run(L, R"(
+        love.event.pump()
+        local events = love.event.pollAll()
+        ok = events == first and events[2] == a
+    )");
+
+    CHECK(eventqueue::Get(L, "ok"));
+
+    lua_close(L);
+}
+
+TEST(shorter_events_leave_nothing_behind)
+{
+    lua_State* L = eventqueue::Open();
+
+    eventqueue::queued = { eventqueue::Touch(1, 1, 1) };
+    eventqueue::Run(L, "love.event.pump(); love.event.pollAll()");
+
+    eventqueue::queued = { eventqueue::Named("lowmemory") };
+    eventqueue::Run(L, R"(
+        love.event.pump()
+        local events, count = love.event.pollAll()
+        ok = count == 1 and events[1].n == 1 and events[1][2] == nil and events[1][7] == nil
+    )");
+
+    CHECK(eventqueue::Get(L, "ok"));
+
+    lua_close(L);
+}
+
+/* the tables after the last event don't keep a pushed message's arguments alive */
+TEST(quiet_frames_let_go_of_arguments)
+{
+    lua_State* L = eventqueue::Open();
+
+    eventqueue::Run(L, R"(
+        love.event.push("custom", { 1, 2, 3 })
+        love.event.pump()
+
+        local events, count = love.event.pollAll()
+        weak = setmetatable({ events[1][2] }, { __mode = "v" })
+
+        events = nil
+        love.event.pollAll()
+        collectgarbage()
+        collectgarbage()
+
+        ok = count == 1 and weak[1] == nil
+    )");
+
+    CHECK(eventqueue::Get(L, "ok"));
+
+    lua_close(L);
+}
+
+/* past the pool, a burst gets tables of its own that aren't kept */
+TEST(the_pool_is_capped)
+{
+    lua_State* L = eventqueue::Open();
+
+    queue(200);
+    eventqueue::Run(L, R"(
+        love.event.pump()
+        local events = love.event.pollAll()
+        a, b = events[1], events[200]
+    )");
+
+    queue(200);
+    eventqueue::Run(L, R"(
+        love.event.pump()
+        local events, count = love.event.pollAll()
+        ok = count == 200 and events[1] == a and events[200] ~= b and events[200][3] == 398
+    )");
+
+    CHECK(eventqueue::Get(L, "ok"));
+
+    lua_close(L);
+}
+
+/* as documented: an inner call reuses the outer call's tables */
+TEST(nested_calls_share_the_result)
+{
+    lua_State* L = eventqueue::Open();
+
+    queue(2);
+    eventqueue::Run(L, R"(
+        love.event.pump()
+        local outer, count = love.event.pollAll()
+        local inner = love.event.pollAll()
+        ok = count == 2 and inner == outer and outer[1] == nil
+    )");
+
+    CHECK(eventqueue::Get(L, "ok"));
+
+    lua_close(L);
+}
@@ -0,0 +1,141 @@
+#include "check.h"
+
+#include "resampler.h"
+
+using namespace love;
+using namespace love::resampler;
+
+namespace
+{
+    constexpr int AMPLITUDE = 16000;
+
+    std::vector<int16_t> sine(double frequency, double rate, int frames)
+    {
+        std::vector<int16_t> samples(frames);
+
+        for (int frame = 0; frame < frames; frame++)
+        {
+            double phase   = 2 * M_PI * frequency * frame / rate;
+            samples[frame] = int16_t(std::lround(AMPLITUDE * std::sin(phase)));
+        }
+
+        return samples;
+    }
+
+    /* against the sine itself, leaving out the ramps at either end */
+    double snr(const std::vector<int16_t>& output, double frequency, double inputRate,
+               double outputRate)
+    {
+        uint64_t step = (uint64_t)(inputRate / outputRate * 4294967296.0);
+
+        double signal = 0.0;
+        double noise  = 0.0;
+
+        for (size_t frame = 64; frame + 64 < output.size(); frame++)
+        {
+            double time     = (double)(frame * step) / 4294967296.0;
+            double expected = AMPLITUDE * std::sin(2 * M_PI * frequency * time / inputRate);
+
+            signal += expected * expected;
+            noise += (output[frame] - expected) * (output[frame] - expected);
+        }
+
+        return 10.0 * std::log10(signal / noise);
+    }
+} // namespace
+
+TEST(same_rate_is_bit_exact)
+{
+    auto input = reference::Noise(4096 * 2, 1);
+
+    for (int quality = 0; quality < Resampler::QUALITY_MAX_ENUM; quality++)
+    {
+        Resampler resampler(2, 48000, 48000, (Resampler::Quality)quality);
+        CHECK(reference::Stream(resampler, input, 2, 1000) == input);
+    }
+}
+
+TEST(pull_matches_the_reference)
+{
+    CHECK(reference::Matches(1));
+    CHECK(reference::Matches(2));
+}
+
+TEST(chunk_size_does_not_change_the_output)
+{
+    auto input = reference::Noise(5000 * 2, 2);
+
+    Resampler whole(2, 44100, 48000, Resampler::QUALITY_MEDIUM);
+    auto expected = reference::Stream(whole, input, 2, 5000);
+
+    for (int chunk : { 1, 7, 64, 1023 })
+    {
+        Resampler resampler(2, 44100, 48000, Resampler::QUALITY_MEDIUM);
+        CHECK(reference::Stream(resampler, input, 2, chunk) == expected);
+    }
+}
+
+TEST(channels_stay_apart)
+{
+    auto left = sine(1000, 22050, 4000);
+    std::vector<int16_t> input(left.size() * 2, 0);
+
+    for (size_t frame = 0; frame < left.size(); frame++)
+        input[frame * 2] = left[frame];
+
+    Resampler resampler(2, 22050, 48000, Resampler::QUALITY_BEST);
+    auto output = reference::Stream(resampler, input, 2, 512);
+
+    bool silent = true;
+
+    for (size_t frame = 0; frame < output.size() / 2; frame++)
+        silent = silent && output[frame * 2 + 1] == 0;
+
+    CHECK(silent);
+}
+
+/* an octave down in pitch takes twice the output for the same input */
+TEST(pitch_scales_the_length)
+{
+    auto input = reference::Noise(4800, 3);
+
+    Resampler resampler(1, 48000, 48000, Resampler::QUALITY_FAST);
+    resampler.SetPitch(0.5);
+
+    CHECK(reference::Stream(resampler, input, 1, 256).size() == 9600);
+    CHECK(resampler.ToInputFrames(9600) == 4800);
+}
+
+TEST(reset_starts_over)
+{
+    auto input = reference::Noise(3000, 4);
+
+    Resampler resampler(1, 32000, 48000, Resampler::QUALITY_MEDIUM);
+    auto first = reference::Stream(resampler, input, 1, 300);
+
+    resampler.Reset();
+
+    CHECK(!resampler.IsFlushed());
+    CHECK(reference::Stream(resampler, input, 1, 300) == first);
+}
+
+TEST(sine_up_and_down_stays_clean)
+{
+    const double rates[][2] = { { 22050, 48000 }, { 48000, 32728.5 } };
+
+    /* dB, each quality should beat */
+    const double floors[Resampler::QUALITY_MAX_ENUM] = { 45, 58, 58 };
+
+    for (auto& rate : rates)
+    {
+        auto input = sine(1000, rate[0], 8000);
+
+        for (int quality = 0; quality < Resampler::QUALITY_MAX_ENUM; quality++)
+        {
+            Resampler resampler(1, rate[0], rate[1], (Resampler::Quality)quality);
+            auto output = reference::Stream(resampler, input, 1, 1024);
+
+            CHECK(snr(output, 1000, rate[0], rate[1]) > floors[quality]);
+        }
+    }
+}
@@ -0,0 +1,197 @@
+#pragma once
+
+#include "objects/source/resampler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+/*
+** Resampler without the streaming: every output frame is worked out from
+** the whole input in 64-bit math, with the weights rounded to Q14 the way
+** the table is. Pull has to agree to the sample, whatever the kernel, for
+** test/resampler, test/neon and test/smlad.
+*/
+namespace love::resampler::reference
+{
+    struct Kernel
+    {
+        int taps;
+        double beta;
+    };
+
+    /* as in resampler.cpp */
+    constexpr Kernel KERNELS[Resampler::QUALITY_MAX_ENUM] = {
+        { 4, 4.0 },
+        { 16, 6.0 },
+        { 32, 8.6 },
+    };
+
+    inline double BesselI0(double x)
+    {
+        double sum  = 1.0;
+        double term = 1.0;
+
+        for (int k = 1; term > sum * 1e-12; k++)
+        {
+            double factor = x / (2.0 * k);
+
+            term *= factor * factor;
+            sum += term;
+        }
+
+        return sum;
+    }
+
+    /* Q14 weights for an output frame @offset of the way past an input frame */
+    inline std::vector<int> Weights(Resampler::Quality quality, double cutoff, double offset)
+    {
+        const int taps    = KERNELS[quality].taps;
+        const int half    = taps / 2;
+        const double beta = KERNELS[quality].beta;
+        const double norm = BesselI0(beta);
+
+        std::vector<double> row(taps);
+        double sum = 0.0;
+
+        for (int tap = 0; tap < taps; tap++)
+        {
+            double x = tap - (half - 1) - offset;
+            double t = x / half;
+
+            double window = BesselI0(beta * std::sqrt(std::max(0.0, 1.0 - t * t))) / norm;
+            double sinc   = (x == 0.0) ? 1.0 : std::sin(M_PI * cutoff * x) / (M_PI * cutoff * x);
+
+            row[tap] = cutoff * sinc * window;
+            sum += row[tap];
+        }
+
+        std::vector<int> weights(taps);
+
+        int total   = 0;
+        int largest = 0;
+
+        for (int tap = 0; tap < taps; tap++)
+        {
+            weights[tap] = (int)std::lround(row[tap] / sum * 16384);
+            total += weights[tap];
+
+            if (weights[tap] > weights[largest])
+                largest = tap;
+        }
+
+        weights[largest] += 16384 - total;
+
+        return weights;
+    }
+
+    /* all of interleaved @input, then its tail, as Push, Flush and Pull give it */
+    inline std::vector<int16_t> Resample(const std::vector<int16_t>& input, int channels,
+                                         double inputRate, double outputRate,
+                                         Resampler::Quality quality, double pitch = 1.0)
+    {
+        const int half = KERNELS[quality].taps / 2;
+
+        double ratio  = (inputRate * pitch) / outputRate;
+        uint64_t step = (uint64_t)(ratio * 4294967296.0);
+
+        double cutoff = std::max(std::round(std::min(1.0, 1.0 / ratio) * 64.0) / 64.0, 1.0 / 64.0);
+
+        int64_t frames = (int64_t)input.size() / channels;
+        std::vector<int16_t> output;
+
+        for (uint64_t position = 0; (int64_t)(position >> 32) < frames; position += step)
+        {
+            int64_t index = position >> 32;
+            int phase     = (position >> 24) & (Resampler::PHASES - 1);
+
+            auto weights = Weights(quality, cutoff, (double)phase / Resampler::PHASES);
+
+            for (int channel = 0; channel < channels; channel++)
+            {
+                int64_t sum = 0;
+
+                for (int tap = 0; tap < (int)weights.size(); tap++)
+                {
+                    int64_t frame = index - (half - 1) + tap;
+
+                    if (frame >= 0 && frame < frames)
+                        sum += input[frame * channels + channel] * weights[tap];
+                }
+
+                sum = (sum + 8192) >> 14;
+                output.push_back((int16_t)std::clamp<int64_t>(sum, -32768, 32767));
+            }
+        }
+
+        return output;
+    }
+
+    /* through a Resampler, pushing and pulling @chunk frames at a time */
+    inline std::vector<int16_t> Stream(Resampler& resampler, const std::vector<int16_t>& input,
+                                       int channels, int chunk)
+    {
+        std::vector<int16_t> output;
+        std::vector<int16_t> buffer(chunk * channels);
+
+        int frames = (int)input.size() / channels;
+
+        auto drain = [&]() {
+            int made;
+
+            while ((made = resampler.Pull(buffer.data(), chunk)) > 0)
+                output.insert(output.end(), buffer.begin(), buffer.begin() + made * channels);
+        };
+
+        for (int frame = 0; frame < frames; frame += chunk)
+        {
+            resampler.Push(input.data() + frame * channels, std::min(chunk, frames - frame));
+            drain();
+        }
+
+        resampler.Flush();
+        drain();
+
+        return output;
+    }
+
+    /* full scale noise, with the extremes first */
+    inline std::vector<int16_t> Noise(int samples, unsigned seed)
+    {
+        std::mt19937 random(seed);
+        std::vector<int16_t> noise(samples);
+
+        for (int index = 0; index < samples; index++)
+            noise[index] = (index < 8) ? ((index & 1) ? 32767 : -32768) : int16_t(random());
+
+        return noise;
+    }
+
+    /* whether every quality agrees with Resample, up and down and through a pitch change */
+    inline bool Matches(int channels)
+    {
+        const double rates[][2] = { { 22050, 48000 }, { 48000, 32728.5 }, { 44100, 44100 } };
+        auto input              = Noise(4099 * channels, channels);
+
+        for (int quality = 0; quality < Resampler::QUALITY_MAX_ENUM; quality++)
+        {
+            for (auto& rate : rates)
+            {
+                for (double pitch : { 1.0, 0.75 })
+                {
+                    auto kind = (Resampler::Quality)quality;
+
+                    Resampler resampler(channels, rate[0], rate[1], kind);
+                    resampler.SetPitch(pitch);
+
+                    if (Stream(resampler, input, channels, 1024) !=
+                        Resample(input, channels, rate[0], rate[1], kind, pitch))
+                        return false;
+                }
+            }
+        }
+
+        return true;
+    }
+} // namespace love::resampler::reference
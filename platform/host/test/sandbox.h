@@ -0,0 +1,45 @@
+#pragma once
+
+#include "common/luax.h"
+#include "modules/physics/wrap_physics.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+** A bare Lua state with love.physics in it, for test/ and bench/. Chunks
+** run through Run, and a Lua error in one ends the program with its
+** message rather than letting it carry on with half a scene.
+*/
+namespace love::sandbox
+{
+    inline lua_State* Open()
+    {
+        lua_State* L = luaL_newstate();
+        luaL_openlibs(L);
+
+        Wrap_Physics::Register(L);
+        lua_pop(L, 1);
+
+        return L;
+    }
+
+    inline void Run(lua_State* L, const char* chunk)
+    {
+        if (luaL_dostring(L, chunk) == 0)
+            return;
+
+        fprintf(stderr, "%s\n", lua_tostring(L, -1));
+        abort();
+    }
+
+    /* a global number set by the last chunk */
+    inline double Get(lua_State* L, const char* name)
+    {
+        lua_getglobal(L, name);
+        double value = lua_tonumber(L, -1);
+        lua_pop(L, 1);
+
+        return value;
+    }
+} // namespace love::sandbox
@@ -0,0 +1,16 @@
+#include "check.h"
+
+#include "resampler.h"
+
+/* built with __ARM_FEATURE_SIMD32, against the scalar stand-ins in test/arm_acle.h */
+#if !defined(__ARM_FEATURE_SIMD32)
+    #error "test/smlad is meant to build the 3DS's SIMD32 paths"
+#endif
+
+using namespace love::resampler;
+
+TEST(resampler_smlad_matches_the_reference)
+{
+    CHECK(reference::Matches(1));
+    CHECK(reference::Matches(2));
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "objects/source/sourcec.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+** A StaticDataBuffer for AudioCache, for test/ and bench/. The host's comes
+** with all of objects/source.cpp and the audio driver behind it; this one
+** only copies the samples, and counts what's alive. Include it from one
+** file per program; it defines the constructor and destructor.
+*/
+namespace love::staticbuffer
+{
+    inline int live     = 0;
+    inline size_t bytes = 0;
+} // namespace love::staticbuffer
+
+love::StaticDataBuffer::StaticDataBuffer(const void* data, size_t size) : size(size)
+{
+    s16* memory = (s16*)malloc(size);
+    memcpy(memory, data, size);
+
+    this->buffer = { memory, size };
+
+    staticbuffer::live++;
+    staticbuffer::bytes += size;
+}
+
+love::StaticDataBuffer::~StaticDataBuffer()
+{
+    free(this->buffer.first);
+
+    staticbuffer::live--;
+    staticbuffer::bytes -= this->size;
+}
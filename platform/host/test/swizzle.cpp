@@ -0,0 +1,186 @@
+#include "check.h"
+
+#include "common/exception.h"
+#include "common/swizzle.h"
+
+#include <string.h>
+
+#include <random>
+#include <vector>
+
+using namespace love;
+
+namespace
+{
+    /* worked out from the bits rather than a table: x in the even ones, y in the odd */
+    unsigned tiledIndex(unsigned width, unsigned x, unsigned y)
+    {
+        unsigned morton = 0;
+
+        for (unsigned bit = 0; bit < 3; bit++)
+        {
+            morton |= ((x >> bit) & 1) << (bit * 2);
+            morton |= ((y >> bit) & 1) << (bit * 2 + 1);
+        }
+
+        unsigned tile = (y / 8) * (width / 8) + (x / 8);
+        return tile * 64 + morton;
+    }
+
+    std::vector<uint8_t> noise(size_t size, unsigned seed)
+    {
+        std::mt19937 random(seed);
+        std::vector<uint8_t> bytes(size);
+
+        for (auto& byte : bytes)
+            byte = uint8_t(random());
+
+        return bytes;
+    }
+
+    bool samePixel(const uint8_t* a, const uint8_t* b, size_t pixelSize)
+    {
+        return memcmp(a, b, pixelSize) == 0;
+    }
+} // namespace
+
+TEST(tiled_index_is_morton)
+{
+    for (unsigned y = 0; y < 16; y++)
+    {
+        for (unsigned x = 0; x < 32; x++)
+            CHECK(swizzle::GetTiledIndex(32, x, y) == tiledIndex(32, x, y));
+    }
+}
+
+/* unaligned rectangles, so every kernel's leading, whole and trailing parts run */
+TEST(linear_to_tiled_places_every_pixel)
+{
+    constexpr unsigned width = 64, height = 40;
+
+    for (size_t pixelSize : { 1, 2, 4 })
+    {
+        auto original = noise(width * height * pixelSize, 1);
+        auto source   = noise(27 * 19 * pixelSize, 2);
+
+        std::vector<uint8_t> tiled(original);
+
+        swizzle::LinearToTiled(source.data(), 27 * pixelSize, tiled.data(), width, 5, 3, 27, 19,
+                               pixelSize);
+
+        for (unsigned y = 0; y < height; y++)
+        {
+            for (unsigned x = 0; x < width; x++)
+            {
+                const uint8_t* pixel = tiled.data() + tiledIndex(width, x, y) * pixelSize;
+                bool inside          = x >= 5 && x < 5 + 27 && y >= 3 && y < 3 + 19;
+
+                if (inside)
+                {
+                    const uint8_t* expected = source.data() + ((y - 3) * 27 + (x - 5)) * pixelSize;
+                    CHECK(samePixel(pixel, expected, pixelSize));
+                }
+                else
+                {
+                    const uint8_t* expected = original.data() + (pixel - tiled.data());
+                    CHECK(samePixel(pixel, expected, pixelSize));
+                }
+            }
+        }
+    }
+}
+
+TEST(tiled_to_linear_reads_the_rectangle)
+{
+    constexpr unsigned width = 64, height = 32;
+
+    for (size_t pixelSize : { 1, 2, 4 })
+    {
+        auto tiled = noise(width * height * pixelSize, 3);
+        std::vector<uint8_t> linear(21 * 13 * pixelSize);
+
+        swizzle::TiledToLinear(tiled.data(), width, 9, 6, linear.data(), 21 * pixelSize, 21, 13,
+                               pixelSize);
+
+        for (unsigned y = 0; y < 13; y++)
+        {
+            for (unsigned x = 0; x < 21; x++)
+            {
+                size_t offset = tiledIndex(width, x + 9, y + 6) * pixelSize;
+
+                const uint8_t* pixel    = linear.data() + (y * 21 + x) * pixelSize;
+                const uint8_t* expected = tiled.data() + offset;
+
+                CHECK(samePixel(pixel, expected, pixelSize));
+            }
+        }
+    }
+}
+
+TEST(copy_tiled_aligned_and_not)
+{
+    constexpr unsigned srcWidth = 320, dstWidth = 384, height = 48;
+
+    struct Rect
+    {
+        unsigned sx, sy, dx, dy, width, height;
+    };
+
+    /* whole tiles in both, offsets that don't line up, and rows longer than one span */
+    const Rect rects[] = { { 8, 16, 32, 8, 48, 24 },
+                           { 3, 5, 70, 11, 37, 29 },
+                           { 5, 3, 9, 2, 300, 20 } };
+
+    for (size_t pixelSize : { 1, 2, 4 })
+    {
+        for (const Rect& rect : rects)
+        {
+            auto source   = noise(srcWidth * height * pixelSize, 4);
+            auto original = noise(dstWidth * height * pixelSize, 5);
+
+            std::vector<uint8_t> destination(original);
+
+            swizzle::CopyTiled(source.data(), srcWidth, rect.sx, rect.sy, destination.data(),
+                               dstWidth, rect.dx, rect.dy, rect.width, rect.height, pixelSize);
+
+            for (unsigned y = 0; y < height; y++)
+            {
+                for (unsigned x = 0; x < dstWidth; x++)
+                {
+                    size_t offset = tiledIndex(dstWidth, x, y) * pixelSize;
+
+                    bool inside = x >= rect.dx && x < rect.dx + rect.width && y >= rect.dy &&
+                                  y < rect.dy + rect.height;
+
+                    const uint8_t* expected = original.data() + offset;
+
+                    if (inside)
+                    {
+                        unsigned sx = x - rect.dx + rect.sx, sy = y - rect.dy + rect.sy;
+                        expected = source.data() + tiledIndex(srcWidth, sx, sy) * pixelSize;
+                    }
+
+                    CHECK(samePixel(destination.data() + offset, expected, pixelSize));
+                }
+            }
+        }
+    }
+}
+
+TEST(odd_pixel_sizes_are_refused)
+{
+    uint8_t pixels[64 * 3] = {};
+    bool threw             = false;
+
+    try
+    {
+        swizzle::LinearToTiled(pixels, 8 * 3, pixels, 8, 0, 0, 8, 8, 3);
+    }
+    catch (love::Exception&)
+    {
+        threw = true;
+    }
+
+    CHECK(threw);
+    CHECK(!swizzle::IsPixelSizeSupported(3) && swizzle::IsPixelSizeSupported(4));
+}
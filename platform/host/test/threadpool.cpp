@@ -0,0 +1,95 @@
+#include "check.h"
+
+#include "threadpool.h"
+
+#include <algorithm>
+
+using namespace love;
+
+namespace
+{
+    const char* ADD = "return function(a, b) return a + b end";
+
+    StrongReference<Future> submit(ThreadPool& pool, float a, float b)
+    {
+        return StrongReference<Future>(pool.Submit({ Variant(a), Variant(b) }),
+                                       Acquire::NORETAIN);
+    }
+
+    float number(Future& future)
+    {
+        auto results = future.GetResults();
+
+        if (results.size() != 1 || results[0].GetType() != Variant::NUMBER)
+            return -1.0f;
+
+        return results[0].GetValue<Variant::NUMBER>();
+    }
+} // namespace
+
+TEST(jobs_return_their_results)
+{
+    auto code = threadpool::Code(ADD);
+    ThreadPool pool("add", code.Get(), 2);
+
+    auto future = submit(pool, 2, 3);
+
+    CHECK(future->Wait(5.0));
+    CHECK(number(*future) == 5.0f);
+}
+
+TEST(errors_fail_only_their_future)
+{
+    auto code = threadpool::Code("return function(a) assert(a > 0, 'negative') return a end");
+    ThreadPool pool("check", code.Get(), 1);
+
+    auto bad  = submit(pool, -1, 0);
+    auto good = submit(pool, 1, 0);
+
+    CHECK(bad->Wait(5.0) && good->Wait(5.0));
+    CHECK(bad->GetError().find("negative") != std::string::npos);
+    CHECK(number(*good) == 1.0f);
+}
+
+/* taken or stolen as they're pushed, the count never dips below zero */
+TEST(pending_stays_in_step)
+{
+    auto code = threadpool::Code(ADD);
+    ThreadPool pool("add", code.Get(), 4);
+
+    std::vector<StrongReference<Future>> futures;
+    int lowest = 0;
+
+    for (int index = 0; index < 4000; index++)
+    {
+        futures.push_back(submit(pool, (float)index, 1));
+        lowest = std::min(lowest, pool.GetPendingCount());
+    }
+
+    bool all = true;
+
+    for (auto& future : futures)
+        all = future->Wait(5.0) && all;
+
+    CHECK(all);
+    CHECK(lowest == 0);
+    CHECK(pool.GetPendingCount() == 0);
+    CHECK(number(*futures.back()) == 4000.0f);
+}
+
+TEST(bad_worker_counts_throw)
+{
+    auto code = threadpool::Code(ADD);
+    bool threw = false;
+
+    try
+    {
+        ThreadPool pool("none", code.Get(), 0);
+    }
+    catch (love::Exception&)
+    {
+        threw = true;
+    }
+
+    CHECK(threw);
+}
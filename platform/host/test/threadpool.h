@@ -0,0 +1,40 @@
+#pragma once
+
+#include "objects/data/byte/bytedata.h"
+#include "objects/thread/luathread.h"
+#include "objects/threadpool/threadpool.h"
+
+#include "modules/timer/timer.h"
+
+#include <string.h>
+
+#include <chrono>
+
+/*
+** Stands in for what ThreadPool leans on, for test/threadpool and
+** bench/threadpool. A worker's state gets the standard libraries and not
+** love, which the host can't load, so a new state here is cheaper than
+** it is on a console and thread-per-job comes out ahead of where it is.
+*/
+namespace love::threadpool
+{
+    /* the pool's code, as a Data it holds on to */
+    inline StrongReference<Data> Code(const char* code)
+    {
+        return StrongReference<Data>(new ByteData(code, strlen(code)), Acquire::NORETAIN);
+    }
+} // namespace love::threadpool
+
+lua_State* love::LuaThread::NewState()
+{
+    lua_State* L = luaL_newstate();
+    luaL_openlibs(L);
+
+    return L;
+}
+
+double love::common::Timer::GetTime()
+{
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration<double>(now).count();
+}
@@ -0,0 +1,240 @@
+#include "check.h"
+
+#include "common/tlsf.h"
+
+#include <string.h>
+
+#include <random>
+#include <vector>
+
+using namespace love;
+
+namespace
+{
+    constexpr size_t ALIGNMENT = 0x40;
+    constexpr size_t SIZE      = 0x100000;
+
+    struct Pool
+    {
+        std::vector<uint8_t> memory = std::vector<uint8_t>(SIZE + ALIGNMENT);
+        TLSF tlsf;
+
+        Pool()
+        {
+            this->tlsf.Init(this->memory.data() + 1, SIZE, ALIGNMENT);
+        }
+    };
+
+    /* every block is filled with its own size, so a neighbour writing over it shows */
+    bool intact(const uint8_t* block, size_t size)
+    {
+        for (size_t offset = 0; offset < size; offset++)
+        {
+            if (block[offset] != uint8_t(size))
+                return false;
+        }
+
+        return true;
+    }
+} // namespace
+
+TEST(addresses_are_aligned)
+{
+    Pool pool;
+    size_t allocated = 0;
+
+    for (size_t size = 1; size < 0x1000; size += 97)
+    {
+        void* address = pool.tlsf.Allocate(size, allocated);
+
+        CHECK(address != nullptr);
+        CHECK(((uintptr_t)address & (ALIGNMENT - 1)) == 0);
+        CHECK(allocated >= size && allocated % ALIGNMENT == 0);
+    }
+}
+
+TEST(free_merges_back_to_one_block)
+{
+    Pool pool;
+    size_t allocated = 0;
+
+    size_t total = pool.tlsf.GetStats().size;
+
+    void* first  = pool.tlsf.Allocate(0x1000, allocated);
+    void* second = pool.tlsf.Allocate(0x2000, allocated);
+    void* third  = pool.tlsf.Allocate(0x3000, allocated);
+
+    CHECK(pool.tlsf.GetStats().usedBlocks == 3);
+
+    /* middle first, so both sides of a merge are exercised */
+    pool.tlsf.Free(second);
+    pool.tlsf.Free(first);
+    pool.tlsf.Free(third);
+
+    TLSF::Stats stats = pool.tlsf.GetStats();
+
+    CHECK(stats.used == 0 && stats.usedBlocks == 0);
+    CHECK(stats.freeBlocks == 1 && stats.largestFree == total);
+    CHECK(stats.fragmentation == 0.0f);
+}
+
+TEST(full_pool_fails_cleanly)
+{
+    Pool pool;
+    size_t allocated = 0;
+
+    CHECK(pool.tlsf.Allocate(SIZE * 2, allocated) == nullptr);
+
+    std::vector<void*> addresses;
+
+    while (void* address = pool.tlsf.Allocate(0x10000 - ALIGNMENT, allocated))
+        addresses.push_back(address);
+
+    CHECK(addresses.size() > 0);
+
+    for (void* address : addresses)
+        pool.tlsf.Free(address);
+
+    CHECK(pool.tlsf.GetStats().used == 0);
+}
+
+TEST(double_free_is_ignored)
+{
+    Pool pool;
+    size_t allocated = 0;
+
+    void* first  = pool.tlsf.Allocate(0x100, allocated);
+    void* second = pool.tlsf.Allocate(0x100, allocated);
+
+    pool.tlsf.Free(first);
+    pool.tlsf.Free(first);
+
+    CHECK(pool.tlsf.GetStats().usedBlocks == 1);
+
+    /* merged into its neighbour this time */
+    pool.tlsf.Free(second);
+    pool.tlsf.Free(second);
+
+    CHECK(pool.tlsf.GetStats().usedBlocks == 0);
+    CHECK(pool.tlsf.GetStats().freeBlocks == 1);
+}
+
+TEST(frees_outside_the_region_are_ignored)
+{
+    Pool pool;
+    size_t allocated = 0;
+
+    uint8_t* address = (uint8_t*)pool.tlsf.Allocate(0x100, allocated);
+
+    /* the first bytes of the region, where no tag can be in front */
+    pool.tlsf.Free(pool.memory.data() + ALIGNMENT);
+
+    /* past the end, and not on an allocation boundary */
+    pool.tlsf.Free(pool.memory.data() + pool.memory.size() + ALIGNMENT);
+    pool.tlsf.Free(address + 1);
+
+    int outside = 0;
+    pool.tlsf.Free(&outside);
+
+    CHECK(pool.tlsf.GetStats().usedBlocks == 1);
+}
+
+TEST(stale_free_over_new_data_is_ignored)
+{
+    Pool pool;
+    size_t allocated = 0;
+
+    void* first  = pool.tlsf.Allocate(0x100, allocated);
+    void* second = pool.tlsf.Allocate(0x100, allocated);
+
+    pool.tlsf.Free(second);
+    pool.tlsf.Free(first);
+
+    /* spans both, and its data covers where second's tag was */
+    uint8_t* spanning = (uint8_t*)pool.tlsf.Allocate(0x300, allocated);
+    memset(spanning, 0xAB, allocated);
+
+    pool.tlsf.Free(second);
+
+    CHECK(pool.tlsf.GetStats().usedBlocks == 1);
+
+    pool.tlsf.Free(spanning);
+    CHECK(pool.tlsf.GetStats().usedBlocks == 0);
+}
+
+/* the tag lives in the unit in front of the address at this alignment */
+TEST(old_generations_are_turned_away)
+{
+    Pool pool;
+    size_t allocated = 0;
+
+    uint8_t* first = (uint8_t*)pool.tlsf.Allocate(0x100, allocated);
+
+    uint8_t stale[ALIGNMENT];
+    memcpy(stale, first - ALIGNMENT, ALIGNMENT);
+
+    pool.tlsf.Free(first);
+
+    /* the same address and the same node again */
+    uint8_t* second = (uint8_t*)pool.tlsf.Allocate(0x100, allocated);
+    CHECK(second == first);
+
+    uint8_t current[ALIGNMENT];
+    memcpy(current, second - ALIGNMENT, ALIGNMENT);
+
+    memcpy(second - ALIGNMENT, stale, ALIGNMENT);
+    pool.tlsf.Free(second);
+
+    CHECK(pool.tlsf.GetStats().usedBlocks == 1);
+
+    memcpy(second - ALIGNMENT, current, ALIGNMENT);
+    pool.tlsf.Free(second);
+
+    CHECK(pool.tlsf.GetStats().usedBlocks == 0);
+}
+
+/* random sizes in random order, checking nothing handed out overlaps */
+TEST(random_churn_keeps_blocks_apart)
+{
+    Pool pool;
+    std::mt19937 random(42);
+
+    std::vector<std::pair<uint8_t*, size_t>> live;
+
+    for (int step = 0; step < 20000; step++)
+    {
+        if (!live.empty() && (random() % 2 == 0 || live.size() > 200))
+        {
+            size_t index = random() % live.size();
+            auto block   = live[index];
+
+            CHECK(intact(block.first, block.second));
+            pool.tlsf.Free(block.first);
+
+            live[index] = live.back();
+            live.pop_back();
+
+            continue;
+        }
+
+        size_t size      = 1 + random() % 0x2000;
+        size_t allocated = 0;
+
+        uint8_t* address = (uint8_t*)pool.tlsf.Allocate(size, allocated);
+
+        if (address == nullptr)
+            continue;
+
+        memset(address, uint8_t(size), size);
+        live.emplace_back(address, size);
+    }
+
+    for (auto& block : live)
+    {
+        CHECK(intact(block.first, block.second));
+        pool.tlsf.Free(block.first);
+    }
+
+    CHECK(pool.tlsf.GetStats().used == 0);
+    CHECK(pool.tlsf.GetStats().freeBlocks == 1);
+}
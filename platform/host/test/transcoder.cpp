@@ -0,0 +1,105 @@
+#include "check.h"
+
+#include "objects/compressedimagedata/transcoder.h"
+
+#include <stdlib.h>
+#include <vector>
+
+using namespace love;
+
+namespace
+{
+    /* a DXT1 block of one opaque color, every index pointing at color0 */
+    void solidDXT1(uint16_t color, uint8_t* block)
+    {
+        block[0] = block[2] = uint8_t(color);
+        block[1] = block[3] = uint8_t(color >> 8);
+        block[4] = block[5] = block[6] = block[7] = 0;
+    }
+} // namespace
+
+TEST(tiled_size_pads_to_a_tile)
+{
+    CHECK(transcoder::GetTiledSize(PIXELFORMAT_TEX3DS_ETC1, 1, 1) == 4 * 8);
+    CHECK(transcoder::GetTiledSize(PIXELFORMAT_TEX3DS_ETC1A4, 1, 1) == 4 * 16);
+    CHECK(transcoder::GetTiledSize(PIXELFORMAT_TEX3DS_ETC1, 100, 20) == 32 * 8 * 8);
+}
+
+TEST(dxt1_solid_block_decodes)
+{
+    uint8_t block[8];
+    uint8_t pixels[16 * 4];
+
+    solidDXT1(0xF800, block);
+    transcoder::DecodeBlock(PIXELFORMAT_DXT1, block, pixels);
+
+    for (int index = 0; index < 16; index++)
+    {
+        const uint8_t* pixel = pixels + index * 4;
+        CHECK(pixel[0] == 0xFF && pixel[1] == 0 && pixel[2] == 0 && pixel[3] == 0xFF);
+    }
+}
+
+TEST(dxt1_alpha_picks_etc1a4)
+{
+    uint8_t block[8] = { 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+
+    CHECK(transcoder::GetTiledFormat(PIXELFORMAT_DXT1, block, 8) == PIXELFORMAT_TEX3DS_ETC1A4);
+
+    solidDXT1(0x07E0, block);
+    CHECK(transcoder::GetTiledFormat(PIXELFORMAT_DXT1, block, 8) == PIXELFORMAT_TEX3DS_ETC1);
+}
+
+TEST(etc1_encode_stays_close)
+{
+    uint8_t pixels[16 * 4];
+    uint8_t decoded[16 * 4];
+
+    for (int index = 0; index < 16; index++)
+    {
+        pixels[index * 4 + 0] = uint8_t(0x40 + index * 4);
+        pixels[index * 4 + 1] = 0x80;
+        pixels[index * 4 + 2] = uint8_t(0xC0 - index * 2);
+        pixels[index * 4 + 3] = 0xFF;
+    }
+
+    uint64_t bits = transcoder::EncodeETC1(pixels);
+
+    uint8_t block[8];
+    for (int index = 0; index < 8; index++)
+        block[index] = uint8_t(bits >> (56 - index * 8));
+
+    transcoder::DecodeBlock(PIXELFORMAT_ETC1, block, decoded);
+
+    for (int index = 0; index < 16 * 4; index++)
+        CHECK(abs(decoded[index] - pixels[index]) <= 24);
+}
+
+/* each 8x8 tile holds four blocks in Z order, and the padding is zeroed */
+TEST(transcode_tiles_in_z_order)
+{
+    constexpr int width = 8, height = 4;
+
+    uint8_t source[2 * 8];
+    solidDXT1(0xF800, source);
+    solidDXT1(0x001F, source + 8);
+
+    auto format = transcoder::GetTiledFormat(PIXELFORMAT_DXT1, source, sizeof(source));
+    CHECK(format == PIXELFORMAT_TEX3DS_ETC1);
+
+    std::vector<uint8_t> output(transcoder::GetTiledSize(format, width, height), 0xAA);
+    transcoder::Transcode(PIXELFORMAT_DXT1, source, width, height, format, output.data());
+
+    uint8_t block[8];
+    uint8_t pixels[16 * 4];
+
+    /* blocks are stored little endian, the decoder wants them big endian */
+    for (int index = 0; index < 8; index++)
+        block[index] = output[8 + 7 - index];
+
+    transcoder::DecodeBlock(PIXELFORMAT_ETC1, block, pixels);
+    CHECK(pixels[2] > 0xE0 && pixels[0] < 0x20);
+
+    for (size_t index = 16; index < output.size(); index++)
+        CHECK(output[index] == 0);
+}
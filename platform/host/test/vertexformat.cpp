@@ -0,0 +1,145 @@
+#include "check.h"
+
+#include "common/exception.h"
+#include "objects/mesh/vertexformat.h"
+
+#include <string.h>
+
+using namespace love;
+using namespace love::vertexformat;
+
+namespace
+{
+    bool throws(const std::vector<AttribFormat>& format)
+    {
+        try
+        {
+            Layout layout(format);
+        }
+        catch (love::Exception&)
+        {
+            return true;
+        }
+
+        return false;
+    }
+} // namespace
+
+TEST(attributes_are_packed_as_declared)
+{
+    Layout layout({ { "VertexColor", DATA_UNORM8, 3 },
+                    { "Custom", DATA_UNORM16, 2 },
+                    { "VertexPosition", DATA_FLOAT, 2 } });
+
+    /* no padding, so the unorm16 pair starts at an odd offset */
+    CHECK(layout.attributes[0].offset == 0);
+    CHECK(layout.attributes[1].offset == 3);
+    CHECK(layout.attributes[2].offset == 7);
+    CHECK(layout.stride == 15);
+
+    CHECK(layout.standard[ATTRIB_COLOR] == 0);
+    CHECK(layout.standard[ATTRIB_POSITION] == 2);
+    CHECK(layout.standard[ATTRIB_TEXCOORD] == -1);
+}
+
+TEST(bad_formats_are_refused)
+{
+    CHECK(throws({}));
+    CHECK(throws({ { "A", DATA_FLOAT, 0 } }));
+    CHECK(throws({ { "A", DATA_FLOAT, MAX_ATTRIBUTE_COMPONENTS + 1 } }));
+    CHECK(throws({ { "A", DATA_FLOAT, 2 }, { "A", DATA_UNORM8, 4 } }));
+    CHECK(!throws({ { "A", DATA_FLOAT, MAX_ATTRIBUTE_COMPONENTS } }));
+}
+
+TEST(normalized_types_clamp_and_round)
+{
+    const float in[4] = { -0.5f, 0.5f, 1.0f, 2.0f };
+
+    uint8_t bytes[4];
+    Pack(DATA_UNORM8, 4, in, bytes);
+
+    CHECK(bytes[0] == 0 && bytes[1] == 128 && bytes[2] == 255 && bytes[3] == 255);
+
+    /* one byte in, to check the unaligned reads and writes */
+    uint8_t shorts[1 + 4 * sizeof(uint16_t)] = {};
+    Pack(DATA_UNORM16, 4, in, shorts + 1);
+
+    uint16_t second;
+    memcpy(&second, shorts + 1 + sizeof(uint16_t), sizeof(second));
+
+    CHECK(shorts[0] == 0 && second == 32768);
+
+    float out[4];
+    Unpack(DATA_UNORM16, 4, shorts + 1, out);
+
+    CHECK(out[0] == 0.0f && out[2] == 1.0f && out[3] == 1.0f);
+    CHECK(out[1] > 0.49999f && out[1] < 0.50001f);
+}
+
+TEST(every_unorm8_value_round_trips)
+{
+    for (int value = 0; value < 256; value++)
+    {
+        uint8_t byte = (uint8_t)value, packed = 0;
+        float unpacked;
+
+        Unpack(DATA_UNORM8, 1, &byte, &unpacked);
+        Pack(DATA_UNORM8, 1, &unpacked, &packed);
+
+        CHECK(packed == byte);
+    }
+}
+
+TEST(floats_are_copied_exactly)
+{
+    const float in[3] = { -1234.5f, 1e-30f, 3.0e30f };
+
+    uint8_t bytes[3 * sizeof(float)];
+    float out[3];
+
+    Pack(DATA_FLOAT, 3, in, bytes);
+    Unpack(DATA_FLOAT, 3, bytes, out);
+
+    CHECK(memcmp(in, out, sizeof(in)) == 0);
+}
+
+TEST(new_vertices_are_zero_with_white_color)
+{
+    Layout layout({ { "VertexPosition", DATA_FLOAT, 2 }, { "VertexColor", DATA_UNORM16, 4 } });
+
+    std::vector<uint8_t> vertices(layout.stride * 3, 0xAB);
+    FillDefaults(layout, vertices.data(), 3);
+
+    Vector2 positions[3];
+    Colorf colors[3];
+
+    GetStandardAttributes(layout, vertices.data(), 3, positions, nullptr, colors);
+
+    for (int index = 0; index < 3; index++)
+    {
+        CHECK(positions[index].x == 0.0f && positions[index].y == 0.0f);
+        CHECK(colors[index].r == 1.0f && colors[index].g == 1.0f);
+        CHECK(colors[index].b == 1.0f && colors[index].a == 1.0f);
+    }
+}
+
+TEST(missing_components_take_defaults)
+{
+    Layout layout({ { "VertexPosition", DATA_FLOAT, 1 }, { "VertexColor", DATA_UNORM8, 3 } });
+
+    const float x          = 7.5f;
+    const uint8_t color[3] = { 0, 51, 255 };
+
+    uint8_t vertex[sizeof(float) + 3];
+    memcpy(vertex, &x, sizeof(float));
+    memcpy(vertex + sizeof(float), color, 3);
+
+    Vector2 position, texCoord(5.0f, 5.0f);
+    Colorf rgba;
+
+    GetStandardAttributes(layout, vertex, 1, &position, &texCoord, &rgba);
+
+    CHECK(position.x == 7.5f && position.y == 0.0f);
+    CHECK(texCoord.x == 0.0f && texCoord.y == 0.0f);
+    CHECK(rgba.r == 0.0f && rgba.g == 0.2f && rgba.b == 1.0f && rgba.a == 1.0f);
+}
@@ -9,6 +9,7 @@
 
 #include "common/lmath.h"
 #include <memory>
+#include <vector>
 
 #include "common/pixelformat.h"
 
@@ -19,6 +20,13 @@ class CImage
     CMemPool::Handle m_mem;
 
   public:
+    /* one mipmap level, level 0 first */
+    struct Level
+    {
+        const void* data;
+        size_t size;
+    };
+
     CImage() : m_image {}, m_descriptor {}, m_mem {}
     {}
 
@@ -49,6 +57,9 @@ class CImage
     bool load(love::PixelFormat format, bool isSRGB, void* buffer, size_t size, int width,
               int height, bool empty = false);
 
+    bool load(love::PixelFormat format, bool isSRGB, const std::vector<Level>& levels, int width,
+              int height);
+
     bool loadEmptyPixels(CMemPool& imagePool, CMemPool& scratchPool, dk::Device device,
                          dk::Queue queue, uint32_t width, uint32_t height, DkImageFormat format,
                          uint32_t flags = 0);
@@ -60,6 +71,10 @@ class CImage
                     dk::Queue transferQueue, const void* data, uint32_t width, uint32_t height,
                     DkImageFormat format, uint32_t flags = 0);
 
+    bool loadMemory(CMemPool& imagePool, CMemPool& scratchPool, dk::Device device,
+                    dk::Queue transferQueue, const std::vector<Level>& levels, uint32_t width,
+                    uint32_t height, DkImageFormat format, uint32_t flags = 0);
+
     size_t getFormatSize(DkImageFormat format);
 
   private:
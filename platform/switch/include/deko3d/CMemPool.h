@@ -13,6 +13,9 @@ class CMemPool
     uint32_t m_flags;
     uint32_t m_blockSize;
 
+    uint64_t m_reservedSize;
+    uint64_t m_usedSize;
+
     struct Block
     {
         CIntrusiveListNode<Block> m_node;
@@ -143,6 +146,8 @@ class CMemPool
         m_dev { dev },
         m_flags { flags },
         m_blockSize { blockSize },
+        m_reservedSize { 0 },
+        m_usedSize { 0 },
         m_blocks {},
         m_memMap {},
         m_sliceHeap {},
@@ -151,6 +156,17 @@ class CMemPool
     ~CMemPool();
 
     Handle allocate(uint32_t size, uint32_t alignment = DK_CMDMEM_ALIGNMENT);
+
+    /* bytes taken from the device in blocks, and how much of that is handed out */
+    constexpr uint64_t getReservedSize() const
+    {
+        return m_reservedSize;
+    }
+
+    constexpr uint64_t getUsedSize() const
+    {
+        return m_usedSize;
+    }
 };
 
 constexpr bool operator<(uint32_t lhs, CMemPool::Slice const& rhs)
@@ -24,10 +24,13 @@
                                            // types
 #define GLM_FORCE_INTRINSICS // Enables usage of SIMD CPU instructions (requiring the above as well)
 #include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
 #include <glm/mat4x4.hpp>
 #include <glm/vec3.hpp>
 #include <glm/vec4.hpp>
 
+#include <optional>
+
 #define MAX_ANISOTROPY 16
 
 namespace love
@@ -145,7 +148,8 @@ class deko3d
 
     void UnRegisterResHandle(DkResHandle handle);
 
-    bool RenderTexture(const DkResHandle handle, const vertex::Vertex* points, size_t count);
+    bool RenderTexture(const DkResHandle handle, const vertex::Vertex* points, size_t count,
+                       DkPrimitive mode = DkPrimitive_Quads);
 
     bool RenderVideo(const DkResHandle handles[3], const vertex::Vertex* points, size_t count);
 
@@ -157,6 +161,23 @@ class deko3d
 
     bool RenderPoints(const vertex::Vertex* points, size_t count);
 
+    /*
+    ** Draws from GPU-resident vertices (and optional 32-bit indices)
+    ** instead of copying into the vertex ring. @transform and @color are
+    ** applied on the GPU, so the vertices never change with either.
+    */
+    bool RenderMesh(DkPrimitive mode, const CMemPool::Handle& vertices,
+                    const CMemPool::Handle& indices, uint32_t first, uint32_t count,
+                    const love::Matrix4& transform, const Colorf& color,
+                    std::optional<DkResHandle> texture);
+
+    /*
+    ** Begins the frame if it hasn't been and returns its number. Once
+    ** this returns, the GPU is done with everything submitted in frame
+    ** (number - MAX_FRAMEBUFFERS) and before.
+    */
+    uint64_t EnsureFrame();
+
     static DkWrapMode GetDekoWrapMode(love::Texture::WrapMode wrap);
 
     static bool GetConstant(PixelFormat in, DkImageFormat& out);
@@ -165,8 +186,26 @@ class deko3d
 
     void SetDekoBarrier(DkBarrier barrier, uint32_t flags);
 
+    struct FrameStats
+    {
+        int drawCalls;
+        int64_t vertices;
+        int canvasSwitches;
+        int shaderSwitches;
+    };
+
+    /* counted over the last presented frame */
+    const FrameStats& GetFrameStats() const
+    {
+        return this->lastFrameStats;
+    }
+
   private:
+    FrameStats frameStats {};
+    FrameStats lastFrameStats {};
+
     vertex::Vertex* vertexData;
+    DkGpuAddr vertexDataAddr;
 
     uint32_t firstVertex = 0;
     BitwiseAlloc<MAX_OBJECTS> allocator;
@@ -197,6 +236,7 @@ class deko3d
     {
         glm::mat4 mdlvMtx;
         glm::mat4 projMtx;
+        glm::vec4 color; //< multiplies the vertex colors, white except for a Mesh
     };
 
     dk::UniqueDevice device;
@@ -257,6 +297,8 @@ class deko3d
     Transformation transformState;
     CMemPool::Handle transformUniformBuffer;
 
+    uint64_t frameCount; //< presented so far, so the number of the one being recorded
+
     dk::ImageLayout layoutFramebuffer;
     std::array<DkImage const*, MAX_FRAMEBUFFERS> framebufferArray;
 
@@ -89,6 +89,8 @@ namespace love::deko3d
 
         RendererInfo GetRendererInfo() const override;
 
+        Stats GetStats() const override;
+
         // Internal?
         Shader* NewShader(Shader::StandardShader type);
 
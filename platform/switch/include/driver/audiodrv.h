@@ -12,6 +12,8 @@ namespace love::driver
     class Audrv : public common::driver::Audrv
     {
       public:
+        static constexpr double OUTPUT_RATE = 48000.0;
+
         ~Audrv();
 
         static Audrv& Instance()
@@ -26,6 +28,8 @@ namespace love::driver
 
         void SetChannelVolume(size_t channel, float volume);
 
+        void SetChannelPitch(size_t channel, float pitch);
+
         bool IsChannelPlaying(size_t channel);
 
         bool IsChannelPaused(size_t channel);
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "deko3d/CMemPool.h"
+#include "deko3d/vertex.h"
+
+#include "objects/mesh/meshc.h"
+
+namespace love
+{
+    class Mesh : public common::Mesh
+    {
+      public:
+        Mesh(const std::vector<AttribFormat>& format, const void* data, size_t size,
+             DrawMode mode, Usage usage);
+
+        Mesh(const std::vector<AttribFormat>& format, int vertexCount, DrawMode mode,
+             Usage usage);
+
+        virtual ~Mesh();
+
+        void Flush() override;
+
+        void Draw(Graphics* gfx, const Matrix4& localTransform) override;
+
+        static DkPrimitive GetPrimitive(DrawMode mode);
+
+      private:
+        /*
+        ** Static meshes keep their converted vertices (and vertex map) in
+        ** the GPU data pool and are drawn in place, with the current color
+        ** applied on the GPU. There are two copies, so a change is written
+        ** into the one no frame in flight is reading. Stream and dynamic
+        ** meshes go through the per-frame vertex ring like primitives.
+        */
+        static constexpr int BUFFER_COUNT = 2;
+
+        struct Buffer
+        {
+            CMemPool::Handle vertices;
+            CMemPool::Handle indices;
+
+            /* what changed since this copy was last written */
+            size_t dirtyStart;
+            size_t dirtyEnd;
+            bool indicesDirty;
+
+            bool drawn;
+            uint64_t lastFrame;
+        };
+
+        Buffer buffers[BUFFER_COUNT];
+        int current; //< the copy written last
+
+        void TakeModifications();
+
+        static bool IsStale(const Buffer& buffer);
+
+        /* false while a frame in flight may still read @buffer */
+        static bool IsWritable(const Buffer& buffer, uint64_t frame);
+
+        void Upload(Buffer& buffer);
+
+        void DrawStatic(Graphics* gfx, const Matrix4& transform);
+
+        void DrawStreamed(Graphics* gfx, const Matrix4& transform);
+    };
+} // namespace love
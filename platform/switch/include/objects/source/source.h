@@ -7,7 +7,7 @@ namespace love
     class Source : public common::Source
     {
       public:
-        Source(Pool* pool, SoundData* sound);
+        Source(Pool* pool, SoundData* sound, StaticDataBuffer* buffer);
 
         Source(Pool* pool, Decoder* decoder);
 
@@ -34,6 +34,8 @@ namespace love
 
         void ClearChannel() override;
 
+        void ApplyPitch() override;
+
       private:
         AudioDriverWaveBuf sources[Source::MAX_BUFFERS];
 
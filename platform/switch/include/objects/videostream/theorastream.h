@@ -27,7 +27,7 @@ namespace love
 
         virtual void SetupBuffers() override;
 
-        virtual void FillBufferData(th_ycbcr_buffer bufferInfo) override;
+        virtual void FillBufferData(IFrame* target, th_ycbcr_buffer bufferInfo) override;
 
       private:
         unsigned yPlaneXOffset;
@@ -14,6 +14,7 @@ layout (std140, binding = 0) uniform Transformation
 {
     mat4 mdlvMtx;
     mat4 projMtx;
+    vec4 color;
 } u;
 
 void main()
@@ -21,6 +22,6 @@ void main()
     vec4 pos = u.mdlvMtx * vec4(inPos, 1.0);
     gl_Position = u.projMtx * pos;
 
-    outColor = inColor;
+    outColor = inColor * u.color;
     outTexCoord = inTexCoord;
 }
@@ -8,6 +8,7 @@
 #include "common/lmath.h"
 #include "common/pixelformat.h"
 
+#include <algorithm>
 #include <cstdio>
 
 bool CImage::load(love::PixelFormat pixelFormat, bool isSRGB, void* buffer, size_t size, int width,
@@ -29,6 +30,18 @@ bool CImage::load(love::PixelFormat pixelFormat, bool isSRGB, void* buffer, size
                                      ::deko3d::Instance().GetTextureQueue(), width, height, format);
 }
 
+bool CImage::load(love::PixelFormat pixelFormat, bool isSRGB, const std::vector<Level>& levels,
+                  int width, int height)
+{
+    DkImageFormat format;
+    if (!::deko3d::GetConstant(pixelFormat, format))
+        return false;
+
+    return this->loadMemory(::deko3d::Instance().GetImages(), ::deko3d::Instance().GetData(),
+                            ::deko3d::Instance().GetDevice(),
+                            ::deko3d::Instance().GetTextureQueue(), levels, width, height, format);
+}
+
 /* replace the pixels at a location */
 bool CImage::replacePixels(CMemPool& scratchPool, dk::Device device, const void* data, size_t size,
                            dk::Queue transferQueue, const love::Rect& rect)
@@ -130,25 +143,51 @@ bool CImage::loadMemory(CMemPool& imagePool, CMemPool& scratchPool, dk::Device d
                         dk::Queue transferQueue, const void* data, uint32_t width, uint32_t height,
                         DkImageFormat dkFormat, uint32_t flags)
 {
-    if (data == nullptr)
-        return false;
-
-    // Allocate temporary memory for the image
     PixelFormat format;
     if (!::deko3d::GetConstant(dkFormat, format))
         return false;
 
     size_t size = width * height * love::GetPixelFormatSize(format);
 
-    if (size <= 0)
+    return this->loadMemory(imagePool, scratchPool, device, transferQueue, { { data, size } },
+                            width, height, dkFormat, flags);
+}
+
+/*
+** Every level is staged in its own scratch memory and copied
+** with a view of just that level, all in one command list.
+*/
+bool CImage::loadMemory(CMemPool& imagePool, CMemPool& scratchPool, dk::Device device,
+                        dk::Queue transferQueue, const std::vector<Level>& levels, uint32_t width,
+                        uint32_t height, DkImageFormat dkFormat, uint32_t flags)
+{
+    if (levels.empty() || levels[0].data == nullptr)
         return false;
 
-    CMemPool::Handle tempImageMemory = scratchPool.allocate(size, DK_IMAGE_LINEAR_STRIDE_ALIGNMENT);
+    std::vector<CMemPool::Handle> tempImageMemory;
 
-    if (!tempImageMemory)
-        return false;
+    for (const auto& level : levels)
+    {
+        if (level.data == nullptr || level.size == 0)
+            break;
 
-    memcpy(tempImageMemory.getCpuAddr(), data, size);
+        CMemPool::Handle memory =
+            scratchPool.allocate(level.size, DK_IMAGE_LINEAR_STRIDE_ALIGNMENT);
+
+        if (!memory)
+        {
+            for (auto& handle : tempImageMemory)
+                handle.destroy();
+
+            return false;
+        }
+
+        memcpy(memory.getCpuAddr(), level.data, level.size);
+        tempImageMemory.push_back(memory);
+    }
+
+    if (tempImageMemory.empty())
+        return false;
 
     /*
     ** We need to have a command buffer and some more memory for it
@@ -158,12 +197,15 @@ bool CImage::loadMemory(CMemPool& imagePool, CMemPool& scratchPool, dk::Device d
     CMemPool::Handle tempCmdMem  = scratchPool.allocate(DK_MEMBLOCK_ALIGNMENT);
     tempCmdBuff.addMemory(tempCmdMem.getMemBlock(), tempCmdMem.getOffset(), tempCmdMem.getSize());
 
+    uint32_t mipmapCount = (uint32_t)tempImageMemory.size();
+
     // Set the image layout for the image
     dk::ImageLayout layout;
     dk::ImageLayoutMaker { device }
         .setFlags(flags)
         .setFormat(dkFormat)
         .setDimensions(width, height)
+        .setMipLevels(mipmapCount)
         .initialize(layout);
 
     // Create the image
@@ -172,12 +214,20 @@ bool CImage::loadMemory(CMemPool& imagePool, CMemPool& scratchPool, dk::Device d
     m_descriptor.initialize(m_image);
 
     /*
-    ** Create the image's view and copy the data
-    ** to the temporary image memory
+    ** Create a view of each level and copy the data
+    ** to it from the temporary image memory
     */
-    dk::ImageView imageView { m_image };
-    tempCmdBuff.copyBufferToImage({ tempImageMemory.getGpuAddr() }, imageView,
-                                  { 0, 0, 0, width, height, 1 }, 0);
+    for (uint32_t level = 0; level < mipmapCount; level++)
+    {
+        uint32_t levelWidth  = std::max(width >> level, 1U);
+        uint32_t levelHeight = std::max(height >> level, 1U);
+
+        dk::ImageView imageView { m_image };
+        imageView.setMipLevels(level, 1);
+
+        tempCmdBuff.copyBufferToImage({ tempImageMemory[level].getGpuAddr() }, imageView,
+                                      { 0, 0, 0, levelWidth, levelHeight, 1 }, 0);
+    }
 
     // Submit the commands to the transfer queue
     transferQueue.submitCommands(tempCmdBuff.finishList());
@@ -185,7 +235,9 @@ bool CImage::loadMemory(CMemPool& imagePool, CMemPool& scratchPool, dk::Device d
 
     // Destroy the memory we don't need
     tempCmdMem.destroy();
-    tempImageMemory.destroy();
+
+    for (auto& handle : tempImageMemory)
+        handle.destroy();
 
     return true;
 }
@@ -102,6 +102,7 @@ auto CMemPool::allocate(uint32_t size, uint32_t alignment) -> Handle
         blk->m_cpuAddr = blk->m_obj.getCpuAddr();
         blk->m_gpuAddr = blk->m_obj.getGpuAddr();
         m_blocks.add(blk);
+        m_reservedSize += blkSize;
 
         start_offset = 0;
         end_offset   = size;
@@ -149,6 +150,7 @@ auto CMemPool::allocate(uint32_t size, uint32_t alignment) -> Handle
     }
 
     slice->m_pool = this;
+    m_usedSize += slice->getSize();
     return slice;
 
 _bad:
@@ -158,6 +160,7 @@ _bad:
 
 void CMemPool::_destroy(Slice* slice)
 {
+    m_usedSize -= slice->getSize();
     slice->m_pool = nullptr;
 
     Slice* left  = m_memMap.prev(slice);
@@ -24,6 +24,8 @@ namespace
 } // namespace
 
 deko3d::deko3d() :
+    vertexData(nullptr),
+    vertexDataAddr(DK_GPU_ADDR_INVALID),
     firstVertex(0),
     renderState(STATE_MAX_ENUM),
     /*
@@ -46,11 +48,13 @@ deko3d::deko3d() :
                static_cast<int>(Screen::HANDHELD_HEIGHT) },
     framebuffers(),
     descriptorsDirty(false),
-    depthBuffer()
+    depthBuffer(),
+    frameCount(0)
 {
     this->transformUniformBuffer =
         this->pool.data.allocate(sizeof(this->transformState), DK_UNIFORM_BUF_ALIGNMENT);
     this->transformState.mdlvMtx = glm::mat4(1.0f);
+    this->transformState.color   = glm::vec4(1.0f);
 
     this->descriptors.image.allocate(this->pool.data);
     this->descriptors.sampler.allocate(this->pool.data);
@@ -260,6 +264,8 @@ void deko3d::BindFramebuffer(love::Canvas* canvas)
     if (this->framebuffers.dirty)
         this->SetDekoBarrier(DkBarrier_Fragments, 0);
 
+    this->frameStats.canvasSwitches++;
+
     dk::ImageView target { this->framebuffers.images[this->framebuffers.slot] };
 
     if (canvas != nullptr)
@@ -288,7 +294,8 @@ void deko3d::BeginFrame()
 {
     std::pair<void*, DkGpuAddr> data = this->vtxRing.begin();
 
-    this->vertexData = (vertex::Vertex*)data.first;
+    this->vertexData     = (vertex::Vertex*)data.first;
+    this->vertexDataAddr = data.second;
 
     this->cmdBuf.bindRasterizerState(this->state.rasterizer);
     this->cmdBuf.bindColorState(this->state.color);
@@ -317,9 +324,13 @@ void deko3d::Present()
         this->queue.presentImage(this->swapchain, this->framebuffers.slot);
 
         this->framebuffers.inFrame = false;
+        this->frameCount++;
     }
 
     this->framebuffers.slot = -1;
+
+    this->lastFrameStats = this->frameStats;
+    this->frameStats     = FrameStats {};
 }
 
 void deko3d::SetStencil(DkStencilOp op, DkCompareOp compare, int value)
@@ -366,7 +377,8 @@ DkResHandle deko3d::RegisterResHandle(const dk::ImageDescriptor& descriptor)
     return dkMakeTextureHandle(index, index);
 }
 
-bool deko3d::RenderTexture(const DkResHandle handle, const vertex::Vertex* points, size_t count)
+bool deko3d::RenderTexture(const DkResHandle handle, const vertex::Vertex* points, size_t count,
+                           DkPrimitive mode)
 {
     if (count > (this->vtxRing.getSize() - this->firstVertex) || points == nullptr)
         return false;
@@ -383,7 +395,10 @@ bool deko3d::RenderTexture(const DkResHandle handle, const vertex::Vertex* point
 
     memcpy(this->vertexData + this->firstVertex, points, count * sizeof(vertex::Vertex));
 
-    this->cmdBuf.draw(DkPrimitive_Quads, count, 1, this->firstVertex, 0);
+    this->cmdBuf.draw(mode, count, 1, this->firstVertex, 0);
+
+    this->frameStats.drawCalls++;
+    this->frameStats.vertices += count;
 
     this->firstVertex += count;
 
@@ -409,6 +424,9 @@ bool deko3d::RenderVideo(const DkResHandle handles[3], const vertex::Vertex* poi
 
     this->cmdBuf.draw(DkPrimitive_Quads, count, 1, this->firstVertex, 0);
 
+    this->frameStats.drawCalls++;
+    this->frameStats.vertices += count;
+
     this->firstVertex += count;
 
     return true;
@@ -425,6 +443,9 @@ bool deko3d::RenderPolyline(DkPrimitive mode, const vertex::Vertex* points, size
 
     this->cmdBuf.draw(mode, count, 1, this->firstVertex, 0);
 
+    this->frameStats.drawCalls++;
+    this->frameStats.vertices += count;
+
     this->firstVertex += count;
 
     return true;
@@ -441,6 +462,9 @@ bool deko3d::RenderPolygon(const vertex::Vertex* points, size_t count)
 
     this->cmdBuf.draw(DkPrimitive_TriangleFan, count, 1, this->firstVertex, 0);
 
+    this->frameStats.drawCalls++;
+    this->frameStats.vertices += count;
+
     this->firstVertex += count;
 
     return true;
@@ -457,11 +481,75 @@ bool deko3d::RenderPoints(const vertex::Vertex* points, size_t count)
 
     this->cmdBuf.draw(DkPrimitive_Points, count, 1, this->firstVertex, 0);
 
+    this->frameStats.drawCalls++;
+    this->frameStats.vertices += count;
+
     this->firstVertex += count;
 
     return true;
 }
 
+uint64_t deko3d::EnsureFrame()
+{
+    /* beginning a frame waits on the fence of the last one to use its slice */
+    this->EnsureInFrame();
+
+    return this->frameCount;
+}
+
+bool deko3d::RenderMesh(DkPrimitive mode, const CMemPool::Handle& vertices,
+                        const CMemPool::Handle& indices, uint32_t first, uint32_t count,
+                        const love::Matrix4& transform, const Colorf& color,
+                        std::optional<DkResHandle> texture)
+{
+    if (!vertices || count == 0)
+        return false;
+
+    this->EnsureInState(texture.has_value() ? STATE_TEXTURE : STATE_PRIMITIVE);
+
+    if (texture.has_value())
+    {
+        if (this->descriptorsDirty)
+        {
+            this->cmdBuf.barrier(DkBarrier_Primitives, DkInvalidateFlags_Descriptors);
+            this->descriptorsDirty = false;
+        }
+
+        this->cmdBuf.bindTextures(DkStage_Fragment, 0, texture.value());
+    }
+
+    /* Matrix4 is column-major, just like glm */
+    this->transformState.mdlvMtx = glm::make_mat4(transform.GetElements());
+    this->transformState.color   = glm::vec4(color.r, color.g, color.b, color.a);
+    this->cmdBuf.pushConstants(this->transformUniformBuffer.getGpuAddr(),
+                               this->transformUniformBuffer.getSize(), 0,
+                               sizeof(this->transformState), &this->transformState);
+
+    this->cmdBuf.bindVtxBuffer(0, vertices.getGpuAddr(), vertices.getSize());
+
+    if (indices)
+    {
+        this->cmdBuf.bindIdxBuffer(DkIdxFormat_Uint32, indices.getGpuAddr());
+        this->cmdBuf.drawIndexed(mode, count, 1, first, 0, 0);
+    }
+    else
+        this->cmdBuf.draw(mode, count, 1, first, 0);
+
+    this->frameStats.drawCalls++;
+    this->frameStats.vertices += count;
+
+    /* Restore the vertex ring, identity model-view and white for everything else */
+    this->transformState.mdlvMtx = glm::mat4(1.0f);
+    this->transformState.color   = glm::vec4(1.0f);
+    this->cmdBuf.pushConstants(this->transformUniformBuffer.getGpuAddr(),
+                               this->transformUniformBuffer.getSize(), 0,
+                               sizeof(this->transformState), &this->transformState);
+
+    this->cmdBuf.bindVtxBuffer(0, this->vertexDataAddr, this->vtxRing.getSize());
+
+    return true;
+}
+
 void deko3d::SetPointSize(float size)
 {
     this->EnsureInFrame();
@@ -524,6 +612,7 @@ void deko3d::SetCullMode(DkFace face)
 void deko3d::UseProgram(const love::Shader::Program& program)
 {
     this->EnsureInFrame();
+    this->frameStats.shaderSwitches++;
 
     this->cmdBuf.bindShaders(DkStageFlag_GraphicsMask, { *program.vertex, *program.fragment });
     this->cmdBuf.bindUniformBuffer(DkStage_Vertex, 0, this->transformUniformBuffer.getGpuAddr(),
@@ -543,7 +632,7 @@ void deko3d::SetTextureFilter(const love::Texture::Filter& filter)
     DkFilter mag =
         (filter.min == love::Texture::FILTER_NEAREST) ? DkFilter_Nearest : DkFilter_Linear;
 
-    DkMipFilter mipFilter = DkMipFilter_Linear;
+    DkMipFilter mipFilter = DkMipFilter_None;
     if (filter.mipmap != love::Texture::FILTER_NONE)
     {
         if (filter.min == love::Texture::FILTER_NEAREST &&
@@ -95,6 +95,20 @@ Graphics::RendererInfo love::deko3d::Graphics::GetRendererInfo() const
     return info;
 }
 
+Graphics::Stats love::deko3d::Graphics::GetStats() const
+{
+    Stats stats = love::Graphics::GetStats();
+
+    const auto& frame = ::deko3d::Instance().GetFrameStats();
+
+    stats.drawCalls      = frame.drawCalls;
+    stats.vertices       = frame.vertices;
+    stats.canvasSwitches = frame.canvasSwitches;
+    stats.shaderSwitches = frame.shaderSwitches;
+
+    return stats;
+}
+
 void love::deko3d::Graphics::SetColor(Colorf color)
 {
     love::Graphics::SetColor(color);
@@ -88,6 +88,16 @@ void Audrv::SetChannelVolume(size_t channel, float volume)
     audrvVoiceSetVolume(&this->driver, channel, volume);
 }
 
+/*
+** Set a channel's pitch, the renderer resamples by it
+*/
+void Audrv::SetChannelPitch(size_t channel, float pitch)
+{
+    thread::Lock lock(this->mutex);
+
+    audrvVoiceSetPitch(&this->driver, channel, pitch);
+}
+
 /*
 ** Check if a channel is playing
 */
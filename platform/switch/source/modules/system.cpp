@@ -4,6 +4,9 @@
 #include "common/bidirectionalmap.h"
 #include "common/results.h"
 
+#include "deko3d/deko.h"
+#include "pools/audiopool.h"
+
 using namespace love;
 
 System::System()
@@ -182,6 +185,23 @@ const std::string& System::GetSystemTheme()
     return this->systemInfo.colorTheme;
 }
 
+static void AddPool(std::vector<System::MemoryPool>& pools, const char* name, CMemPool& pool)
+{
+    pools.push_back({ name, pool.getReservedSize(), pool.getUsedSize() });
+}
+
+void System::GetMemoryPools(std::vector<MemoryPool>& pools) const
+{
+    auto& instance = ::deko3d::Instance();
+
+    AddPool(pools, "images", instance.GetImages());
+    AddPool(pools, "data", instance.GetData());
+    AddPool(pools, "code", instance.GetCode());
+
+    love::TLSF::Stats audio = AudioPool::GetStats();
+    pools.push_back({ "audio", audio.size, audio.used });
+}
+
 // clang-format off
 constexpr auto languages = BidirectionalMap<>::Create(
     "jp",      SetLanguage_JA,
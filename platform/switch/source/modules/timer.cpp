@@ -3,15 +3,13 @@
 
 using namespace love;
 
-static constexpr auto NS_TO_SEC = 1000000000.0;
-
 Timer::Timer()
 {
     Timer::reference    = armGetSystemTick();
     this->prevFPSUpdate = currentTime = this->GetTime();
 }
 
-double common::Timer::GetTime()
+uint64_t common::Timer::GetTimeNs()
 {
-    return armTicksToNs(armGetSystemTick() - Timer::reference) / NS_TO_SEC;
+    return armTicksToNs(armGetSystemTick() - Timer::reference);
 }
\ No newline at end of file
@@ -11,6 +11,7 @@ Image::Image(const Slices& slices, bool validate) :
     Texture(slices.GetTextureType()),
     data(slices),
     mipmapsType(MIPMAPS_NONE),
+    mipmapFilter(mipmaps::FILTER_BOX),
     sRGB(Graphics::IsGammaCorrect())
 {
     if (validate && data.Validate() == MIPMAPS_DATA)
@@ -26,8 +27,12 @@ Image::Image(TextureType type, PixelFormat format, int width, int height, int sl
     this->Init(format, width, height);
 }
 
-Image::Image(const Slices& slices) : Image(slices, true)
+Image::Image(const Slices& slices) : Image(slices, Settings())
+{}
+
+Image::Image(const Slices& slices, const Settings& settings) : Image(slices, true)
 {
+    this->SetupMipmaps(settings);
     this->Init(slices.Get(0, 0));
 }
 
@@ -45,8 +50,26 @@ void Image::Init(PixelFormat pixelFormat, int width, int height)
 
     if (this->data.Get(0, 0))
     {
-        bool success = this->texture.load(format, this->sRGB, this->data.Get(0, 0)->GetData(),
-                                          this->data.Get(0, 0)->GetSize(), width, height);
+        std::vector<CImage::Level> levels;
+
+        for (int mip = 0; mip < this->data.GetMipmapCount(); mip++)
+        {
+            ImageDataBase* level = this->data.Get(0, mip);
+            levels.push_back({ level->ReadData(), level->GetSize() });
+        }
+
+        std::vector<std::vector<uint8_t>> generated;
+
+        if (this->mipmapsType == MIPMAPS_GENERATED)
+        {
+            mipmaps::Generate(this->mipmapFilter, (const uint8_t*)levels[0].data, width, height,
+                              Texture::GetTotalMipmapCount(width, height), generated);
+
+            for (const auto& level : generated)
+                levels.push_back({ level.data(), level.size() });
+        }
+
+        bool success = this->texture.load(format, this->sRGB, levels, width, height);
 
         if (!success)
         {
@@ -56,6 +79,8 @@ void Image::Init(PixelFormat pixelFormat, int width, int height)
             throw love::Exception("Failed to upload image data: format %s not supported",
                                   formatName);
         }
+
+        this->mipmapCount = (int)levels.size();
     }
     else
     {
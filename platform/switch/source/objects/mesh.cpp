@@ -0,0 +1,264 @@
+#include "objects/mesh/mesh.h"
+
+#include "deko3d/deko.h"
+#include "modules/graphics/graphics.h"
+
+using namespace love;
+
+Mesh::Mesh(const std::vector<AttribFormat>& format, const void* data, size_t size,
+           DrawMode mode, Usage usage) :
+    common::Mesh(format, data, size, mode, usage),
+    buffers {},
+    current(0)
+{}
+
+Mesh::Mesh(const std::vector<AttribFormat>& format, int vertexCount, DrawMode mode,
+           Usage usage) :
+    common::Mesh(format, vertexCount, mode, usage),
+    buffers {},
+    current(0)
+{}
+
+Mesh::~Mesh()
+{
+    for (Buffer& buffer : this->buffers)
+    {
+        buffer.vertices.destroy();
+        buffer.indices.destroy();
+    }
+}
+
+DkPrimitive Mesh::GetPrimitive(DrawMode mode)
+{
+    switch (mode)
+    {
+        case DRAWMODE_FAN:
+        default:
+            return DkPrimitive_TriangleFan;
+        case DRAWMODE_STRIP:
+            return DkPrimitive_TriangleStrip;
+        case DRAWMODE_TRIANGLES:
+            return DkPrimitive_Triangles;
+        case DRAWMODE_POINTS:
+            return DkPrimitive_Points;
+    }
+}
+
+/* what changed goes to every copy, each catches up when it's next written */
+void Mesh::TakeModifications()
+{
+    if (this->IsModified())
+    {
+        for (Buffer& buffer : this->buffers)
+        {
+            if (buffer.dirtyEnd > buffer.dirtyStart)
+            {
+                buffer.dirtyStart = std::min(buffer.dirtyStart, this->modifiedStart);
+                buffer.dirtyEnd   = std::max(buffer.dirtyEnd, this->modifiedEnd);
+            }
+            else
+            {
+                buffer.dirtyStart = this->modifiedStart;
+                buffer.dirtyEnd   = this->modifiedEnd;
+            }
+        }
+    }
+
+    if (this->vertexMapModified)
+    {
+        for (Buffer& buffer : this->buffers)
+            buffer.indicesDirty = true;
+    }
+
+    common::Mesh::Flush();
+}
+
+bool Mesh::IsStale(const Buffer& buffer)
+{
+    return !buffer.vertices || buffer.dirtyEnd > buffer.dirtyStart || buffer.indicesDirty;
+}
+
+bool Mesh::IsWritable(const Buffer& buffer, uint64_t frame)
+{
+    return !buffer.drawn || buffer.lastFrame + ::deko3d::MAX_FRAMEBUFFERS <= frame;
+}
+
+/*
+** Convert what changed in @buffer from the user's format into the
+** renderer's vertex layout, directly in GPU memory
+*/
+void Mesh::Upload(Buffer& buffer)
+{
+    if (!buffer.vertices)
+    {
+        size_t size = this->vertexCount * sizeof(vertex::Vertex);
+
+        buffer.vertices = ::deko3d::Instance().GetData().allocate(size, alignof(vertex::Vertex));
+
+        if (!buffer.vertices)
+            throw love::Exception("Failed to allocate %zu bytes of GPU memory for Mesh.", size);
+
+        buffer.dirtyStart   = 0;
+        buffer.dirtyEnd     = this->vertexCount;
+        buffer.indicesDirty = true;
+    }
+
+    size_t first = buffer.dirtyStart;
+    size_t count = buffer.dirtyEnd - buffer.dirtyStart;
+
+    std::vector<Vector2> positions(count);
+    std::vector<Vector2> texCoords(count);
+    std::vector<Colorf> colors(count);
+
+    this->GetStandardAttributes(first, count, positions.data(), texCoords.data(), colors.data());
+
+    vertex::Vertex* vertices = (vertex::Vertex*)buffer.vertices.getCpuAddr() + first;
+
+    for (size_t index = 0; index < count; index++)
+    {
+        const Colorf& color = colors[index];
+
+        vertices[index] = { .position = { positions[index].x, positions[index].y, 0.0f },
+                            .color    = { color.r, color.g, color.b, color.a },
+                            .texcoord = { vertex::normto16t(texCoords[index].x),
+                                          vertex::normto16t(texCoords[index].y) } };
+    }
+
+    buffer.dirtyStart = buffer.dirtyEnd = 0;
+
+    if (!buffer.indicesDirty)
+        return;
+
+    /* no frame in flight reads this copy, so it can go */
+    buffer.indices.destroy();
+    buffer.indicesDirty = false;
+
+    if (!this->useVertexMap || this->vertexMap.empty())
+        return;
+
+    size_t size = this->vertexMap.size() * sizeof(uint32_t);
+
+    buffer.indices = ::deko3d::Instance().GetData().allocate(size, sizeof(uint32_t));
+
+    if (!buffer.indices)
+        throw love::Exception("Failed to allocate %zu bytes of GPU memory for Mesh.", size);
+
+    memcpy(buffer.indices.getCpuAddr(), this->vertexMap.data(), size);
+}
+
+void Mesh::Flush()
+{
+    this->TakeModifications();
+}
+
+void Mesh::Draw(Graphics* gfx, const Matrix4& localTransform)
+{
+    Matrix4 transform(gfx->GetTransform(), localTransform);
+
+    if (this->usage == USAGE_STATIC)
+        this->DrawStatic(gfx, transform);
+    else
+        this->DrawStreamed(gfx, transform);
+}
+
+void Mesh::DrawStatic(Graphics* gfx, const Matrix4& transform)
+{
+    this->TakeModifications();
+
+    uint64_t frame = ::deko3d::Instance().EnsureFrame();
+
+    if (Mesh::IsStale(this->buffers[this->current]))
+    {
+        int written = -1;
+
+        /* the other copy first, leaving the one drawn last alone */
+        for (int offset = 1; offset <= BUFFER_COUNT && written < 0; offset++)
+        {
+            int candidate = (this->current + offset) % BUFFER_COUNT;
+
+            if (Mesh::IsWritable(this->buffers[candidate], frame))
+                written = candidate;
+        }
+
+        /* changed again while both copies are in flight, so copy it this once */
+        if (written < 0)
+        {
+            this->DrawStreamed(gfx, transform);
+            return;
+        }
+
+        this->Upload(this->buffers[written]);
+        this->current = written;
+    }
+
+    Buffer& buffer = this->buffers[this->current];
+
+    size_t total = this->useVertexMap ? this->vertexMap.size() : this->vertexCount;
+
+    size_t start = 0;
+    size_t count = total;
+
+    if (this->rangeStart >= 0 && this->rangeCount > 0)
+    {
+        start = std::min((size_t)this->rangeStart, total);
+        count = std::min((size_t)this->rangeCount, total - start);
+    }
+
+    if (count == 0)
+        return;
+
+    std::optional<DkResHandle> handle;
+    if (this->texture.Get() != nullptr)
+        handle = this->texture->GetHandle();
+
+    ::deko3d::Instance().RenderMesh(Mesh::GetPrimitive(this->drawMode), buffer.vertices,
+                                    this->useVertexMap ? buffer.indices : CMemPool::Handle {},
+                                    start, count, transform, gfx->GetColor(), handle);
+
+    buffer.drawn     = true;
+    buffer.lastFrame = frame;
+}
+
+void Mesh::DrawStreamed(Graphics* gfx, const Matrix4& transform)
+{
+    std::vector<uint32_t> indices;
+    if (!this->GetDrawIndices(indices))
+        return;
+
+    common::Mesh::Flush();
+
+    std::vector<Vector2> positions(this->vertexCount);
+    std::vector<Vector2> texCoords(this->vertexCount);
+    std::vector<Colorf> colors(this->vertexCount);
+
+    this->GetStandardAttributes(0, this->vertexCount, positions.data(), texCoords.data(),
+                                colors.data());
+
+    transform.TransformXY(positions.data(), positions.data(), (int)this->vertexCount);
+
+    const Colorf color = gfx->GetColor();
+
+    std::vector<vertex::Vertex> vertices(indices.size());
+
+    for (size_t index = 0; index < indices.size(); index++)
+    {
+        const uint32_t current = indices[index];
+
+        Colorf vertexColor = colors[current];
+        vertexColor *= color;
+
+        vertices[index] = { .position = { positions[current].x, positions[current].y, 0.0f },
+                            .color    = { vertexColor.r, vertexColor.g, vertexColor.b,
+                                          vertexColor.a },
+                            .texcoord = { vertex::normto16t(texCoords[current].x),
+                                          vertex::normto16t(texCoords[current].y) } };
+    }
+
+    DkPrimitive primitive = Mesh::GetPrimitive(this->drawMode);
+
+    if (this->texture.Get() != nullptr)
+        ::deko3d::Instance().RenderTexture(this->texture->GetHandle(), vertices.data(),
+                                           vertices.size(), primitive);
+    else
+        ::deko3d::Instance().RenderPolyline(primitive, vertices.data(), vertices.size());
+}
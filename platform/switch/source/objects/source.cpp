@@ -8,16 +8,16 @@ using namespace love;
 
 #define AudioModule() (Module::GetInstance<Audio>(Module::M_AUDIO))
 
-StaticDataBuffer::StaticDataBuffer(void* data, size_t size)
+StaticDataBuffer::StaticDataBuffer(const void* data, size_t size) : size(size)
 {
     std::pair<void*, size_t> buff = AudioPool::MemoryAlign(size);
 
-    if (buff.first)
-    {
-        memcpy(buff.first, data, size);
+    if (!buff.first)
+        throw love::Exception("Not enough audio memory for %zu bytes.", size);
 
-        this->buffer = { (s16*)buff.first, buff.second };
-    }
+    memcpy(buff.first, data, size);
+
+    this->buffer = { (s16*)buff.first, buff.second };
 }
 
 StaticDataBuffer::~StaticDataBuffer()
@@ -27,7 +27,8 @@ StaticDataBuffer::~StaticDataBuffer()
 
 /* SOURCE IMPLEMENTATION */
 
-Source::Source(Pool* pool, SoundData* sound) : common::Source(pool, sound)
+Source::Source(Pool* pool, SoundData* sound, StaticDataBuffer* buffer) :
+    common::Source(pool, sound, buffer)
 {
     this->sources[0]                     = AudioDriverWaveBuf();
     this->sources[0].start_sample_offset = 0;
@@ -97,11 +98,18 @@ void Source::SetVolume(float volume)
 void Source::Reset()
 {
     PcmFormat format = (this->bitDepth == 8) ? PcmFormat_Int8 : PcmFormat_Int16;
-    driver::Audrv::Instance().ResetChannel(this->channel, this->channels, format, this->sampleRate);
+    driver::Audrv::Instance().ResetChannel(this->channel, this->channels, format,
+                                           (int)this->GetChannelRate());
 
+    this->ApplyPitch();
     this->SetVolume(this->GetVolume());
 }
 
+void Source::ApplyPitch()
+{
+    driver::Audrv::Instance().SetChannelPitch(this->channel, this->GetChannelPitch());
+}
+
 bool Source::Update()
 {
     if (!this->valid)
@@ -170,7 +178,7 @@ void Source::PrepareAtomic()
 int Source::StreamAtomic(size_t which)
 {
     auto buffer = this->sources[which].data_pcm16;
-    int decoded = std::max(decoder->Decode(buffer), 0);
+    int decoded = std::max(this->DecodeStream(buffer), 0);
 
     if (decoded > 0)
         armDCacheFlush(buffer, decoded);
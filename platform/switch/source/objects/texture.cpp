@@ -34,6 +34,7 @@ bool Texture::SetWrap(const Wrap& wrap)
 
 void Texture::SetFilter(const Filter& filter)
 {
+    this->filter = filter;
     ::deko3d::Instance().SetTextureFilter(this, filter);
 }
 
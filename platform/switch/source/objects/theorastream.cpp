@@ -16,19 +16,19 @@ TheoraStream::Frame::~Frame()
 
 TheoraStream::TheoraStream(File* file) : common::TheoraStream(file)
 {
-    this->frontBuffer = new Frame();
-    this->backBuffer  = new Frame();
+    for (size_t index = 0; index < FRAME_COUNT; index++)
+        this->frames.push_back(new Frame());
 
     th_info_init(&this->info);
 
     try
     {
         this->ParseHeader();
+        this->InitFrames();
     }
     catch (love::Exception& exception)
     {
-        delete this->backBuffer;
-        delete this->frontBuffer;
+        this->DeleteFrames();
 
         th_info_clear(&this->info);
 
@@ -58,36 +58,36 @@ size_t TheoraStream::GetSize() const
 
 void TheoraStream::SetupBuffers()
 {
-    Frame* buffers[2] = { (Frame*)this->backBuffer, (Frame*)this->frontBuffer };
-
     this->yPlaneXOffset = this->cPlaneXOffset = this->info.pic_x;
     this->yPlaneYOffset = this->cPlaneYOffset = this->info.pic_y;
 
     scaleFormat(this->info.pixel_fmt, cPlaneXOffset, cPlaneYOffset);
 
-    for (size_t index = 0; index < 2; index++)
+    for (IFrame* buffer : this->frames)
     {
-        buffers[index]->cw = buffers[index]->yw = this->info.pic_width;
-        buffers[index]->ch = buffers[index]->yh = this->info.pic_height;
+        Frame* frame = (Frame*)buffer;
+
+        frame->cw = frame->yw = this->info.pic_width;
+        frame->ch = frame->yh = this->info.pic_height;
 
-        scaleFormat(this->info.pixel_fmt, buffers[index]->cw, buffers[index]->ch);
+        scaleFormat(this->info.pixel_fmt, frame->cw, frame->ch);
 
-        buffers[index]->yPlane  = new uint8_t[buffers[index]->yw * buffers[index]->yh];
-        buffers[index]->cbPlane = new uint8_t[buffers[index]->cw * buffers[index]->ch];
-        buffers[index]->crPlane = new uint8_t[buffers[index]->cw * buffers[index]->ch];
+        frame->yPlane  = new uint8_t[frame->yw * frame->yh];
+        frame->cbPlane = new uint8_t[frame->cw * frame->ch];
+        frame->crPlane = new uint8_t[frame->cw * frame->ch];
 
-        memset(buffers[index]->yPlane, 16, buffers[index]->yw * buffers[index]->yh);
-        memset(buffers[index]->cbPlane, 128, buffers[index]->cw * buffers[index]->ch);
-        memset(buffers[index]->crPlane, 128, buffers[index]->cw * buffers[index]->ch);
+        memset(frame->yPlane, 16, frame->yw * frame->yh);
+        memset(frame->cbPlane, 128, frame->cw * frame->ch);
+        memset(frame->crPlane, 128, frame->cw * frame->ch);
     }
 }
 
-void TheoraStream::FillBufferData(th_ycbcr_buffer bufferInfo)
+void TheoraStream::FillBufferData(IFrame* target, th_ycbcr_buffer bufferInfo)
 {
     if (!bufferInfo[0].data || !bufferInfo[1].data || !bufferInfo[2].data)
         return;
 
-    Frame* frame = (Frame*)this->backBuffer;
+    Frame* frame = (Frame*)target;
 
     for (int y = 0; y < frame->yh; ++y)
     {
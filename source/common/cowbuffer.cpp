@@ -0,0 +1,236 @@
+#include "common/cowbuffer.h"
+#include "common/exception.h"
+
+#include <algorithm>
+#include <atomic>
+#include <string.h>
+
+using namespace love;
+
+static std::atomic<int64_t> allocatedBytes(0);
+static std::atomic<int64_t> logicalBytes(0);
+
+CowBuffer::Chunk::Chunk(size_t size) : memory(nullptr), size(size)
+{
+    try
+    {
+        this->memory = new uint8_t[size];
+    }
+    catch (std::bad_alloc&)
+    {
+        throw love::Exception("Out of memory");
+    }
+
+    allocatedBytes += size;
+}
+
+CowBuffer::Chunk::Chunk(uint8_t* memory, size_t size, const Deleter& deleter) :
+    memory(memory),
+    size(size),
+    deleter(deleter)
+{
+    allocatedBytes += size;
+}
+
+CowBuffer::Chunk::~Chunk()
+{
+    if (this->deleter)
+        this->deleter(this->memory);
+    else
+        delete[] this->memory;
+
+    allocatedBytes -= this->size;
+}
+
+CowBuffer::CowBuffer() : size(0), blockSize(0)
+{}
+
+CowBuffer::CowBuffer(size_t size, size_t blockSize) :
+    size(size),
+    blockSize(blockSize > 0 ? blockSize : size)
+{
+    if (size == 0)
+        return;
+
+    this->flat.Set(new Chunk(size), Acquire::NORETAIN);
+    logicalBytes += size;
+}
+
+CowBuffer::CowBuffer(uint8_t* memory, size_t size, size_t blockSize, const Deleter& deleter) :
+    size(size),
+    blockSize(blockSize > 0 ? blockSize : size)
+{
+    this->flat.Set(new Chunk(memory, size, deleter), Acquire::NORETAIN);
+    logicalBytes += size;
+}
+
+CowBuffer::CowBuffer(const CowBuffer& other) :
+    size(other.size),
+    blockSize(other.blockSize),
+    flat(other.flat),
+    blocks(other.blocks)
+{
+    logicalBytes += this->size;
+}
+
+CowBuffer& CowBuffer::operator=(const CowBuffer& other)
+{
+    if (this == &other)
+        return *this;
+
+    logicalBytes += int64_t(other.size) - int64_t(this->size);
+
+    this->size      = other.size;
+    this->blockSize = other.blockSize;
+    this->flat      = other.flat;
+    this->blocks    = other.blocks;
+
+    return *this;
+}
+
+CowBuffer::~CowBuffer()
+{
+    logicalBytes -= this->size;
+}
+
+size_t CowBuffer::GetSize() const
+{
+    return this->size;
+}
+
+size_t CowBuffer::GetBlockSize() const
+{
+    return this->blockSize;
+}
+
+bool CowBuffer::IsShared() const
+{
+    if (this->flat)
+        return this->flat->GetReferenceCount() > 1;
+
+    for (const auto& block : this->blocks)
+    {
+        if (block.view || block.chunk->GetReferenceCount() > 1)
+            return true;
+    }
+
+    return false;
+}
+
+const uint8_t* CowBuffer::ReadBlock(size_t offset) const
+{
+    size_t index = offset / this->blockSize;
+
+    if (this->flat)
+        return this->flat->memory + index * this->blockSize;
+
+    if (index >= this->blocks.size())
+        return nullptr;
+
+    return this->blocks[index].data;
+}
+
+uint8_t* CowBuffer::WriteBlock(size_t offset)
+{
+    size_t index = offset / this->blockSize;
+
+    if (this->flat)
+    {
+        if (this->flat->GetReferenceCount() == 1)
+            return this->flat->memory + index * this->blockSize;
+
+        this->Split();
+    }
+
+    if (index >= this->blocks.size())
+        return nullptr;
+
+    Block& block = this->blocks[index];
+
+    if (block.view || block.chunk->GetReferenceCount() > 1)
+    {
+        size_t length = std::min(this->blockSize, this->size - index * this->blockSize);
+        Chunk* copy   = new Chunk(length);
+
+        memcpy(copy->memory, block.data, length);
+
+        block.chunk.Set(copy, Acquire::NORETAIN);
+        block.data = copy->memory;
+        block.view = false;
+    }
+
+    return block.data;
+}
+
+const uint8_t* CowBuffer::ReadContiguous()
+{
+    if (this->size == 0)
+        return nullptr;
+
+    if (!this->flat)
+        this->Join();
+
+    return this->flat->memory;
+}
+
+uint8_t* CowBuffer::WriteContiguous()
+{
+    if (this->size == 0)
+        return nullptr;
+
+    if (!this->flat)
+        this->Join();
+    else if (this->flat->GetReferenceCount() > 1)
+    {
+        Chunk* copy = new Chunk(this->size);
+        memcpy(copy->memory, this->flat->memory, this->size);
+
+        this->flat.Set(copy, Acquire::NORETAIN);
+    }
+
+    return this->flat->memory;
+}
+
+/* every block starts out as a view of the flat chunk */
+void CowBuffer::Split()
+{
+    size_t count = (this->size + this->blockSize - 1) / this->blockSize;
+    this->blocks.resize(count);
+
+    for (size_t index = 0; index < count; index++)
+    {
+        Block& block = this->blocks[index];
+
+        block.chunk = this->flat;
+        block.data  = this->flat->memory + index * this->blockSize;
+        block.view  = true;
+    }
+
+    this->flat.Set(nullptr);
+}
+
+void CowBuffer::Join()
+{
+    Chunk* joined = new Chunk(this->size);
+
+    for (size_t index = 0; index < this->blocks.size(); index++)
+    {
+        size_t offset = index * this->blockSize;
+        size_t length = std::min(this->blockSize, this->size - offset);
+
+        memcpy(joined->memory + offset, this->blocks[index].data, length);
+    }
+
+    this->flat.Set(joined, Acquire::NORETAIN);
+    this->blocks.clear();
+}
+
+int64_t CowBuffer::GetAllocatedBytes()
+{
+    return allocatedBytes;
+}
+
+int64_t CowBuffer::GetLogicalBytes()
+{
+    return logicalBytes;
+}
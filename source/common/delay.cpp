@@ -2,6 +2,8 @@
     #include <3ds.h>
 #elif defined(__SWITCH__)
     #include <switch.h>
+#elif defined(__HOST__)
+    #include "host.h"
 #endif
 
 #include "common/delay.h"
@@ -618,6 +618,7 @@ void Luax::RawNewType(lua_State* L, love::Type& type, Object* object)
     Proxy* userdata = (Proxy*)lua_newuserdata(L, sizeof(Proxy));
 
     object->Retain();
+    object->SetLiveType(type);
 
     userdata->object = object;
     userdata->type   = &type;
@@ -642,14 +643,15 @@ void Luax::RawNewType(lua_State* L, love::Type& type, Object* object)
 lua_Number Luax::ComputeObjectKey(lua_State* L, Object* object)
 {
     // Compute a key to store our userdata
-    const size_t minAlign = alignof(std::max_align_t);
+    // Objects held by value in another (a module's RandomGenerator) may only be 8-aligned
+    const size_t minAlign = std::min<size_t>(alignof(std::max_align_t), 8);
     uintptr_t key         = (uintptr_t)object;
 
     if ((key & (minAlign - 1)) != 0)
         luaL_error(L, "Cannot push LOVE object. Unexpected alignment (%p should be %d).", object,
                    minAlign);
 
-    static const size_t shift = (size_t)log2(alignof(std::max_align_t));
+    static const size_t shift = (size_t)log2(minAlign);
     key >>= shift;
 
     if (key > MAX_LUAOBJ_KEY)
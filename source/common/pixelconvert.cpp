@@ -0,0 +1,274 @@
+#include "common/pixelconvert.h"
+
+#include <string.h>
+
+using namespace love;
+
+namespace
+{
+    struct Color8
+    {
+        uint8_t r, g, b, a;
+    };
+
+    struct Color16
+    {
+        uint16_t r, g, b, a;
+    };
+
+    inline Color16 widen(const Color8& c)
+    {
+        return { WidenChannel(c.r), WidenChannel(c.g), WidenChannel(c.b), WidenChannel(c.a) };
+    }
+
+    inline Color8 narrow(const Color16& c)
+    {
+        return { NarrowChannel(c.r), NarrowChannel(c.g), NarrowChannel(c.b), NarrowChannel(c.a) };
+    }
+
+    /*
+    ** Each format knows how to load and store one pixel at its native
+    ** depth. 8 bit formats are only widened when the other side is RGBA16.
+    */
+    struct RGBA8
+    {
+        static constexpr size_t SIZE = 4;
+        static constexpr bool WIDE   = false;
+
+        static Color8 Load(const uint8_t* p)
+        {
+            return { p[0], p[1], p[2], p[3] };
+        }
+
+        static void Store(const Color8& c, uint8_t* p)
+        {
+            p[0] = c.r;
+            p[1] = c.g;
+            p[2] = c.b;
+            p[3] = c.a;
+        }
+    };
+
+    /* packed as a | b << 8 | g << 16 | r << 24 */
+    struct TEX3DS_RGBA8
+    {
+        static constexpr size_t SIZE = 4;
+        static constexpr bool WIDE   = false;
+
+        static Color8 Load(const uint8_t* p)
+        {
+            return { p[3], p[2], p[1], p[0] };
+        }
+
+        static void Store(const Color8& c, uint8_t* p)
+        {
+            p[0] = c.a;
+            p[1] = c.b;
+            p[2] = c.g;
+            p[3] = c.r;
+        }
+    };
+
+    struct RGB8
+    {
+        static constexpr size_t SIZE = 3;
+        static constexpr bool WIDE   = false;
+
+        static Color8 Load(const uint8_t* p)
+        {
+            return { p[0], p[1], p[2], 0xFF };
+        }
+
+        static void Store(const Color8& c, uint8_t* p)
+        {
+            p[0] = c.r;
+            p[1] = c.g;
+            p[2] = c.b;
+        }
+    };
+
+    struct R8
+    {
+        static constexpr size_t SIZE = 1;
+        static constexpr bool WIDE   = false;
+
+        static Color8 Load(const uint8_t* p)
+        {
+            return { p[0], 0, 0, 0xFF };
+        }
+
+        static void Store(const Color8& c, uint8_t* p)
+        {
+            p[0] = c.r;
+        }
+    };
+
+    struct RGBA16
+    {
+        static constexpr size_t SIZE = 8;
+        static constexpr bool WIDE   = true;
+
+        static Color16 Load(const uint8_t* p)
+        {
+            Color16 c;
+            memcpy(&c, p, sizeof(c));
+
+            return c;
+        }
+
+        static void Store(const Color16& c, uint8_t* p)
+        {
+            memcpy(p, &c, sizeof(c));
+        }
+    };
+
+    template<typename Format>
+    inline Color16 loadWide(const uint8_t* p)
+    {
+        if constexpr (Format::WIDE)
+            return Format::Load(p);
+        else
+            return widen(Format::Load(p));
+    }
+
+    template<typename Format>
+    inline void storeWide(const Color16& c, uint8_t* p)
+    {
+        if constexpr (Format::WIDE)
+            Format::Store(c, p);
+        else
+            Format::Store(narrow(c), p);
+    }
+
+    /*
+    ** The loops are plain enough for the compiler to unroll and,
+    ** with NEON on the Switch, vectorize.
+    */
+    template<typename Src, typename Dst>
+    void convertRow(const void* src, void* dst, size_t count)
+    {
+        const uint8_t* in = (const uint8_t*)src;
+        uint8_t* out      = (uint8_t*)dst;
+
+        for (size_t index = 0; index < count; index++, in += Src::SIZE, out += Dst::SIZE)
+        {
+            if constexpr (Src::WIDE || Dst::WIDE)
+                storeWide<Dst>(loadWide<Src>(in), out);
+            else
+                Dst::Store(Src::Load(in), out);
+        }
+    }
+
+    template<size_t Size>
+    void copyRow(const void* src, void* dst, size_t count)
+    {
+        memcpy(dst, src, count * Size);
+    }
+
+    /* RGBA8 <-> TEX3DS_RGBA8 is a byte swap of each pixel, a single REV on ARM */
+    void swapRow(const void* src, void* dst, size_t count)
+    {
+        const uint8_t* in = (const uint8_t*)src;
+        uint8_t* out      = (uint8_t*)dst;
+
+        for (size_t index = 0; index < count; index++, in += 4, out += 4)
+        {
+            uint32_t pixel;
+            memcpy(&pixel, in, sizeof(pixel));
+
+            pixel = __builtin_bswap32(pixel);
+            memcpy(out, &pixel, sizeof(pixel));
+        }
+    }
+
+    enum RowFormat
+    {
+        ROW_RGBA8,
+        ROW_TEX3DS_RGBA8,
+        ROW_RGB8,
+        ROW_R8,
+        ROW_RGBA16,
+        ROW_MAX_ENUM
+    };
+
+    bool getRowFormat(PixelFormat format, RowFormat& out)
+    {
+        switch (format)
+        {
+            case PIXELFORMAT_RGBA8:
+                out = ROW_RGBA8;
+                return true;
+            case PIXELFORMAT_TEX3DS_RGBA8:
+#if defined(__3DS__)
+                out = ROW_TEX3DS_RGBA8;
+#else
+                /* only the 3DS packs it into a word, setPixel elsewhere writes it as RGBA8 */
+                out = ROW_RGBA8;
+#endif
+                return true;
+            case PIXELFORMAT_RGB8:
+                out = ROW_RGB8;
+                return true;
+            case PIXELFORMAT_R8:
+                out = ROW_R8;
+                return true;
+            case PIXELFORMAT_RGBA16:
+                out = ROW_RGBA16;
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    // clang-format off
+    /* indexed by [source][destination] */
+    constexpr PixelRowConverter converters[ROW_MAX_ENUM][ROW_MAX_ENUM] =
+    {
+        {
+            copyRow<4>,
+            swapRow,
+            convertRow<RGBA8, RGB8>,
+            convertRow<RGBA8, R8>,
+            convertRow<RGBA8, RGBA16>
+        },
+        {
+            swapRow,
+            copyRow<4>,
+            convertRow<TEX3DS_RGBA8, RGB8>,
+            convertRow<TEX3DS_RGBA8, R8>,
+            convertRow<TEX3DS_RGBA8, RGBA16>
+        },
+        {
+            convertRow<RGB8, RGBA8>,
+            convertRow<RGB8, TEX3DS_RGBA8>,
+            copyRow<3>,
+            convertRow<RGB8, R8>,
+            convertRow<RGB8, RGBA16>
+        },
+        {
+            convertRow<R8, RGBA8>,
+            convertRow<R8, TEX3DS_RGBA8>,
+            convertRow<R8, RGB8>,
+            copyRow<1>,
+            convertRow<R8, RGBA16>
+        },
+        {
+            convertRow<RGBA16, RGBA8>,
+            convertRow<RGBA16, TEX3DS_RGBA8>,
+            convertRow<RGBA16, RGB8>,
+            convertRow<RGBA16, R8>,
+            copyRow<8>
+        }
+    };
+    // clang-format on
+} // namespace
+
+PixelRowConverter love::GetPixelRowConverter(PixelFormat source, PixelFormat destination)
+{
+    RowFormat from, to;
+
+    if (!getRowFormat(source, from) || !getRowFormat(destination, to))
+        return nullptr;
+
+    return converters[from][to];
+}
@@ -13,10 +13,12 @@ unsigned love::GetPixelFormatSize(PixelFormat format)
         case PIXELFORMAT_ETC2_RGBA1:
         case PIXELFORMAT_RGBA16:
         case PIXELFORMAT_ETC2_RGB:
+        case PIXELFORMAT_TEX3DS_ETC1:
             return 8;
         case PIXELFORMAT_DXT3:
         case PIXELFORMAT_DXT5:
         case PIXELFORMAT_ETC2_RGBA:
+        case PIXELFORMAT_TEX3DS_ETC1A4:
             return 16;
         case PIXELFORMAT_RGBA8:
         case PIXELFORMAT_TEX3DS_RGBA8:
@@ -52,6 +54,7 @@ int love::GetPixelFormatColorComponents(PixelFormat format)
         case PIXELFORMAT_ETC1:
         case PIXELFORMAT_ETC2_RGB:
         case PIXELFORMAT_RGB8:
+        case PIXELFORMAT_TEX3DS_ETC1:
             return 3;
         case PIXELFORMAT_DXT3:
         case PIXELFORMAT_ETC2_RGBA1:
@@ -73,6 +76,7 @@ int love::GetPixelFormatColorComponents(PixelFormat format)
         case PIXELFORMAT_ASTC_12x10:
         case PIXELFORMAT_ASTC_12x12:
         case PIXELFORMAT_TEX3DS_RGBA8:
+        case PIXELFORMAT_TEX3DS_ETC1A4:
             return 4;
         default:
             return 0;
@@ -0,0 +1,130 @@
+#include "common/pixelmap.h"
+
+#if defined(__ARM_NEON)
+    #include <arm_neon.h>
+#endif
+
+using namespace love;
+
+#if defined(__ARM_NEON)
+/* Multiply on eight lanes at once */
+static inline uint16x8_t multiply(uint16x8_t x, uint16x8_t y)
+{
+    const uint32x4_t half = vdupq_n_u32(0x8000);
+
+    uint32x4_t low  = vaddq_u32(vmull_u16(vget_low_u16(x), vget_low_u16(y)), half);
+    uint32x4_t high = vaddq_u32(vmull_u16(vget_high_u16(x), vget_high_u16(y)), half);
+
+    return vcombine_u16(vshrn_n_u32(vsraq_n_u32(low, low, 16), 16),
+                        vshrn_n_u32(vsraq_n_u32(high, high, 16), 16));
+}
+
+/*
+** Eight pixels at a time, split into one register per channel. Returns
+** how many pixels were done, the rest are left to the scalar loops.
+*/
+static size_t mapRowNeon(pixelmap::Operation operation, const uint16_t value[4], uint16_t* row,
+                         size_t count)
+{
+    size_t done = 0;
+
+    for (; done + 8 <= count; done += 8)
+    {
+        uint16_t* pixels   = row + done * 4;
+        uint16x8x4_t color = vld4q_u16(pixels);
+
+        switch (operation)
+        {
+            case pixelmap::MAP_TINT:
+                for (int channel = 0; channel < 4; channel++)
+                {
+                    uint16x8_t tint    = vdupq_n_u16(value[channel]);
+                    color.val[channel] = multiply(color.val[channel], tint);
+                }
+                break;
+            case pixelmap::MAP_THRESHOLD:
+                for (int channel = 0; channel < 3; channel++)
+                    color.val[channel] = vcgeq_u16(color.val[channel], vdupq_n_u16(value[0]));
+                break;
+            case pixelmap::MAP_PREMULTIPLY:
+                for (int channel = 0; channel < 3; channel++)
+                    color.val[channel] = multiply(color.val[channel], color.val[3]);
+                break;
+            case pixelmap::MAP_GRAYSCALE:
+            {
+                const uint32x4_t half = vdupq_n_u32(0x8000);
+
+                uint32x4_t low = vmull_n_u16(vget_low_u16(color.val[0]), 19595);
+                low            = vmlal_n_u16(low, vget_low_u16(color.val[1]), 38470);
+                low            = vmlal_n_u16(low, vget_low_u16(color.val[2]), 7471);
+
+                uint32x4_t high = vmull_n_u16(vget_high_u16(color.val[0]), 19595);
+                high            = vmlal_n_u16(high, vget_high_u16(color.val[1]), 38470);
+                high            = vmlal_n_u16(high, vget_high_u16(color.val[2]), 7471);
+
+                uint16x8_t luma = vcombine_u16(vshrn_n_u32(vaddq_u32(low, half), 16),
+                                               vshrn_n_u32(vaddq_u32(high, half), 16));
+
+                color.val[0] = color.val[1] = color.val[2] = luma;
+                break;
+            }
+            default:
+                return done;
+        }
+
+        vst4q_u16(pixels, color);
+    }
+
+    return done;
+}
+#endif
+
+void pixelmap::MapRow(Operation operation, const uint16_t value[4], uint16_t* row, size_t count)
+{
+    uint16_t* end = row + count * 4;
+
+#if defined(__ARM_NEON)
+    row += mapRowNeon(operation, value, row, count) * 4;
+#endif
+
+    switch (operation)
+    {
+        case MAP_TINT:
+            for (uint16_t* pixel = row; pixel < end; pixel += 4)
+            {
+                pixel[0] = Multiply(pixel[0], value[0]);
+                pixel[1] = Multiply(pixel[1], value[1]);
+                pixel[2] = Multiply(pixel[2], value[2]);
+                pixel[3] = Multiply(pixel[3], value[3]);
+            }
+            break;
+        case MAP_THRESHOLD:
+            for (uint16_t* pixel = row; pixel < end; pixel += 4)
+            {
+                pixel[0] = pixel[0] >= value[0] ? 0xFFFF : 0;
+                pixel[1] = pixel[1] >= value[0] ? 0xFFFF : 0;
+                pixel[2] = pixel[2] >= value[0] ? 0xFFFF : 0;
+            }
+            break;
+        case MAP_PREMULTIPLY:
+            for (uint16_t* pixel = row; pixel < end; pixel += 4)
+            {
+                pixel[0] = Multiply(pixel[0], pixel[3]);
+                pixel[1] = Multiply(pixel[1], pixel[3]);
+                pixel[2] = Multiply(pixel[2], pixel[3]);
+            }
+            break;
+        case MAP_GRAYSCALE:
+            for (uint16_t* pixel = row; pixel < end; pixel += 4)
+            {
+                /* 0.299, 0.587 and 0.114 in 16.16 fixed point, summing to 1 */
+                uint32_t luma = (pixel[0] * 19595u + pixel[1] * 38470u + pixel[2] * 7471u +
+                                 0x8000u) >> 16;
+
+                pixel[0] = pixel[1] = pixel[2] = uint16_t(luma);
+            }
+            break;
+        default:
+            break;
+    }
+}
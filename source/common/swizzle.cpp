@@ -0,0 +1,286 @@
+#include "common/swizzle.h"
+#include "common/exception.h"
+
+#include <string.h>
+
+#include <vector>
+
+using namespace love;
+
+// clang-format off
+/* Morton offset of each pixel inside a tile, indexed by y * 8 + x */
+static constexpr uint8_t mortonTable[swizzle::TILE_PIXELS] =
+{
+     0,  1,  4,  5, 16, 17, 20, 21,
+     2,  3,  6,  7, 18, 19, 22, 23,
+     8,  9, 12, 13, 24, 25, 28, 29,
+    10, 11, 14, 15, 26, 27, 30, 31,
+    32, 33, 36, 37, 48, 49, 52, 53,
+    34, 35, 38, 39, 50, 51, 54, 55,
+    40, 41, 44, 45, 56, 57, 60, 61,
+    42, 43, 46, 47, 58, 59, 62, 63,
+};
+// clang-format on
+
+bool swizzle::IsPixelSizeSupported(size_t pixelSize)
+{
+    return pixelSize == 1 || pixelSize == 2 || pixelSize == 4;
+}
+
+unsigned swizzle::GetTiledIndex(unsigned width, unsigned x, unsigned y)
+{
+    unsigned tile = (y / TILE_SIZE) * (width / TILE_SIZE) + (x / TILE_SIZE);
+    return tile * TILE_PIXELS + mortonTable[(y % TILE_SIZE) * TILE_SIZE + (x % TILE_SIZE)];
+}
+
+static void checkPixelSize(size_t pixelSize)
+{
+    if (!swizzle::IsPixelSizeSupported(pixelSize))
+        throw love::Exception("Cannot swizzle %zu-byte pixels.", pixelSize);
+}
+
+/*
+** Row kernels: one row of pixels in, or out of, a tile row. The Morton
+** offsets of a row only depend on y % 8, so they are looked up once per row
+** and whole 8-pixel spans are moved per tile.
+*/
+template<typename T>
+static void linearRowToTiled(const T* src, T* tileRow, unsigned dx, unsigned width, unsigned subY)
+{
+    const uint8_t* offsets = &mortonTable[subY * swizzle::TILE_SIZE];
+
+    unsigned x = 0;
+
+    /* leading partial tile */
+    for (; x < width && (dx + x) % swizzle::TILE_SIZE != 0; x++)
+    {
+        unsigned dstX = dx + x;
+        tileRow[(dstX / swizzle::TILE_SIZE) * swizzle::TILE_PIXELS +
+                offsets[dstX % swizzle::TILE_SIZE]] = src[x];
+    }
+
+    /* whole tiles */
+    for (; x + swizzle::TILE_SIZE <= width; x += swizzle::TILE_SIZE)
+    {
+        T* tile = tileRow + ((dx + x) / swizzle::TILE_SIZE) * swizzle::TILE_PIXELS;
+
+        for (unsigned index = 0; index < swizzle::TILE_SIZE; index++)
+            tile[offsets[index]] = src[x + index];
+    }
+
+    /* trailing partial tile */
+    for (; x < width; x++)
+    {
+        unsigned dstX = dx + x;
+        tileRow[(dstX / swizzle::TILE_SIZE) * swizzle::TILE_PIXELS +
+                offsets[dstX % swizzle::TILE_SIZE]] = src[x];
+    }
+}
+
+template<typename T>
+static void tiledRowToLinear(const T* tileRow, T* dst, unsigned sx, unsigned width, unsigned subY)
+{
+    const uint8_t* offsets = &mortonTable[subY * swizzle::TILE_SIZE];
+
+    unsigned x = 0;
+
+    for (; x < width && (sx + x) % swizzle::TILE_SIZE != 0; x++)
+    {
+        unsigned srcX = sx + x;
+        dst[x] = tileRow[(srcX / swizzle::TILE_SIZE) * swizzle::TILE_PIXELS +
+                         offsets[srcX % swizzle::TILE_SIZE]];
+    }
+
+    for (; x + swizzle::TILE_SIZE <= width; x += swizzle::TILE_SIZE)
+    {
+        const T* tile = tileRow + ((sx + x) / swizzle::TILE_SIZE) * swizzle::TILE_PIXELS;
+
+        for (unsigned index = 0; index < swizzle::TILE_SIZE; index++)
+            dst[x + index] = tile[offsets[index]];
+    }
+
+    for (; x < width; x++)
+    {
+        unsigned srcX = sx + x;
+        dst[x] = tileRow[(srcX / swizzle::TILE_SIZE) * swizzle::TILE_PIXELS +
+                         offsets[srcX % swizzle::TILE_SIZE]];
+    }
+}
+
+template<typename T>
+static void linearToTiled(const uint8_t* src, size_t srcPitch, T* dst, unsigned dstWidth,
+                          unsigned dx, unsigned dy, unsigned width, unsigned height)
+{
+    const unsigned tilesPerRow = dstWidth / swizzle::TILE_SIZE;
+
+    for (unsigned y = 0; y < height; y++)
+    {
+        unsigned dstY = dy + y;
+        T* tileRow    = dst + (dstY / swizzle::TILE_SIZE) * tilesPerRow * swizzle::TILE_PIXELS;
+
+        linearRowToTiled((const T*)(src + y * srcPitch), tileRow, dx, width,
+                         dstY % swizzle::TILE_SIZE);
+    }
+}
+
+template<typename T>
+static void tiledToLinear(const T* src, unsigned srcWidth, unsigned sx, unsigned sy, uint8_t* dst,
+                          size_t dstPitch, unsigned width, unsigned height)
+{
+    const unsigned tilesPerRow = srcWidth / swizzle::TILE_SIZE;
+
+    for (unsigned y = 0; y < height; y++)
+    {
+        unsigned srcY    = sy + y;
+        const T* tileRow = src + (srcY / swizzle::TILE_SIZE) * tilesPerRow * swizzle::TILE_PIXELS;
+
+        tiledRowToLinear(tileRow, (T*)(dst + y * dstPitch), sx, width, srcY % swizzle::TILE_SIZE);
+    }
+}
+
+/*
+** A tiled index splits into a part from x and a part from y: the tile
+** column plus x's Morton bits, and the tile row plus y's. Unaligned copies
+** look both up once per call, leaving two table reads per pixel.
+*/
+static unsigned columnPart(unsigned x)
+{
+    return (x / swizzle::TILE_SIZE) * swizzle::TILE_PIXELS + mortonTable[x % swizzle::TILE_SIZE];
+}
+
+static unsigned rowPart(unsigned width, unsigned y)
+{
+    unsigned tileRow = (y / swizzle::TILE_SIZE) * (width / swizzle::TILE_SIZE);
+    unsigned morton  = mortonTable[(y % swizzle::TILE_SIZE) * swizzle::TILE_SIZE];
+
+    return tileRow * swizzle::TILE_PIXELS + morton;
+}
+
+template<typename T>
+static void copyTiledPixels(const T* src, unsigned srcWidth, unsigned sx, unsigned sy, T* dst,
+                            unsigned dstWidth, unsigned dx, unsigned dy, unsigned width,
+                            unsigned height)
+{
+    std::vector<unsigned> columns(width * 2);
+
+    unsigned* srcColumns = columns.data();
+    unsigned* dstColumns = columns.data() + width;
+
+    for (unsigned x = 0; x < width; x++)
+    {
+        srcColumns[x] = columnPart(sx + x);
+        dstColumns[x] = columnPart(dx + x);
+    }
+
+    for (unsigned y = 0; y < height; y++)
+    {
+        const T* srcRow = src + rowPart(srcWidth, sy + y);
+        T* dstRow       = dst + rowPart(dstWidth, dy + y);
+
+        for (unsigned x = 0; x < width; x++)
+            dstRow[dstColumns[x]] = srcRow[srcColumns[x]];
+    }
+}
+
+void swizzle::LinearToTiled(const void* src, size_t srcPitch, void* dst, unsigned dstWidth,
+                            unsigned dx, unsigned dy, unsigned width, unsigned height,
+                            size_t pixelSize)
+{
+    checkPixelSize(pixelSize);
+
+    const uint8_t* source = (const uint8_t*)src;
+
+    switch (pixelSize)
+    {
+        case 1:
+            return linearToTiled(source, srcPitch, (uint8_t*)dst, dstWidth, dx, dy, width, height);
+        case 2:
+            return linearToTiled(source, srcPitch, (uint16_t*)dst, dstWidth, dx, dy, width, height);
+        case 4:
+        default:
+            return linearToTiled(source, srcPitch, (uint32_t*)dst, dstWidth, dx, dy, width, height);
+    }
+}
+
+void swizzle::TiledToLinear(const void* src, unsigned srcWidth, unsigned sx, unsigned sy,
+                            void* dst, size_t dstPitch, unsigned width, unsigned height,
+                            size_t pixelSize)
+{
+    checkPixelSize(pixelSize);
+
+    uint8_t* destination = (uint8_t*)dst;
+
+    switch (pixelSize)
+    {
+        case 1:
+            return tiledToLinear((const uint8_t*)src, srcWidth, sx, sy, destination, dstPitch,
+                                 width, height);
+        case 2:
+            return tiledToLinear((const uint16_t*)src, srcWidth, sx, sy, destination, dstPitch,
+                                 width, height);
+        case 4:
+        default:
+            return tiledToLinear((const uint32_t*)src, srcWidth, sx, sy, destination, dstPitch,
+                                 width, height);
+    }
+}
+
+void swizzle::CopyTiled(const void* src, unsigned srcWidth, unsigned sx, unsigned sy, void* dst,
+                        unsigned dstWidth, unsigned dx, unsigned dy, unsigned width,
+                        unsigned height, size_t pixelSize)
+{
+    checkPixelSize(pixelSize);
+
+    bool aligned = (sx % TILE_SIZE) == 0 && (sy % TILE_SIZE) == 0 && (dx % TILE_SIZE) == 0 &&
+                   (dy % TILE_SIZE) == 0;
+
+    const uint8_t* source = (const uint8_t*)src;
+    uint8_t* destination  = (uint8_t*)dst;
+
+    const size_t tileBytes = TILE_PIXELS * pixelSize;
+
+    unsigned wholeWidth  = aligned ? width - (width % TILE_SIZE) : 0;
+    unsigned wholeHeight = aligned ? height - (height % TILE_SIZE) : 0;
+
+    /* whole tiles: each row of them is one contiguous run in both images */
+    if (wholeWidth > 0 && wholeHeight > 0)
+    {
+        const size_t runBytes = (wholeWidth / TILE_SIZE) * tileBytes;
+
+        for (unsigned y = 0; y < wholeHeight; y += TILE_SIZE)
+        {
+            size_t srcTile = ((sy + y) / TILE_SIZE) * (srcWidth / TILE_SIZE) + sx / TILE_SIZE;
+            size_t dstTile = ((dy + y) / TILE_SIZE) * (dstWidth / TILE_SIZE) + dx / TILE_SIZE;
+
+            memcpy(destination + dstTile * tileBytes, source + srcTile * tileBytes, runBytes);
+        }
+    }
+    else
+    {
+        wholeWidth  = 0;
+        wholeHeight = 0;
+    }
+
+    /* whatever is left: the right column and bottom row of partial tiles */
+    auto copyPixels = [&](unsigned x, unsigned y, unsigned w, unsigned h) {
+        if (w == 0 || h == 0)
+            return;
+
+        switch (pixelSize)
+        {
+            case 1:
+                return copyTiledPixels((const uint8_t*)src, srcWidth, sx + x, sy + y,
+                                       (uint8_t*)dst, dstWidth, dx + x, dy + y, w, h);
+            case 2:
+                return copyTiledPixels((const uint16_t*)src, srcWidth, sx + x, sy + y,
+                                       (uint16_t*)dst, dstWidth, dx + x, dy + y, w, h);
+            case 4:
+            default:
+                return copyTiledPixels((const uint32_t*)src, srcWidth, sx + x, sy + y,
+                                       (uint32_t*)dst, dstWidth, dx + x, dy + y, w, h);
+        }
+    };
+
+    copyPixels(wholeWidth, 0, width - wholeWidth, wholeHeight);
+    copyPixels(0, wholeHeight, width, height - wholeHeight);
+}
@@ -0,0 +1,357 @@
+#include "common/tlsf.h"
+
+#include <string.h>
+
+using namespace love;
+
+TLSF::TLSF() :
+    alignment(0),
+    alignmentShift(0),
+    start(nullptr),
+    end(nullptr),
+    tagUnits(0),
+    totalUnits(0),
+    usedUnits(0),
+    usedBlocks(0),
+    freeBlocks(0),
+    generation(0),
+    flBitmap(0),
+    slBitmap {},
+    bins {},
+    spare(nullptr)
+{}
+
+TLSF::~TLSF()
+{
+    for (Block* block : this->nodes)
+        delete block;
+}
+
+void TLSF::Init(void* base, size_t size, size_t alignment)
+{
+    for (Block* block : this->nodes)
+        delete block;
+
+    this->nodes.clear();
+
+    this->spare    = nullptr;
+    this->flBitmap = 0;
+
+    for (int fl = 0; fl < FL_COUNT; fl++)
+    {
+        this->slBitmap[fl] = 0;
+
+        for (int sl = 0; sl < SL_COUNT; sl++)
+            this->bins[fl][sl] = nullptr;
+    }
+
+    this->alignment      = alignment;
+    this->alignmentShift = __builtin_ctzll(alignment);
+    this->tagUnits       = (sizeof(Tag) + alignment - 1) >> this->alignmentShift;
+
+    uintptr_t start = ((uintptr_t)base + alignment - 1) & ~(uintptr_t)(alignment - 1);
+    size_t waste    = start - (uintptr_t)base;
+
+    this->totalUnits = (size > waste) ? (size - waste) >> this->alignmentShift : 0;
+    this->start      = (uint8_t*)start;
+    this->end        = this->start + (this->totalUnits << this->alignmentShift);
+    this->usedUnits  = 0;
+    this->usedBlocks = 0;
+    this->freeBlocks = 0;
+
+    if (this->totalUnits == 0)
+        return;
+
+    Block* block = this->NewBlock();
+
+    block->base  = (uint8_t*)start;
+    block->units = this->totalUnits;
+
+    this->InsertFree(block);
+}
+
+/* ties the generation to the pointer, so stray bytes in front of an address rarely pass */
+uint32_t TLSF::Check(const Tag& tag)
+{
+    uint64_t block = (uintptr_t)tag.block;
+    return TAG_MAGIC ^ tag.generation ^ (uint32_t)block ^ (uint32_t)(block >> 32);
+}
+
+/*
+** Sizes below SL_COUNT each get their own bin. Above that, the first
+** level is the power of two and the second the next SL_COUNT_LOG2 bits.
+*/
+void TLSF::Mapping(size_t units, int& fl, int& sl)
+{
+    if (units < SL_COUNT)
+    {
+        fl = 0;
+        sl = (int)units;
+
+        return;
+    }
+
+    int log = 63 - __builtin_clzll(units);
+
+    fl = log - SL_COUNT_LOG2 + 1;
+    sl = (int)(units >> (log - SL_COUNT_LOG2)) - SL_COUNT;
+}
+
+TLSF::Block* TLSF::NewBlock()
+{
+    Block* block = this->spare;
+
+    if (block != nullptr)
+        this->spare = block->nextFree;
+    else
+    {
+        block = new Block();
+        this->nodes.push_back(block);
+    }
+
+    *block = Block {};
+
+    return block;
+}
+
+void TLSF::DeleteBlock(Block* block)
+{
+    /* so a stale tag pointing here is turned away */
+    block->base     = nullptr;
+    block->nextFree = this->spare;
+    this->spare     = block;
+}
+
+void TLSF::InsertFree(Block* block)
+{
+    int fl, sl;
+    Mapping(block->units, fl, sl);
+
+    Block*& head = this->bins[fl][sl];
+
+    block->free     = true;
+    block->prevFree = nullptr;
+    block->nextFree = head;
+
+    if (head != nullptr)
+        head->prevFree = block;
+
+    head = block;
+
+    this->slBitmap[fl] |= 1u << sl;
+    this->flBitmap |= 1ull << fl;
+
+    this->freeBlocks++;
+}
+
+void TLSF::RemoveFree(Block* block)
+{
+    int fl, sl;
+    Mapping(block->units, fl, sl);
+
+    if (block->prevFree != nullptr)
+        block->prevFree->nextFree = block->nextFree;
+    else
+        this->bins[fl][sl] = block->nextFree;
+
+    if (block->nextFree != nullptr)
+        block->nextFree->prevFree = block->prevFree;
+
+    if (this->bins[fl][sl] == nullptr)
+    {
+        this->slBitmap[fl] &= ~(1u << sl);
+
+        if (this->slBitmap[fl] == 0)
+            this->flBitmap &= ~(1ull << fl);
+    }
+
+    block->free = false;
+    this->freeBlocks--;
+}
+
+/*
+** Round up to the start of the next bin so that anything in the bin
+** found is big enough, then take the first non-empty bin at or above it.
+*/
+TLSF::Block* TLSF::FindFree(size_t units)
+{
+    if (units >= SL_COUNT)
+    {
+        int log = 63 - __builtin_clzll(units);
+        units += ((size_t)1 << (log - SL_COUNT_LOG2)) - 1;
+    }
+
+    int fl, sl;
+    Mapping(units, fl, sl);
+
+    if (fl >= FL_COUNT)
+        return nullptr;
+
+    uint32_t slMap = this->slBitmap[fl] & (~0u << sl);
+
+    if (slMap == 0)
+    {
+        uint64_t flMap = this->flBitmap & (~0ull << (fl + 1));
+
+        if (flMap == 0)
+            return nullptr;
+
+        fl    = __builtin_ctzll(flMap);
+        slMap = this->slBitmap[fl];
+    }
+
+    return this->bins[fl][__builtin_ctz(slMap)];
+}
+
+void* TLSF::Allocate(size_t size, size_t& allocated)
+{
+    if (!this->IsReady() || size > SIZE_MAX - (this->alignment - 1))
+        return nullptr;
+
+    size_t units = (size + this->alignment - 1) >> this->alignmentShift;
+
+    if (units == 0)
+        units = 1;
+
+    units += this->tagUnits;
+
+    Block* block = this->FindFree(units);
+
+    if (block == nullptr)
+        return nullptr;
+
+    this->RemoveFree(block);
+
+    if (block->units > units)
+    {
+        Block* rest = this->NewBlock();
+
+        rest->base         = block->base + (units << this->alignmentShift);
+        rest->units        = block->units - units;
+        rest->prevPhysical = block;
+        rest->nextPhysical = block->nextPhysical;
+
+        if (block->nextPhysical != nullptr)
+            block->nextPhysical->prevPhysical = rest;
+
+        block->nextPhysical = rest;
+        block->units        = units;
+
+        this->InsertFree(rest);
+    }
+
+    this->usedUnits += block->units;
+    this->usedBlocks++;
+
+    block->generation = ++this->generation;
+
+    Tag tag {};
+
+    tag.block      = block;
+    tag.generation = block->generation;
+    tag.check      = Check(tag);
+
+    uint8_t* address = block->base + (this->tagUnits << this->alignmentShift);
+    memcpy(address - sizeof(Tag), &tag, sizeof(Tag));
+
+    allocated = (block->units - this->tagUnits) << this->alignmentShift;
+
+    return address;
+}
+
+void TLSF::Free(void* address)
+{
+    if (address == nullptr || !this->IsReady())
+        return;
+
+    uint8_t* tagged  = (uint8_t*)address;
+    size_t tagOffset = this->tagUnits << this->alignmentShift;
+
+    /* not where any allocation of ours could start, so there's no tag to read */
+    if (tagged < this->start + tagOffset || tagged >= this->end ||
+        ((tagged - this->start) & (this->alignment - 1)) != 0)
+        return;
+
+    Tag tag {};
+    memcpy(&tag, tagged - sizeof(Tag), sizeof(Tag));
+
+    /* only follow a pointer we wrote, then make sure it's still that allocation */
+    if (tag.check != Check(tag))
+        return;
+
+    Block* block = tag.block;
+
+    if (block->free || block->generation != tag.generation || block->base + tagOffset != tagged)
+        return;
+
+    /* a second free of the same address fails the check above */
+    memset(tagged - sizeof(Tag), 0, sizeof(Tag));
+
+    this->usedUnits -= block->units;
+    this->usedBlocks--;
+
+    Block* prev = block->prevPhysical;
+
+    if (prev != nullptr && prev->free)
+    {
+        this->RemoveFree(prev);
+
+        prev->units += block->units;
+        prev->nextPhysical = block->nextPhysical;
+
+        if (block->nextPhysical != nullptr)
+            block->nextPhysical->prevPhysical = prev;
+
+        this->DeleteBlock(block);
+        block = prev;
+    }
+
+    Block* next = block->nextPhysical;
+
+    if (next != nullptr && next->free)
+    {
+        this->RemoveFree(next);
+
+        block->units += next->units;
+        block->nextPhysical = next->nextPhysical;
+
+        if (next->nextPhysical != nullptr)
+            next->nextPhysical->prevPhysical = block;
+
+        this->DeleteBlock(next);
+    }
+
+    this->InsertFree(block);
+}
+
+/* the largest free block is somewhere in the highest non-empty bin */
+TLSF::Stats TLSF::GetStats() const
+{
+    Stats stats {};
+
+    stats.size       = this->totalUnits << this->alignmentShift;
+    stats.used       = this->usedUnits << this->alignmentShift;
+    stats.usedBlocks = this->usedBlocks;
+    stats.freeBlocks = this->freeBlocks;
+
+    if (this->flBitmap == 0)
+        return stats;
+
+    int fl = 63 - __builtin_clzll(this->flBitmap);
+    int sl = 31 - __builtin_clz(this->slBitmap[fl]);
+
+    size_t largest = 0;
+
+    for (Block* block = this->bins[fl][sl]; block != nullptr; block = block->nextFree)
+    {
+        if (block->units > largest)
+            largest = block->units;
+    }
+
+    size_t freeUnits = this->totalUnits - this->usedUnits;
+
+    stats.largestFree   = largest << this->alignmentShift;
+    stats.fragmentation = 1.0f - (float)largest / freeUnits;
+
+    return stats;
+}
@@ -2,7 +2,12 @@
 
 using namespace love;
 
-Type::Type(const char* name, Type* parent) : name(name), parent(parent), id(0), initialized(false)
+Type::Type(const char* name, Type* parent) :
+    name(name),
+    parent(parent),
+    id(0),
+    initialized(false),
+    live(0)
 {}
 
 void Type::Init()
@@ -57,3 +62,18 @@ const char* love::Type::GetName() const
 {
     return this->name;
 }
+
+int Type::GetLiveCount() const
+{
+    return this->live.load(std::memory_order_relaxed);
+}
+
+void Type::AddLive(int delta)
+{
+    this->live.fetch_add(delta, std::memory_order_relaxed);
+}
+
+const std::unordered_map<std::string, Type*>& Type::GetTypes()
+{
+    return m_types;
+}
@@ -116,8 +116,11 @@ Variant::Variant(const Variant& other) : variant(other.variant)
         this->GetValue<Type::TABLE>()->Retain();
 }
 
+/* the reference moves too, or @other's destructor lets go of it under us */
 Variant::Variant(Variant&& other) : variant(std::move(other.variant))
-{}
+{
+    other.variant = Nil();
+}
 
 std::string Variant::GetTypeString() const
 {
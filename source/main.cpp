@@ -5,6 +5,8 @@
     #include <3ds.h>
 #elif defined(__SWITCH__)
     #include <switch.h>
+#elif defined(__HOST__)
+    #include "common/headless.h"
 #endif
 
 enum DoneAction
@@ -105,9 +107,15 @@ DoneAction Run_Love_Potion(int argc, char** argv, int& retval)
     while (Luax::Resume(L, 0) == LUA_YIELD && aptMainLoop())
 #elif defined(__SWITCH__)
     while (Luax::Resume(L, 0) == LUA_YIELD)
+#elif defined(__HOST__)
+    while (love::Headless::Resume(L) == LUA_YIELD)
 #endif
         lua_pop(L, lua_gettop(L) - stackpos);
 
+#if defined(__HOST__)
+    love::Headless::PrintStats();
+#endif
+
     retval          = 0;
     DoneAction done = DONE_QUIT;
 
@@ -130,6 +138,10 @@ int main(int argc, char* argv[])
     if (!IsApplicationType())
         return 0;
 
+#if defined(__HOST__)
+    love::Headless::ParseArgs(argc, argv);
+#endif
+
     DoneAction done = DONE_QUIT;
     int retval      = 0;
 
@@ -76,9 +76,17 @@ Source* Audio::NewSource(Decoder* decoder)
     return new Source(this->pool, decoder);
 }
 
+/* Sources with the same samples play from the same buffer */
 Source* Audio::NewSource(SoundData* sound)
 {
-    return new Source(this->pool, sound);
+    StrongReference<StaticDataBuffer> buffer(this->cache.GetBuffer(sound), Acquire::NORETAIN);
+
+    return new Source(this->pool, sound, buffer.Get());
+}
+
+AudioCache& Audio::GetCache()
+{
+    return this->cache;
 }
 
 bool Audio::Play(const std::vector<common::Source*>& sources)
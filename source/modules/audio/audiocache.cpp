@@ -0,0 +1,194 @@
+#include "modules/audio/audiocache.h"
+
+#include "common/exception.h"
+
+using namespace love;
+
+AudioCache::AudioCache() :
+    soundBytes(0),
+    soundBudget(DEFAULT_SOUND_BUDGET),
+    bufferBytes(0),
+    bufferBudget(DEFAULT_BUFFER_BUDGET),
+    hits(0),
+    misses(0),
+    evictions(0)
+{}
+
+AudioCache::~AudioCache()
+{}
+
+StaticDataBuffer* AudioCache::GetBuffer(SoundData* sound)
+{
+    uint64_t id = sound->GetContentId();
+
+    thread::Lock lock(this->mutex);
+
+    auto found = (id != 0) ? this->buffers.lookup.find(id) : this->buffers.lookup.end();
+
+    if (found != this->buffers.lookup.end())
+    {
+        auto& list = this->buffers.list;
+        list.splice(list.begin(), list, found->second);
+
+        this->hits++;
+
+        StaticDataBuffer* buffer = found->second->object.Get();
+        buffer->Retain();
+
+        return buffer;
+    }
+
+    this->misses++;
+
+    const void* data = sound->ReadData();
+    size_t size      = sound->GetSize();
+
+    /* written to while we were reading, so don't file it under the old id */
+    if (sound->GetContentId() != id)
+        id = 0;
+
+    StrongReference<StaticDataBuffer> buffer;
+
+    try
+    {
+        buffer.Set(new StaticDataBuffer(data, size), Acquire::NORETAIN);
+    }
+    catch (love::Exception&)
+    {
+        /* audio memory might only be full of buffers nothing plays anymore */
+        this->Trim(this->buffers, this->bufferBytes, 0);
+        buffer.Set(new StaticDataBuffer(data, size), Acquire::NORETAIN);
+    }
+
+    if (id != 0)
+    {
+        this->buffers.list.push_front({ id, buffer, 0, 0 });
+        this->buffers.lookup[id] = this->buffers.list.begin();
+        this->bufferBytes += size;
+
+        this->Trim(this->buffers, this->bufferBytes, this->bufferBudget);
+    }
+
+    buffer->Retain();
+
+    return buffer.Get();
+}
+
+SoundData* AudioCache::GetSoundData(const std::string& path, int64_t modtime, int64_t size)
+{
+    thread::Lock lock(this->mutex);
+
+    auto found = this->sounds.lookup.find(path);
+
+    if (found == this->sounds.lookup.end())
+        return nullptr;
+
+    auto entry = found->second;
+
+    /* the file changed since, whoever still holds the old one keeps it */
+    if (entry->modtime != modtime || entry->size != size)
+    {
+        this->Erase(this->sounds, entry, this->soundBytes);
+        return nullptr;
+    }
+
+    this->sounds.list.splice(this->sounds.list.begin(), this->sounds.list, entry);
+
+    SoundData* sound = entry->object.Get();
+    sound->Retain();
+
+    return sound;
+}
+
+void AudioCache::AddSoundData(const std::string& path, int64_t modtime, int64_t size,
+                              SoundData* sound)
+{
+    thread::Lock lock(this->mutex);
+
+    auto found = this->sounds.lookup.find(path);
+
+    if (found != this->sounds.lookup.end())
+        this->Erase(this->sounds, found->second, this->soundBytes);
+
+    this->sounds.list.push_front({ path, StrongReference<SoundData>(sound), modtime, size });
+    this->sounds.lookup[path] = this->sounds.list.begin();
+    this->soundBytes += sound->GetSize();
+
+    this->Trim(this->sounds, this->soundBytes, this->soundBudget);
+}
+
+template<typename Key, typename T>
+typename std::list<AudioCache::Entry<Key, T>>::iterator AudioCache::Erase(
+    Entries<Key, T>& entries, typename std::list<Entry<Key, T>>::iterator it, size_t& bytes)
+{
+    bytes -= it->object->GetSize();
+    entries.lookup.erase(it->key);
+
+    return entries.list.erase(it);
+}
+
+/*
+** Least recently used entries are at the back. Ones still held elsewhere
+** are stepped over, they wouldn't free anything.
+*/
+template<typename Key, typename T>
+void AudioCache::Trim(Entries<Key, T>& entries, size_t& bytes, size_t budget)
+{
+    auto it = entries.list.end();
+
+    while (bytes > budget && it != entries.list.begin())
+    {
+        --it;
+
+        if (it->object->GetReferenceCount() != 1)
+            continue;
+
+        it = this->Erase(entries, it, bytes);
+        this->evictions++;
+    }
+}
+
+void AudioCache::SetBudgets(size_t soundBudget, size_t bufferBudget)
+{
+    thread::Lock lock(this->mutex);
+
+    this->soundBudget  = soundBudget;
+    this->bufferBudget = bufferBudget;
+
+    this->Trim(this->sounds, this->soundBytes, this->soundBudget);
+    this->Trim(this->buffers, this->bufferBytes, this->bufferBudget);
+}
+
+/* Sources keep their buffers, they just won't be shared with new ones */
+void AudioCache::Clear()
+{
+    thread::Lock lock(this->mutex);
+
+    this->buffers.list.clear();
+    this->buffers.lookup.clear();
+
+    this->sounds.list.clear();
+    this->sounds.lookup.clear();
+
+    this->soundBytes  = 0;
+    this->bufferBytes = 0;
+}
+
+AudioCache::Stats AudioCache::GetStats()
+{
+    thread::Lock lock(this->mutex);
+
+    Stats stats {};
+
+    stats.soundBytes   = this->soundBytes;
+    stats.soundBudget  = this->soundBudget;
+    stats.bufferBytes  = this->bufferBytes;
+    stats.bufferBudget = this->bufferBudget;
+    stats.buffers      = (int)this->buffers.list.size();
+    stats.sounds       = (int)this->sounds.list.size();
+    stats.hits         = this->hits;
+    stats.misses       = this->misses;
+    stats.evictions    = this->evictions;
+
+    return stats;
+}
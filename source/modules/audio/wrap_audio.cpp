@@ -1,4 +1,5 @@
 #include "modules/audio/wrap_audio.h"
+#include "modules/filesystem/filesystem.h"
 
 using namespace love;
 
@@ -28,12 +29,40 @@ int Wrap_Audio::NewSource(lua_State* L)
                 "Cannot create queueable sources using newSource. Use newQueueableSource instead.");
     }
 
+    /* a file that was loaded as static before, and hasn't changed since, is already decoded */
+    std::string path;
+    Filesystem::Info info {};
+
+    auto filesystem = Module::GetInstance<Filesystem>(Module::M_FILESYSTEM);
+
+    if (type == Source::TYPE_STATIC && lua_type(L, 1) == LUA_TSTRING && filesystem != nullptr &&
+        filesystem->GetInfo(lua_tostring(L, 1), info))
+    {
+        auto& cache = instance()->GetCache();
+
+        if (SoundData* sound = cache.GetSoundData(lua_tostring(L, 1), info.modtime, info.size))
+        {
+            Luax::PushType(L, sound);
+            sound->Release();
+
+            lua_replace(L, 1);
+        }
+        else
+            path = lua_tostring(L, 1);
+    }
+
     if (lua_isstring(L, 1) || Luax::IsType(L, 1, File::type) || Luax::IsType(L, 1, FileData::type))
         Luax::ConvertObject(L, 1, "sound", "newDecoder");
 
     if (type == Source::TYPE_STATIC && Luax::IsType(L, 1, Decoder::type))
         Luax::ConvertObject(L, 1, "sound", "newSoundData");
 
+    if (!path.empty() && Luax::IsType(L, 1, SoundData::type))
+    {
+        auto& cache = instance()->GetCache();
+        cache.AddSoundData(path, info.modtime, info.size, Luax::ToType<SoundData>(L, 1));
+    }
+
     Source* source = nullptr;
 
     Luax::CatchException(L, [&]() {
@@ -170,14 +199,103 @@ int Wrap_Audio::SetVolume(lua_State* L)
     return 0;
 }
 
+int Wrap_Audio::GetCacheStats(lua_State* L)
+{
+    AudioCache::Stats stats = instance()->GetCache().GetStats();
+
+    lua_createtable(L, 0, 9);
+
+    lua_pushinteger(L, stats.soundBytes);
+    lua_setfield(L, -2, "soundbytes");
+
+    lua_pushinteger(L, stats.soundBudget);
+    lua_setfield(L, -2, "soundbudget");
+
+    lua_pushinteger(L, stats.bufferBytes);
+    lua_setfield(L, -2, "bufferbytes");
+
+    lua_pushinteger(L, stats.bufferBudget);
+    lua_setfield(L, -2, "bufferbudget");
+
+    lua_pushinteger(L, stats.buffers);
+    lua_setfield(L, -2, "buffers");
+
+    lua_pushinteger(L, stats.sounds);
+    lua_setfield(L, -2, "sounds");
+
+    lua_pushnumber(L, stats.hits);
+    lua_setfield(L, -2, "hits");
+
+    lua_pushnumber(L, stats.misses);
+    lua_setfield(L, -2, "misses");
+
+    lua_pushnumber(L, stats.evictions);
+    lua_setfield(L, -2, "evictions");
+
+    return 1;
+}
+
+int Wrap_Audio::SetCacheBudget(lua_State* L)
+{
+    AudioCache::Stats stats = instance()->GetCache().GetStats();
+
+    lua_Number soundBudget  = luaL_checknumber(L, 1);
+    lua_Number bufferBudget = luaL_optnumber(L, 2, stats.bufferBudget);
+
+    if (soundBudget < 0 || bufferBudget < 0)
+        return luaL_error(L, "Cache budget must not be negative.");
+
+    instance()->GetCache().SetBudgets((size_t)soundBudget, (size_t)bufferBudget);
+
+    return 0;
+}
+
+int Wrap_Audio::GetResampleQuality(lua_State* L)
+{
+    const char* name = nullptr;
+
+    if (!Resampler::GetConstant(Resampler::GetDefaultQuality(), name))
+        return luaL_error(L, "Invalid resample quality.");
+
+    lua_pushstring(L, name);
+
+    return 1;
+}
+
+/* streams made after this use @quality */
+int Wrap_Audio::SetResampleQuality(lua_State* L)
+{
+    const char* name = luaL_checkstring(L, 1);
+    Resampler::Quality quality;
+
+    if (!Resampler::GetConstant(name, quality))
+        return Luax::EnumError(L, "resample quality", Resampler::GetConstants(quality), name);
+
+    Resampler::SetDefaultQuality(quality);
+
+    return 0;
+}
+
+int Wrap_Audio::ClearCache(lua_State* L)
+{
+    instance()->GetCache().Clear();
+
+    return 0;
+}
+
 // clang-format off
 static constexpr luaL_Reg functions[] =
 {
+    { "clearCache",           Wrap_Audio::ClearCache           },
+    { "getCacheStats",        Wrap_Audio::GetCacheStats        },
+    { "getResampleQuality",   Wrap_Audio::GetResampleQuality   },
     { "getVolume",            Wrap_Audio::GetVolume            },
     { "getActiveSourceCount", Wrap_Audio::GetActiveSourceCount },
     { "newSource",            Wrap_Audio::NewSource            },
     { "pause",                Wrap_Audio::Pause                },
     { "play",                 Wrap_Audio::Play                 },
+    { "setCacheBudget",       Wrap_Audio::SetCacheBudget       },
+    { "setResampleQuality",   Wrap_Audio::SetResampleQuality   },
     { "setVolume",            Wrap_Audio::SetVolume            },
     { "stop",                 Wrap_Audio::Stop                 },
     { 0,                      0                                }
@@ -0,0 +1,579 @@
+#include "modules/data/serializer.h"
+
+#include "common/exception.h"
+
+#include <math.h>
+#include <memory>
+#include <string.h>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace love;
+
+namespace
+{
+    constexpr uint32_t MAGIC  = 0x5245534C; //< "LSER"
+    constexpr uint8_t VERSION = 1;
+
+    /* magic, version, format, two reserved bytes, then the uncompressed size */
+    constexpr size_t HEADER_SIZE = 16;
+
+    constexpr int MAX_DEPTH = 128;
+
+    /* integers past this can't all be told apart as doubles */
+    constexpr double MAX_EXACT_INTEGER = 9007199254740992.0;
+
+    enum Tag : uint8_t
+    {
+        TAG_NIL,
+        TAG_FALSE,
+        TAG_TRUE,
+        TAG_INTEGER, //< zigzag varint
+        TAG_NUMBER,  //< 8 byte double
+        TAG_STRING,  //< varint length, then the bytes
+        TAG_STRING_REF,
+        TAG_TABLE //< varint array and hash counts, array values, then key/value pairs
+    };
+
+    class Writer
+    {
+      public:
+        Writer() : bytes(nullptr), size(0), capacity(0)
+        {}
+
+        ~Writer()
+        {
+            delete[] this->bytes;
+        }
+
+        void Reserve(size_t extra)
+        {
+            if (this->size + extra <= this->capacity)
+                return;
+
+            size_t capacity = std::max(std::max(this->capacity * 2, this->size + extra),
+                                       (size_t)4096);
+            char* bytes     = nullptr;
+
+            try
+            {
+                bytes = new char[capacity];
+            }
+            catch (std::bad_alloc&)
+            {
+                throw love::Exception("Out of memory.");
+            }
+
+            if (this->size > 0)
+                memcpy(bytes, this->bytes, this->size);
+
+            delete[] this->bytes;
+
+            this->bytes    = bytes;
+            this->capacity = capacity;
+        }
+
+        void WriteByte(uint8_t byte)
+        {
+            this->Reserve(1);
+            this->bytes[this->size++] = (char)byte;
+        }
+
+        void WriteBytes(const void* data, size_t size)
+        {
+            this->Reserve(size);
+
+            memcpy(this->bytes + this->size, data, size);
+            this->size += size;
+        }
+
+        void WriteVarint(uint64_t value)
+        {
+            this->Reserve(10);
+
+            while (value >= 0x80)
+            {
+                this->bytes[this->size++] = (char)(value | 0x80);
+                value >>= 7;
+            }
+
+            this->bytes[this->size++] = (char)value;
+        }
+
+        char* GetBytes() const
+        {
+            return this->bytes;
+        }
+
+        size_t GetSize() const
+        {
+            return this->size;
+        }
+
+        /* hands the buffer over, shrunk if doubling left it mostly empty */
+        char* Release()
+        {
+            char* bytes = this->bytes;
+
+            if ((double)this->capacity / (double)this->size > 1.2)
+            {
+                char* shrunk = new (std::nothrow) char[this->size];
+
+                if (shrunk)
+                {
+                    memcpy(shrunk, bytes, this->size);
+                    delete[] bytes;
+                    bytes = shrunk;
+                }
+            }
+
+            this->bytes    = nullptr;
+            this->capacity = 0;
+
+            return bytes;
+        }
+
+      private:
+        char* bytes;
+        size_t size;
+        size_t capacity;
+    };
+
+    class Encoder
+    {
+      public:
+        Encoder(lua_State* L, Writer& writer) : L(L), writer(writer), depth(0)
+        {}
+
+        void Encode(int index);
+
+      private:
+        void EncodeTable(int index);
+
+        /* how many of 1..n are present before the first gap */
+        size_t CountArray(int index);
+
+        bool IsArrayKey(int index, size_t count);
+
+        lua_State* L;
+        Writer& writer;
+
+        /* Lua interns strings, so the same pointer means the same string */
+        std::unordered_map<const char*, uint32_t> strings;
+        std::unordered_set<const void*> tables;
+
+        int depth;
+    };
+
+    void Encoder::Encode(int index)
+    {
+        switch (lua_type(L, index))
+        {
+            case LUA_TNIL:
+                this->writer.WriteByte(TAG_NIL);
+                break;
+            case LUA_TBOOLEAN:
+                this->writer.WriteByte(lua_toboolean(L, index) ? TAG_TRUE : TAG_FALSE);
+                break;
+            case LUA_TNUMBER:
+            {
+                double number = lua_tonumber(L, index);
+
+                if (number == floor(number) && fabs(number) <= MAX_EXACT_INTEGER)
+                {
+                    int64_t integer = (int64_t)number;
+                    uint64_t zigzag = ((uint64_t)integer << 1) ^ (uint64_t)(integer >> 63);
+
+                    this->writer.WriteByte(TAG_INTEGER);
+                    this->writer.WriteVarint(zigzag);
+                }
+                else
+                {
+                    this->writer.WriteByte(TAG_NUMBER);
+                    this->writer.WriteBytes(&number, sizeof(number));
+                }
+
+                break;
+            }
+            case LUA_TSTRING:
+            {
+                size_t length      = 0;
+                const char* string = lua_tolstring(L, index, &length);
+
+                auto found = this->strings.emplace(string, (uint32_t)this->strings.size());
+
+                if (!found.second)
+                {
+                    this->writer.WriteByte(TAG_STRING_REF);
+                    this->writer.WriteVarint(found.first->second);
+
+                    break;
+                }
+
+                this->writer.WriteByte(TAG_STRING);
+                this->writer.WriteVarint(length);
+                this->writer.WriteBytes(string, length);
+
+                break;
+            }
+            case LUA_TTABLE:
+                this->EncodeTable(index);
+                break;
+            default:
+                throw love::Exception("Can't serialize a value of type %s.",
+                                      luaL_typename(L, index));
+        }
+    }
+
+    size_t Encoder::CountArray(int index)
+    {
+        size_t length = lua_objlen(L, index);
+
+        for (size_t key = 1; key <= length; key++)
+        {
+            lua_rawgeti(L, index, (int)key);
+            bool missing = lua_isnil(L, -1);
+            lua_pop(L, 1);
+
+            if (missing)
+                return key - 1;
+        }
+
+        return length;
+    }
+
+    bool Encoder::IsArrayKey(int index, size_t count)
+    {
+        if (lua_type(L, index) != LUA_TNUMBER)
+            return false;
+
+        double key = lua_tonumber(L, index);
+
+        return key >= 1 && key <= (double)count && key == floor(key);
+    }
+
+    void Encoder::EncodeTable(int index)
+    {
+        if (++this->depth > MAX_DEPTH)
+            throw love::Exception("Tables are nested too deeply to serialize.");
+
+        const void* table = lua_topointer(L, index);
+
+        if (!this->tables.insert(table).second)
+            throw love::Exception("Cycle detected in table.");
+
+        if (!lua_checkstack(L, 3))
+            throw love::Exception("Tables are nested too deeply to serialize.");
+
+        size_t arrayCount = this->CountArray(index);
+        size_t hashCount  = 0;
+
+        lua_pushnil(L);
+
+        while (lua_next(L, index) != 0)
+        {
+            if (!this->IsArrayKey(-2, arrayCount))
+                hashCount++;
+
+            lua_pop(L, 1);
+        }
+
+        this->writer.WriteByte(TAG_TABLE);
+        this->writer.WriteVarint(arrayCount);
+        this->writer.WriteVarint(hashCount);
+
+        for (size_t key = 1; key <= arrayCount; key++)
+        {
+            lua_rawgeti(L, index, (int)key);
+            this->Encode(lua_gettop(L));
+            lua_pop(L, 1);
+        }
+
+        lua_pushnil(L);
+
+        while (lua_next(L, index) != 0)
+        {
+            int top = lua_gettop(L);
+
+            if (!this->IsArrayKey(top - 1, arrayCount))
+            {
+                this->Encode(top - 1);
+                this->Encode(top);
+            }
+
+            lua_pop(L, 1);
+        }
+
+        /* the same table may appear again anywhere that isn't inside itself */
+        this->tables.erase(table);
+        this->depth--;
+    }
+
+    class Decoder
+    {
+      public:
+        Decoder(lua_State* L, const char* data, size_t size) :
+            L(L),
+            current((const uint8_t*)data),
+            end((const uint8_t*)data + size),
+            depth(0)
+        {}
+
+        void Decode();
+
+        bool IsFinished() const
+        {
+            return this->current == this->end;
+        }
+
+      private:
+        void Need(size_t size)
+        {
+            if (size > (size_t)(this->end - this->current))
+                throw love::Exception("Serialized data is truncated.");
+        }
+
+        uint8_t ReadByte()
+        {
+            this->Need(1);
+            return *this->current++;
+        }
+
+        uint64_t ReadVarint()
+        {
+            uint64_t value = 0;
+
+            for (int shift = 0; shift < 64; shift += 7)
+            {
+                uint8_t byte = this->ReadByte();
+                value |= (uint64_t)(byte & 0x7F) << shift;
+
+                if ((byte & 0x80) == 0)
+                    return value;
+            }
+
+            throw love::Exception("Serialized data is corrupt.");
+        }
+
+        void DecodeTable();
+
+        lua_State* L;
+
+        const uint8_t* current;
+        const uint8_t* end;
+
+        /* every string so far, pointing into the data being decoded */
+        std::vector<std::pair<const char*, size_t>> strings;
+
+        int depth;
+    };
+
+    void Decoder::Decode()
+    {
+        switch (this->ReadByte())
+        {
+            case TAG_NIL:
+                lua_pushnil(L);
+                break;
+            case TAG_FALSE:
+                lua_pushboolean(L, 0);
+                break;
+            case TAG_TRUE:
+                lua_pushboolean(L, 1);
+                break;
+            case TAG_INTEGER:
+            {
+                uint64_t value = this->ReadVarint();
+                int64_t number = (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+
+                lua_pushnumber(L, (lua_Number)number);
+
+                break;
+            }
+            case TAG_NUMBER:
+            {
+                double number = 0;
+
+                this->Need(sizeof(number));
+                memcpy(&number, this->current, sizeof(number));
+                this->current += sizeof(number);
+
+                lua_pushnumber(L, number);
+
+                break;
+            }
+            case TAG_STRING:
+            {
+                uint64_t length = this->ReadVarint();
+                this->Need(length);
+
+                const char* string = (const char*)this->current;
+                this->current += length;
+
+                this->strings.emplace_back(string, (size_t)length);
+                lua_pushlstring(L, string, (size_t)length);
+
+                break;
+            }
+            case TAG_STRING_REF:
+            {
+                uint64_t id = this->ReadVarint();
+
+                if (id >= this->strings.size())
+                    throw love::Exception("Serialized data is corrupt.");
+
+                lua_pushlstring(L, this->strings[id].first, this->strings[id].second);
+
+                break;
+            }
+            case TAG_TABLE:
+                this->DecodeTable();
+                break;
+            default:
+                throw love::Exception("Serialized data is corrupt.");
+        }
+    }
+
+    void Decoder::DecodeTable()
+    {
+        if (++this->depth > MAX_DEPTH || !lua_checkstack(L, 3))
+            throw love::Exception("Serialized data is nested too deeply.");
+
+        uint64_t arrayCount = this->ReadVarint();
+        uint64_t hashCount  = this->ReadVarint();
+
+        /* every entry takes at least a byte, which keeps bad counts from allocating */
+        size_t remaining = (size_t)(this->end - this->current);
+
+        if (arrayCount > remaining || hashCount > remaining / 2)
+            throw love::Exception("Serialized data is corrupt.");
+
+        lua_createtable(L, (int)arrayCount, (int)hashCount);
+
+        for (uint64_t key = 1; key <= arrayCount; key++)
+        {
+            this->Decode();
+            lua_rawseti(L, -2, (int)key);
+        }
+
+        for (uint64_t index = 0; index < hashCount; index++)
+        {
+            this->Decode();
+
+            /* nil and NaN can't be keys, and rawset would raise a Lua error for them */
+            bool isNaN = lua_type(L, -1) == LUA_TNUMBER && isnan(lua_tonumber(L, -1));
+
+            if (lua_isnil(L, -1) || isNaN)
+                throw love::Exception("Serialized data is corrupt.");
+
+            this->Decode();
+            lua_rawset(L, -3);
+        }
+
+        this->depth--;
+    }
+} // namespace
+
+namespace love::data
+{
+    ByteData* _Serialize(lua_State* L, int index, Compressor::Format format, int level)
+    {
+        if (index < 0 && index > LUA_REGISTRYINDEX)
+            index += lua_gettop(L) + 1;
+
+        Writer writer;
+        writer.Reserve(HEADER_SIZE);
+        writer.WriteBytes(&MAGIC, sizeof(MAGIC));
+
+        uint8_t header[] = { VERSION, (uint8_t)format, 0, 0 };
+        writer.WriteBytes(header, sizeof(header));
+
+        uint64_t rawSize = 0;
+        writer.WriteBytes(&rawSize, sizeof(rawSize));
+
+        Encoder(L, writer).Encode(index);
+
+        rawSize = writer.GetSize() - HEADER_SIZE;
+        memcpy(writer.GetBytes() + 8, &rawSize, sizeof(rawSize));
+
+        if (format == Compressor::FORMAT_MAX_ENUM)
+        {
+            size_t size = writer.GetSize();
+            char* bytes = writer.Release();
+
+            return new ByteData(bytes, size, true);
+        }
+
+        Compressor* compressor = Compressor::GetCompressor(format);
+
+        if (compressor == nullptr)
+            throw love::Exception("Invalid compression format.");
+
+        size_t compressedSize = 0;
+        std::unique_ptr<char[]> compressed(compressor->Compress(
+            format, writer.GetBytes() + HEADER_SIZE, (size_t)rawSize, level, compressedSize));
+
+        ByteData* data = new ByteData(HEADER_SIZE + compressedSize);
+        char* bytes    = (char*)data->GetData();
+
+        memcpy(bytes, writer.GetBytes(), HEADER_SIZE);
+        memcpy(bytes + HEADER_SIZE, compressed.get(), compressedSize);
+
+        return data;
+    }
+
+    void _Deserialize(lua_State* L, const char* data, size_t size)
+    {
+        uint32_t magic   = 0;
+        uint64_t rawSize = 0;
+
+        if (size < HEADER_SIZE)
+            throw love::Exception("Not serialized data.");
+
+        memcpy(&magic, data, sizeof(magic));
+
+        if (magic != MAGIC)
+            throw love::Exception("Not serialized data.");
+
+        uint8_t version = (uint8_t)data[4];
+        uint8_t format  = (uint8_t)data[5];
+
+        if (version != VERSION)
+            throw love::Exception("Unsupported serialized data version %u.", version);
+
+        memcpy(&rawSize, data + 8, sizeof(rawSize));
+
+        const char* payload = data + HEADER_SIZE;
+        size_t payloadSize  = size - HEADER_SIZE;
+
+        std::unique_ptr<char[]> decompressed;
+
+        if (format != Compressor::FORMAT_MAX_ENUM)
+        {
+            Compressor* compressor = nullptr;
+
+            if (format < Compressor::FORMAT_MAX_ENUM)
+                compressor = Compressor::GetCompressor((Compressor::Format)format);
+
+            if (compressor == nullptr)
+                throw love::Exception("Invalid compression format.");
+
+            size_t decompressedSize = (size_t)rawSize;
+            decompressed.reset(compressor->Decompress((Compressor::Format)format, payload,
+                                                      payloadSize, decompressedSize));
+
+            payload     = decompressed.get();
+            payloadSize = decompressedSize;
+        }
+
+        if (payloadSize != rawSize)
+            throw love::Exception("Serialized data is truncated.");
+
+        Decoder decoder(L, payload, payloadSize);
+        decoder.Decode();
+
+        if (!decoder.IsFinished())
+            throw love::Exception("Serialized data is corrupt.");
+    }
+} // namespace love::data
@@ -1,5 +1,7 @@
 #include "modules/data/wrap_datamodule.h"
 
+#include <algorithm>
+
 using namespace love;
 
 #define instance() (Module::GetInstance<DataModule>(Module::M_DATA))
@@ -39,7 +41,7 @@ int Wrap_DataModule::NewByteData(lua_State* L)
             return luaL_error(L,
                               "Offset and size arguments must fit within the given Data's size.");
 
-        const char* bytes = (const char*)data->GetData() + offset;
+        const char* bytes = (const char*)data->ReadData() + offset;
 
         Luax::CatchException(L, [&]() { byteData = instance()->NewByteData(bytes, (size_t)size); });
     }
@@ -88,7 +90,7 @@ int Wrap_DataModule::Compress(lua_State* L)
         Data* rawData = Wrap_Data::CheckData(L, 3);
 
         rawSize  = rawData->GetSize();
-        rawBytes = (const char*)rawData->GetData();
+        rawBytes = (const char*)rawData->ReadData();
     }
 
     CompressedData* compressedData = nullptr;
@@ -136,7 +138,7 @@ int Wrap_DataModule::Decompress(lua_State* L)
         {
             Data* data = Luax::CheckType<Data>(L, 3);
 
-            compressedBytes = (const char*)data->GetData();
+            compressedBytes = (const char*)data->ReadData();
             compressedSize  = data->GetSize();
         }
         else
@@ -232,7 +234,7 @@ int Wrap_DataModule::Decode(lua_State* L)
     {
         Data* data = Luax::ToType<Data>(L, 3);
 
-        src       = (const char*)data->GetData();
+        src       = (const char*)data->ReadData();
         srcLength = data->GetSize();
     }
     else
@@ -286,7 +288,7 @@ int Wrap_DataModule::Encode(lua_State* L)
     {
         Data* data = Luax::ToType<Data>(L, 3);
 
-        src       = (const char*)data->GetData();
+        src       = (const char*)data->ReadData();
         srcLength = data->GetSize();
     }
     else
@@ -364,7 +366,7 @@ int Wrap_DataModule::Unpack(lua_State* L)
     {
         Data* data = Wrap_Data::CheckData(L, 2);
 
-        dataStr = (const char*)data->GetData();
+        dataStr = (const char*)data->ReadData();
         size    = data->GetSize();
     }
     else
@@ -373,20 +375,89 @@ int Wrap_DataModule::Unpack(lua_State* L)
     return lua53_str_unpack(L, formatStr, dataStr, size, 2, 3);
 }
 
+int Wrap_DataModule::Serialize(lua_State* L)
+{
+    luaL_checkany(L, 1);
+
+    Compressor::Format format = Compressor::FORMAT_MAX_ENUM;
+
+    if (!lua_isnoneornil(L, 2))
+    {
+        const char* formatStr = luaL_checkstring(L, 2);
+
+        if (!Compressor::GetConstant(formatStr, format))
+            return Luax::EnumError(L, "compressed data format", Compressor::GetConstants(format),
+                                   formatStr);
+    }
+
+    int level      = (int)luaL_optinteger(L, 3, -1);
+    ByteData* data = nullptr;
+
+    Luax::CatchException(L, [&]() { data = data::_Serialize(L, 1, format, level); });
+
+    Luax::PushType(L, data);
+    data->Release();
+
+    return 1;
+}
+
+int Wrap_DataModule::Deserialize(lua_State* L)
+{
+    const char* bytes = nullptr;
+    size_t size       = 0;
+
+    if (Luax::IsType(L, 1, Data::type))
+    {
+        Data* data = Wrap_Data::CheckData(L, 1);
+
+        bytes = (const char*)data->ReadData();
+        size  = data->GetSize();
+    }
+    else
+        bytes = luaL_checklstring(L, 1, &size);
+
+    Luax::CatchException(L, [&]() { data::_Deserialize(L, bytes, size); });
+
+    return 1;
+}
+
+/* bytes held by ImageData and SoundData, and how much sharing saved */
+int Wrap_DataModule::GetSharedMemoryStats(lua_State* L)
+{
+    int64_t allocated = CowBuffer::GetAllocatedBytes();
+    int64_t logical   = CowBuffer::GetLogicalBytes();
+
+    lua_createtable(L, 0, 3);
+
+    lua_pushnumber(L, allocated);
+    lua_setfield(L, -2, "allocated");
+
+    lua_pushnumber(L, logical);
+    lua_setfield(L, -2, "logical");
+
+    lua_pushnumber(L, std::max<int64_t>(logical - allocated, 0));
+    lua_setfield(L, -2, "saved");
+
+    return 1;
+}
+
 // clang-format off
 static constexpr luaL_Reg functions[] =
 {
-    { "compress",      Wrap_DataModule::Compress    },
-    { "decode",        Wrap_DataModule::Decode      },
-    { "decompress",    Wrap_DataModule::Decompress  },
-    { "encode",        Wrap_DataModule::Encode      },
-    { "getPackedSize", lua53_str_packsize           },
-    { "hash",          Wrap_DataModule::Hash        },
-    { "newByteData",   Wrap_DataModule::NewByteData },
-    { "newDataView",   Wrap_DataModule::NewDataView },
-    { "pack",          Wrap_DataModule::Pack        },
-    { "unpack",        Wrap_DataModule::Unpack      },
-    { 0,               0                            }
+    { "compress",             Wrap_DataModule::Compress             },
+    { "decode",               Wrap_DataModule::Decode               },
+    { "decompress",           Wrap_DataModule::Decompress           },
+    { "deserialize",          Wrap_DataModule::Deserialize          },
+    { "encode",               Wrap_DataModule::Encode               },
+    { "getPackedSize",        lua53_str_packsize                    },
+    { "getSharedMemoryStats", Wrap_DataModule::GetSharedMemoryStats },
+    { "hash",                 Wrap_DataModule::Hash                 },
+    { "newByteData",          Wrap_DataModule::NewByteData          },
+    { "newDataView",          Wrap_DataModule::NewDataView          },
+    { "pack",                 Wrap_DataModule::Pack                 },
+    { "serialize",            Wrap_DataModule::Serialize            },
+    { "unpack",               Wrap_DataModule::Unpack               },
+    { 0,                      0                                     }
 };
 
 static constexpr lua_CFunction types[] =
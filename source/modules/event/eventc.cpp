@@ -1,50 +1,252 @@
 #include "modules/touch/touch.h"
-#include "modules/window/window.h"
+
+#if not defined(__HOST__)
+    #include "modules/window/window.h"
+#endif
 
 #include "modules/event/eventc.h"
 
+#include "common/strongref.h"
+
+#include "modules/filesystem/filesystem.h"
+#include "modules/timer/timer.h"
+
 using namespace love::driver;
 
-love::common::Event::Event()
+love::common::Event::Event() : logMode(LOG_NONE), frame(0), logStart(0), replayEnded(false)
 {
     this->driver = std::make_unique<love::driver::Hidrv>();
 }
 
+love::common::Event::~Event()
+{
+    /* a recording still going when the game quits is kept if it can be */
+    if (this->logMode == LOG_NONE || Module::GetInstance<Filesystem>(M_FILESYSTEM) == nullptr)
+        return;
+
+    /* nowhere to report a failed write from here, and throwing would abort */
+    try
+    {
+        this->Stop();
+    }
+    catch (const std::exception&)
+    {}
+}
+
 std::unique_ptr<love::driver::Hidrv>& love::common::Event::GetDriver()
 {
     return this->driver;
 }
 
+void love::common::Event::Record(const std::string& filename)
+{
+    this->Stop();
+
+    this->log         = std::make_unique<EventLog>();
+    this->logMode     = LOG_RECORD;
+    this->logFilename = filename;
+
+    this->frame    = 0;
+    this->logStart = Timer::GetTime();
+}
+
+void love::common::Event::Replay(const std::string& filename)
+{
+    auto filesystem = Module::GetInstance<Filesystem>(M_FILESYSTEM);
+    auto timer      = Module::GetInstance<Timer>(M_TIMER);
+
+    if (filesystem == nullptr)
+        throw love::Exception("love.filesystem is needed to replay events.");
+
+    StrongReference<FileData> data(filesystem->Read(filename.c_str()), Acquire::NORETAIN);
+
+    auto log = std::make_unique<EventLog>(data->GetData(), data->GetSize());
+
+    this->Stop();
+
+    this->log         = std::move(log);
+    this->logMode     = LOG_REPLAY;
+    this->logFilename = filename;
+
+    this->frame       = 0;
+    this->replayEnded = false;
+
+    if (timer != nullptr)
+    {
+        timer->SetFixedDelta(this->log->GetDelta());
+        timer->SetProfiling(true);
+    }
+}
+
+void love::common::Event::Stop()
+{
+    if (this->logMode == LOG_NONE)
+        return;
+
+    auto filesystem = Module::GetInstance<Filesystem>(M_FILESYSTEM);
+    auto timer      = Module::GetInstance<Timer>(M_TIMER);
+
+    LogMode mode = this->logMode;
+    auto log     = std::move(this->log);
+
+    this->logMode = LOG_NONE;
+
+    if (mode == LOG_RECORD)
+    {
+        double elapsed = Timer::GetTime() - this->logStart;
+        double delta   = (this->frame > 0) ? elapsed / this->frame : 0.0;
+
+        const auto& bytes = log->Finish(this->frame, delta);
+
+        if (filesystem != nullptr)
+            filesystem->Write(this->logFilename.c_str(), bytes.data(), bytes.size());
+    }
+    else if (timer != nullptr)
+    {
+        std::string csv = timer->GetProfileCSV();
+
+        timer->SetProfiling(false);
+        timer->SetFixedDelta(0);
+
+        if (filesystem != nullptr)
+        {
+            std::string filename = this->logFilename + ".csv";
+            filesystem->Write(filename.c_str(), csv.data(), csv.size());
+        }
+    }
+}
+
+bool love::common::Event::IsRecording() const
+{
+    return this->logMode == LOG_RECORD;
+}
+
+bool love::common::Event::IsReplaying() const
+{
+    return this->logMode == LOG_REPLAY;
+}
+
+/*
+** While replaying, the recording stands in for the driver. The driver is
+** still drained so that only a real request to quit gets through.
+*/
+bool love::common::Event::PollDriver(Hidrv::LOVE_Event& event)
+{
+    if (this->logMode == LOG_REPLAY)
+    {
+        while (this->driver->Poll(&event))
+        {
+            if (event.type == Hidrv::TYPE_QUIT)
+                return true;
+        }
+
+        return this->log->Next(this->frame, event);
+    }
+
+    if (!this->driver->Poll(&event))
+        return false;
+
+    if (this->logMode == LOG_RECORD)
+        this->log->Write(this->frame, event);
+
+    return true;
+}
+
 void love::common::Event::Pump()
 {
     this->ExceptionIfInRenderPass("love.event.pump");
 
     Hidrv::LOVE_Event event;
+    EventRecord record;
 
-    while (this->driver->Poll(&event))
+    this->frame++;
+
+    thread::Lock lock(this->mutex);
+
+    /* only what this pump adds is merged, earlier frames are left alone */
+    size_t first = this->ring.GetCount();
+
+    while (this->PollDriver(event))
     {
-        Message* message = this->Convert(event);
+        if (!this->Convert(event, record))
+            continue;
 
-        if (message)
-        {
-            this->Push(message);
-            message->Release();
-        }
+        if (!this->Coalesce(record, first))
+            this->ring.Append() = record;
+    }
+
+    if (this->logMode == LOG_REPLAY && !this->replayEnded && this->log->IsFinished(this->frame))
+    {
+        this->ring.Append().name = "quit";
+        this->replayEnded        = true;
     }
 }
 
-love::Message* love::common::Event::Convert(const Hidrv::LOVE_Event& event)
+/*
+** A stick or finger that moved several times since the last pump only
+** reports where it ended up. Anything else from the same stick or finger
+** in between, like a press, stops the search so the order is kept.
+*/
+bool love::common::Event::Coalesce(const EventRecord& record, size_t first)
 {
-    Message* message = nullptr;
+    bool isAxis  = record.kind == EventRecord::KIND_GAMEPAD_AXIS;
+    bool isMoved = record.kind == EventRecord::KIND_TOUCH && record.name == NAME_TOUCHMOVED;
 
-    std::vector<Variant> vargs;
-    vargs.reserve(4);
+    if (!isAxis && !isMoved)
+        return false;
 
-    const char* text = nullptr;
+    for (size_t index = this->ring.GetCount(); index-- > first;)
+    {
+        EventRecord& queued = this->ring.At(index);
+
+        if (isAxis)
+        {
+            bool sameStick = (queued.kind == EventRecord::KIND_GAMEPAD_BUTTON ||
+                              queued.kind == EventRecord::KIND_GAMEPAD_AXIS ||
+                              queued.kind == EventRecord::KIND_JOYSTICK) &&
+                             queued.input.stick == record.input.stick;
+
+            if (!sameStick)
+                continue;
+
+            if (queued.kind != EventRecord::KIND_GAMEPAD_AXIS)
+                return false;
 
+            if (queued.input.name != record.input.name)
+                continue;
+
+            queued.input.value = record.input.value;
+            record.input.stick->Release();
+
+            return true;
+        }
+
+        if (queued.kind != EventRecord::KIND_TOUCH || queued.touch.id != record.touch.id)
+            continue;
+
+        if (queued.name != NAME_TOUCHMOVED)
+            return false;
+
+        queued.touch.x = record.touch.x;
+        queued.touch.y = record.touch.y;
+        queued.touch.dx += record.touch.dx;
+        queued.touch.dy += record.touch.dy;
+        queued.touch.pressure = record.touch.pressure;
+
+        return true;
+    }
+
+    return false;
+}
+
+bool love::common::Event::Convert(const Hidrv::LOVE_Event& event, EventRecord& record)
+{
     Touch* touchModule = nullptr;
     Touch::TouchInfo touchinfo;
 
+    record      = EventRecord {};
+    record.kind = EventRecord::KIND_NAME;
+
     switch (event.type)
     {
         case Hidrv::TYPE_TOUCHPRESS:
@@ -63,60 +265,53 @@ love::Message* love::common::Event::Convert(const Hidrv::LOVE_Event& event)
             if (touchModule)
                 touchModule->OnEvent(event.type, touchinfo);
 
-            vargs.emplace_back((void*)(intptr_t)touchinfo.id);
-            vargs.emplace_back((float)touchinfo.x);
-            vargs.emplace_back((float)touchinfo.y);
-            vargs.emplace_back((float)touchinfo.dx);
-            vargs.emplace_back((float)touchinfo.dy);
-            vargs.emplace_back((float)touchinfo.pressure);
+            record.kind = EventRecord::KIND_TOUCH;
+
+            record.touch.id       = touchinfo.id;
+            record.touch.x        = (float)touchinfo.x;
+            record.touch.y        = (float)touchinfo.y;
+            record.touch.dx       = (float)touchinfo.dx;
+            record.touch.dy       = (float)touchinfo.dy;
+            record.touch.pressure = (float)touchinfo.pressure;
 
             if (event.type == Hidrv::TYPE_TOUCHPRESS)
-                text = "touchpressed";
+                record.name = "touchpressed";
             else if (event.type == Hidrv::TYPE_TOUCHRELEASE)
-                text = "touchreleased";
+                record.name = "touchreleased";
             else
-                text = "touchmoved";
-
-            message = new Message(text, vargs);
+                record.name = NAME_TOUCHMOVED;
 
-            break;
+            return true;
         }
         case Hidrv::TYPE_GAMEPADUP:
         case Hidrv::TYPE_GAMEPADDOWN:
         case Hidrv::TYPE_GAMEPADAXIS:
         case Hidrv::TYPE_GAMEPADADDED:
         case Hidrv::TYPE_GAMEPADREMOVED:
-            message = this->ConvertJoystickEvent(event);
-            break;
+            return this->ConvertJoystickEvent(event, record);
         case Hidrv::TYPE_WINDOWEVENT:
-            message = this->ConvertWindowEvent(event);
-            break;
+            return this->ConvertWindowEvent(event, record);
         case Hidrv::TYPE_QUIT:
-            message = new Message("quit");
-            break;
+            record.name = "quit";
+            return true;
         case Hidrv::TYPE_LOWMEMORY:
-            message = new Message("lowmemory");
-            break;
+            record.name = "lowmemory";
+            return true;
         default:
             break;
     }
 
-    return message;
+    return false;
 }
 
-love::Message* love::common::Event::ConvertJoystickEvent(const Hidrv::LOVE_Event& event) const
+/* the record keeps a reference to the stick until it's handed to Lua */
+bool love::common::Event::ConvertJoystickEvent(const Hidrv::LOVE_Event& event,
+                                               EventRecord& record) const
 {
     auto joyModule = Module::GetInstance<Joystick>(M_JOYSTICK);
 
     if (!joyModule)
-        return nullptr;
-
-    Message* message = nullptr;
-
-    std::vector<Variant> vargs;
-    vargs.reserve(4);
-
-    love::Type* joystickType = &Gamepad::type;
+        return false;
 
     love::Gamepad* stick = nullptr;
 
@@ -131,43 +326,42 @@ love::Message* love::common::Event::ConvertJoystickEvent(const Hidrv::LOVE_Event
         case Hidrv::TYPE_GAMEPADDOWN:
         {
             if (!love::Gamepad::GetConstant(event.button.name, padButton))
-                break;
+                return false;
 
             if (!love::Gamepad::GetConstant(padButton, text))
-                break;
+                return false;
 
             stick = joyModule->GetJoystickFromID(event.button.which);
 
             if (!stick)
-                break;
+                return false;
 
-            vargs.emplace_back(joystickType, stick);
-            vargs.emplace_back(text, strlen(text));
+            record.kind = EventRecord::KIND_GAMEPAD_BUTTON;
+            record.name =
+                (event.type == Hidrv::TYPE_GAMEPADDOWN) ? "gamepadpressed" : "gamepadreleased";
 
-            message = new Message((event.type == Hidrv::TYPE_GAMEPADDOWN) ? "gamepadpressed"
-                                                                          : "gamepadreleased",
-                                  vargs);
+            record.input.name = text;
 
             break;
         }
         case Hidrv::TYPE_GAMEPADAXIS:
         {
             if (!love::Gamepad::GetConstant(event.axis.axis, padAxis))
-                break;
+                return false;
 
             if (!love::Gamepad::GetConstant(padAxis, text))
-                break;
+                return false;
 
             stick = joyModule->GetJoystickFromID(event.axis.which);
 
             if (!stick)
-                break;
+                return false;
 
-            vargs.emplace_back(joystickType, stick);
-            vargs.emplace_back(text, strlen(text));
-            vargs.emplace_back(event.axis.value);
+            record.kind = EventRecord::KIND_GAMEPAD_AXIS;
+            record.name = "gamepadaxis";
 
-            message = new Message("gamepadaxis", vargs);
+            record.input.name  = text;
+            record.input.value = event.axis.value;
 
             break;
         }
@@ -176,11 +370,10 @@ love::Message* love::common::Event::ConvertJoystickEvent(const Hidrv::LOVE_Event
             stick = joyModule->AddGamepad(event.padStatus.which);
 
             if (!stick)
-                break;
-
-            vargs.emplace_back(joystickType, stick);
+                return false;
 
-            message = new Message("joystickadded", vargs);
+            record.kind = EventRecord::KIND_JOYSTICK;
+            record.name = "joystickadded";
 
             break;
         }
@@ -189,73 +382,76 @@ love::Message* love::common::Event::ConvertJoystickEvent(const Hidrv::LOVE_Event
             stick = joyModule->GetJoystickFromID(event.padStatus.which);
 
             if (!stick)
-                break;
+                return false;
 
+            /* held on to before the module lets go of it */
+            stick->Retain();
             joyModule->RemoveGamepad(stick);
-            vargs.emplace_back(joystickType, stick);
 
-            message = new Message("joystickremoved", vargs);
+            record.kind        = EventRecord::KIND_JOYSTICK;
+            record.name        = "joystickremoved";
+            record.input.stick = stick;
 
-            break;
+            return true;
         }
         default:
-            break;
+            return false;
     }
 
-    return message;
+    stick->Retain();
+    record.input.stick = stick;
+
+    return true;
 }
 
-love::Message* love::common::Event::ConvertWindowEvent(const Hidrv::LOVE_Event& event)
+bool love::common::Event::ConvertWindowEvent(const Hidrv::LOVE_Event& event, EventRecord& record)
 {
-    Message* message = nullptr;
-
-    std::vector<Variant> vargs;
-    vargs.reserve(4);
-
-    Window* windowModule = nullptr;
-
     switch (event.subType)
     {
         case Hidrv::TYPE_FOCUS_LOST:
         case Hidrv::TYPE_FOCUS_GAINED:
         {
-            vargs.emplace_back(event.type == Hidrv::TYPE_FOCUS_GAINED);
+            record.kind  = EventRecord::KIND_FOCUS;
+            record.name  = "focus";
+            record.focus = (event.subType == Hidrv::TYPE_FOCUS_GAINED);
 
-            message = new Message("focus", vargs);
-
-            break;
+            return true;
         }
         case Hidrv::TYPE_RESIZE:
         {
-            windowModule = Module::GetInstance<Window>(M_WINDOW);
-
             int width  = event.size.width;
             int height = event.size.height;
 
-            vargs.emplace_back((float)width);
-            vargs.emplace_back((float)height);
+            record.kind        = EventRecord::KIND_RESIZE;
+            record.name        = "resize";
+            record.size.width  = width;
+            record.size.height = height;
 
-            message = new Message("resize", vargs);
+#if not defined(__HOST__)
+            Window* windowModule = Module::GetInstance<Window>(M_WINDOW);
 
             if (windowModule)
                 windowModule->OnSizeChanged(width, height);
+#endif
 
-            break;
+            return true;
         }
         default:
             break;
     }
 
-    return message;
+    return false;
 }
 
 /* potentially useless? */
 void love::common::Event::ExceptionIfInRenderPass(const char* name)
 {
+#if not defined(__HOST__)
     auto gfx = Module::GetInstance<Graphics>(M_GRAPHICS);
     if (gfx != nullptr && gfx->IsCanvasActive())
         throw love::Exception("%s cannot be called while a Canvas is active in love.graphics.",
                               name);
+#endif
 }
 
 void love::common::Event::InternalClear()
@@ -264,7 +460,7 @@ void love::common::Event::InternalClear()
 
     Hidrv::LOVE_Event event;
 
-    while (this->driver->Poll(&event))
+    while (this->PollDriver(event))
     {
         /* do nothing */
     }
@@ -276,24 +472,14 @@ void love::common::Event::Clear()
 {
     thread::Lock lock(this->mutex);
 
-    while (!this->queue.empty())
-    {
-        this->queue.front()->Release();
-        this->queue.pop();
-    }
+    this->ring.Clear();
 }
 
-bool love::common::Event::Poll(Message*& message)
+bool love::common::Event::Poll(EventRecord& record)
 {
     thread::Lock lock(this->mutex);
 
-    if (this->queue.empty())
-        return false;
-
-    message = this->queue.front();
-    this->queue.pop();
-
-    return true;
+    return this->ring.Pop(record);
 };
 
 void love::common::Event::Push(Message* message)
@@ -301,17 +487,21 @@ void love::common::Event::Push(Message* message)
     thread::Lock lock(this->mutex);
 
     message->Retain();
-    this->queue.push(message);
+
+    EventRecord& record = this->ring.Append();
+
+    record.kind    = EventRecord::KIND_MESSAGE;
+    record.message = message;
 }
 
-love::Message* love::common::Event::Wait()
+bool love::common::Event::Wait(EventRecord& record)
 {
     this->ExceptionIfInRenderPass("love.event.wait");
 
     Hidrv::LOVE_Event event;
 
-    if (this->driver->Poll(&event) == false)
-        return nullptr;
+    if (this->PollDriver(event) == false)
+        return false;
 
-    return this->Convert(event);
+    return this->Convert(event, record);
 }
@@ -0,0 +1,271 @@
+#include "modules/event/eventlog.h"
+
+#include "common/exception.h"
+
+#include <algorithm>
+#include <string.h>
+
+using namespace love;
+using Hidrv = driver::Hidrv;
+
+EventLog::EventLog() :
+    buffer(HEADER_SIZE, 0),
+    offset(HEADER_SIZE),
+    frames(0),
+    delta(0),
+    lastFrame(0),
+    nextFrame(0),
+    hasNext(false)
+{}
+
+EventLog::EventLog(const void* data, size_t size) :
+    buffer((const uint8_t*)data, (const uint8_t*)data + size),
+    offset(0),
+    frames(0),
+    delta(0),
+    lastFrame(0),
+    nextFrame(0),
+    hasNext(false)
+{
+    uint32_t magic   = 0;
+    uint16_t version = 0;
+    uint16_t padding = 0;
+
+    if (size < HEADER_SIZE)
+        throw love::Exception("Not an event log.");
+
+    this->ReadBytes(&magic, sizeof(magic));
+    this->ReadBytes(&version, sizeof(version));
+    this->ReadBytes(&padding, sizeof(padding));
+
+    if (magic != MAGIC)
+        throw love::Exception("Not an event log.");
+
+    if (version != VERSION)
+        throw love::Exception("Unsupported event log version %u.", version);
+
+    this->ReadBytes(&this->frames, sizeof(this->frames));
+    this->ReadBytes(&this->delta, sizeof(this->delta));
+
+    this->ReadNextFrame();
+}
+
+/* LEB128, so the common case of a small frame gap is one byte */
+void EventLog::WriteVarint(uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        this->buffer.push_back((uint8_t)(value | 0x80));
+        value >>= 7;
+    }
+
+    this->buffer.push_back((uint8_t)value);
+}
+
+void EventLog::WriteBytes(const void* data, size_t size)
+{
+    const uint8_t* bytes = (const uint8_t*)data;
+    this->buffer.insert(this->buffer.end(), bytes, bytes + size);
+}
+
+void EventLog::WriteString(const char* string)
+{
+    size_t length = (string != nullptr) ? std::min<size_t>(strlen(string), 0xFF) : 0;
+
+    this->buffer.push_back((uint8_t)length);
+    this->WriteBytes(string, length);
+}
+
+uint64_t EventLog::ReadVarint()
+{
+    uint64_t value = 0;
+
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        uint8_t byte = 0;
+        this->ReadBytes(&byte, 1);
+
+        value |= (uint64_t)(byte & 0x7F) << shift;
+
+        if ((byte & 0x80) == 0)
+            return value;
+    }
+
+    throw love::Exception("Event log is corrupt.");
+}
+
+void EventLog::ReadBytes(void* data, size_t size)
+{
+    if (size > this->buffer.size() - this->offset)
+        throw love::Exception("Event log is truncated.");
+
+    memcpy(data, this->buffer.data() + this->offset, size);
+    this->offset += size;
+}
+
+const char* EventLog::ReadString()
+{
+    uint8_t length = 0;
+    this->ReadBytes(&length, 1);
+
+    std::string name(length, '\0');
+    this->ReadBytes(name.data(), length);
+
+    return this->names.insert(std::move(name)).first->c_str();
+}
+
+void EventLog::ReadNextFrame()
+{
+    this->hasNext = this->offset < this->buffer.size();
+
+    if (this->hasNext)
+        this->nextFrame = this->lastFrame + (uint32_t)this->ReadVarint();
+}
+
+void EventLog::Write(uint32_t frame, const LOVE_Event& event)
+{
+    this->WriteVarint(frame - this->lastFrame);
+    this->WriteVarint(event.type);
+
+    this->lastFrame = frame;
+
+    switch (event.type)
+    {
+        case Hidrv::TYPE_GAMEPADAXIS:
+        {
+            float value = event.axis.value;
+
+            this->WriteVarint(event.axis.which);
+            this->WriteVarint(event.axis.number);
+            this->WriteString(event.axis.axis);
+            this->WriteBytes(&value, sizeof(value));
+
+            break;
+        }
+        case Hidrv::TYPE_GAMEPADDOWN:
+        case Hidrv::TYPE_GAMEPADUP:
+            this->WriteVarint(event.button.which);
+            this->WriteString(event.button.name);
+            this->WriteVarint((uint32_t)event.button.button);
+            break;
+        case Hidrv::TYPE_GAMEPADADDED:
+        case Hidrv::TYPE_GAMEPADREMOVED:
+            this->WriteVarint(event.padStatus.which);
+            this->WriteVarint(event.padStatus.connected);
+            break;
+        case Hidrv::TYPE_TOUCHPRESS:
+        case Hidrv::TYPE_TOUCHRELEASE:
+        case Hidrv::TYPE_TOUCHMOVED:
+        {
+            /* touch positions are whole pixels, so floats lose nothing */
+            float values[] = { (float)event.touch.x, (float)event.touch.y,
+                               (float)event.touch.dx, (float)event.touch.dy,
+                               (float)event.touch.pressure };
+
+            this->WriteVarint((uint64_t)event.touch.id);
+            this->WriteBytes(values, sizeof(values));
+
+            break;
+        }
+        case Hidrv::TYPE_WINDOWEVENT:
+        {
+            this->WriteVarint(event.subType);
+
+            if (event.subType == Hidrv::TYPE_RESIZE)
+            {
+                this->WriteVarint((uint32_t)event.size.width);
+                this->WriteVarint((uint32_t)event.size.height);
+            }
+
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+bool EventLog::Next(uint32_t frame, LOVE_Event& event)
+{
+    if (!this->hasNext || this->nextFrame > frame)
+        return false;
+
+    event      = LOVE_Event {};
+    event.type = (uint8_t)this->ReadVarint();
+
+    this->lastFrame = this->nextFrame;
+
+    switch (event.type)
+    {
+        case Hidrv::TYPE_GAMEPADAXIS:
+            event.axis.which  = this->ReadVarint();
+            event.axis.number = this->ReadVarint();
+            event.axis.axis   = this->ReadString();
+            this->ReadBytes(&event.axis.value, sizeof(event.axis.value));
+            break;
+        case Hidrv::TYPE_GAMEPADDOWN:
+        case Hidrv::TYPE_GAMEPADUP:
+            event.button.which  = this->ReadVarint();
+            event.button.name   = this->ReadString();
+            event.button.button = (int)(uint32_t)this->ReadVarint();
+            break;
+        case Hidrv::TYPE_GAMEPADADDED:
+        case Hidrv::TYPE_GAMEPADREMOVED:
+            event.padStatus.which     = this->ReadVarint();
+            event.padStatus.connected = this->ReadVarint() != 0;
+            break;
+        case Hidrv::TYPE_TOUCHPRESS:
+        case Hidrv::TYPE_TOUCHRELEASE:
+        case Hidrv::TYPE_TOUCHMOVED:
+        {
+            float values[5];
+
+            event.touch.id = (int64_t)this->ReadVarint();
+            this->ReadBytes(values, sizeof(values));
+
+            event.touch.x        = values[0];
+            event.touch.y        = values[1];
+            event.touch.dx       = values[2];
+            event.touch.dy       = values[3];
+            event.touch.pressure = values[4];
+
+            break;
+        }
+        case Hidrv::TYPE_WINDOWEVENT:
+        {
+            event.subType = (uint8_t)this->ReadVarint();
+
+            if (event.subType == Hidrv::TYPE_RESIZE)
+            {
+                event.size.width  = (int)(uint32_t)this->ReadVarint();
+                event.size.height = (int)(uint32_t)this->ReadVarint();
+            }
+
+            break;
+        }
+        default:
+            break;
+    }
+
+    this->ReadNextFrame();
+
+    return true;
+}
+
+const std::vector<uint8_t>& EventLog::Finish(uint32_t frames, double delta)
+{
+    uint16_t version = VERSION;
+    uint16_t padding = 0;
+
+    this->frames = frames;
+    this->delta  = delta;
+
+    uint8_t* header = this->buffer.data();
+
+    memcpy(header, &MAGIC, sizeof(MAGIC));
+    memcpy(header + 4, &version, sizeof(version));
+    memcpy(header + 6, &padding, sizeof(padding));
+    memcpy(header + 8, &frames, sizeof(frames));
+    memcpy(header + 12, &delta, sizeof(delta));
+
+    return this->buffer;
+}
@@ -0,0 +1,66 @@
+#include "modules/event/eventring.h"
+
+using namespace love;
+
+void EventRecord::Release()
+{
+    if (this->kind == KIND_MESSAGE && this->message != nullptr)
+        this->message->Release();
+    else if ((this->kind == KIND_GAMEPAD_BUTTON || this->kind == KIND_GAMEPAD_AXIS ||
+              this->kind == KIND_JOYSTICK) &&
+             this->input.stick != nullptr)
+    {
+        this->input.stick->Release();
+    }
+
+    this->kind = KIND_NAME;
+}
+
+EventRing::EventRing() : records(INITIAL_CAPACITY), head(0), count(0)
+{}
+
+/* capacity stays a power of two so At can mask instead of divide */
+void EventRing::Grow()
+{
+    std::vector<EventRecord> grown(this->records.size() * 2);
+
+    for (size_t index = 0; index < this->count; index++)
+        grown[index] = this->At(index);
+
+    this->records = std::move(grown);
+    this->head    = 0;
+}
+
+EventRecord& EventRing::Append()
+{
+    if (this->count == this->records.size())
+        this->Grow();
+
+    EventRecord& record = this->At(this->count++);
+
+    record      = EventRecord {};
+    record.kind = EventRecord::KIND_NAME;
+
+    return record;
+}
+
+bool EventRing::Pop(EventRecord& record)
+{
+    if (this->count == 0)
+        return false;
+
+    record = this->At(0);
+
+    this->head = (this->head + 1) & (this->records.size() - 1);
+    this->count--;
+
+    return true;
+}
+
+void EventRing::Clear()
+{
+    EventRecord record;
+
+    while (this->Pop(record))
+        record.Release();
+}
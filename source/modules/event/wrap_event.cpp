@@ -6,21 +6,190 @@ using namespace love;
 
 #define instance() (Module::GetInstance<love::Event>(Module::M_EVENT))
 
-static int Poll_I(lua_State* L)
-{
-    Message* message = nullptr;
+/* registry keys for what pollAll hands back, kept between calls */
+static constexpr const char* POLLALL_EVENTS = "_love_event_pollall";
+static constexpr const char* POLLALL_POOL   = "_love_event_pollall_pool";
+
+/* event tables kept for reuse, more than a busy frame has */
+static constexpr int POLLALL_POOL_SIZE = 64;
 
-    if (instance()->Poll(message))
+/* pushes the name and arguments, then lets go of what @record held */
+static int PushRecord(lua_State* L, EventRecord& record)
+{
+    if (record.kind == EventRecord::KIND_MESSAGE)
     {
-        int args = message->ToLua(L);
-        message->Release();
+        int args = record.message->ToLua(L);
+        record.Release();
 
         return args;
     }
 
+    lua_pushstring(L, record.name);
+
+    int args = 1;
+
+    switch (record.kind)
+    {
+        case EventRecord::KIND_TOUCH:
+            lua_pushlightuserdata(L, (void*)(intptr_t)record.touch.id);
+            lua_pushnumber(L, record.touch.x);
+            lua_pushnumber(L, record.touch.y);
+            lua_pushnumber(L, record.touch.dx);
+            lua_pushnumber(L, record.touch.dy);
+            lua_pushnumber(L, record.touch.pressure);
+            args += 6;
+            break;
+        case EventRecord::KIND_GAMEPAD_AXIS:
+            Luax::PushType(L, record.input.stick);
+            lua_pushstring(L, record.input.name);
+            lua_pushnumber(L, record.input.value);
+            args += 3;
+            break;
+        case EventRecord::KIND_GAMEPAD_BUTTON:
+            Luax::PushType(L, record.input.stick);
+            lua_pushstring(L, record.input.name);
+            args += 2;
+            break;
+        case EventRecord::KIND_JOYSTICK:
+            Luax::PushType(L, record.input.stick);
+            args += 1;
+            break;
+        case EventRecord::KIND_FOCUS:
+            lua_pushboolean(L, record.focus);
+            args += 1;
+            break;
+        case EventRecord::KIND_RESIZE:
+            lua_pushnumber(L, record.size.width);
+            lua_pushnumber(L, record.size.height);
+            args += 2;
+            break;
+        default:
+            break;
+    }
+
+    record.Release();
+
+    return args;
+}
+
+static int Poll_I(lua_State* L)
+{
+    EventRecord record;
+
+    if (instance()->Poll(record))
+        return PushRecord(L, record);
+
     return 0;
 }
 
+static void GetRegistryTable(lua_State* L, const char* key)
+{
+    lua_getfield(L, LUA_REGISTRYINDEX, key);
+
+    if (lua_istable(L, -1))
+        return;
+
+    lua_pop(L, 1);
+
+    lua_newtable(L);
+    lua_pushvalue(L, -1);
+    lua_setfield(L, LUA_REGISTRYINDEX, key);
+}
+
+/* nils @entry's arguments from @first up to its old n, so nothing stale is kept alive */
+static void ClearEntry(lua_State* L, int entry, int first)
+{
+    lua_getfield(L, entry, "n");
+    int stale = (int)lua_tointeger(L, -1);
+    lua_pop(L, 1);
+
+    for (int index = first; index <= stale; index++)
+    {
+        lua_pushnil(L);
+        lua_rawseti(L, entry, index);
+    }
+}
+
+/*
+** Every queued event as { name, args... } with its length in n. The array
+** and the first POLLALL_POOL_SIZE tables in it are reused by the next
+** call, so nothing is allocated once the game has seen its busiest frame.
+** That makes the result only good until pollAll is called again: one
+** called from inside a handler overwrites the events its caller is still
+** walking. Pooled tables past the last event are emptied, so they don't
+** keep a Joystick or a pushed message's arguments alive, and a burst of
+** events past the pool size gets fresh tables that are left to the GC.
+*/
+int Wrap_Event::PollAll(lua_State* L)
+{
+    GetRegistryTable(L, POLLALL_EVENTS);
+    int events = lua_gettop(L);
+
+    GetRegistryTable(L, POLLALL_POOL);
+    int pool = lua_gettop(L);
+
+    int previous = (int)lua_objlen(L, events);
+    int count    = 0;
+
+    EventRecord record;
+
+    while (instance()->Poll(record))
+    {
+        count++;
+
+        if (count <= POLLALL_POOL_SIZE)
+            lua_rawgeti(L, pool, count);
+        else
+            lua_pushnil(L);
+
+        if (lua_isnil(L, -1))
+        {
+            lua_pop(L, 1);
+            lua_createtable(L, 7, 1);
+
+            if (count <= POLLALL_POOL_SIZE)
+            {
+                lua_pushvalue(L, -1);
+                lua_rawseti(L, pool, count);
+            }
+        }
+
+        int entry = lua_gettop(L);
+        int args  = PushRecord(L, record);
+
+        for (int index = args; index > 0; index--)
+            lua_rawseti(L, entry, index);
+
+        ClearEntry(L, entry, args + 1);
+
+        lua_pushinteger(L, args);
+        lua_setfield(L, entry, "n");
+
+        lua_rawseti(L, events, count);
+    }
+
+    for (int index = count + 1; index <= previous; index++)
+    {
+        if (index <= POLLALL_POOL_SIZE)
+        {
+            lua_rawgeti(L, pool, index);
+            ClearEntry(L, lua_gettop(L), 1);
+
+            lua_pushinteger(L, 0);
+            lua_setfield(L, -2, "n");
+            lua_pop(L, 1);
+        }
+
+        lua_pushnil(L);
+        lua_rawseti(L, events, index);
+    }
+
+    lua_pushvalue(L, events);
+    lua_pushinteger(L, count);
+
+    return 2;
+}
+
 int Wrap_Event::Clear(lua_State* L)
 {
     Luax::CatchException(L, [&]() { instance()->Clear(); });
@@ -28,6 +197,20 @@ int Wrap_Event::Clear(lua_State* L)
     return 0;
 }
 
+int Wrap_Event::IsRecording(lua_State* L)
+{
+    lua_pushboolean(L, instance()->IsRecording());
+
+    return 1;
+}
+
+int Wrap_Event::IsReplaying(lua_State* L)
+{
+    lua_pushboolean(L, instance()->IsReplaying());
+
+    return 1;
+}
+
 int Wrap_Event::Pump(lua_State* L)
 {
     Luax::CatchException(L, [&]() { instance()->Pump(); });
@@ -53,17 +236,13 @@ int Wrap_Event::Push(lua_State* L)
 
 int Wrap_Event::Wait(lua_State* L)
 {
-    Message* message = nullptr;
-
-    Luax::CatchException(L, [&]() { message = instance()->Wait(); });
+    EventRecord record;
+    bool found = false;
 
-    if (message)
-    {
-        int args = message->ToLua(L);
-        message->Release();
+    Luax::CatchException(L, [&]() { found = instance()->Wait(record); });
 
-        return args;
-    }
+    if (found)
+        return PushRecord(L, record);
 
     return 0;
 }
@@ -83,16 +262,47 @@ int Wrap_Event::Quit(lua_State* L)
     return 1;
 }
 
+int Wrap_Event::Record(lua_State* L)
+{
+    const char* filename = luaL_checkstring(L, 1);
+
+    Luax::CatchException(L, [&]() { instance()->Record(filename); });
+
+    return 0;
+}
+
+int Wrap_Event::Replay(lua_State* L)
+{
+    const char* filename = luaL_checkstring(L, 1);
+
+    Luax::CatchException(L, [&]() { instance()->Replay(filename); });
+
+    return 0;
+}
+
+int Wrap_Event::Stop(lua_State* L)
+{
+    Luax::CatchException(L, [&]() { instance()->Stop(); });
+
+    return 0;
+}
+
 // clang-format off
 static constexpr luaL_Reg functions[] =
 {
-    { "clear",  Wrap_Event::Clear  },
-    { "poll_i", Poll_I             },
-    { "pump",   Wrap_Event::Pump   },
-    { "push",   Wrap_Event::Push   },
-    { "quit",   Wrap_Event::Quit   },
-    { "wait",   Wrap_Event::Wait   },
-    { 0,        0                  }
+    { "clear",       Wrap_Event::Clear       },
+    { "isRecording", Wrap_Event::IsRecording },
+    { "isReplaying", Wrap_Event::IsReplaying },
+    { "pollAll",     Wrap_Event::PollAll     },
+    { "poll_i",      Poll_I                  },
+    { "pump",        Wrap_Event::Pump        },
+    { "push",        Wrap_Event::Push        },
+    { "quit",        Wrap_Event::Quit        },
+    { "record",      Wrap_Event::Record      },
+    { "replay",      Wrap_Event::Replay      },
+    { "stop",        Wrap_Event::Stop        },
+    { "wait",        Wrap_Event::Wait        },
+    { 0,             0                       }
 };
 
 // clang-format on
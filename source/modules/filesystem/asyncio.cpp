@@ -0,0 +1,257 @@
+#include "modules/filesystem/asyncio.h"
+
+#include "modules/event/event.h"
+#include "modules/filesystem/filesystem.h"
+
+#include "common/exception.h"
+
+using namespace love;
+
+AsyncIO::AsyncIO(Filesystem* filesystem) :
+    filesystem(filesystem),
+    pending(0),
+    stopping(false)
+{
+    this->threadName = "AsyncIO";
+}
+
+AsyncIO::~AsyncIO()
+{
+    this->Stop();
+}
+
+void AsyncIO::Stop()
+{
+    {
+        thread::Lock lock(this->mutex);
+        this->stopping = true;
+    }
+
+    this->condition->Broadcast();
+    this->Wait();
+
+    /* on the thread that stops us, where love.event is torn down, never on ours */
+    this->event.Set(nullptr);
+}
+
+Future* AsyncIO::Queue(Request& request, const void* data, size_t size)
+{
+    Future* future = new Future();
+    request.future.Set(future);
+
+    /* queued from the main thread, the only one love.event comes and goes on */
+    auto eventModule = Module::GetInstance<love::Event>(Module::M_EVENT);
+
+    {
+        thread::Lock lock(this->mutex);
+
+        if (this->event.Get() == nullptr)
+            this->event.Set(eventModule);
+
+        if (data != nullptr)
+        {
+            std::vector<char>& staging = this->front.staging;
+            const char* bytes          = (const char*)data;
+
+            request.offset = staging.size();
+            request.size   = (int64_t)size;
+
+            staging.insert(staging.end(), bytes, bytes + size);
+        }
+
+        this->front.requests.push_back(std::move(request));
+        this->pending++;
+    }
+
+    this->condition->Signal();
+
+    return future;
+}
+
+Future* AsyncIO::Read(const std::string& filename, int64_t size)
+{
+    Request request {};
+
+    request.operation = OPERATION_READ;
+    request.filename  = filename;
+    request.size      = size;
+
+    return this->Queue(request);
+}
+
+Future* AsyncIO::Write(const std::string& filename, const void* data, size_t size)
+{
+    Request request {};
+
+    request.operation = OPERATION_WRITE;
+    request.filename  = filename;
+
+    return this->Queue(request, data, size);
+}
+
+Future* AsyncIO::Append(const std::string& filename, const void* data, size_t size)
+{
+    Request request {};
+
+    request.operation = OPERATION_APPEND;
+    request.filename  = filename;
+
+    return this->Queue(request, data, size);
+}
+
+Future* AsyncIO::Mount(const std::string& archive, const std::string& mountpoint,
+                       bool appendToPath)
+{
+    Request request {};
+
+    request.operation    = OPERATION_MOUNT;
+    request.filename     = archive;
+    request.mountpoint   = mountpoint;
+    request.appendToPath = appendToPath;
+
+    return this->Queue(request);
+}
+
+void AsyncIO::Flush()
+{
+    Request request {};
+    request.operation = OPERATION_BARRIER;
+
+    StrongReference<Future> future(this->Queue(request), Acquire::NORETAIN);
+    future->Wait();
+}
+
+int AsyncIO::GetPendingCount() const
+{
+    return this->pending.load();
+}
+
+void AsyncIO::ThreadFunction()
+{
+    while (true)
+    {
+        {
+            thread::Lock lock(this->mutex);
+
+            while (this->front.requests.empty() && !this->stopping)
+                this->condition->Wait(this->mutex);
+
+            /* stopping only ends the thread once nothing is left to write */
+            if (this->front.requests.empty())
+                break;
+
+            /* both keep their capacity, so a steady game stops allocating here */
+            std::swap(this->front, this->back);
+        }
+
+        size_t count = this->back.requests.size();
+
+        for (size_t index = 0; index < count; index++)
+        {
+            size_t last = index;
+
+            std::vector<Variant> results;
+            std::string error;
+
+            try
+            {
+                results = this->Perform(this->back, index, last);
+            }
+            catch (std::exception& e)
+            {
+                error = e.what();
+            }
+
+            for (; index <= last; index++)
+            {
+                const Request& request = this->back.requests[index];
+
+                /* not pending by the time anyone waiting on it wakes up */
+                this->pending--;
+
+                if (error.empty())
+                    request.future->SetResults(std::vector<Variant>(results));
+                else
+                    request.future->SetError(error);
+
+                this->Complete(request);
+            }
+
+            index = last;
+        }
+
+        this->back.requests.clear();
+        this->back.staging.clear();
+    }
+}
+
+std::vector<Variant> AsyncIO::Perform(const Batch& batch, size_t first, size_t& last)
+{
+    const Request& request = batch.requests[first];
+    const char* filename   = request.filename.c_str();
+    const char* bytes      = batch.staging.data() + request.offset;
+
+    switch (request.operation)
+    {
+        case OPERATION_READ:
+        {
+            StrongReference<FileData> data(this->filesystem->Read(filename, request.size),
+                                           Acquire::NORETAIN);
+
+            return { Variant(&FileData::type, data.Get()) };
+        }
+        case OPERATION_WRITE:
+            this->filesystem->Write(filename, bytes, request.size);
+            return { Variant(true) };
+        case OPERATION_APPEND:
+        {
+            /* queued back to back, so their bytes are back to back in staging too */
+            int64_t size = request.size;
+
+            while (last + 1 < batch.requests.size())
+            {
+                const Request& next = batch.requests[last + 1];
+
+                if (next.operation != OPERATION_APPEND || next.filename != request.filename)
+                    break;
+
+                size += next.size;
+                last++;
+            }
+
+            this->filesystem->Append(filename, bytes, size);
+            return { Variant(true) };
+        }
+        case OPERATION_MOUNT:
+        {
+            bool success = this->filesystem->Mount(filename, request.mountpoint.c_str(),
+                                                   request.appendToPath);
+
+            return { Variant(success) };
+        }
+        case OPERATION_BARRIER:
+        default:
+            return {};
+    }
+}
+
+void AsyncIO::Complete(const Request& request)
+{
+    if (request.operation == OPERATION_BARRIER)
+        return;
+
+    common::Event* eventModule = nullptr;
+
+    {
+        thread::Lock lock(this->mutex);
+        eventModule = this->event.Get();
+    }
+
+    if (!eventModule)
+        return;
+
+    std::vector<Variant> args = { Variant(&Future::type, request.future.Get()) };
+
+    StrongReference<Message> message(new Message("iocomplete", args), Acquire::NORETAIN);
+    eventModule->Push(message);
+}
@@ -0,0 +1,193 @@
+#include "modules/filesystem/entrycache.h"
+
+#include <physfs.h>
+
+#include <sys/stat.h>
+
+#include <algorithm>
+
+using namespace love;
+
+EntryCache& EntryCache::Instance()
+{
+    static EntryCache instance;
+    return instance;
+}
+
+EntryCache::EntryCache() : budget(DEFAULT_BUDGET), bytes(0), hits(0), misses(0)
+{}
+
+/* anything that isn't a directory on disk, a mounted Data included */
+bool EntryCache::IsArchive(const std::string& directory)
+{
+    auto iterator = this->archives.find(directory);
+
+    if (iterator != this->archives.end())
+        return iterator->second;
+
+    struct stat info;
+    bool archive = (stat(directory.c_str(), &info) != 0 || !S_ISDIR(info.st_mode));
+
+    this->archives.emplace(directory, archive);
+
+    return archive;
+}
+
+FileData* EntryCache::Load(const std::string& filename)
+{
+    PHYSFS_Stat stat = {};
+
+    /* sized up front, so an entry too big to keep isn't opened twice */
+    if (PHYSFS_stat(filename.c_str(), &stat) == 0)
+        return nullptr;
+
+    int64_t size = (int64_t)stat.filesize;
+
+    if (size < 0 || size > this->GetBudget() / ENTRY_FRACTION)
+        return nullptr;
+
+    PHYSFS_File* handle = PHYSFS_openRead(filename.c_str());
+
+    if (handle == nullptr)
+        return nullptr;
+
+    FileData* data = new FileData(size, filename);
+    int64_t read   = PHYSFS_readBytes(handle, data->GetData(), (PHYSFS_uint64)size);
+
+    PHYSFS_close(handle);
+
+    if (read != size)
+    {
+        data->Release();
+        return nullptr;
+    }
+
+    return data;
+}
+
+bool EntryCache::Get(const std::string& filename, StrongReference<FileData>& data)
+{
+    if (this->GetBudget() == 0)
+        return false;
+
+    const char* directory = PHYSFS_getRealDir(filename.c_str());
+
+    if (directory == nullptr)
+        return false;
+
+    std::string key = std::string(directory) + ":" + filename;
+
+    {
+        thread::Lock lock(this->mutex);
+
+        if (!this->IsArchive(directory))
+            return false;
+
+        auto iterator = this->lookup.find(key);
+
+        if (iterator != this->lookup.end())
+        {
+            this->entries.splice(this->entries.begin(), this->entries, iterator->second);
+            data = iterator->second->data;
+
+            this->hits++;
+
+            return true;
+        }
+    }
+
+    /* inflated outside the lock, so one big entry doesn't hold up every other read */
+    FileData* loaded = this->Load(filename);
+
+    if (loaded == nullptr)
+        return false;
+
+    data.Set(loaded, Acquire::NORETAIN);
+
+    thread::Lock lock(this->mutex);
+
+    this->misses++;
+
+    /* whoever loaded it first keeps their copy */
+    if (this->lookup.find(key) == this->lookup.end())
+    {
+        this->entries.push_front(Entry { key, directory, data });
+        this->lookup.emplace(key, this->entries.begin());
+
+        this->bytes += (int64_t)loaded->GetSize();
+        this->Evict(this->budget);
+    }
+
+    return true;
+}
+
+void EntryCache::Evict(int64_t budget)
+{
+    while (this->bytes > budget && !this->entries.empty())
+    {
+        Entry& last = this->entries.back();
+
+        this->bytes -= (int64_t)last.data->GetSize();
+        this->lookup.erase(last.key);
+
+        this->entries.pop_back();
+    }
+}
+
+void EntryCache::SetBudget(int64_t bytes)
+{
+    thread::Lock lock(this->mutex);
+
+    this->budget = std::max<int64_t>(bytes, 0);
+    this->Evict(this->budget);
+}
+
+int64_t EntryCache::GetBudget() const
+{
+    thread::Lock lock(this->mutex);
+
+    return this->budget;
+}
+
+EntryCache::Stats EntryCache::GetStats() const
+{
+    thread::Lock lock(this->mutex);
+
+    Stats stats {};
+
+    stats.hits    = this->hits;
+    stats.misses  = this->misses;
+    stats.entries = (int)this->entries.size();
+    stats.bytes   = this->bytes;
+
+    return stats;
+}
+
+void EntryCache::Invalidate(const std::string& archive)
+{
+    thread::Lock lock(this->mutex);
+
+    for (auto iterator = this->entries.begin(); iterator != this->entries.end();)
+    {
+        if (iterator->archive != archive)
+        {
+            ++iterator;
+            continue;
+        }
+
+        this->bytes -= (int64_t)iterator->data->GetSize();
+        this->lookup.erase(iterator->key);
+
+        iterator = this->entries.erase(iterator);
+    }
+
+    this->archives.erase(archive);
+}
+
+void EntryCache::Clear()
+{
+    thread::Lock lock(this->mutex);
+
+    this->Evict(0);
+    this->archives.clear();
+}
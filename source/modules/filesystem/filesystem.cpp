@@ -1,4 +1,5 @@
 #include "modules/filesystem/filesystem.h"
+#include "modules/filesystem/entrycache.h"
 
 #include <physfs.h>
 
@@ -11,6 +12,8 @@
     #include <3ds.h>
 #elif defined(__SWITCH__)
     #include <switch.h>
+#elif defined(__HOST__)
+    #include "host.h"
 #endif
 
 #include <filesystem>
@@ -65,8 +68,10 @@ void Filesystem::Init(const char* arg0)
     if (R_FAILED(result))
         throw love::Exception("Failed to initialize romfs: %x", result);
 
+#if not defined(__HOST__)
     if (!PHYSFS_mount("romfs:/", "internal", true))
         throw love::Exception("Could not mount romFS");
+#endif
 
     /* Symlinks don't exist on 3DS/Switch */
     this->SetSymLinksEnabled(false);
@@ -74,6 +79,10 @@ void Filesystem::Init(const char* arg0)
 
 Filesystem::~Filesystem()
 {
+    /* queued writes land before PhysFS goes away */
+    if (this->asyncIO.Get() != nullptr)
+        this->asyncIO->Stop();
+
     if (PHYSFS_isInit())
         PHYSFS_deinit();
 }
@@ -135,6 +144,9 @@ bool Filesystem::SetupWriteDirectory()
     if (!PHYSFS_isInit())
         return false;
 
+    /* a queued write can get here from the I/O thread */
+    thread::Lock lock(this->stateMutex);
+
     if (this->identity.empty() || this->fullSavePath.empty() || this->relativeSavePath.empty())
         return false;
 
@@ -252,6 +264,8 @@ std::string Filesystem::GetExecutablePath() const
 
 void Filesystem::SetFused(bool fused)
 {
+    thread::Lock lock(this->stateMutex);
+
     if (this->fusedSet)
         return;
 
@@ -300,6 +314,8 @@ bool Filesystem::SetSource(const char* source)
     if (!PHYSFS_isInit())
         return false;
 
+    thread::Lock lock(this->stateMutex);
+
     if (!this->gameSource.empty())
         return false;
 
@@ -335,6 +351,9 @@ bool Filesystem::Mount(const char* archive, const char* mountpoint, bool appendT
     if (!PHYSFS_isInit() || !archive)
         return false;
 
+    /* love.filesystem.mountAsync gets here from the I/O thread */
+    thread::Lock lock(this->stateMutex);
+
     std::string realPath;
     std::string sourceBase = this->GetSourceBaseDirectory();
 
@@ -381,6 +400,9 @@ bool Filesystem::Mount(Data* data, const char* archive, const char* mountpoint,
     if (!PHYSFS_isInit())
         return false;
 
+    /* mountedData is shared with Mount and UnMount from the I/O thread */
+    thread::Lock lock(this->stateMutex);
+
     if (PHYSFS_mountMemory(data->GetData(), data->GetSize(), nullptr, archive, mountpoint,
                            appendToPath) != 0)
     {
@@ -396,11 +418,16 @@ bool Filesystem::UnMount(const char* archive)
     if (!PHYSFS_isInit() || !archive)
         return false;
 
+    /* a path mounted from the I/O thread can be unmounted from this one */
+    thread::Lock lock(this->stateMutex);
+
     auto dataIterator = this->mountedData.find(archive);
 
     if (dataIterator != this->mountedData.end() && PHYSFS_unmount(archive) != 0)
     {
         this->mountedData.erase(dataIterator);
+        EntryCache::Instance().Invalidate(archive);
+
         return true;
     }
 
@@ -440,24 +467,35 @@ bool Filesystem::UnMount(const char* archive)
 
     const char* mountPoint = PHYSFS_getMountPoint(realPath.c_str());
 
-    if (!mountPoint)
+    if (!mountPoint || PHYSFS_unmount(realPath.c_str()) == 0)
         return false;
 
-    return PHYSFS_unmount(realPath.c_str()) != 0;
+    EntryCache::Instance().Invalidate(realPath);
+
+    return true;
 }
 
 bool Filesystem::UnMount(Data* data)
 {
-    for (const auto& dataPair : this->mountedData)
+    std::string archive;
+    bool found = false;
+
     {
-        if (dataPair.second.Get() == data)
+        thread::Lock lock(this->stateMutex);
+
+        for (const auto& dataPair : this->mountedData)
         {
-            std::string archive = dataPair.first;
-            return this->UnMount(archive.c_str());
+            if (dataPair.second.Get() == data)
+            {
+                archive = dataPair.first;
+                found   = true;
+                break;
+            }
         }
     }
 
-    return false;
+    /* copied out, as UnMount takes the lock itself */
+    return found && this->UnMount(archive.c_str());
 }
 
 std::vector<std::string>& Filesystem::GetRequirePath()
@@ -477,6 +515,8 @@ bool Filesystem::SetIdentity(const char* name, bool appendToPath)
     if (!PHYSFS_isInit())
         return false;
 
+    thread::Lock lock(this->stateMutex);
+
     std::string oldSavePath = this->fullSavePath;
 
     // Save directory
@@ -520,8 +560,27 @@ void Filesystem::Write(const char* filename, const void* data, int64_t size)
         throw love::Exception("Data could not be written.");
 }
 
+AsyncIO* Filesystem::GetAsyncIO()
+{
+    if (this->asyncIO.Get() != nullptr)
+        return this->asyncIO;
+
+    AsyncIO* asyncIO = new AsyncIO(this);
+    this->asyncIO.Set(asyncIO, Acquire::NORETAIN);
+
+    if (!asyncIO->Start())
+    {
+        this->asyncIO.Set(nullptr);
+        throw love::Exception("Could not start the file I/O thread.");
+    }
+
+    return asyncIO;
+}
+
 void Filesystem::AllowMountingForPath(const std::string& path)
 {
+    thread::Lock lock(this->stateMutex);
+
     if (std::find(this->allowedMountPaths.begin(), this->allowedMountPaths.end(), path) ==
         this->allowedMountPaths.end())
         this->allowedMountPaths.push_back(path);
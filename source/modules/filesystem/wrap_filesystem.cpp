@@ -1,5 +1,10 @@
 #include "modules/filesystem/wrap_filesystem.h"
 
+#include "modules/filesystem/entrycache.h"
+#include "objects/future/wrap_future.h"
+
+#include "wrap_filesystem_lua.h"
+
 #include <array>
 #include <filesystem>
 
@@ -442,7 +447,7 @@ int Wrap_Filesystem::NewFileData(lua_State* L)
     {
         Data* data = Wrap_Data::CheckData(L, 1);
 
-        ptr    = data->GetData();
+        ptr    = data->ReadData();
         length = data->GetSize();
     }
     else if (lua_isstring(L, 1))
@@ -569,7 +574,7 @@ int Wrap_Filesystem::WriteOrAppend(lua_State* L, File::Mode mode)
     {
         Data* data = Luax::ToType<Data>(L, 2);
 
-        input  = (const char*)data->GetData();
+        input  = (const char*)data->ReadData();
         length = data->GetSize();
     }
     else if (lua_isstring(L, 2))
@@ -601,6 +606,140 @@ int Wrap_Filesystem::Write(lua_State* L)
     return Wrap_Filesystem::WriteOrAppend(L, File::MODE_WRITE);
 }
 
+int Wrap_Filesystem::SetCacheBudget(lua_State* L)
+{
+    lua_Number bytes = luaL_checknumber(L, 1);
+
+    EntryCache::Instance().SetBudget((int64_t)bytes);
+
+    return 0;
+}
+
+int Wrap_Filesystem::GetCacheBudget(lua_State* L)
+{
+    lua_pushnumber(L, (lua_Number)EntryCache::Instance().GetBudget());
+
+    return 1;
+}
+
+int Wrap_Filesystem::GetCacheStats(lua_State* L)
+{
+    EntryCache::Stats stats = EntryCache::Instance().GetStats();
+
+    lua_createtable(L, 0, 4);
+
+    lua_pushnumber(L, (lua_Number)stats.hits);
+    lua_setfield(L, -2, "hits");
+
+    lua_pushnumber(L, (lua_Number)stats.misses);
+    lua_setfield(L, -2, "misses");
+
+    lua_pushinteger(L, stats.entries);
+    lua_setfield(L, -2, "entries");
+
+    lua_pushnumber(L, (lua_Number)stats.bytes);
+    lua_setfield(L, -2, "bytes");
+
+    return 1;
+}
+
+/* Async, see wrap_filesystem.lua for the callbacks */
+
+static int PushHandle(lua_State* L, Future* future)
+{
+    Luax::PushType(L, future);
+    future->Release();
+
+    return 1;
+}
+
+int Wrap_Filesystem::ReadAsync(lua_State* L)
+{
+    const char* filename = luaL_checkstring(L, 1);
+    int64_t length       = (int64_t)luaL_optinteger(L, 2, File::ALL);
+
+    Future* future = nullptr;
+    Luax::CatchException(L, [&]() { future = instance()->GetAsyncIO()->Read(filename, length); });
+
+    return PushHandle(L, future);
+}
+
+int Wrap_Filesystem::WriteOrAppendAsync(lua_State* L, File::Mode mode)
+{
+    const char* filename = luaL_checkstring(L, 1);
+
+    const char* input = nullptr;
+    size_t length     = 0;
+
+    if (Luax::IsType(L, 2, Data::type))
+    {
+        Data* data = Luax::ToType<Data>(L, 2);
+
+        input  = (const char*)data->ReadData();
+        length = data->GetSize();
+    }
+    else if (lua_isstring(L, 2))
+        input = lua_tolstring(L, 2, &length);
+    else
+        return luaL_argerror(L, 2, "string or Data expected");
+
+    length = std::min<size_t>(luaL_optinteger(L, 3, length), length);
+
+    Future* future = nullptr;
+
+    Luax::CatchException(L, [&]() {
+        AsyncIO* asyncIO = instance()->GetAsyncIO();
+
+        if (mode == File::MODE_APPEND)
+            future = asyncIO->Append(filename, input, length);
+        else
+            future = asyncIO->Write(filename, input, length);
+    });
+
+    return PushHandle(L, future);
+}
+
+int Wrap_Filesystem::WriteAsync(lua_State* L)
+{
+    return Wrap_Filesystem::WriteOrAppendAsync(L, File::MODE_WRITE);
+}
+
+int Wrap_Filesystem::AppendAsync(lua_State* L)
+{
+    return Wrap_Filesystem::WriteOrAppendAsync(L, File::MODE_APPEND);
+}
+
+int Wrap_Filesystem::MountAsync(lua_State* L)
+{
+    const char* archive    = luaL_checkstring(L, 1);
+    const char* mountPoint = luaL_checkstring(L, 2);
+    bool append            = Luax::OptBoolean(L, 3, false);
+
+    Future* future = nullptr;
+
+    Luax::CatchException(
+        L, [&]() { future = instance()->GetAsyncIO()->Mount(archive, mountPoint, append); });
+
+    return PushHandle(L, future);
+}
+
+int Wrap_Filesystem::Flush(lua_State* L)
+{
+    Luax::CatchException(L, [&]() { instance()->GetAsyncIO()->Flush(); });
+
+    return 0;
+}
+
+int Wrap_Filesystem::GetPendingCount(lua_State* L)
+{
+    int count = 0;
+    Luax::CatchException(L, [&]() { count = instance()->GetAsyncIO()->GetPendingCount(); });
+
+    lua_pushinteger(L, count);
+
+    return 1;
+}
+
 File* Wrap_Filesystem::GetFile(lua_State* L, int index)
 {
     File* file = nullptr;
@@ -718,12 +857,20 @@ bool Wrap_Filesystem::CanGetData(lua_State* L, int index)
 // clang-format off
 static constexpr luaL_Reg functions[] =
 {
+    { "_appendAsync",           Wrap_Filesystem::AppendAsync            },
+    { "_mountAsync",            Wrap_Filesystem::MountAsync             },
+    { "_readAsync",             Wrap_Filesystem::ReadAsync              },
+    { "_writeAsync",            Wrap_Filesystem::WriteAsync             },
     { "append",                 Wrap_Filesystem::Append                 },
     { "createDirectory",        Wrap_Filesystem::CreateDirectory        },
+    { "flush",                  Wrap_Filesystem::Flush                  },
+    { "getCacheBudget",         Wrap_Filesystem::GetCacheBudget         },
+    { "getCacheStats",          Wrap_Filesystem::GetCacheStats          },
     { "getDirectoryItems",      Wrap_Filesystem::GetDirectoryItems      },
     { "getExecutablePath",      Wrap_Filesystem::GetExecutablePath      },
     { "getIdentity",            Wrap_Filesystem::GetIdentity            },
     { "getInfo",                Wrap_Filesystem::GetInfo                },
+    { "getPendingCount",        Wrap_Filesystem::GetPendingCount        },
     { "getRealDirectory",       Wrap_Filesystem::GetRealDirectory       },
     { "getRequirePath",         Wrap_Filesystem::GetRequirePath         },
     { "getSaveDirectory",       Wrap_Filesystem::GetSaveDirectory       },
@@ -740,6 +887,7 @@ static constexpr luaL_Reg functions[] =
     { "newFileData",            Wrap_Filesystem::NewFileData            },
     { "read",                   Wrap_Filesystem::Read                   },
     { "remove",                 Wrap_Filesystem::Remove                 },
+    { "setCacheBudget",         Wrap_Filesystem::SetCacheBudget         },
     { "setFused",               Wrap_Filesystem::SetFused               },
     { "setIdentity",            Wrap_Filesystem::SetIdentity            },
     { "setRequirePath",         Wrap_Filesystem::SetRequirePath         },
@@ -753,6 +901,7 @@ static constexpr lua_CFunction types[] =
 {
     Wrap_FileData::Register,
     Wrap_File::Register,
+    Wrap_Future::Register,
     nullptr
 };
 // clang-format on
@@ -776,5 +925,12 @@ int Wrap_Filesystem::Register(lua_State* L)
     wrappedModule.type      = &Module::type;
     wrappedModule.types     = types;
 
-    return Luax::RegisterModule(L, wrappedModule);
+    int ret = Luax::RegisterModule(L, wrappedModule);
+
+    luaL_loadbuffer(L, (const char*)wrap_filesystem_lua, wrap_filesystem_lua_size,
+                    "wrap_filesystem.lua");
+    lua_pushvalue(L, -2);
+    lua_call(L, 1, 0);
+
+    return ret;
 }
@@ -210,6 +210,22 @@ bool Graphics::IsCanvasActive() const
     return this->states.back().canvas != nullptr;
 }
 
+Graphics::Stats Graphics::GetStats() const
+{
+    Stats stats {};
+
+    stats.drawCalls      = -1;
+    stats.vertices       = -1;
+    stats.canvasSwitches = -1;
+    stats.shaderSwitches = -1;
+
+    stats.canvases = Canvas::type.GetLiveCount();
+    stats.images   = Image::type.GetLiveCount();
+    stats.fonts    = Font::type.GetLiveCount();
+
+    return stats;
+}
+
 bool Graphics::GetScissor(Rect& scissor) const
 {
     const DisplayState& state = states.back();
@@ -324,9 +340,9 @@ Image* Graphics::NewImage(Texture::TextureType t, PixelFormat format, int width,
     return new Image(t, format, width, height, slices);
 }
 
-Image* Graphics::NewImage(const Image::Slices& data)
+Image* Graphics::NewImage(const Image::Slices& data, const Image::Settings& settings)
 {
-    return new Image(data);
+    return new Image(data, settings);
 }
 
 Quad* Graphics::NewQuad(Quad::Viewport viewport, double sw, double sh)
@@ -339,6 +355,18 @@ Text* Graphics::NewText(Font* font, const std::vector<Font::ColoredString>& text
     return new Text(font, text);
 }
 
+Mesh* Graphics::NewMesh(const std::vector<Mesh::AttribFormat>& format, const void* data,
+                        size_t size, Mesh::DrawMode mode, Mesh::Usage usage)
+{
+    return new Mesh(format, data, size, mode, usage);
+}
+
+Mesh* Graphics::NewMesh(const std::vector<Mesh::AttribFormat>& format, int vertexCount,
+                        Mesh::DrawMode mode, Mesh::Usage usage)
+{
+    return new Mesh(format, vertexCount, mode, usage);
+}
+
 Canvas* Graphics::NewCanvas(const Canvas::Settings& settings)
 {
     return new Canvas(settings);
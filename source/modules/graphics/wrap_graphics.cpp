@@ -4,9 +4,11 @@
 
 #include "modules/image/imagemodule.h"
 
+#include "objects/atlasdata/wrap_atlasdata.h"
 #include "objects/compressedimagedata/compressedimagedata.h"
 #include "objects/compressedimagedata/wrap_compressedimagedata.h"
 
+#include "objects/data/wrap_data.h"
 #include "objects/imagedata/wrap_imagedata.h"
 #include "objects/video/wrap_video.h"
 
@@ -843,12 +845,12 @@ static std::pair<StrongReference<ImageData>, StrongReference<CompressedImageData
     return std::make_pair(imageData, cData);
 }
 
-static int _pushNewImage(lua_State* L, Image::Slices& slices)
+static int _pushNewImage(lua_State* L, Image::Slices& slices, const Image::Settings& settings)
 {
     StrongReference<Image> image;
 
     Luax::CatchException(
-        L, [&]() { image.Set(instance()->NewImage(slices), Acquire::NORETAIN); },
+        L, [&]() { image.Set(instance()->NewImage(slices, settings), Acquire::NORETAIN); },
         [&](bool) { slices.Clear(); });
 
     Luax::PushType(L, image);
@@ -874,6 +876,32 @@ int Wrap_Graphics::NewVideo(lua_State* L)
     return 1;
 }
 
+static Image::Settings checkImageSettings(lua_State* L, int index)
+{
+    Image::Settings settings;
+
+    if (lua_isnoneornil(L, index))
+        return settings;
+
+    luaL_checktype(L, index, LUA_TTABLE);
+
+    settings.mipmaps = Luax::BoolFlag(L, index, "mipmaps", settings.mipmaps);
+
+    lua_getfield(L, index, "mipmapfilter");
+
+    if (!lua_isnoneornil(L, -1))
+    {
+        const char* name = luaL_checkstring(L, -1);
+
+        if (!Image::GetConstant(name, settings.mipmapFilter))
+            Luax::EnumError(L, "mipmap filter", Image::GetConstants(settings.mipmapFilter), name);
+    }
+
+    lua_pop(L, 1);
+
+    return settings;
+}
+
 int Wrap_Graphics::NewImage(lua_State* L)
 {
     Image::Slices slices(Texture::TEXTURE_2D);
@@ -882,12 +910,68 @@ int Wrap_Graphics::NewImage(lua_State* L)
     float dpiScale = 1.0f;
     auto data      = getImageData(L, 1, true, &dpiScale);
 
+    Image::Settings settings = checkImageSettings(L, 2);
+
+    /* compressed data brings its own mipmaps */
     if (data.first.Get())
         slices.Set(0, 0, data.first);
     else
-        slices.Add(data.second, 0, 0, false, false);
+        slices.Add(data.second, 0, 0, false, settings.mipmaps);
+
+    if (data.second.Get())
+        settings.mipmaps = false;
+
+    return _pushNewImage(L, slices, settings);
+}
+
+/*
+** One Image per page. Returns two tables keyed by entry name: the page
+** Image each entry is on and the Quad for it.
+*/
+int Wrap_Graphics::NewAtlas(lua_State* L)
+{
+    AtlasData* atlas         = Wrap_AtlasData::CheckAtlasData(L, 1);
+    Image::Settings settings = checkImageSettings(L, 2);
+
+    std::vector<StrongReference<Image>> pages;
+
+    for (int index = 0; index < atlas->GetPageCount(); index++)
+    {
+        Image::Slices slices(Texture::TEXTURE_2D);
+        slices.Set(0, 0, atlas->GetPage(index));
+
+        StrongReference<Image> page;
 
-    return _pushNewImage(L, slices);
+        Luax::CatchException(
+            L, [&]() { page.Set(instance()->NewImage(slices, settings), Acquire::NORETAIN); });
+
+        pages.push_back(page);
+    }
+
+    const auto& entries = atlas->GetEntries();
+
+    lua_createtable(L, 0, entries.size());
+    lua_createtable(L, 0, entries.size());
+
+    for (const auto& entry : entries)
+    {
+        Image* page = pages[entry.page].Get();
+
+        Quad::Viewport viewport = { (double)entry.x, (double)entry.y, (double)entry.width,
+                                    (double)entry.height };
+
+        Quad* quad = instance()->NewQuad(viewport, page->GetWidth(), page->GetHeight());
+
+        Luax::PushType(L, page);
+        lua_setfield(L, -3, entry.name.c_str());
+
+        Luax::PushType(L, quad);
+        lua_setfield(L, -2, entry.name.c_str());
+
+        quad->Release();
+    }
+
+    return 2;
 }
 
 int Wrap_Graphics::NewText(lua_State* L)
@@ -985,6 +1069,86 @@ int Wrap_Graphics::NewFont(lua_State* L)
     return 1;
 }
 
+int Wrap_Graphics::NewMesh(lua_State* L)
+{
+    std::vector<Mesh::AttribFormat> format;
+
+    int start = 1;
+
+    /* newMesh(vertexformat, vertices | vertexcount | data, ...) */
+    if (lua_istable(L, 1) && (lua_istable(L, 2) || lua_isnumber(L, 2) ||
+                              Luax::IsType(L, 2, Data::type)))
+    {
+        Wrap_Mesh::CheckVertexFormat(L, 1, format);
+        start = 2;
+    }
+    else
+        format = Mesh::GetDefaultVertexFormat();
+
+    Mesh::DrawMode drawMode = Mesh::DRAWMODE_FAN;
+    Mesh::Usage usage       = Mesh::USAGE_DYNAMIC;
+
+    if (!lua_isnoneornil(L, start + 1))
+    {
+        const char* name = luaL_checkstring(L, start + 1);
+
+        if (!Mesh::GetConstant(name, drawMode))
+            return Luax::EnumError(L, "mesh draw mode", Mesh::GetConstants(drawMode), name);
+    }
+
+    if (!lua_isnoneornil(L, start + 2))
+    {
+        const char* name = luaL_checkstring(L, start + 2);
+
+        if (!Mesh::GetConstant(name, usage))
+            return Luax::EnumError(L, "usage hint", Mesh::GetConstants(usage), name);
+    }
+
+    Mesh* mesh = nullptr;
+
+    if (lua_isnumber(L, start))
+    {
+        int vertexCount = (int)luaL_checkinteger(L, start);
+
+        Luax::CatchException(
+            L, [&]() { mesh = instance()->NewMesh(format, vertexCount, drawMode, usage); });
+    }
+    else if (Luax::IsType(L, start, Data::type))
+    {
+        Data* data = Wrap_Data::CheckData(L, start);
+
+        Luax::CatchException(L, [&]() {
+            mesh = instance()->NewMesh(format, data->ReadData(), data->GetSize(), drawMode, usage);
+        });
+    }
+    else
+    {
+        luaL_checktype(L, start, LUA_TTABLE);
+
+        int vertexCount = (int)lua_objlen(L, start);
+        if (vertexCount < 1)
+            return luaL_error(L, "At least one vertex is required.");
+
+        Luax::CatchException(
+            L, [&]() { mesh = instance()->NewMesh(format, vertexCount, drawMode, usage); });
+    }
+
+    /* Lua owns it from here, so it's collected if setVertices errors below */
+    Luax::PushType(L, mesh);
+    mesh->Release();
+
+    if (lua_istable(L, start))
+    {
+        /* let setVertices pack the table, then hand the Mesh back */
+        lua_pushcfunction(L, Wrap_Mesh::SetVertices);
+        lua_pushvalue(L, -2);
+        lua_pushvalue(L, start);
+        lua_call(L, 2, 0);
+    }
+
+    return 1;
+}
+
 int Wrap_Graphics::NewQuad(lua_State* L)
 {
     Quad::Viewport v;
@@ -1408,6 +1572,36 @@ int Wrap_Graphics::GetRendererInfo(lua_State* L)
     return 4;
 }
 
+/* fields the renderer can't count are left out rather than zeroed */
+static void SetStat(lua_State* L, const char* name, int64_t value)
+{
+    if (value < 0)
+        return;
+
+    lua_pushnumber(L, (lua_Number)value);
+    lua_setfield(L, -2, name);
+}
+
+int Wrap_Graphics::GetStats(lua_State* L)
+{
+    Graphics::Stats stats = instance()->GetStats();
+
+    if (lua_istable(L, 1))
+        lua_pushvalue(L, 1);
+    else
+        lua_createtable(L, 0, 7);
+
+    SetStat(L, "drawcalls", stats.drawCalls);
+    SetStat(L, "vertices", stats.vertices);
+    SetStat(L, "canvasswitches", stats.canvasSwitches);
+    SetStat(L, "shaderswitches", stats.shaderSwitches);
+    SetStat(L, "canvases", stats.canvases);
+    SetStat(L, "images", stats.images);
+    SetStat(L, "fonts", stats.fonts);
+
+    return 1;
+}
+
 // clang-format off
 static constexpr luaL_Reg functions[] =
 {
@@ -1434,15 +1628,18 @@ static constexpr luaL_Reg functions[] =
     { "getRendererInfo",       Wrap_Graphics::GetRendererInfo       },
     { "getScissor",            Wrap_Graphics::GetScissor            },
     { "getScreens",            Wrap_Graphics::GetScreens            },
+    { "getStats",              Wrap_Graphics::GetStats              },
     { "getWidth",              Wrap_Graphics::GetWidth              },
     { "intersectScissor",      Wrap_Graphics::IntersectScissor      },
     { "inverseTransformPoint", Wrap_Graphics::InverseTransformPoint },
     { "isActive",              Wrap_Graphics::IsActive              },
     { "isCreated",             Wrap_Graphics::IsCreated             },
     { "line",                  Wrap_Graphics::Line                  },
+    { "newAtlas",              Wrap_Graphics::NewAtlas              },
     { "newCanvas",             Wrap_Graphics::NewCanvas             },
     { "newFont",               Wrap_Graphics::NewFont               },
     { "newImage",              Wrap_Graphics::NewImage              },
+    { "newMesh",               Wrap_Graphics::NewMesh               },
     { "newQuad",               Wrap_Graphics::NewQuad               },
     { "newText",               Wrap_Graphics::NewText               },
     { "_newVideo",             Wrap_Graphics::NewVideo              },
@@ -1493,6 +1690,7 @@ static constexpr lua_CFunction types[] =
     Wrap_Canvas::Register,
     Wrap_Font::Register,
     Wrap_Image::Register,
+    Wrap_Mesh::Register,
     Wrap_Quad::Register,
 #if defined(__SWITCH__)
     Wrap_Shader::Register,
@@ -0,0 +1,112 @@
+#include "modules/image/encodeworker.h"
+
+#include "modules/event/event.h"
+#include "modules/thread/types/lock.h"
+
+#include "objects/filedata/filedata.h"
+#include "objects/imagedata/handlers/pnghandler.h"
+#include "objects/thread/thread.h"
+
+using namespace love;
+
+EncodeWorker::EncodeWorker() : stopping(false)
+{
+    this->threadName = "ImageEncoder";
+}
+
+EncodeWorker::~EncodeWorker()
+{
+    this->Stop();
+}
+
+void EncodeWorker::AddJob(const Job& job)
+{
+    thread::Lock lock(this->mutex);
+    this->jobs.push_back(job);
+
+    this->condition->Broadcast();
+}
+
+void EncodeWorker::Stop()
+{
+    {
+        thread::Lock lock(this->mutex);
+        this->stopping = true;
+        this->condition->Broadcast();
+    }
+
+    this->owner->Wait();
+}
+
+void EncodeWorker::ThreadFunction()
+{
+    while (true)
+    {
+        Job job {};
+
+        {
+            thread::Lock lock(this->mutex);
+
+            while (!this->stopping && this->jobs.empty())
+                this->condition->Wait(this->mutex);
+
+            /* a screenshot taken right before quitting still gets written */
+            if (this->jobs.empty())
+                return;
+
+            job = this->jobs.front();
+            this->jobs.pop_front();
+        }
+
+        this->Encode(job);
+    }
+}
+
+void EncodeWorker::Encode(Job& job)
+{
+    FormatHandler::EncodedImage encoded {};
+
+    FileData* fileData = nullptr;
+    std::string error;
+
+    try
+    {
+        if (job.format != FormatHandler::ENCODED_PNG)
+            throw love::Exception("Only PNG can be encoded asynchronously.");
+
+        encoded = PNGHandler::EncodeBands(job.snapshot, EncodeWorker::MAX_BANDS);
+
+        fileData = new FileData(encoded.size, job.filename);
+        memcpy(fileData->GetData(), encoded.data, encoded.size);
+    }
+    catch (std::exception& e)
+    {
+        /* bad_alloc included, nothing may escape the thread */
+        error = e.what();
+    }
+
+    delete[] encoded.data;
+    delete[] job.snapshot.data;
+
+    auto eventModule = Module::GetInstance<love::Event>(Module::M_EVENT);
+
+    if (eventModule != nullptr)
+    {
+        std::vector<Variant> args = { Variant(&ImageData::type, job.source.Get()),
+                                      Variant((float)job.id) };
+
+        if (error.empty())
+            args.emplace_back(&FileData::type, fileData);
+        else
+        {
+            args.emplace_back();
+            args.emplace_back(error.c_str(), error.length());
+        }
+
+        StrongReference<Message> message(new Message("imageencoded", args), Acquire::NORETAIN);
+        eventModule->Push(message);
+    }
+
+    if (fileData)
+        fileData->Release();
+}
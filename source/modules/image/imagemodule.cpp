@@ -1,4 +1,5 @@
 #include "modules/image/imagemodule.h"
+#include "modules/image/encodeworker.h"
 
 #include "objects/imagedata/handlers/jpghandler.h"
 #include "objects/imagedata/handlers/pnghandler.h"
@@ -11,22 +12,25 @@
 
 using namespace love;
 
-ImageModule::ImageModule()
+ImageModule::ImageModule() : encodeWorker(nullptr)
 {
     this->formatHandlers = {
 #if not defined(__3DS__)
         new PNGHandler(),
         new JPGHandler(),
-        new DDSHandler(),
-        new PKMHandler(),
         new ASTCHandler(),
 #endif
+        /* transcoded to ETC1 on the 3DS */
+        new DDSHandler(),
+        new PKMHandler(),
         new T3XHandler()
     };
 }
 
 ImageModule::~ImageModule()
 {
+    delete this->encodeWorker;
+
     for (auto* handler : this->formatHandlers)
         handler->Release();
 }
@@ -52,6 +56,35 @@ CompressedImageData* ImageModule::NewCompressedData(Data* data)
     return new CompressedImageData(this->formatHandlers, data);
 }
 
+AtlasData* ImageModule::NewAtlasData(const std::vector<AtlasData::Source>& sources,
+                                     const AtlasData::Settings& settings)
+{
+    return new AtlasData(sources, settings);
+}
+
+AtlasData* ImageModule::NewAtlasData(Data* data)
+{
+    return new AtlasData(data);
+}
+
+EncodeWorker* ImageModule::GetEncodeWorker()
+{
+    if (this->encodeWorker == nullptr)
+    {
+        this->encodeWorker = new EncodeWorker();
+
+        if (!this->encodeWorker->Start())
+        {
+            delete this->encodeWorker;
+            this->encodeWorker = nullptr;
+
+            throw love::Exception("Could not start the image encoding thread.");
+        }
+    }
+
+    return this->encodeWorker;
+}
+
 bool ImageModule::IsCompressed(Data* data)
 {
     for (FormatHandler* handler : formatHandlers)
@@ -117,7 +150,9 @@ constexpr auto pixelFormats = BidirectionalMap<>::Create(
     "ASTC10x8",        PIXELFORMAT_ASTC_10x8,
     "ASTC10x10",       PIXELFORMAT_ASTC_10x10,
     "ASTC12x10",       PIXELFORMAT_ASTC_12x10,
-    "ASTC12x12",       PIXELFORMAT_ASTC_12x12
+    "ASTC12x12",       PIXELFORMAT_ASTC_12x12,
+    "tex3ds_etc1",     PIXELFORMAT_TEX3DS_ETC1,
+    "tex3ds_etc1a4",   PIXELFORMAT_TEX3DS_ETC1A4
 );
 // clang-format on
 
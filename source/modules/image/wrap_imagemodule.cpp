@@ -1,6 +1,10 @@
 #include "modules/image/wrap_imagemodule.h"
 #include "modules/image/imagemodule.h"
 
+#include "objects/atlasdata/wrap_atlasdata.h"
+
+#include <string>
+
 using namespace love;
 
 #define instance() (Module::GetInstance<ImageModule>(Module::M_IMAGE))
@@ -111,12 +115,88 @@ int Wrap_ImageModule::IsCompressed(lua_State* L)
     return 1;
 }
 
+/*
+** Either a table of images to pack, or an atlas saved earlier. Images are
+** ImageData or anything with a filename. String keys name the entries,
+** otherwise filenames do. ImageData in the array part is named by index.
+*/
+int Wrap_ImageModule::NewAtlasData(lua_State* L)
+{
+    AtlasData* self = nullptr;
+
+    if (!lua_istable(L, 1))
+    {
+        Data* data = Wrap_Filesystem::GetData(L, 1);
+
+        Luax::CatchException(
+            L, [&]() { self = instance()->NewAtlasData(data); }, [&](bool) { data->Release(); });
+
+        Luax::PushType(L, self);
+        self->Release();
+
+        return 1;
+    }
+
+    AtlasData::Settings settings;
+
+    if (!lua_isnoneornil(L, 2))
+    {
+        luaL_checktype(L, 2, LUA_TTABLE);
+
+        settings.maxSize = Luax::IntFlag(L, 2, "maxsize", settings.maxSize);
+        settings.padding = Luax::IntFlag(L, 2, "padding", settings.padding);
+    }
+
+    std::vector<AtlasData::Source> sources;
+
+    lua_pushnil(L);
+
+    while (lua_next(L, 1))
+    {
+        AtlasData::Source source;
+        int value = lua_gettop(L);
+
+        /* lua_tostring would turn a number key into a string and break lua_next */
+        if (lua_type(L, -2) == LUA_TSTRING)
+            source.name = lua_tostring(L, -2);
+        else if (lua_type(L, -1) == LUA_TSTRING)
+            source.name = lua_tostring(L, -1);
+        else
+            source.name = std::to_string((long long)lua_tointeger(L, -2));
+
+        if (Luax::IsType(L, value, ImageData::type))
+            source.imageData.Set(Wrap_ImageData::CheckImageData(L, value));
+        else
+        {
+            Data* data = Wrap_Filesystem::GetData(L, value);
+
+            Luax::CatchException(
+                L,
+                [&]() {
+                    source.imageData.Set(instance()->NewImageData(data), Acquire::NORETAIN);
+                },
+                [&](bool) { data->Release(); });
+        }
+
+        sources.push_back(source);
+        lua_settop(L, value - 1);
+    }
+
+    Luax::CatchException(L, [&]() { self = instance()->NewAtlasData(sources, settings); });
+
+    Luax::PushType(L, self);
+    self->Release();
+
+    return 1;
+}
+
 // clang-format off
 static constexpr luaL_Reg functions[] =
 {
     { "newImageData",      Wrap_ImageModule::NewImageData      },
     { "newCompressedData", Wrap_ImageModule::NewCompressedData },
     { "isCompressed",      Wrap_ImageModule::IsCompressed      },
+    { "newAtlasData",      Wrap_ImageModule::NewAtlasData      },
     { 0,                   0                                   }
 };
 
@@ -124,6 +204,7 @@ static constexpr lua_CFunction types[] =
 {
     Wrap_ImageData::Register,
     Wrap_CompressedData::Register,
+    Wrap_AtlasData::Register,
     nullptr
 };
 // clang-format on
@@ -7,20 +7,28 @@
 #include "modules/data/wrap_datamodule.h"
 #include "modules/event/wrap_event.h"
 #include "modules/filesystem/wrap_filesystem.h"
-#include "modules/font/wrap_fontmodule.h"
-#include "modules/graphics/wrap_graphics.h"
 #include "modules/image/wrap_imagemodule.h"
 #include "modules/joystick/wrap_joystick.h"
 #include "modules/keyboard/wrap_keyboard.h"
 #include "modules/math/wrap_mathmodule.h"
-#include "modules/physics/wrap_physics.h"
 #include "modules/sound/wrap_sound.h"
 #include "modules/system/wrap_system.h"
 #include "modules/thread/wrap_threadmodule.h"
 #include "modules/timer/wrap_timer.h"
 #include "modules/touch/wrap_touch.h"
-#include "modules/video/wrap_videomodule.h"
-#include "modules/window/wrap_window.h"
+
+#if !defined(LOVE_NO_PHYSICS)
+    #include "modules/physics/wrap_physics.h"
+#endif
+
+#if defined(__HOST__)
+    #include "common/headless.h"
+#else
+    #include "modules/font/wrap_fontmodule.h"
+    #include "modules/graphics/wrap_graphics.h"
+    #include "modules/video/wrap_videomodule.h"
+    #include "modules/window/wrap_window.h"
+#endif
 
 #include "https/common/HTTPSCommon.h"
 #include "luasocket/luasocket.h"
@@ -47,30 +55,41 @@ static constexpr char console_lua[] =
 
 static constexpr luaL_Reg modules[] =
 {
-    { "love.audio",      Wrap_Audio::Register        },
-    { "love.data",       Wrap_DataModule::Register   },
-    { "love.event",      Wrap_Event::Register        },
-    { "love.graphics",   Wrap_Graphics::Register     },
-    { "love.filesystem", Wrap_Filesystem::Register   },
-    { "love.font",       Wrap_FontModule::Register   },
-    { "love.image",      Wrap_ImageModule::Register  },
-    { "love.joystick",   Wrap_Joystick::Register     },
-    { "love.keyboard",   Wrap_Keyboard::Register     },
-    { "love.math",       Wrap_Math::Register         },
-    { "love.physics",    Wrap_Physics::Register      },
-    { "love.sound",      Wrap_Sound::Register        },
-    { "love.system",     Wrap_System::Register       },
-    { "love.thread",     Wrap_ThreadModule::Register },
-    { "love.timer",      Wrap_Timer::Register        },
-    { "love.touch",      Wrap_Touch::Register        },
-    { "love.video",      Wrap_VideoModule::Register  },
-    { "love.window",     Wrap_Window::Register       },
-    { "love.nogame",     love::NoGame                },
-    { "love.arg",        love::LoadArgs              },
-    { "love.callbacks",  love::LoadCallbacks         },
-    { "love.boot",       love::Boot                  },
-    { "love.console",    love::OpenConsole           },
-    { 0,                 0                           }
+    { "love.audio",      Wrap_Audio::Register           },
+    { "love.data",       Wrap_DataModule::Register      },
+    { "love.event",      Wrap_Event::Register           },
+    { "love.filesystem", Wrap_Filesystem::Register      },
+    { "love.image",      Wrap_ImageModule::Register     },
+    { "love.joystick",   Wrap_Joystick::Register        },
+    { "love.keyboard",   Wrap_Keyboard::Register        },
+    { "love.math",       Wrap_Math::Register            },
+#if !defined(LOVE_NO_PHYSICS)
+    { "love.physics",    Wrap_Physics::Register         },
+#else
+    { "love.physics",    love::Headless::OpenNullModule },
+#endif
+    { "love.sound",      Wrap_Sound::Register           },
+    { "love.system",     Wrap_System::Register          },
+    { "love.thread",     Wrap_ThreadModule::Register    },
+    { "love.timer",      Wrap_Timer::Register           },
+    { "love.touch",      Wrap_Touch::Register           },
+#if defined(__HOST__)
+    { "love.font",       love::Headless::OpenNullModule },
+    { "love.graphics",   love::Headless::OpenNullModule },
+    { "love.video",      love::Headless::OpenNullModule },
+    { "love.window",     love::Headless::OpenNullModule },
+#else
+    { "love.font",       Wrap_FontModule::Register      },
+    { "love.graphics",   Wrap_Graphics::Register        },
+    { "love.video",      Wrap_VideoModule::Register     },
+    { "love.window",     Wrap_Window::Register          },
+#endif
+    { "love.nogame",     love::NoGame                   },
+    { "love.arg",        love::LoadArgs                 },
+    { "love.callbacks",  love::LoadCallbacks            },
+    { "love.boot",       love::Boot                     },
+    { "love.console",    love::OpenConsole              },
+    { 0,                 0                              }
 };
 //clang-format on
 
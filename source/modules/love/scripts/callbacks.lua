@@ -159,6 +159,12 @@ function love.createhandlers()
                 return love.threaderror(thread, error)
             end
         end,
+        imageencoded = function (imagedata, id, filedata, error)
+            return imagedata:_encodeFinished(id, filedata, error)
+        end,
+        iocomplete = function (handle)
+            return love.filesystem._ioComplete(handle)
+        end,
         resize = function (width, height)
             if love.resize then
                 return love.resize(width, height)
@@ -260,25 +266,38 @@ function love.run()
         plainScreens = {"top", "bottom"}
     end
 
+    -- only keeps anything while a replay is being profiled
+    local mark = love.timer and love.timer.mark or function() end
+
     return function()
         if love.window and g_windowShown then
             return
         end
 
+        mark("events")
+
         if love.event and love.event.pump then
             love.event.pump()
 
-            for name, a, b, c, d, e, f in love.event.poll() do
+            local events, count = love.event.pollAll()
+
+            for index = 1, count do
+                local event = events[index]
+                local name = event[1]
+
                 if name == "quit" then
                     if not love.quit or not love.quit() then
-                        return a or 0
+                        love.event.stop()
+                        return event[2] or 0
                     end
                 end
 
-                love.handlers[name](a, b, c, d, e, f)
+                love.handlers[name](unpack(event, 2, event.n))
             end
         end
 
+        mark("update")
+
         if love.timer then
             delta = love.timer.step()
         end
@@ -287,6 +306,8 @@ function love.run()
             love.update(delta)
         end
 
+        mark("draw")
+
         if love.graphics and love.graphics.isActive() then
             local screens = is3DHack() and normalScreens or plainScreens
 
@@ -301,11 +322,22 @@ function love.run()
                 end
             end
 
+            mark("present")
             love.graphics.present()
         end
 
+        mark("sleep")
+
         if love.timer then
-            love.timer.sleep(0.001)
+            -- does nothing unless love.timer.setCollectorBudget handed it the collector
+            love.timer.collect()
+
+            -- love.timer.setTargetRate holds frames to a steady rate
+            if love.timer.getTargetRate() > 0 then
+                love.timer.pace()
+            else
+                love.timer.sleep(0.001)
+            end
         end
     end
 end
@@ -29,7 +29,9 @@ DecoderImpl DecoderImplFor()
 
 Sound::~Sound()
 {
+#if !defined(LOVE_NO_MP3)
     MP3Decoder::Quit();
+#endif
 }
 
 Decoder* Sound::NewDecoder(FileData* data, int bufferSize)
@@ -37,11 +39,21 @@ Decoder* Sound::NewDecoder(FileData* data, int bufferSize)
     std::string ext = data->GetExtension();
     std::transform(ext.begin(), ext.end(), ext.begin(), tolower);
 
-    std::vector<DecoderImpl> possibilities = { DecoderImplFor<VorbisDecoder>(),
-                                               DecoderImplFor<MP3Decoder>(),
-                                               DecoderImplFor<WaveDecoder>(),
-                                               DecoderImplFor<FLACDecoder>(),
-                                               DecoderImplFor<ModPlugDecoder>() };
+    std::vector<DecoderImpl> possibilities = {
+#if !defined(LOVE_NO_VORBIS)
+        DecoderImplFor<VorbisDecoder>(),
+#endif
+#if !defined(LOVE_NO_MP3)
+        DecoderImplFor<MP3Decoder>(),
+#endif
+        DecoderImplFor<WaveDecoder>(),
+#if !defined(LOVE_NO_FLAC)
+        DecoderImplFor<FLACDecoder>(),
+#endif
+#if !defined(LOVE_NO_MODPLUG)
+        DecoderImplFor<ModPlugDecoder>(),
+#endif
+    };
 
     for (DecoderImpl& item : possibilities)
     {
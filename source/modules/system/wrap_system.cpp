@@ -2,6 +2,10 @@
 
 #include "modules/system/system.h"
 
+#include "common/cowbuffer.h"
+#include "objects/data/compressed/compresseddata.h"
+#include "objects/filedata/filedata.h"
+
 using namespace love;
 
 #define instance() (Module::GetInstance<System>(Module::M_SYSTEM))
@@ -123,6 +127,63 @@ int Wrap_System::GetSystemTheme(lua_State* L)
     return 1;
 }
 
+static void SetField(lua_State* L, const char* name, int64_t value)
+{
+    lua_pushnumber(L, (lua_Number)value);
+    lua_setfield(L, -2, name);
+}
+
+/* everything is a snapshot; call it once per frame at most to watch for leaks */
+int Wrap_System::GetMemoryStats(lua_State* L)
+{
+    if (lua_istable(L, 1))
+        lua_pushvalue(L, 1);
+    else
+        lua_createtable(L, 0, 4);
+
+    SetField(L, "objects", Object::GetLiveCount());
+
+    lua_newtable(L);
+
+    for (const auto& pair : love::Type::GetTypes())
+    {
+        int count = pair.second->GetLiveCount();
+
+        if (count > 0)
+            SetField(L, pair.first.c_str(), count);
+    }
+
+    lua_setfield(L, -2, "types");
+
+    lua_createtable(L, 0, 4);
+
+    SetField(L, "file", FileData::GetTotalBytes());
+    SetField(L, "compressed", CompressedData::GetTotalBytes());
+    SetField(L, "shared", CowBuffer::GetAllocatedBytes());
+    SetField(L, "sharedlogical", CowBuffer::GetLogicalBytes());
+
+    lua_setfield(L, -2, "data");
+
+    std::vector<System::MemoryPool> pools;
+    instance()->GetMemoryPools(pools);
+
+    lua_createtable(L, 0, (int)pools.size());
+
+    for (const auto& pool : pools)
+    {
+        lua_createtable(L, 0, 2);
+
+        SetField(L, "size", pool.size);
+        SetField(L, "used", pool.used);
+
+        lua_setfield(L, -2, pool.name);
+    }
+
+    lua_setfield(L, -2, "pools");
+
+    return 1;
+}
+
 #if defined(__3DS__)
 int Wrap_System::SetPlayCoins(lua_State* L)
 {
@@ -150,6 +211,7 @@ static constexpr luaL_Reg functions[] =
 {
     { "getColorTheme",       Wrap_System::GetSystemTheme      },
     { "getFriendCode",       Wrap_System::GetFriendCode       },
+    { "getMemoryStats",      Wrap_System::GetMemoryStats      },
     { "getPreferredLocales", Wrap_System::GetPreferredLocales },
     { "getModel",            Wrap_System::GetModel            },
     { "getNetworkInfo",      Wrap_System::GetNetworkInfo      },
@@ -7,6 +7,11 @@ LuaThread* ThreadModule::NewThread(const std::string& name, Data* data)
     return new LuaThread(name, data);
 }
 
+ThreadPool* ThreadModule::NewPool(const std::string& name, Data* data, int workers)
+{
+    return new ThreadPool(name, data, workers);
+}
+
 Channel* ThreadModule::NewChannel()
 {
     return new Channel();
@@ -23,6 +23,7 @@ bool love::thread::Mutex::IsLocked()
 
 void love::thread::Mutex::Unlock()
 {
-    LOVE_mutexUnlock(&this->mutex);
+    /* cleared while it's still ours, or it races the next owner's Lock */
     this->locked = false;
+    LOVE_mutexUnlock(&this->mutex);
 }
@@ -11,46 +11,53 @@
 #include "objects/channel/channel.h"
 #include "objects/channel/wrap_channel.h"
 
+#include "objects/future/wrap_future.h"
+#include "objects/threadpool/wrap_threadpool.h"
+
 #define instance() (Module::GetInstance<ThreadModule>(Module::M_THREAD))
 
 using namespace love;
 
-int Wrap_ThreadModule::NewThread(lua_State* L)
+/* turns the code argument at @index into Data, naming it after its file if it has one */
+static Data* CheckCode(lua_State* L, int index, std::string& name)
 {
-    std::string name = "Thread Code";
-    love::Data* data = nullptr;
-
-    if (lua_isstring(L, 1))
+    if (lua_isstring(L, index))
     {
         size_t length   = 0;
-        const char* str = lua_tolstring(L, 1, &length);
+        const char* str = lua_tolstring(L, index, &length);
 
         if (length >= 1024 || memchr(str, '\n', length))
         {
-            lua_pushvalue(L, 1);
+            lua_pushvalue(L, index);
             lua_pushstring(L, "string");
 
             int indexes[] = { lua_gettop(L) - 1, lua_gettop(L) };
             Luax::ConvertObject(L, indexes, 2, "filesystem", "newFileData");
 
             lua_pop(L, 1);
-            lua_replace(L, 1);
+            lua_replace(L, index);
         }
         else
-            Luax::ConvertObject(L, 1, "filesystem", "newFileData");
+            Luax::ConvertObject(L, index, "filesystem", "newFileData");
     }
-    else if (Luax::IsType(L, 1, File::type))
-        Luax::ConvertObject(L, 1, "filesystem", "newFileData");
+    else if (Luax::IsType(L, index, File::type))
+        Luax::ConvertObject(L, index, "filesystem", "newFileData");
 
-    if (Luax::IsType(L, 1, FileData::type))
+    if (Luax::IsType(L, index, FileData::type))
     {
-        FileData* fileData = Luax::CheckType<FileData>(L, 1);
+        FileData* fileData = Luax::CheckType<FileData>(L, index);
 
         name = std::string("@") + fileData->GetName();
-        data = fileData;
+        return fileData;
     }
-    else
-        data = Luax::CheckType<Data>(L, 1);
+
+    return Luax::CheckType<Data>(L, index);
+}
+
+int Wrap_ThreadModule::NewThread(lua_State* L)
+{
+    std::string name = "Thread Code";
+    love::Data* data = CheckCode(L, 1, name);
 
     LuaThread* thread = instance()->NewThread(name, data);
     Luax::PushType(L, thread);
@@ -60,6 +67,22 @@ int Wrap_ThreadModule::NewThread(lua_State* L)
     return 1;
 }
 
+int Wrap_ThreadModule::NewPool(lua_State* L)
+{
+    int workers = (int)luaL_checkinteger(L, 1);
+
+    std::string name = "Pool Code";
+    love::Data* data = CheckCode(L, 2, name);
+
+    ThreadPool* pool = nullptr;
+    Luax::CatchException(L, [&]() { pool = instance()->NewPool(name, data, workers); });
+
+    Luax::PushType(L, pool);
+    pool->Release();
+
+    return 1;
+}
+
 int Wrap_ThreadModule::NewChannel(lua_State* L)
 {
     Channel* channel = instance()->NewChannel();
@@ -85,6 +108,7 @@ static constexpr luaL_Reg functions[] =
 {
     { "getChannel", Wrap_ThreadModule::GetChannel },
     { "newChannel", Wrap_ThreadModule::NewChannel },
+    { "newPool",    Wrap_ThreadModule::NewPool    },
     { "newThread",  Wrap_ThreadModule::NewThread  },
     { 0,            0                             }
 };
@@ -93,6 +117,8 @@ static constexpr lua_CFunction types[] =
 {
     Wrap_LuaThread::Register,
     Wrap_Channel::Register,
+    Wrap_ThreadPool::Register,
+    Wrap_Future::Register,
     nullptr
 };
 // clang-format on
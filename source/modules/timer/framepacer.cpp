@@ -0,0 +1,148 @@
+#include "modules/timer/framepacer.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace love;
+
+static constexpr double NS_PER_SEC = 1000000000.0;
+
+FramePacer::FramePacer(NowFunction now, SleepFunction sleep) :
+    now(now),
+    sleep(sleep),
+    rate(0),
+    period(0),
+    spinMargin(DEFAULT_SPIN_MARGIN),
+    started(false),
+    deadline(0),
+    lastFrame(0),
+    history {},
+    historyCount(0),
+    historyNext(0),
+    frames(0),
+    dropped(0)
+{}
+
+void FramePacer::SetTargetRate(double rate)
+{
+    this->rate    = (rate > 0) ? rate : 0;
+    this->period  = (rate > 0) ? (int64_t)(NS_PER_SEC / rate + 0.5) : 0;
+    this->started = false;
+}
+
+double FramePacer::GetTargetRate() const
+{
+    return this->rate;
+}
+
+void FramePacer::SetSpinMargin(int64_t nanoseconds)
+{
+    this->spinMargin = std::max<int64_t>(nanoseconds, 0);
+}
+
+int64_t FramePacer::GetSpinMargin() const
+{
+    return this->spinMargin;
+}
+
+void FramePacer::Wait()
+{
+    if (this->period == 0)
+        return;
+
+    uint64_t time = this->now();
+
+    /* the first frame has nothing to be measured against */
+    if (!this->started)
+    {
+        this->started   = true;
+        this->lastFrame = time;
+        this->deadline  = time + this->period;
+
+        return;
+    }
+
+    int64_t late = (int64_t)(time - this->deadline);
+
+    if (late >= this->period)
+    {
+        /* too far behind to catch up, so start counting from now */
+        this->dropped += late / this->period;
+        this->deadline = time;
+    }
+    else if (late < 0)
+    {
+        int64_t coarse = -late - this->spinMargin;
+
+        if (coarse > 0)
+            this->sleep(coarse);
+
+        while ((int64_t)((time = this->now()) - this->deadline) < 0)
+            continue;
+    }
+
+    this->Record(time);
+    this->deadline += this->period;
+}
+
+int64_t FramePacer::GetIdleTime() const
+{
+    if (this->period == 0 || !this->started)
+        return -1;
+
+    int64_t left = (int64_t)(this->deadline - this->now()) - this->spinMargin;
+
+    return std::max<int64_t>(left, 0);
+}
+
+void FramePacer::Record(uint64_t time)
+{
+    this->history[this->historyNext] = (int64_t)(time - this->lastFrame);
+
+    this->historyNext  = (this->historyNext + 1) % HISTORY_SIZE;
+    this->historyCount = std::min(this->historyCount + 1, HISTORY_SIZE);
+
+    this->lastFrame = time;
+    this->frames++;
+}
+
+FramePacer::Stats FramePacer::GetStats() const
+{
+    Stats stats {};
+
+    stats.frames  = this->frames;
+    stats.dropped = this->dropped;
+
+    if (this->historyCount == 0)
+        return stats;
+
+    std::array<int64_t, HISTORY_SIZE> sorted = this->history;
+
+    auto begin = sorted.begin();
+    auto end   = begin + this->historyCount;
+
+    /* nearest rank, so p99 of a few frames is the slowest one */
+    auto percentile = [&](double fraction) {
+        size_t rank = (size_t)std::ceil(fraction * this->historyCount);
+        auto nth    = begin + (std::max<size_t>(rank, 1) - 1);
+
+        std::nth_element(begin, nth, end);
+
+        return *nth / NS_PER_SEC;
+    };
+
+    stats.p50 = percentile(0.50);
+    stats.p95 = percentile(0.95);
+    stats.p99 = percentile(0.99);
+
+    return stats;
+}
+
+void FramePacer::Reset()
+{
+    this->started      = false;
+    this->historyCount = 0;
+    this->historyNext  = 0;
+    this->frames       = 0;
+    this->dropped      = 0;
+}
@@ -0,0 +1,130 @@
+#include "modules/timer/gcscheduler.h"
+
+#include <algorithm>
+
+using namespace love;
+
+static constexpr double NS_PER_SEC = 1000000000.0;
+
+GCScheduler::GCScheduler(NowFunction now) :
+    now(now),
+    budget(0),
+    savedPause(PAUSE),
+    savedStepMul(0),
+    cycling(false),
+    threshold(0),
+    lastCount(0),
+    stats {}
+{}
+
+void GCScheduler::SetBudget(lua_State* L, int64_t nanoseconds)
+{
+    bool enable = (nanoseconds > 0);
+
+    if (enable != (this->budget > 0))
+    {
+#if LUA_VERSION_NUM >= 504
+        /* young objects die in minor collections, which are cheap enough to leave running */
+        lua_gc(L, enable ? LUA_GCGEN : LUA_GCINC, 0, 0);
+#else
+        if (enable)
+        {
+            this->savedPause = lua_gc(L, LUA_GCSETPAUSE, BACKSTOP_PAUSE);
+
+            /* there's no getter, so it's read by setting it and put straight back */
+            this->savedStepMul = lua_gc(L, LUA_GCSETSTEPMUL, BACKSTOP_STEPMUL);
+            lua_gc(L, LUA_GCSETSTEPMUL, this->savedStepMul);
+        }
+        else
+        {
+            lua_gc(L, LUA_GCSETPAUSE, this->savedPause);
+            lua_gc(L, LUA_GCSETSTEPMUL, this->savedStepMul);
+        }
+#endif
+        this->cycling   = false;
+        this->lastCount = lua_gc(L, LUA_GCCOUNT, 0);
+        this->threshold = this->lastCount;
+        this->stats     = Stats {};
+    }
+
+    this->budget = std::max<int64_t>(nanoseconds, 0);
+}
+
+int64_t GCScheduler::GetBudget() const
+{
+    return this->budget;
+}
+
+void GCScheduler::Step(lua_State* L, int kilobytes)
+{
+    if (lua_gc(L, LUA_GCSTEP, kilobytes) == 0)
+        return;
+
+    this->cycling   = false;
+    this->threshold = lua_gc(L, LUA_GCCOUNT, 0) * PAUSE / 100;
+    this->stats.cycles++;
+}
+
+void GCScheduler::Collect(lua_State* L, int64_t available)
+{
+    if (this->budget == 0)
+        return;
+
+    uint64_t start = this->now();
+
+#if LUA_VERSION_NUM >= 504
+    /* a generational step is a whole minor collection, one a frame will do */
+    this->Step(L, 0);
+#else
+    lua_gc(L, LUA_GCSETSTEPMUL, this->savedStepMul);
+
+    int count = lua_gc(L, LUA_GCCOUNT, 0);
+
+    if (!this->cycling && count >= this->threshold)
+        this->cycling = true;
+
+    /* past where Lua's own collector would have stepped in, so the cycle is finished now */
+    if (this->cycling && count >= (int64_t)this->threshold * BACKSTOP_PAUSE / PAUSE)
+    {
+        while (this->cycling)
+            this->Step(L, SLICE_SIZE * 64);
+    }
+
+    /* a step of n kilobytes is what allocating them would have set off */
+    int debt = std::max(count - this->lastCount, 0);
+
+    if (this->cycling && debt > 0)
+        this->Step(L, debt);
+
+    int64_t limit = std::min(available, this->budget);
+    int64_t slice = 0;
+
+    /* stop once the next slice, as long as the last, would run over */
+    while (this->cycling && (int64_t)(this->now() - start) + slice <= limit)
+    {
+        uint64_t sliceStart = this->now();
+        this->Step(L, SLICE_SIZE);
+
+        slice = (int64_t)(this->now() - sliceStart);
+    }
+
+    /*
+    ** A step in the middle of a cycle leaves Lua stepping again after the
+    ** next kilobyte, so until the next Collect it does a fraction of the
+    ** work. The step that ends a cycle sets Lua's threshold from
+    ** BACKSTOP_PAUSE by itself.
+    */
+    if (this->cycling)
+        lua_gc(L, LUA_GCSETSTEPMUL, BACKSTOP_STEPMUL);
+
+    this->lastCount = lua_gc(L, LUA_GCCOUNT, 0);
+#endif
+
+    this->stats.last = (this->now() - start) / NS_PER_SEC;
+    this->stats.max  = std::max(this->stats.max, this->stats.last);
+}
+
+GCScheduler::Stats GCScheduler::GetStats() const
+{
+    return this->stats;
+}
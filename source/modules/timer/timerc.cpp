@@ -1,5 +1,9 @@
 #include "modules/timer/timerc.h"
 
+#include "common/bidirectionalmap.h"
+
+#include <stdio.h>
+
 using namespace love::common;
 
 // Löve2D Functions
@@ -8,10 +12,20 @@ using namespace love::common;
     #include <3ds.h>
 #elif defined(__SWITCH__)
     #include <switch.h>
+#elif defined(__HOST__)
+    #include "host.h"
 #endif
 
 uint64_t Timer::reference = 0;
 
+static constexpr double NS_PER_SEC = 1000000000.0;
+
+static void sleepNs(int64_t nanoseconds)
+{
+    if (nanoseconds > 0)
+        svcSleepThread(nanoseconds);
+}
+
 Timer::Timer() :
     currentTime(0),
     prevFPSUpdate(0),
@@ -19,9 +33,21 @@ Timer::Timer() :
     averageDelta(0),
     fpsUpdateFrequency(1),
     frames(0),
-    dt(0)
+    dt(0),
+    fixedDelta(0),
+    profiling(false),
+    phase(PHASE_MAX_ENUM),
+    phaseStart(0),
+    frameTimes {},
+    pacer(Timer::GetTimeNs, sleepNs),
+    collector(Timer::GetTimeNs)
 {}
 
+double Timer::GetTime()
+{
+    return Timer::GetTimeNs() / NS_PER_SEC;
+}
+
 double Timer::GetAverageDelta()
 {
     return this->averageDelta;
@@ -41,15 +67,10 @@ int Timer::GetFPS()
 ** According to LÖVE docs:
 ** "sleep in seconds"
 */
-void Timer::Sleep(float seconds)
+void Timer::Sleep(double seconds)
 {
-    if (seconds >= 0)
-    {
-        u32 milliseconds = seconds * 1000.0f;
-        u64 nanoSeconds  = milliseconds * Timer::SLEEP_DURATION;
-
-        svcSleepThread(nanoSeconds);
-    }
+    if (seconds > 0)
+        sleepNs((int64_t)(seconds * NS_PER_SEC));
 }
 
 double Timer::Step()
@@ -74,5 +95,156 @@ double Timer::Step()
         this->frames        = 0;
     }
 
+    /* fps still reports the real rate, only the game sees the fixed step */
+    if (this->fixedDelta > 0)
+        this->dt = this->fixedDelta;
+
     return this->dt;
 }
+
+void Timer::SetFixedDelta(double delta)
+{
+    this->fixedDelta = (delta > 0) ? delta : 0;
+}
+
+double Timer::GetFixedDelta() const
+{
+    return this->fixedDelta;
+}
+
+void Timer::Mark(Phase phase)
+{
+    if (!this->profiling)
+        return;
+
+    double now = Timer::GetTime();
+
+    if (this->phase != PHASE_MAX_ENUM)
+        this->frameTimes[this->phase] += (now - this->phaseStart) * 1000.0;
+
+    if (phase == PHASE_EVENTS && this->phase != PHASE_MAX_ENUM)
+    {
+        this->profile.push_back(this->frameTimes);
+        this->frameTimes.fill(0.0f);
+    }
+
+    this->phase      = phase;
+    this->phaseStart = now;
+}
+
+void Timer::SetProfiling(bool enable)
+{
+    this->profiling = enable;
+    this->phase     = PHASE_MAX_ENUM;
+
+    this->frameTimes.fill(0.0f);
+
+    if (enable)
+        this->profile.clear();
+}
+
+bool Timer::IsProfiling() const
+{
+    return this->profiling;
+}
+
+std::string Timer::GetProfileCSV() const
+{
+    std::string csv = "frame";
+
+    for (int index = 0; index < PHASE_MAX_ENUM; index++)
+    {
+        const char* name = nullptr;
+        Timer::GetConstant((Phase)index, name);
+
+        csv += ",";
+        csv += name;
+    }
+
+    csv += "\n";
+
+    char value[32];
+
+    for (size_t frame = 0; frame < this->profile.size(); frame++)
+    {
+        csv += std::to_string(frame + 1);
+
+        for (float time : this->profile[frame])
+        {
+            snprintf(value, sizeof(value), ",%.3f", time);
+            csv += value;
+        }
+
+        csv += "\n";
+    }
+
+    return csv;
+}
+
+void Timer::SetTargetRate(double rate)
+{
+    this->pacer.SetTargetRate(rate);
+}
+
+double Timer::GetTargetRate() const
+{
+    return this->pacer.GetTargetRate();
+}
+
+void Timer::Pace()
+{
+    this->pacer.Wait();
+}
+
+love::FramePacer::Stats Timer::GetFrameStats() const
+{
+    return this->pacer.GetStats();
+}
+
+void Timer::SetCollectorBudget(lua_State* L, double seconds)
+{
+    this->collector.SetBudget(L, (int64_t)(seconds * NS_PER_SEC));
+}
+
+double Timer::GetCollectorBudget() const
+{
+    return this->collector.GetBudget() / NS_PER_SEC;
+}
+
+void Timer::Collect(lua_State* L)
+{
+    int64_t idle = this->pacer.GetIdleTime();
+
+    /* unpaced, the budget is all there is to go on */
+    this->collector.Collect(L, (idle < 0) ? this->collector.GetBudget() : idle);
+}
+
+love::GCScheduler::Stats Timer::GetCollectorStats() const
+{
+    return this->collector.GetStats();
+}
+
+// clang-format off
+constexpr auto phases = BidirectionalMap<>::Create(
+    "events",  Timer::Phase::PHASE_EVENTS,
+    "update",  Timer::Phase::PHASE_UPDATE,
+    "draw",    Timer::Phase::PHASE_DRAW,
+    "present", Timer::Phase::PHASE_PRESENT,
+    "sleep",   Timer::Phase::PHASE_SLEEP
+);
+// clang-format on
+
+bool Timer::GetConstant(const char* in, Phase& out)
+{
+    return phases.Find(in, out);
+}
+
+bool Timer::GetConstant(Phase in, const char*& out)
+{
+    return phases.ReverseFind(in, out);
+}
+
+std::vector<const char*> Timer::GetConstants(Phase)
+{
+    return phases.GetNames();
+}
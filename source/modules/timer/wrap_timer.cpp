@@ -4,6 +4,13 @@ using namespace love;
 
 #define instance() (Module::GetInstance<Timer>(Module::M_TIMER))
 
+int Wrap_Timer::Collect(lua_State* L)
+{
+    instance()->Collect(L);
+
+    return 0;
+}
+
 int Wrap_Timer::GetAverageDelta(lua_State* L)
 {
     double average = instance()->GetAverageDelta();
@@ -40,9 +47,111 @@ int Wrap_Timer::GetTime(lua_State* L)
     return 1;
 }
 
+int Wrap_Timer::GetCollectorBudget(lua_State* L)
+{
+    lua_pushnumber(L, instance()->GetCollectorBudget());
+
+    return 1;
+}
+
+int Wrap_Timer::GetFixedDelta(lua_State* L)
+{
+    lua_pushnumber(L, instance()->GetFixedDelta());
+
+    return 1;
+}
+
+int Wrap_Timer::GetFrameStats(lua_State* L)
+{
+    FramePacer::Stats stats      = instance()->GetFrameStats();
+    GCScheduler::Stats collector = instance()->GetCollectorStats();
+
+    lua_createtable(L, 0, 8);
+
+    lua_pushnumber(L, stats.p50);
+    lua_setfield(L, -2, "p50");
+
+    lua_pushnumber(L, stats.p95);
+    lua_setfield(L, -2, "p95");
+
+    lua_pushnumber(L, stats.p99);
+    lua_setfield(L, -2, "p99");
+
+    lua_pushnumber(L, (lua_Number)stats.frames);
+    lua_setfield(L, -2, "frames");
+
+    lua_pushnumber(L, (lua_Number)stats.dropped);
+    lua_setfield(L, -2, "dropped");
+
+    lua_pushnumber(L, collector.last);
+    lua_setfield(L, -2, "gc");
+
+    lua_pushnumber(L, collector.max);
+    lua_setfield(L, -2, "gcmax");
+
+    lua_pushnumber(L, (lua_Number)collector.cycles);
+    lua_setfield(L, -2, "gccycles");
+
+    return 1;
+}
+
+int Wrap_Timer::GetTargetRate(lua_State* L)
+{
+    lua_pushnumber(L, instance()->GetTargetRate());
+
+    return 1;
+}
+
+int Wrap_Timer::Mark(lua_State* L)
+{
+    const char* name = luaL_checkstring(L, 1);
+    Timer::Phase phase;
+
+    if (!Timer::GetConstant(name, phase))
+        return Luax::EnumError(L, "frame phase", Timer::GetConstants(phase), name);
+
+    instance()->Mark(phase);
+
+    return 0;
+}
+
+int Wrap_Timer::Pace(lua_State* L)
+{
+    instance()->Pace();
+
+    return 0;
+}
+
+int Wrap_Timer::SetCollectorBudget(lua_State* L)
+{
+    double seconds = luaL_optnumber(L, 1, 0);
+
+    instance()->SetCollectorBudget(L, seconds);
+
+    return 0;
+}
+
+int Wrap_Timer::SetFixedDelta(lua_State* L)
+{
+    double delta = luaL_optnumber(L, 1, 0);
+
+    instance()->SetFixedDelta(delta);
+
+    return 0;
+}
+
+int Wrap_Timer::SetTargetRate(lua_State* L)
+{
+    double rate = luaL_optnumber(L, 1, 0);
+
+    instance()->SetTargetRate(rate);
+
+    return 0;
+}
+
 int Wrap_Timer::Sleep(lua_State* L)
 {
-    float seconds = luaL_checknumber(L, 1);
+    double seconds = luaL_checknumber(L, 1);
 
     instance()->Sleep(seconds);
 
@@ -61,13 +170,23 @@ int Wrap_Timer::Step(lua_State* L)
 // clang-format off
 static constexpr luaL_Reg functions[] =
 {
-    { "getAverageDelta", Wrap_Timer::GetAverageDelta },
-    { "getDelta",        Wrap_Timer::GetDelta        },
-    { "getFPS",          Wrap_Timer::GetFPS          },
-    { "getTime",         Wrap_Timer::GetTime         },
-    { "sleep",           Wrap_Timer::Sleep           },
-    { "step",            Wrap_Timer::Step            },
-    { 0,                 0                           }
+    { "collect",            Wrap_Timer::Collect            },
+    { "getAverageDelta",    Wrap_Timer::GetAverageDelta    },
+    { "getCollectorBudget", Wrap_Timer::GetCollectorBudget },
+    { "getDelta",           Wrap_Timer::GetDelta           },
+    { "getFPS",             Wrap_Timer::GetFPS             },
+    { "getFixedDelta",      Wrap_Timer::GetFixedDelta      },
+    { "getFrameStats",      Wrap_Timer::GetFrameStats      },
+    { "getTargetRate",      Wrap_Timer::GetTargetRate      },
+    { "getTime",            Wrap_Timer::GetTime            },
+    { "mark",               Wrap_Timer::Mark               },
+    { "pace",               Wrap_Timer::Pace               },
+    { "setCollectorBudget", Wrap_Timer::SetCollectorBudget },
+    { "setFixedDelta",      Wrap_Timer::SetFixedDelta      },
+    { "setTargetRate",      Wrap_Timer::SetTargetRate      },
+    { "sleep",              Wrap_Timer::Sleep              },
+    { "step",               Wrap_Timer::Step               },
+    { 0,                    0                              }
 };
 // clang-format on
 
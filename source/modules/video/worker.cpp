@@ -3,8 +3,7 @@
 #include "modules/thread/types/lock.h"
 #include "objects/thread/thread.h"
 
-#include "common/delay.h"
-#include "modules/timer/timer.h"
+#include <algorithm>
 
 using namespace love;
 
@@ -20,12 +19,20 @@ Worker::~Worker()
 
 void Worker::AddStream(TheoraStream* stream)
 {
+    stream->SetWorker(this);
+
     thread::Lock lock(this->mutex);
     this->streams.push_back(stream);
 
     this->condition->Broadcast();
 }
 
+void Worker::Notify()
+{
+    thread::Lock lock(this->mutex);
+    this->condition->Broadcast();
+}
+
 void Worker::Stop()
 {
     {
@@ -35,43 +42,57 @@ void Worker::Stop()
     }
 
     this->owner->Wait();
+
+    /* streams can outlive us, make sure they don't wake a dead worker */
+    for (auto& stream : this->streams)
+        stream->SetWorker(nullptr);
+
+    this->streams.clear();
 }
 
-void Worker::ThreadFunction()
+/* call with the mutex held */
+bool Worker::HasWork()
 {
-    double lastFrame = Timer::GetTime();
+    auto unused = [](const StrongReference<TheoraStream>& stream) {
+        if (stream->GetReferenceCount() > 1)
+            return false;
 
-    while (true)
+        stream->SetWorker(nullptr);
+        return true;
+    };
+
+    this->streams.erase(std::remove_if(this->streams.begin(), this->streams.end(), unused),
+                        this->streams.end());
+
+    for (const auto& stream : this->streams)
     {
-        love::Sleep(2);
+        if (stream->NeedsDecode())
+            return true;
+    }
 
-        thread::Lock lock(this->mutex);
+    return false;
+}
 
-        while (!this->stopping && this->streams.empty())
+void Worker::ThreadFunction()
+{
+    while (true)
+    {
         {
-            this->condition->Wait(this->mutex);
-            lastFrame = Timer::GetTime();
-        }
-
-        if (this->stopping)
-            return;
+            thread::Lock lock(this->mutex);
 
-        double currentFrame = Timer::GetTime();
-        double delta        = currentFrame - lastFrame;
+            while (!this->stopping && !this->HasWork())
+                this->condition->Wait(this->mutex, IDLE_TIMEOUT_NS);
 
-        lastFrame = currentFrame;
+            if (this->stopping)
+                return;
 
-        for (auto it = this->streams.begin(); it != this->streams.end(); ++it)
-        {
-            TheoraStream* stream = *it;
+            this->pending = this->streams;
+        }
 
-            if (stream->GetReferenceCount() == 1)
-            {
-                this->streams.erase(it);
-                break;
-            }
+        /* one frame per stream per round, so no stream starves the others */
+        for (auto& stream : this->pending)
+            stream->DecodeNext();
 
-            stream->ThreadedFillBackBuffer(delta);
-        }
+        this->pending.clear();
     }
 }
@@ -0,0 +1,352 @@
+#include "objects/atlasdata/atlasdata.h"
+#include "objects/atlasdata/maxrects.h"
+
+#include "common/exception.h"
+#include "common/lmath.h"
+
+#include "modules/filesystem/filesystem.h"
+
+#include <algorithm>
+#include <string.h>
+
+using namespace love;
+
+love::Type AtlasData::type("AtlasData", &Object::type);
+
+namespace
+{
+    struct Pending
+    {
+        size_t source;
+
+        int width;
+        int height;
+    };
+
+    struct Placement
+    {
+        size_t source;
+        MaxRects::Rect rect;
+    };
+
+    /* double the shorter side, false once both are at @maxSize */
+    bool growBin(int& width, int& height, int maxSize)
+    {
+        if (width >= maxSize && height >= maxSize)
+            return false;
+
+        if ((width <= height && width < maxSize) || height >= maxSize)
+            width *= 2;
+        else
+            height *= 2;
+
+        return true;
+    }
+
+    /*
+    ** Start from the smallest power of two bin that could hold everything
+    ** and grow it until everything fits or it can't grow any more. What
+    ** didn't fit is left in @pending for the next page.
+    */
+    MaxRects packPage(std::vector<Pending>& pending, int maxSize, std::vector<Placement>& placed)
+    {
+        long area   = 0;
+        int widest  = 1;
+        int tallest = 1;
+
+        for (const auto& item : pending)
+        {
+            widest  = std::max(widest, item.width);
+            tallest = std::max(tallest, item.height);
+
+            area += (long)item.width * item.height;
+        }
+
+        int width  = std::min(NextPO2(widest), maxSize);
+        int height = std::min(NextPO2(tallest), maxSize);
+
+        while ((long)width * height < area && growBin(width, height, maxSize))
+            continue;
+
+        std::vector<Pending> leftover;
+
+        while (true)
+        {
+            MaxRects bin(width, height);
+
+            placed.clear();
+            leftover.clear();
+
+            for (const auto& item : pending)
+            {
+                MaxRects::Rect rect;
+
+                if (bin.Insert(item.width, item.height, rect))
+                    placed.push_back({ item.source, rect });
+                else
+                    leftover.push_back(item);
+            }
+
+            if (leftover.empty() || !growBin(width, height, maxSize))
+            {
+                pending.swap(leftover);
+                return bin;
+            }
+        }
+    }
+} // namespace
+
+AtlasData::AtlasData(const std::vector<Source>& sources, const Settings& settings)
+{
+    this->Pack(sources, settings);
+}
+
+AtlasData::AtlasData(Data* data)
+{
+    this->Deserialize((const uint8_t*)data->GetData(), data->GetSize());
+}
+
+AtlasData::~AtlasData()
+{}
+
+/* biggest first, that's what MaxRects does best with */
+void AtlasData::Pack(const std::vector<Source>& sources, const Settings& settings)
+{
+    if (settings.maxSize <= 0 || settings.padding < 0)
+        throw love::Exception("Invalid atlas settings.");
+
+    std::vector<Pending> pending;
+    this->entries.resize(sources.size());
+
+    for (size_t index = 0; index < sources.size(); index++)
+    {
+        const Source& source = sources[index];
+        ImageData* imageData = source.imageData.Get();
+
+        if (!this->names.emplace(source.name, index).second)
+            throw love::Exception("Duplicate atlas entry '%s'.", source.name.c_str());
+
+        if (!ImageData::CanPaste(imageData->GetFormat(), PAGE_FORMAT))
+            throw love::Exception("Cannot pack '%s': its pixel format can't be converted.",
+                                  source.name.c_str());
+
+        int width  = imageData->GetWidth() + settings.padding;
+        int height = imageData->GetHeight() + settings.padding;
+
+        if (width > settings.maxSize || height > settings.maxSize)
+            throw love::Exception("'%s' is too large for an atlas of %dx%d.", source.name.c_str(),
+                                  settings.maxSize, settings.maxSize);
+
+        pending.push_back({ index, width, height });
+    }
+
+    std::stable_sort(pending.begin(), pending.end(), [](const Pending& a, const Pending& b) {
+        int first  = std::max(a.width, a.height);
+        int second = std::max(b.width, b.height);
+
+        if (first != second)
+            return first > second;
+
+        return (long)a.width * a.height > (long)b.width * b.height;
+    });
+
+    std::vector<Placement> placed;
+
+    while (!pending.empty())
+    {
+        MaxRects bin = packPage(pending, settings.maxSize, placed);
+
+        int width  = 0;
+        int height = 0;
+
+        bin.GetUsedSize(width, height);
+
+        StrongReference<ImageData> page(new ImageData(width, height, PAGE_FORMAT),
+                                        Acquire::NORETAIN);
+
+        const int pageIndex = (int)this->pages.size();
+
+        for (const auto& placement : placed)
+        {
+            const Source& source = sources[placement.source];
+            ImageData* imageData = source.imageData.Get();
+
+            Entry& entry = this->entries[placement.source];
+
+            entry.name   = source.name;
+            entry.page   = pageIndex;
+            entry.x      = placement.rect.x;
+            entry.y      = placement.rect.y;
+            entry.width  = imageData->GetWidth();
+            entry.height = imageData->GetHeight();
+
+            page->Paste(imageData, entry.x, entry.y, 0, 0, entry.width, entry.height);
+        }
+
+        this->pages.push_back(page);
+    }
+}
+
+/*
+** Header, one PageHeader per page, one EntryHeader per entry followed
+** by its name, then each page's pixels as ImageData keeps them.
+*/
+void AtlasData::Serialize(std::vector<uint8_t>& out) const
+{
+    auto append = [&out](const void* data, size_t size) {
+        const uint8_t* bytes = (const uint8_t*)data;
+        out.insert(out.end(), bytes, bytes + size);
+    };
+
+    Header header {};
+
+    memcpy(header.identifier, IDENTIFIER, sizeof(IDENTIFIER));
+    header.version    = VERSION;
+    header.pageCount  = this->pages.size();
+    header.entryCount = this->entries.size();
+
+    out.clear();
+    append(&header, sizeof(header));
+
+    for (const auto& page : this->pages)
+    {
+        PageHeader pageHeader { (uint32_t)page->GetWidth(), (uint32_t)page->GetHeight(),
+                                (uint32_t)page->GetFormat(), (uint32_t)page->GetSize() };
+
+        append(&pageHeader, sizeof(pageHeader));
+    }
+
+    for (const auto& entry : this->entries)
+    {
+        EntryHeader entryHeader {};
+
+        entryHeader.page       = entry.page;
+        entryHeader.x          = entry.x;
+        entryHeader.y          = entry.y;
+        entryHeader.width      = entry.width;
+        entryHeader.height     = entry.height;
+        entryHeader.nameLength = entry.name.size();
+
+        append(&entryHeader, sizeof(entryHeader));
+        append(entry.name.data(), entry.name.size());
+    }
+
+    for (const auto& page : this->pages)
+        append(page->GetData(), page->GetSize());
+}
+
+void AtlasData::Deserialize(const uint8_t* data, size_t size)
+{
+    size_t offset = 0;
+
+    auto read = [&](void* dst, size_t length) {
+        if (size - offset < length)
+            throw love::Exception("Could not load atlas: the data is truncated.");
+
+        memcpy(dst, data + offset, length);
+        offset += length;
+    };
+
+    Header header {};
+    read(&header, sizeof(header));
+
+    if (memcmp(header.identifier, IDENTIFIER, sizeof(IDENTIFIER)) != 0)
+        throw love::Exception("Could not load atlas: not an atlas file.");
+
+    if (header.version != VERSION)
+        throw love::Exception("Could not load atlas: version %u is not supported.",
+                              (unsigned)header.version);
+
+    std::vector<PageHeader> pageHeaders(header.pageCount);
+
+    for (auto& pageHeader : pageHeaders)
+        read(&pageHeader, sizeof(pageHeader));
+
+    this->entries.resize(header.entryCount);
+
+    for (size_t index = 0; index < this->entries.size(); index++)
+    {
+        EntryHeader entryHeader {};
+        read(&entryHeader, sizeof(entryHeader));
+
+        if (entryHeader.page >= header.pageCount)
+            throw love::Exception("Could not load atlas: invalid page index.");
+
+        Entry& entry = this->entries[index];
+
+        entry.name.resize(entryHeader.nameLength);
+        read(entry.name.data(), entryHeader.nameLength);
+
+        entry.page   = entryHeader.page;
+        entry.x      = entryHeader.x;
+        entry.y      = entryHeader.y;
+        entry.width  = entryHeader.width;
+        entry.height = entryHeader.height;
+
+        const PageHeader& page = pageHeaders[entry.page];
+
+        if (entryHeader.x + entryHeader.width > page.width ||
+            entryHeader.y + entryHeader.height > page.height)
+            throw love::Exception("Could not load atlas: '%s' is outside of its page.",
+                                  entry.name.c_str());
+
+        this->names.emplace(entry.name, index);
+    }
+
+    for (const auto& pageHeader : pageHeaders)
+    {
+        if (pageHeader.width == 0 || pageHeader.height == 0)
+            throw love::Exception("Could not load atlas: invalid page size.");
+
+        StrongReference<ImageData> page(
+            new ImageData(pageHeader.width, pageHeader.height, (PixelFormat)pageHeader.format),
+            Acquire::NORETAIN);
+
+        if (page->GetSize() != pageHeader.size)
+            throw love::Exception("Could not load atlas: page size mismatch.");
+
+        read(page->GetData(), pageHeader.size);
+        this->pages.push_back(page);
+    }
+}
+
+void AtlasData::Save(const char* filename) const
+{
+    auto filesystem = Module::GetInstance<Filesystem>(Module::M_FILESYSTEM);
+
+    if (filesystem == nullptr)
+        throw love::Exception("Saving an atlas requires love.filesystem.");
+
+    std::vector<uint8_t> contents;
+    this->Serialize(contents);
+
+    filesystem->Write(filename, contents.data(), contents.size());
+}
+
+int AtlasData::GetPageCount() const
+{
+    return (int)this->pages.size();
+}
+
+ImageData* AtlasData::GetPage(int index) const
+{
+    if (index < 0 || index >= (int)this->pages.size())
+        throw love::Exception("Invalid atlas page index: %d", index + 1);
+
+    return this->pages[index].Get();
+}
+
+const std::vector<AtlasData::Entry>& AtlasData::GetEntries() const
+{
+    return this->entries;
+}
+
+const AtlasData::Entry* AtlasData::GetEntry(const std::string& name) const
+{
+    auto found = this->names.find(name);
+
+    if (found == this->names.end())
+        return nullptr;
+
+    return &this->entries[found->second];
+}
@@ -0,0 +1,150 @@
+#include "objects/atlasdata/maxrects.h"
+
+#include <algorithm>
+#include <limits>
+
+using namespace love;
+
+namespace
+{
+    inline bool contains(const MaxRects::Rect& outer, const MaxRects::Rect& inner)
+    {
+        return inner.x >= outer.x && inner.y >= outer.y &&
+               inner.x + inner.width <= outer.x + outer.width &&
+               inner.y + inner.height <= outer.y + outer.height;
+    }
+} // namespace
+
+MaxRects::MaxRects(int width, int height) :
+    width(width),
+    height(height),
+    usedWidth(0),
+    usedHeight(0),
+    usedArea(0)
+{
+    this->freeRects.push_back({ 0, 0, width, height });
+}
+
+bool MaxRects::Insert(int width, int height, Rect& out)
+{
+    if (width <= 0 || height <= 0)
+        return false;
+
+    int bestShort = std::numeric_limits<int>::max();
+    int bestLong  = std::numeric_limits<int>::max();
+
+    bool found = false;
+
+    for (const auto& free : this->freeRects)
+    {
+        if (free.width < width || free.height < height)
+            continue;
+
+        int leftoverX = free.width - width;
+        int leftoverY = free.height - height;
+
+        int shortSide = std::min(leftoverX, leftoverY);
+        int longSide  = std::max(leftoverX, leftoverY);
+
+        if (shortSide < bestShort || (shortSide == bestShort && longSide < bestLong))
+        {
+            out       = { free.x, free.y, width, height };
+            bestShort = shortSide;
+            bestLong  = longSide;
+            found     = true;
+        }
+    }
+
+    if (!found)
+        return false;
+
+    this->Place(out);
+
+    return true;
+}
+
+void MaxRects::Place(const Rect& rect)
+{
+    /* splitting appends, so only look at what was there before */
+    size_t count = this->freeRects.size();
+
+    for (size_t index = 0; index < count;)
+    {
+        if (this->Split(this->freeRects[index], rect))
+        {
+            this->freeRects.erase(this->freeRects.begin() + index);
+            count--;
+        }
+        else
+            index++;
+    }
+
+    this->Prune();
+
+    this->usedWidth  = std::max(this->usedWidth, rect.x + rect.width);
+    this->usedHeight = std::max(this->usedHeight, rect.y + rect.height);
+    this->usedArea += (long)rect.width * rect.height;
+}
+
+/* the parts of @free around @used become new free rectangles */
+bool MaxRects::Split(const Rect& free, const Rect& used)
+{
+    if (used.x >= free.x + free.width || used.x + used.width <= free.x ||
+        used.y >= free.y + free.height || used.y + used.height <= free.y)
+        return false;
+
+    /* copied, @free points into the vector that's about to grow */
+    const Rect source = free;
+
+    if (used.x > source.x)
+        this->freeRects.push_back({ source.x, source.y, used.x - source.x, source.height });
+
+    if (used.x + used.width < source.x + source.width)
+    {
+        int x = used.x + used.width;
+        this->freeRects.push_back({ x, source.y, source.x + source.width - x, source.height });
+    }
+
+    if (used.y > source.y)
+        this->freeRects.push_back({ source.x, source.y, source.width, used.y - source.y });
+
+    if (used.y + used.height < source.y + source.height)
+    {
+        int y = used.y + used.height;
+        this->freeRects.push_back({ source.x, y, source.width, source.y + source.height - y });
+    }
+
+    return true;
+}
+
+void MaxRects::Prune()
+{
+    for (size_t first = 0; first < this->freeRects.size(); first++)
+    {
+        for (size_t second = first + 1; second < this->freeRects.size();)
+        {
+            if (contains(this->freeRects[second], this->freeRects[first]))
+            {
+                this->freeRects.erase(this->freeRects.begin() + first);
+                first--;
+                break;
+            }
+
+            if (contains(this->freeRects[first], this->freeRects[second]))
+                this->freeRects.erase(this->freeRects.begin() + second);
+            else
+                second++;
+        }
+    }
+}
+
+void MaxRects::GetUsedSize(int& width, int& height) const
+{
+    width  = this->usedWidth;
+    height = this->usedHeight;
+}
+
+float MaxRects::GetOccupancy() const
+{
+    return (float)this->usedArea / ((long)this->width * this->height);
+}
@@ -0,0 +1,93 @@
+#include "objects/atlasdata/wrap_atlasdata.h"
+
+using namespace love;
+
+int Wrap_AtlasData::GetPageCount(lua_State* L)
+{
+    AtlasData* self = Wrap_AtlasData::CheckAtlasData(L, 1);
+
+    lua_pushinteger(L, self->GetPageCount());
+
+    return 1;
+}
+
+int Wrap_AtlasData::GetPage(lua_State* L)
+{
+    AtlasData* self = Wrap_AtlasData::CheckAtlasData(L, 1);
+    int index       = luaL_checkinteger(L, 2) - 1;
+
+    ImageData* page = nullptr;
+    Luax::CatchException(L, [&]() { page = self->GetPage(index); });
+
+    Luax::PushType(L, page);
+
+    return 1;
+}
+
+/* page, x, y, width, height or nothing */
+int Wrap_AtlasData::GetEntry(lua_State* L)
+{
+    AtlasData* self  = Wrap_AtlasData::CheckAtlasData(L, 1);
+    const char* name = luaL_checkstring(L, 2);
+
+    const AtlasData::Entry* entry = self->GetEntry(name);
+
+    if (entry == nullptr)
+        return 0;
+
+    lua_pushinteger(L, entry->page + 1);
+    lua_pushinteger(L, entry->x);
+    lua_pushinteger(L, entry->y);
+    lua_pushinteger(L, entry->width);
+    lua_pushinteger(L, entry->height);
+
+    return 5;
+}
+
+int Wrap_AtlasData::GetNames(lua_State* L)
+{
+    AtlasData* self = Wrap_AtlasData::CheckAtlasData(L, 1);
+
+    const auto& entries = self->GetEntries();
+    lua_createtable(L, entries.size(), 0);
+
+    for (size_t index = 0; index < entries.size(); index++)
+    {
+        lua_pushlstring(L, entries[index].name.data(), entries[index].name.size());
+        lua_rawseti(L, -2, index + 1);
+    }
+
+    return 1;
+}
+
+int Wrap_AtlasData::Save(lua_State* L)
+{
+    AtlasData* self      = Wrap_AtlasData::CheckAtlasData(L, 1);
+    const char* filename = luaL_checkstring(L, 2);
+
+    Luax::CatchException(L, [&]() { self->Save(filename); });
+
+    return 0;
+}
+
+AtlasData* Wrap_AtlasData::CheckAtlasData(lua_State* L, int index)
+{
+    return Luax::CheckType<AtlasData>(L, index);
+}
+
+// clang-format off
+static constexpr luaL_Reg functions[] =
+{
+    { "getPageCount", Wrap_AtlasData::GetPageCount },
+    { "getPage",      Wrap_AtlasData::GetPage      },
+    { "getEntry",     Wrap_AtlasData::GetEntry     },
+    { "getNames",     Wrap_AtlasData::GetNames     },
+    { "save",         Wrap_AtlasData::Save         },
+    { 0,              0                            }
+};
+// clang-format on
+
+int Wrap_AtlasData::Register(lua_State* L)
+{
+    return Luax::RegisterType(L, &AtlasData::type, functions, nullptr);
+}
@@ -15,8 +15,14 @@ using namespace love;
 
 love::Type Body::type("Body", &Object::type);
 
-Body::Body(World* world, b2Vec2 position, Body::Type type) : world(world), userdata(nullptr)
+Body::Body(World* world, b2Vec2 position, Body::Type type) :
+    world(world),
+    userdata(nullptr),
+    index(0)
 {
+    if (world->IsThreaded())
+        throw love::Exception("Cannot create a Body while its World is threaded.");
+
     this->userdata = new BodyUserdata { .ref = nullptr };
 
     b2BodyDef bodyDefinition;
@@ -29,6 +35,7 @@ Body::Body(World* world, b2Vec2 position, Body::Type type) : world(world), userd
     this->SetType(type);
 
     this->world->RegisterObject(body, this);
+    this->index = this->world->RegisterBody(this);
 }
 
 Body::~Body()
@@ -484,6 +491,11 @@ World* Body::GetWorld() const
     return this->world;
 }
 
+size_t Body::GetIndex() const
+{
+    return this->index;
+}
+
 int Body::GetFixtures(lua_State* L) const
 {
     lua_newtable(L);
@@ -567,6 +579,10 @@ int Body::GetContacts(lua_State* L) const
 
 void Body::Destroy()
 {
+    /* the step thread owns the world, and must never let go of a Lua reference */
+    if (this->world->IsThreaded())
+        throw love::Exception("Cannot destroy a Body while its World is threaded.");
+
     if (this->world->world->IsLocked())
     {
         // Called during time step. Save reference for destruction afterwards.
@@ -576,8 +592,11 @@ void Body::Destroy()
         return;
     }
 
+    /* buffered ends recorded here keep the fixtures, as destroyed ones */
     this->world->world->DestroyBody(body);
+
     this->world->UnRegisterObject(body);
+    this->world->UnRegisterBody(this->index);
 
     body = NULL;
 
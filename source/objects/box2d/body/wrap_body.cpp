@@ -1,6 +1,8 @@
 #include "objects/box2d/body/wrap_body.h"
 #include "modules/physics/wrap_physics.h"
 
+#include "world/world.h"
+
 using namespace love;
 
 Body* Wrap_Body::CheckBody(lua_State* L, int index)
@@ -10,6 +12,9 @@ Body* Wrap_Body::CheckBody(lua_State* L, int index)
     if (body->body == 0)
         luaL_error(L, "Attempt to use destroyed body!");
 
+    if (body->GetWorld()->IsThreaded())
+        luaL_error(L, "Attempt to use a body while its world is threaded!");
+
     return body;
 }
 
@@ -693,6 +698,15 @@ int Wrap_Body::GetWorld(lua_State* L)
     return 1;
 }
 
+int Wrap_Body::GetIndex(lua_State* L)
+{
+    Body* self = Wrap_Body::CheckBody(L, 1);
+
+    lua_pushinteger(L, self->GetIndex() + 1);
+
+    return 1;
+}
+
 int Wrap_Body::GetFixtures(lua_State* L)
 {
     Body* self = Wrap_Body::CheckBody(L, 1);
@@ -777,6 +791,7 @@ static constexpr luaL_Reg functions[] =
     { "getContacts",                     Wrap_Body::GetContacts                     },
     { "getFixtures",                     Wrap_Body::GetFixtures                     },
     { "getGravityScale",                 Wrap_Body::GetGravityScale                 },
+    { "getIndex",                        Wrap_Body::GetIndex                        },
     { "getInertia",                      Wrap_Body::GetInertia                      },
     { "getJoints",                       Wrap_Body::GetJoints                       },
     { "getKinematicState",               Wrap_Body::GetKinematicState               },
@@ -0,0 +1,115 @@
+#include "callbacks/contactbuffer.h"
+
+#include "common/bidirectionalmap.h"
+#include "common/exception.h"
+
+#include "fixture/fixture.h"
+#include "world/world.h"
+
+#include "modules/physics/physics.h"
+
+using namespace love;
+
+ContactBuffer::ContactBuffer(World* world) : world(world)
+{}
+
+ContactBuffer::~ContactBuffer()
+{
+    this->Clear();
+}
+
+void ContactBuffer::Record(EventType type, b2Contact* contact, const b2ContactImpulse* impulse)
+{
+    Fixture* a = (Fixture*)this->world->FindObject(contact->GetFixtureA());
+    Fixture* b = (Fixture*)this->world->FindObject(contact->GetFixtureB());
+
+    /* the same as the callbacks: contacts end before their fixtures are unregistered */
+    if (!a || !b)
+        throw love::Exception("A fixture has escaped Memoizer!");
+
+    Event& event = this->events.emplace_back();
+
+    event.type     = type;
+    event.fixtureA = a;
+    event.fixtureB = b;
+
+    /*
+    ** Fixtures destroyed later in the step (or before the events are read)
+    ** must stay alive as long as they are referenced here.
+    */
+    a->Retain();
+    b->Retain();
+
+    event.normal     = b2Vec2(0.0f, 0.0f);
+    event.pointCount = 0;
+
+    if (contact->IsTouching())
+    {
+        b2WorldManifold manifold;
+        contact->GetWorldManifold(&manifold);
+
+        event.normal = manifold.normal;
+    }
+
+    if (impulse)
+    {
+        event.pointCount = impulse->count;
+
+        for (int index = 0; index < impulse->count; index++)
+        {
+            event.normalImpulses[index]  = Physics::ScaleUp(impulse->normalImpulses[index]);
+            event.tangentImpulses[index] = Physics::ScaleUp(impulse->tangentImpulses[index]);
+        }
+    }
+}
+
+void ContactBuffer::Clear()
+{
+    for (const Event& event : this->events)
+    {
+        event.fixtureA->Release();
+        event.fixtureB->Release();
+    }
+
+    this->events.clear();
+}
+
+void ContactBuffer::Take(ContactBuffer& other)
+{
+    /* the retained fixtures are handed over as-is */
+    this->events.insert(this->events.end(), other.events.begin(), other.events.end());
+    other.events.clear();
+}
+
+size_t ContactBuffer::GetCount() const
+{
+    return this->events.size();
+}
+
+const ContactBuffer::Event& ContactBuffer::GetEvent(size_t index) const
+{
+    return this->events[index];
+}
+
+// clang-format off
+constexpr auto eventTypes = BidirectionalMap<>::Create(
+    "begin",     ContactBuffer::EVENT_BEGIN,
+    "end",       ContactBuffer::EVENT_END,
+    "postsolve", ContactBuffer::EVENT_POSTSOLVE
+);
+// clang-format on
+
+bool ContactBuffer::GetConstant(const char* in, EventType& out)
+{
+    return eventTypes.Find(in, out);
+}
+
+bool ContactBuffer::GetConstant(EventType in, const char*& out)
+{
+    return eventTypes.ReverseFind(in, out);
+}
+
+std::vector<const char*> ContactBuffer::GetConstants(EventType)
+{
+    return eventTypes.GetNames();
+}
@@ -11,6 +11,9 @@ love::Type Fixture::type("Fixture", &Object::type);
 
 Fixture::Fixture(Body* body, Shape* shape, float density) : body(body), fixture(nullptr)
 {
+    if (body->world->IsThreaded())
+        throw love::Exception("Cannot create a Fixture while its World is threaded.");
+
     this->userdata = new FixtureUserdata { .ref = nullptr };
 
     b2FixtureDef fixtureDefinition;
@@ -330,6 +333,9 @@ int Fixture::GetMassData(lua_State* L) const
 
 void Fixture::Destroy(bool implicit)
 {
+    if (this->body->world->IsThreaded())
+        throw love::Exception("Cannot destroy a Fixture while its World is threaded.");
+
     if (this->body->world->world->IsLocked())
     {
         this->Retain();
@@ -2,6 +2,7 @@
 
 #include "body.h"
 #include "shape.h"
+#include "world.h"
 
 #include "chainshape/chainshape.h"
 #include "circleshape/circleshape.h"
@@ -16,6 +17,9 @@ Fixture* Wrap_Fixture::CheckFixture(lua_State* L, int index)
     if (!self->IsValid())
         luaL_error(L, "Attempt to use destroyed fixture!");
 
+    if (self->GetBody()->GetWorld()->IsThreaded())
+        luaL_error(L, "Attempt to use a fixture while its world is threaded!");
+
     return self;
 }
 
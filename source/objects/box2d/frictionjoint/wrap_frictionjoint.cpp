@@ -1,5 +1,6 @@
 #include "frictionjoint/wrap_frictionjoint.h"
 #include "joint/wrap_joint.h"
+#include "world/world.h"
 
 using namespace love;
 
@@ -10,6 +11,9 @@ FrictionJoint* Wrap_FrictionJoint::CheckFrictionJoint(lua_State* L, int index)
     if (!joint->IsValid())
         luaL_error(L, "Attempt to use destroyed joint!");
 
+    if (joint->GetWorld()->IsThreaded())
+        luaL_error(L, "Attempt to use a joint while its world is threaded!");
+
     return joint;
 }
 
@@ -13,11 +13,17 @@ love::Type Joint::type("Joint", &Object::type);
 
 Joint::Joint(Body* body) : world(body->world), userdata(nullptr), bodyA(body), bodyB(nullptr)
 {
+    if (this->world->IsThreaded())
+        throw love::Exception("Cannot create a Joint while its World is threaded.");
+
     this->userdata = new JointUserdata { .ref = nullptr };
 }
 
 Joint::Joint(Body* a, Body* b) : world(a->world), userdata(nullptr), bodyA(a), bodyB(b)
 {
+    if (this->world->IsThreaded())
+        throw love::Exception("Cannot create a Joint while its World is threaded.");
+
     this->userdata = new JointUserdata { .ref = nullptr };
 }
 
@@ -94,6 +100,11 @@ bool Joint::IsValid() const
     return this->joint != nullptr;
 }
 
+World* Joint::GetWorld() const
+{
+    return this->world;
+}
+
 int Joint::GetAnchors(lua_State* L)
 {
     lua_pushnumber(L, Physics::ScaleUp(this->joint->GetAnchorA().x));
@@ -134,6 +145,9 @@ b2Joint* Joint::CreateJoint(b2JointDef* definition)
 
 void Joint::DestroyJoint(bool implicit)
 {
+    if (this->world->IsThreaded())
+        throw love::Exception("Cannot destroy a Joint while its World is threaded.");
+
     if (this->world->world->IsLocked())
     {
         this->Retain();
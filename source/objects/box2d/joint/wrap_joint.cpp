@@ -12,6 +12,7 @@
 #include "revolutejoint/revolutejoint.h"
 #include "ropejoint/ropejoint.h"
 #include "weldjoint/weldjoint.h"
+#include "world/world.h"
 
 using namespace love;
 
@@ -56,6 +57,9 @@ Joint* Wrap_Joint::CheckJoint(lua_State* L, int index)
     if (!joint->IsValid())
         luaL_error(L, "Attempt to use destroyed joint!");
 
+    if (joint->GetWorld()->IsThreaded())
+        luaL_error(L, "Attempt to use a joint while its world is threaded!");
+
     return joint;
 }
 
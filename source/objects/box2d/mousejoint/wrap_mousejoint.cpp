@@ -1,5 +1,6 @@
 #include "mousejoint/wrap_mousejoint.h"
 #include "joint/wrap_joint.h"
+#include "world/world.h"
 
 using namespace love;
 
@@ -10,6 +11,9 @@ MouseJoint* Wrap_MouseJoint::CheckMouseJoint(lua_State* L, int index)
     if (!joint->IsValid())
         luaL_error(L, "Attempt to use destroyed joint!");
 
+    if (joint->GetWorld()->IsThreaded())
+        luaL_error(L, "Attempt to use a joint while its world is threaded!");
+
     return joint;
 }
 
@@ -6,8 +6,17 @@
 #include "joint/wrap_joint.h"
 #include "shape/shape.h"
 
+#include "common/bidirectionalmap.h"
+
+#include "modules/thread/types/lock.h"
+#include "modules/timer/timer.h"
+
+#include <algorithm>
+
 using namespace love;
 
+static constexpr double NS_PER_SEC = 1000000000.0;
+
 love::Type World::type("World", &Object::type);
 
 void World::SayGoodbye(b2Fixture* bFixture)
@@ -32,7 +41,13 @@ World::World() :
     begin(this),
     end(this),
     presolve(this),
-    postsolve(this)
+    postsolve(this),
+    bufferContacts(false),
+    contactBuffer(this),
+    stepThread(nullptr),
+    timestep(1.0f / 60.0f),
+    pendingContacts(this),
+    snapshotTime(0.0)
 {
     this->world = new b2World(b2Vec2(0, 0));
 
@@ -53,7 +68,13 @@ World::World(b2Vec2 gravity, bool sleep) :
     begin(this),
     end(this),
     presolve(this),
-    postsolve(this)
+    postsolve(this),
+    bufferContacts(false),
+    contactBuffer(this),
+    stepThread(nullptr),
+    timestep(1.0f / 60.0f),
+    pendingContacts(this),
+    snapshotTime(0.0)
 {
     this->world = new b2World(Physics::ScaleDown(gravity));
 
@@ -80,6 +101,26 @@ void World::Update(float dt)
 }
 
 void World::Update(float dt, int velocityIterations, int positionIterations)
+{
+    // The step thread does the stepping, just collect its contacts.
+    if (this->stepThread != nullptr)
+    {
+        thread::Lock lock(this->stepMutex);
+
+        this->contactBuffer.Clear();
+        this->contactBuffer.Take(this->pendingContacts);
+
+        return;
+    }
+
+    // Events from the previous step are only readable until the next one.
+    this->contactBuffer.Clear();
+
+    this->ApplyMutations();
+    this->Step(dt, velocityIterations, positionIterations);
+}
+
+void World::Step(float dt, int velocityIterations, int positionIterations)
 {
     this->world->Step(dt, velocityIterations, positionIterations);
 
@@ -119,14 +160,221 @@ void World::Update(float dt, int velocityIterations, int positionIterations)
         this->Destroy();
 }
 
+void World::QueueMutation(const Mutation& mutation)
+{
+    thread::Lock lock(this->mutationMutex);
+    this->mutations.push_back(mutation);
+}
+
+void World::ApplyMutations()
+{
+    {
+        thread::Lock lock(this->mutationMutex);
+        this->appliedMutations.swap(this->mutations);
+    }
+
+    for (const Mutation& mutation : this->appliedMutations)
+    {
+        Body* body = this->GetBodyByIndex(mutation.index);
+
+        // The body may have been destroyed since the mutation was queued.
+        if (body == nullptr || body->body == nullptr)
+            continue;
+
+        const float* values = mutation.values;
+
+        switch (mutation.type)
+        {
+            case MUTATION_TRANSFORM:
+                body->SetKinematicState(b2Vec2(values[0], values[1]), values[2],
+                                        b2Vec2(values[3], values[4]), values[5]);
+                break;
+            case MUTATION_VELOCITY:
+                body->SetLinearVelocity(values[3], values[4]);
+                body->SetAngularVelocity(values[5]);
+                break;
+            case MUTATION_FORCE:
+                body->ApplyForce(values[0], values[1], true);
+                break;
+            case MUTATION_IMPULSE:
+                body->ApplyLinearImpulse(values[0], values[1], true);
+                break;
+            default:
+                break;
+        }
+    }
+
+    this->appliedMutations.clear();
+}
+
+void World::ThreadedStep()
+{
+    {
+        thread::Lock lock(this->stepMutex);
+
+        this->ApplyMutations();
+        this->Step(this->timestep, 8, 3);
+
+        size_t count = this->bodySlots.size() - this->freeBodySlots.size();
+
+        this->snapshotBack.resize(count);
+        this->snapshotAwakeBack.resize(count);
+
+        this->WriteBodyStates(this->snapshotBack.data(), count, false,
+                              this->snapshotAwakeBack.data());
+    }
+
+    thread::Lock lock(this->snapshotMutex);
+
+    this->snapshotPrevious.swap(this->snapshotCurrent);
+    this->snapshotCurrent.swap(this->snapshotBack);
+    this->snapshotAwake.swap(this->snapshotAwakeBack);
+
+    this->snapshotTime = Timer::GetTime();
+}
+
+void World::SetThreaded(bool enable, float timestep)
+{
+    if (enable)
+    {
+        if (timestep <= 0.0f)
+            throw love::Exception("Timestep must be greater than zero.");
+
+        this->timestep = timestep;
+    }
+
+    if (enable == (this->stepThread != nullptr))
+        return;
+
+    if (enable)
+    {
+        if (this->world->IsLocked())
+            throw love::Exception("Cannot start threading a World during a time step.");
+
+        if (this->filter.ref != nullptr || this->presolve.ref != nullptr)
+            throw love::Exception("Threaded Worlds cannot call a contact filter or preSolve "
+                                  "callback, remove them first.");
+
+        this->bufferContacts = true;
+
+        /* the step thread would invalidate these under the main thread's feet */
+        b2Contact* contactList = this->world->GetContactList();
+
+        while (contactList)
+        {
+            Contact* contact = (Contact*)this->FindObject(contactList);
+
+            if (contact != nullptr)
+                contact->Invalidate();
+
+            contactList = contactList->GetNext();
+        }
+
+        size_t count = this->bodySlots.size() - this->freeBodySlots.size();
+
+        /* start with both snapshots at the current state */
+        this->snapshotCurrent.resize(count);
+        this->snapshotAwake.resize(count);
+
+        this->WriteBodyStates(this->snapshotCurrent.data(), count, false,
+                              this->snapshotAwake.data());
+
+        this->snapshotPrevious = this->snapshotCurrent;
+        this->snapshotTime     = Timer::GetTime();
+
+        this->stepThread = new StepThread(this);
+
+        if (!this->stepThread->Start())
+        {
+            delete this->stepThread;
+            this->stepThread = nullptr;
+
+            throw love::Exception("Failed to start the physics thread.");
+        }
+    }
+    else
+    {
+        this->stepThread->SetFinish();
+        this->stepThread->Wait();
+
+        delete this->stepThread;
+        this->stepThread = nullptr;
+
+        this->contactBuffer.Take(this->pendingContacts);
+    }
+}
+
+bool World::IsThreaded() const
+{
+    return this->stepThread != nullptr;
+}
+
+float World::GetTimestep() const
+{
+    return this->timestep;
+}
+
+World::StepThread::StepThread(World* world) : world(world), finish(false)
+{
+    this->threadName = "PhysicsWorld";
+}
+
+World::StepThread::~StepThread()
+{}
+
+void World::StepThread::SetFinish()
+{
+    thread::Lock lock(this->mutex);
+
+    this->finish = true;
+    this->wake->Signal();
+}
+
+void World::StepThread::ThreadFunction()
+{
+    const int64_t period = (int64_t)(this->world->timestep * NS_PER_SEC + 0.5);
+    uint64_t deadline    = Timer::GetTimeNs() + period;
+
+    while (true)
+    {
+        {
+            thread::Lock lock(this->mutex);
+
+            int64_t remaining;
+
+            /* a timed wait, to the nanosecond, rather than whole-ms sleeps */
+            while (!this->finish && (remaining = (int64_t)(deadline - Timer::GetTimeNs())) > 0)
+                this->wake->Wait(this->mutex, remaining);
+
+            if (this->finish)
+                return;
+        }
+
+        int64_t due   = (int64_t)(Timer::GetTimeNs() - deadline) / period + 1;
+        int64_t steps = std::min<int64_t>(due, MAX_STEPS_PER_UPDATE);
+
+        for (int64_t step = 0; step < steps && !this->finish; step++)
+            this->world->ThreadedStep();
+
+        /* steps past MAX_STEPS_PER_UPDATE are dropped, not caught up later */
+        deadline += due * period;
+    }
+}
+
 void World::BeginContact(b2Contact* contact)
 {
-    this->begin.Process(contact);
+    if (this->bufferContacts)
+        this->GetRecordingBuffer().Record(ContactBuffer::EVENT_BEGIN, contact);
+    else
+        this->begin.Process(contact);
 }
 
 void World::EndContact(b2Contact* bContact)
 {
-    this->end.Process(bContact);
+    if (this->bufferContacts)
+        this->GetRecordingBuffer().Record(ContactBuffer::EVENT_END, bContact);
+    else
+        this->end.Process(bContact);
 
     Contact* contact = (Contact*)this->FindObject(bContact);
 
@@ -136,16 +384,25 @@ void World::EndContact(b2Contact* bContact)
 
 void World::PreSolve(b2Contact* contact, const b2Manifold* /*oldManifold*/)
 {
-    this->presolve.Process(contact);
+    // Threaded worlds refuse a preSolve callback, there's nothing to call.
+    if (this->stepThread == nullptr)
+        this->presolve.Process(contact);
 }
 
 void World::PostSolve(b2Contact* contact, const b2ContactImpulse* impulse)
 {
-    this->postsolve.Process(contact, impulse);
+    if (this->bufferContacts)
+        this->GetRecordingBuffer().Record(ContactBuffer::EVENT_POSTSOLVE, contact, impulse);
+    else
+        this->postsolve.Process(contact, impulse);
 }
 
 bool World::ShouldCollide(b2Fixture* fixtureA, b2Fixture* fixtureB)
 {
+    // Threaded worlds refuse a Lua filter, so only the fixtures' own filtering applies.
+    if (this->stepThread != nullptr)
+        return b2ContactFilter::ShouldCollide(fixtureA, fixtureB);
+
     // Fixtures should be memoized, if we created them
     Fixture* a = (Fixture*)this->FindObject(fixtureA);
     Fixture* b = (Fixture*)this->FindObject(fixtureB);
@@ -171,6 +428,9 @@ int World::SetCallbacks(lua_State* L)
             luaL_checktype(L, i, LUA_TFUNCTION);
     }
 
+    if (this->stepThread != nullptr && !lua_isnoneornil(L, 3))
+        return luaL_error(L, "Threaded Worlds cannot call a preSolve callback.");
+
     delete this->begin.ref;
     this->begin.ref = nullptr;
 
@@ -234,6 +494,9 @@ int World::SetContactFilter(lua_State* L)
     if (!lua_isnoneornil(L, 1))
         luaL_checktype(L, 1, LUA_TFUNCTION);
 
+    if (this->stepThread != nullptr && !lua_isnoneornil(L, 1))
+        return luaL_error(L, "Threaded Worlds cannot call a contact filter.");
+
     if (this->filter.ref)
         delete this->filter.ref;
 
@@ -250,6 +513,32 @@ int World::GetContactFilter(lua_State* L)
     return 1;
 }
 
+void World::SetContactBuffering(bool enable)
+{
+    if (!enable && this->stepThread != nullptr)
+        throw love::Exception("Threaded Worlds always buffer contacts.");
+
+    if (!enable)
+        this->contactBuffer.Clear();
+
+    this->bufferContacts = enable;
+}
+
+bool World::IsContactBuffering() const
+{
+    return this->bufferContacts;
+}
+
+const ContactBuffer& World::GetContactBuffer() const
+{
+    return this->contactBuffer;
+}
+
+ContactBuffer& World::GetRecordingBuffer()
+{
+    return (this->stepThread != nullptr) ? this->pendingContacts : this->contactBuffer;
+}
+
 void World::SetGravity(float x, float y)
 {
     this->world->SetGravity(Physics::ScaleDown(b2Vec2(x, y)));
@@ -384,6 +673,186 @@ int World::GetContacts(lua_State* L)
     return 1;
 }
 
+size_t World::RegisterBody(Body* body)
+{
+    if (!this->freeBodySlots.empty())
+    {
+        size_t index = this->freeBodySlots.back();
+        this->freeBodySlots.pop_back();
+
+        this->bodySlots[index] = body;
+        return index;
+    }
+
+    this->bodySlots.push_back(body);
+    return this->bodySlots.size() - 1;
+}
+
+void World::UnRegisterBody(size_t index)
+{
+    if (index >= this->bodySlots.size() || this->bodySlots[index] == nullptr)
+        return;
+
+    this->bodySlots[index] = nullptr;
+    this->freeBodySlots.push_back(index);
+}
+
+Body* World::GetBodyByIndex(size_t index) const
+{
+    if (index >= this->bodySlots.size())
+        return nullptr;
+
+    return this->bodySlots[index];
+}
+
+size_t World::GetBodyStateCount(bool awakeOnly) const
+{
+    if (this->stepThread != nullptr)
+    {
+        thread::Lock lock(this->snapshotMutex);
+
+        if (!awakeOnly)
+            return this->snapshotAwake.size();
+
+        return std::count(this->snapshotAwake.begin(), this->snapshotAwake.end(), 1);
+    }
+
+    if (!awakeOnly)
+        return this->bodySlots.size() - this->freeBodySlots.size();
+
+    size_t count = 0;
+
+    for (Body* body : this->bodySlots)
+    {
+        if (body != nullptr && body->body->IsAwake())
+            count++;
+    }
+
+    return count;
+}
+
+size_t World::GetBodyStates(BodyState* out, size_t maxBodies, bool awakeOnly) const
+{
+    if (this->stepThread != nullptr)
+        return this->GetInterpolatedStates(out, maxBodies, awakeOnly);
+
+    return this->WriteBodyStates(out, maxBodies, awakeOnly);
+}
+
+size_t World::WriteBodyStates(BodyState* out, size_t maxBodies, bool awakeOnly,
+                              uint8_t* awake) const
+{
+    size_t written = 0;
+
+    for (size_t index = 0; index < this->bodySlots.size() && written < maxBodies; index++)
+    {
+        const Body* body = this->bodySlots[index];
+
+        if (body == nullptr || (awakeOnly && !body->body->IsAwake()))
+            continue;
+
+        const b2Body* bBody = body->body;
+
+        b2Vec2 position = Physics::ScaleUp(bBody->GetPosition());
+        b2Vec2 velocity = Physics::ScaleUp(bBody->GetLinearVelocity());
+
+        out->index     = (uint32_t)(index + 1);
+        out->values[0] = position.x;
+        out->values[1] = position.y;
+        out->values[2] = bBody->GetAngle();
+        out->values[3] = velocity.x;
+        out->values[4] = velocity.y;
+        out->values[5] = bBody->GetAngularVelocity();
+
+        if (awake != nullptr)
+            awake[written] = bBody->IsAwake();
+
+        out++;
+        written++;
+    }
+
+    return written;
+}
+
+/*
+** Blend the last two snapshots by how far we are into the next step.
+** Bodies that are only in the newest snapshot are copied as-is.
+*/
+size_t World::GetInterpolatedStates(BodyState* out, size_t maxBodies, bool awakeOnly) const
+{
+    thread::Lock lock(this->snapshotMutex);
+
+    double elapsed = Timer::GetTime() - this->snapshotTime;
+    float alpha    = std::clamp((float)(elapsed / this->timestep), 0.0f, 1.0f);
+
+    const BodyState* previous    = this->snapshotPrevious.data();
+    const BodyState* previousEnd = previous + this->snapshotPrevious.size();
+
+    const BodyState* current = this->snapshotCurrent.data();
+
+    size_t count   = this->snapshotAwake.size();
+    size_t written = 0;
+
+    for (size_t state = 0; state < count && written < maxBodies; state++, current++)
+    {
+        if (awakeOnly && !this->snapshotAwake[state])
+            continue;
+
+        // Both snapshots are sorted by index.
+        while (previous < previousEnd && previous->index < current->index)
+            previous++;
+
+        *out = *current;
+
+        if (previous < previousEnd && previous->index == current->index)
+        {
+            for (size_t index = 0; index < BODY_STATE_COMPONENTS - 1; index++)
+            {
+                float from = previous->values[index];
+                out->values[index] = from + (current->values[index] - from) * alpha;
+            }
+        }
+
+        out++;
+        written++;
+    }
+
+    return written;
+}
+
+void World::SetTransforms(const BodyState* in, size_t count)
+{
+    if (this->stepThread != nullptr)
+    {
+        for (size_t state = 0; state < count; state++, in++)
+        {
+            Mutation mutation { .type = MUTATION_TRANSFORM, .index = (size_t)in->index - 1 };
+            std::copy_n(in->values, BODY_STATE_COMPONENTS - 1, mutation.values);
+
+            this->QueueMutation(mutation);
+        }
+
+        return;
+    }
+
+    if (this->world->IsLocked())
+        throw love::Exception("Cannot set body transforms during a time step.");
+
+    for (size_t state = 0; state < count; state++, in++)
+    {
+        size_t index = in->index;
+        Body* body   = (index >= 1) ? this->GetBodyByIndex(index - 1) : nullptr;
+
+        if (body == nullptr)
+            throw love::Exception("Invalid body index: %zu.", index);
+
+        const float* values = in->values;
+
+        body->SetKinematicState(b2Vec2(values[0], values[1]), values[2],
+                                b2Vec2(values[3], values[4]), values[5]);
+    }
+}
+
 b2Body* World::GetGroundBody() const
 {
     return this->groundBody;
@@ -431,6 +900,10 @@ void World::Destroy()
     if (this->world == nullptr)
         return;
 
+    // Stop stepping first, this also makes sure the world isn't locked.
+    if (this->stepThread != nullptr)
+        this->SetThreaded(false, this->timestep);
+
     if (this->world->IsLocked())
     {
         this->destructWorld = true;
@@ -457,6 +930,10 @@ void World::Destroy()
     this->begin.ref = this->end.ref = this->presolve.ref = this->postsolve.ref = this->filter.ref =
         nullptr;
 
+    // Release the fixtures held by buffered events and stop recording.
+    this->contactBuffer.Clear();
+    this->bufferContacts = false;
+
     // Cleaning up the world.
     b2Body* bodyList = world->GetBodyList();
 
@@ -501,3 +978,27 @@ love::Object* World::FindObject(void* b2object) const
     else
         return nullptr;
 }
+
+// clang-format off
+constexpr auto mutationTypes = BidirectionalMap<>::Create(
+    "transform", World::MUTATION_TRANSFORM,
+    "velocity",  World::MUTATION_VELOCITY,
+    "force",     World::MUTATION_FORCE,
+    "impulse",   World::MUTATION_IMPULSE
+);
+// clang-format on
+
+bool World::GetConstant(const char* in, MutationType& out)
+{
+    return mutationTypes.Find(in, out);
+}
+
+bool World::GetConstant(MutationType in, const char*& out)
+{
+    return mutationTypes.ReverseFind(in, out);
+}
+
+std::vector<const char*> World::GetConstants(MutationType)
+{
+    return mutationTypes.GetNames();
+}
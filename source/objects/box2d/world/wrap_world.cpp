@@ -1,7 +1,12 @@
 #include "world/wrap_world.h"
 
+#include "common/data.h"
+#include "fixture/fixture.h"
+
 using namespace love;
 
+#define CONTACT_ITERATOR_KEY "_love_world_contactevents"
+
 World* Wrap_World::CheckWorld(lua_State* L, int index)
 {
     World* world = Luax::CheckType<World>(L, index);
@@ -12,6 +17,17 @@ World* Wrap_World::CheckWorld(lua_State* L, int index)
     return world;
 }
 
+/* for anything that touches the b2World, which belongs to the step thread while threaded */
+World* Wrap_World::CheckUnthreadedWorld(lua_State* L, int index)
+{
+    World* world = Wrap_World::CheckWorld(L, index);
+
+    if (world->IsThreaded())
+        luaL_error(L, "Attempt to use a threaded world!");
+
+    return world;
+}
+
 int Wrap_World::Update(lua_State* L)
 {
     World* self = Wrap_World::CheckWorld(L, 1);
@@ -65,9 +81,97 @@ int Wrap_World::GetContactFilter(lua_State* L)
     return self->GetContactFilter(L);
 }
 
-int Wrap_World::SetGravity(lua_State* L)
+int Wrap_World::SetContactBuffering(lua_State* L)
 {
     World* self = Wrap_World::CheckWorld(L, 1);
+    bool enable = Luax::CheckBoolean(L, 2);
+
+    Luax::CatchException(L, [&]() { self->SetContactBuffering(enable); });
+
+    return 0;
+}
+
+int Wrap_World::IsContactBuffering(lua_State* L)
+{
+    World* self = Wrap_World::CheckWorld(L, 1);
+
+    Luax::PushBoolean(L, self->IsContactBuffering());
+
+    return 1;
+}
+
+int Wrap_World::GetContactEventCount(lua_State* L)
+{
+    World* self = Wrap_World::CheckWorld(L, 1);
+
+    lua_pushinteger(L, self->GetContactBuffer().GetCount());
+
+    return 1;
+}
+
+/*
+** Iterator for World:getContactEvents
+** Returns index, event, fixtureA, fixtureB, normalX, normalY
+** followed by the normal and tangent impulse of each contact point.
+*/
+static int ContactEventIterator(lua_State* L)
+{
+    World* self  = Wrap_World::CheckWorld(L, 1);
+    size_t index = (size_t)luaL_checkinteger(L, 2);
+
+    const ContactBuffer& buffer = self->GetContactBuffer();
+
+    if (index >= buffer.GetCount())
+        return 0;
+
+    const ContactBuffer::Event& event = buffer.GetEvent(index);
+
+    const char* name = nullptr;
+    ContactBuffer::GetConstant(event.type, name);
+
+    lua_pushinteger(L, index + 1);
+    lua_pushstring(L, name);
+
+    Luax::PushType(L, event.fixtureA);
+    Luax::PushType(L, event.fixtureB);
+
+    lua_pushnumber(L, event.normal.x);
+    lua_pushnumber(L, event.normal.y);
+
+    for (int point = 0; point < event.pointCount; point++)
+    {
+        lua_pushnumber(L, event.normalImpulses[point]);
+        lua_pushnumber(L, event.tangentImpulses[point]);
+    }
+
+    return 6 + event.pointCount * 2;
+}
+
+int Wrap_World::GetContactEvents(lua_State* L)
+{
+    Wrap_World::CheckWorld(L, 1);
+
+    /* cache the iterator so looping every frame doesn't create a closure */
+    lua_getfield(L, LUA_REGISTRYINDEX, CONTACT_ITERATOR_KEY);
+
+    if (lua_isnil(L, -1))
+    {
+        lua_pop(L, 1);
+
+        lua_pushcfunction(L, ContactEventIterator);
+        lua_pushvalue(L, -1);
+        lua_setfield(L, LUA_REGISTRYINDEX, CONTACT_ITERATOR_KEY);
+    }
+
+    lua_pushvalue(L, 1);
+    lua_pushinteger(L, 0);
+
+    return 3;
+}
+
+int Wrap_World::SetGravity(lua_State* L)
+{
+    World* self = Wrap_World::CheckUnthreadedWorld(L, 1);
 
     float x = luaL_checknumber(L, 2);
     float y = luaL_checknumber(L, 3);
@@ -79,7 +183,7 @@ int Wrap_World::SetGravity(lua_State* L)
 
 int Wrap_World::GetGravity(lua_State* L)
 {
-    World* self = Wrap_World::CheckWorld(L, 1);
+    World* self = Wrap_World::CheckUnthreadedWorld(L, 1);
     lua_remove(L, 1);
 
     return self->GetGravity(L);
@@ -87,7 +191,7 @@ int Wrap_World::GetGravity(lua_State* L)
 
 int Wrap_World::TranslateOrigin(lua_State* L)
 {
-    World* self = Wrap_World::CheckWorld(L, 1);
+    World* self = Wrap_World::CheckUnthreadedWorld(L, 1);
 
     float x = luaL_checknumber(L, 2);
     float y = luaL_checknumber(L, 3);
@@ -99,7 +203,7 @@ int Wrap_World::TranslateOrigin(lua_State* L)
 
 int Wrap_World::SetSleepingAllowed(lua_State* L)
 {
-    World* self  = Wrap_World::CheckWorld(L, 1);
+    World* self  = Wrap_World::CheckUnthreadedWorld(L, 1);
     bool allowed = Luax::CheckBoolean(L, 2);
 
     self->SetSleepingAllowed(allowed);
@@ -109,7 +213,7 @@ int Wrap_World::SetSleepingAllowed(lua_State* L)
 
 int Wrap_World::IsSleepingAllowed(lua_State* L)
 {
-    World* self = Wrap_World::CheckWorld(L, 1);
+    World* self = Wrap_World::CheckUnthreadedWorld(L, 1);
 
     Luax::PushBoolean(L, self->IsSleepingAllowed());
 
@@ -118,7 +222,7 @@ int Wrap_World::IsSleepingAllowed(lua_State* L)
 
 int Wrap_World::IsLocked(lua_State* L)
 {
-    World* self = Wrap_World::CheckWorld(L, 1);
+    World* self = Wrap_World::CheckUnthreadedWorld(L, 1);
 
     Luax::PushBoolean(L, self->IsLocked());
 
@@ -145,7 +249,7 @@ int Wrap_World::GetJointCount(lua_State* L)
 
 int Wrap_World::GetContactCount(lua_State* L)
 {
-    World* self = Wrap_World::CheckWorld(L, 1);
+    World* self = Wrap_World::CheckUnthreadedWorld(L, 1);
 
     lua_pushinteger(L, self->GetContactCount());
 
@@ -154,7 +258,7 @@ int Wrap_World::GetContactCount(lua_State* L)
 
 int Wrap_World::GetBodies(lua_State* L)
 {
-    World* self = Wrap_World::CheckWorld(L, 1);
+    World* self = Wrap_World::CheckUnthreadedWorld(L, 1);
     lua_remove(L, 1);
 
     int ret = 0;
@@ -165,7 +269,7 @@ int Wrap_World::GetBodies(lua_State* L)
 
 int Wrap_World::GetJoints(lua_State* L)
 {
-    World* self = Wrap_World::CheckWorld(L, 1);
+    World* self = Wrap_World::CheckUnthreadedWorld(L, 1);
     lua_remove(L, 1);
 
     int ret = 0;
@@ -176,7 +280,7 @@ int Wrap_World::GetJoints(lua_State* L)
 
 int Wrap_World::GetContacts(lua_State* L)
 {
-    World* self = Wrap_World::CheckWorld(L, 1);
+    World* self = Wrap_World::CheckUnthreadedWorld(L, 1);
     lua_remove(L, 1);
 
     int ret = 0;
@@ -185,9 +289,194 @@ int Wrap_World::GetContacts(lua_State* L)
     return ret;
 }
 
-int Wrap_World::QueryBoundingBox(lua_State* L)
+/*
+** World:getBodyStates([target, awakeOnly])
+** @target may be a Data object (a uint32 index then six native floats per
+** body) or a table (flat numbers).
+** A new table is returned when no target is given.
+** Returns the target and the number of bodies written.
+*/
+int Wrap_World::GetBodyStates(lua_State* L)
+{
+    World* self    = Wrap_World::CheckWorld(L, 1);
+    bool awakeOnly = lua_toboolean(L, 3);
+
+    using BodyState = World::BodyState;
+
+    constexpr size_t components = World::BODY_STATE_COMPONENTS;
+    size_t written              = 0;
+
+    if (Luax::IsType(L, 2, Data::type))
+    {
+        Data* data = Luax::CheckType<Data>(L, 2);
+
+        size_t maxBodies = data->GetSize() / sizeof(BodyState);
+        written = self->GetBodyStates((BodyState*)data->GetData(), maxBodies, awakeOnly);
+
+        if (written < self->GetBodyStateCount(awakeOnly))
+            return luaL_error(L, "Data is too small to hold %d body states.",
+                              (int)self->GetBodyStateCount(awakeOnly));
+
+        lua_pushvalue(L, 2);
+        lua_pushinteger(L, written);
+
+        return 2;
+    }
+
+    std::vector<BodyState> states(self->GetBodyStateCount(awakeOnly));
+    written = self->GetBodyStates(states.data(), states.size(), awakeOnly);
+
+    if (lua_istable(L, 2))
+        lua_pushvalue(L, 2);
+    else if (lua_isnoneornil(L, 2))
+        lua_createtable(L, (int)(states.size() * components), 0);
+    else
+        return luaL_typerror(L, 2, "table or Data");
+
+    for (size_t state = 0; state < written; state++)
+    {
+        int first = (int)(state * components) + 1;
+
+        lua_pushinteger(L, states[state].index);
+        lua_rawseti(L, -2, first);
+
+        for (size_t index = 0; index < components - 1; index++)
+        {
+            lua_pushnumber(L, states[state].values[index]);
+            lua_rawseti(L, -2, first + index + 1);
+        }
+    }
+
+    lua_pushinteger(L, written);
+
+    return 2;
+}
+
+/*
+** World:setTransforms(source[, count])
+** @source is a Data object or table in the getBodyStates layout.
+*/
+int Wrap_World::SetTransforms(lua_State* L)
 {
     World* self = Wrap_World::CheckWorld(L, 1);
+
+    using BodyState = World::BodyState;
+
+    constexpr size_t components = World::BODY_STATE_COMPONENTS;
+
+    std::vector<BodyState> states;
+    const BodyState* source = nullptr;
+    size_t available        = 0;
+
+    if (Luax::IsType(L, 2, Data::type))
+    {
+        Data* data = Luax::CheckType<Data>(L, 2);
+
+        source    = (const BodyState*)data->GetData();
+        available = data->GetSize() / sizeof(BodyState);
+    }
+    else
+    {
+        luaL_checktype(L, 2, LUA_TTABLE);
+
+        available = lua_objlen(L, 2) / components;
+        states.resize(available);
+
+        for (size_t state = 0; state < available; state++)
+        {
+            int first = (int)(state * components) + 1;
+
+            lua_rawgeti(L, 2, first);
+            states[state].index = (uint32_t)luaL_checkinteger(L, -1);
+            lua_pop(L, 1);
+
+            for (size_t index = 0; index < components - 1; index++)
+            {
+                lua_rawgeti(L, 2, first + index + 1);
+                states[state].values[index] = (float)luaL_checknumber(L, -1);
+                lua_pop(L, 1);
+            }
+        }
+
+        source = states.data();
+    }
+
+    size_t count = (size_t)luaL_optinteger(L, 3, available);
+
+    if (count > available)
+        return luaL_error(L, "Source only holds %d body states.", (int)available);
+
+    Luax::CatchException(L, [&]() { self->SetTransforms(source, count); });
+
+    return 0;
+}
+
+/*
+** World:queueMutation(type, bodyIndex, ...)
+** transform: x, y, angle, xVelocity, yVelocity, angularVelocity
+** velocity: xVelocity, yVelocity, angularVelocity
+** force, impulse: x, y
+*/
+int Wrap_World::QueueMutation(lua_State* L)
+{
+    World* self      = Wrap_World::CheckWorld(L, 1);
+    const char* name = luaL_checkstring(L, 2);
+    int index        = luaL_checkinteger(L, 3);
+
+    World::Mutation mutation {};
+
+    if (!World::GetConstant(name, mutation.type))
+        return Luax::EnumError(L, "mutation type", World::GetConstants(mutation.type), name);
+
+    if (self->GetBodyByIndex(index - 1) == nullptr)
+        return luaL_error(L, "Invalid body index: %d.", index);
+
+    mutation.index = index - 1;
+
+    switch (mutation.type)
+    {
+        case World::MUTATION_TRANSFORM:
+            for (int value = 0; value < 6; value++)
+                mutation.values[value] = luaL_checknumber(L, value + 4);
+            break;
+        case World::MUTATION_VELOCITY:
+            for (int value = 3; value < 6; value++)
+                mutation.values[value] = luaL_checknumber(L, value + 1);
+            break;
+        default:
+            mutation.values[0] = luaL_checknumber(L, 4);
+            mutation.values[1] = luaL_checknumber(L, 5);
+            break;
+    }
+
+    self->QueueMutation(mutation);
+
+    return 0;
+}
+
+int Wrap_World::SetThreaded(lua_State* L)
+{
+    World* self    = Wrap_World::CheckWorld(L, 1);
+    bool enable    = Luax::CheckBoolean(L, 2);
+    float timestep = luaL_optnumber(L, 3, self->GetTimestep());
+
+    Luax::CatchException(L, [&]() { self->SetThreaded(enable, timestep); });
+
+    return 0;
+}
+
+int Wrap_World::IsThreaded(lua_State* L)
+{
+    World* self = Wrap_World::CheckWorld(L, 1);
+
+    Luax::PushBoolean(L, self->IsThreaded());
+
+    return 1;
+}
+
+int Wrap_World::QueryBoundingBox(lua_State* L)
+{
+    World* self = Wrap_World::CheckUnthreadedWorld(L, 1);
     lua_remove(L, 1);
 
     return self->QueryBoundingBox(L);
@@ -195,7 +484,7 @@ int Wrap_World::QueryBoundingBox(lua_State* L)
 
 int Wrap_World::RayCast(lua_State* L)
 {
-    World* self = Wrap_World::CheckWorld(L, 1);
+    World* self = Wrap_World::CheckUnthreadedWorld(L, 1);
     lua_remove(L, 1);
 
     int ret = 0;
@@ -225,28 +514,37 @@ int Wrap_World::IsDestroyed(lua_State* L)
 // clang-format off
 static constexpr luaL_Reg functions[] =
 {
-    { "destroy",            Wrap_World::Destroy            },
-    { "getBodies",          Wrap_World::GetBodies          },
-    { "getBodyCount",       Wrap_World::GetBodyCount       },
-    { "getCallbacks",       Wrap_World::GetCallbacks       },
-    { "getContactCount",    Wrap_World::GetContactCount    },
-    { "getContactFilter",   Wrap_World::GetContactFilter   },
-    { "getContacts",        Wrap_World::GetContacts        },
-    { "getGravity",         Wrap_World::GetGravity         },
-    { "getJointCount",      Wrap_World::GetJointCount      },
-    { "getJoints",          Wrap_World::GetJoints          },
-    { "isDestroyed",        Wrap_World::IsDestroyed        },
-    { "isLocked",           Wrap_World::IsLocked           },
-    { "isSleepingAllowed",  Wrap_World::IsSleepingAllowed  },
-    { "queryBoundingBox",   Wrap_World::QueryBoundingBox   },
-    { "rayCast",            Wrap_World::RayCast            },
-    { "setCallbacks",       Wrap_World::SetCallbacks       },
-    { "setContactFilter",   Wrap_World::SetContactFilter   },
-    { "setGravity",         Wrap_World::SetGravity         },
-    { "setSleepingAllowed", Wrap_World::SetSleepingAllowed },
-    { "translateOrigin",    Wrap_World::TranslateOrigin    },
-    { "update",             Wrap_World::Update             },
-    { 0,                    0                              }
+    { "destroy",              Wrap_World::Destroy              },
+    { "getBodies",            Wrap_World::GetBodies            },
+    { "getBodyCount",         Wrap_World::GetBodyCount         },
+    { "getBodyStates",        Wrap_World::GetBodyStates        },
+    { "getCallbacks",         Wrap_World::GetCallbacks         },
+    { "getContactCount",      Wrap_World::GetContactCount      },
+    { "getContactEventCount", Wrap_World::GetContactEventCount },
+    { "getContactEvents",     Wrap_World::GetContactEvents     },
+    { "getContactFilter",     Wrap_World::GetContactFilter     },
+    { "getContacts",          Wrap_World::GetContacts          },
+    { "getGravity",           Wrap_World::GetGravity           },
+    { "getJointCount",        Wrap_World::GetJointCount        },
+    { "getJoints",            Wrap_World::GetJoints            },
+    { "isContactBuffering",   Wrap_World::IsContactBuffering   },
+    { "isDestroyed",          Wrap_World::IsDestroyed          },
+    { "isLocked",             Wrap_World::IsLocked             },
+    { "isSleepingAllowed",    Wrap_World::IsSleepingAllowed    },
+    { "isThreaded",           Wrap_World::IsThreaded           },
+    { "queryBoundingBox",     Wrap_World::QueryBoundingBox     },
+    { "queueMutation",        Wrap_World::QueueMutation        },
+    { "rayCast",              Wrap_World::RayCast              },
+    { "setCallbacks",         Wrap_World::SetCallbacks         },
+    { "setContactBuffering",  Wrap_World::SetContactBuffering  },
+    { "setContactFilter",     Wrap_World::SetContactFilter     },
+    { "setGravity",           Wrap_World::SetGravity           },
+    { "setSleepingAllowed",   Wrap_World::SetSleepingAllowed   },
+    { "setThreaded",          Wrap_World::SetThreaded          },
+    { "setTransforms",        Wrap_World::SetTransforms        },
+    { "translateOrigin",      Wrap_World::TranslateOrigin      },
+    { "update",               Wrap_World::Update               },
+    { 0,                      0                                }
 };
 
 // clang-format on
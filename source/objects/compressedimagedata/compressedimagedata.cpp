@@ -1,6 +1,14 @@
 #include "objects/compressedimagedata/compressedimagedata.h"
 #include "common/exception.h"
 
+#if defined(__3DS__)
+    #include "modules/data/datamodule.h"
+    #include "modules/filesystem/filesystem.h"
+    #include "modules/image/imagemodule.h"
+
+    #include "objects/compressedimagedata/transcoder.h"
+#endif
+
 using namespace love;
 
 love::Type CompressedImageData::type("CompressedImageData", &Data::type);
@@ -33,6 +41,10 @@ CompressedImageData::CompressedImageData(const std::list<FormatHandler*>& format
 
     if (this->images.size() == 0 || this->memory->size == 0)
         throw love::Exception("Could not parse compressed data: No valid data?");
+
+#if defined(__3DS__)
+    this->Transcode(fileData);
+#endif
 }
 
 CompressedImageData::CompressedImageData(const CompressedImageData& other) :
@@ -133,3 +145,213 @@ void CompressedImageData::CheckSliceExists(int slice, int mipLevel) const
     if (mipLevel < 0 || mipLevel >= (int)this->images.size())
         throw love::Exception("Mipmap level %d does not exist.", mipLevel + 1);
 }
+
+#if defined(__3DS__)
+static std::string getCacheFilename(Data* fileData)
+{
+    static constexpr char digits[] = "0123456789abcdef";
+
+    std::string hash = data::_Hash(HashFunction::FUNCTION_MD5, fileData);
+    std::string filename(CompressedImageData::CACHE_DIRECTORY);
+
+    filename += '/';
+
+    for (unsigned char byte : hash)
+    {
+        filename += digits[byte >> 4];
+        filename += digits[byte & 0xF];
+    }
+
+    return filename + ".etc";
+}
+
+/*
+** Decoding and encoding every block is too slow to do on each load,
+** so the result is written to the save directory the first time and
+** just copied back in afterwards.
+*/
+void CompressedImageData::Transcode(Data* fileData)
+{
+    if (this->format == PIXELFORMAT_TEX3DS_ETC1 || this->format == PIXELFORMAT_TEX3DS_ETC1A4)
+        return;
+
+    if (!transcoder::CanDecode(this->format))
+    {
+        const char* name = "unknown";
+        ImageModule::GetConstant(this->format, name);
+
+        throw love::Exception("Compressed format '%s' is not supported on this system.", name);
+    }
+
+    std::string filename = getCacheFilename(fileData);
+
+    PixelFormat tiledFormat =
+        transcoder::GetTiledFormat(this->format, this->memory->data, this->memory->size);
+
+    if (this->LoadCache(filename, tiledFormat))
+        return;
+
+    size_t totalSize = 0;
+
+    for (const auto& image : this->images)
+        totalSize += transcoder::GetTiledSize(tiledFormat, image->GetWidth(), image->GetHeight());
+
+    StrongReference<CompressedMemory> tiled(new CompressedMemory(totalSize), Acquire::NORETAIN);
+    std::vector<StrongReference<CompressedSlice>> slices;
+
+    size_t offset = 0;
+
+    for (const auto& image : this->images)
+    {
+        int width  = image->GetWidth();
+        int height = image->GetHeight();
+
+        size_t size = transcoder::GetTiledSize(tiledFormat, width, height);
+
+        transcoder::Transcode(this->format, (const uint8_t*)image->GetData(), width, height,
+                              tiledFormat, tiled->data + offset);
+
+        slices.emplace_back(new CompressedSlice(tiledFormat, width, height, tiled, offset, size),
+                            Acquire::NORETAIN);
+
+        offset += size;
+    }
+
+    this->format = tiledFormat;
+    this->memory = tiled;
+    this->images = std::move(slices);
+
+    /* failing to cache only makes the next load slower */
+    try
+    {
+        this->SaveCache(filename);
+    }
+    catch (love::Exception&)
+    {}
+}
+
+bool CompressedImageData::LoadCache(const std::string& filename, PixelFormat tiledFormat)
+{
+    auto filesystem = Module::GetInstance<Filesystem>(Module::M_FILESYSTEM);
+    Filesystem::Info info {};
+
+    if (filesystem == nullptr || !filesystem->GetInfo(filename.c_str(), info))
+        return false;
+
+    StrongReference<FileData> fileData;
+
+    try
+    {
+        fileData.Set(filesystem->Read(filename.c_str()), Acquire::NORETAIN);
+    }
+    catch (love::Exception&)
+    {
+        return false;
+    }
+
+    const uint8_t* data = (const uint8_t*)fileData->GetData();
+    size_t size         = fileData->GetSize();
+
+    CacheHeader header {};
+
+    if (size < sizeof(header))
+        return false;
+
+    memcpy(&header, data, sizeof(header));
+
+    if (memcmp(header.identifier, CACHE_IDENTIFIER, sizeof(CACHE_IDENTIFIER)) != 0)
+        return false;
+
+    if (header.version != CACHE_VERSION || header.format != (uint32_t)tiledFormat)
+        return false;
+
+    /* the same levels as the file, which also bounds how many are read */
+    if (header.mipmapCount != this->images.size())
+        return false;
+
+    PixelFormat format = tiledFormat;
+    size_t levelsSize  = header.mipmapCount * sizeof(CacheLevel);
+
+    if (size - sizeof(header) < levelsSize)
+        return false;
+
+    std::vector<CacheLevel> levels(header.mipmapCount);
+    memcpy(levels.data(), data + sizeof(header), levelsSize);
+
+    size_t totalSize = 0;
+
+    for (size_t index = 0; index < levels.size(); index++)
+    {
+        const CacheLevel& level = levels[index];
+        const auto& image       = this->images[index];
+
+        if (level.width != (uint32_t)image->GetWidth() ||
+            level.height != (uint32_t)image->GetHeight())
+            return false;
+
+        if (level.size != transcoder::GetTiledSize(format, image->GetWidth(), image->GetHeight()))
+            return false;
+
+        totalSize += level.size;
+    }
+
+    if (size - sizeof(header) - levelsSize != totalSize)
+        return false;
+
+    StrongReference<CompressedMemory> cached(new CompressedMemory(totalSize), Acquire::NORETAIN);
+    memcpy(cached->data, data + sizeof(header) + levelsSize, totalSize);
+
+    std::vector<StrongReference<CompressedSlice>> slices;
+    size_t offset = 0;
+
+    for (const auto& level : levels)
+    {
+        slices.emplace_back(
+            new CompressedSlice(format, level.width, level.height, cached, offset, level.size),
+            Acquire::NORETAIN);
+
+        offset += level.size;
+    }
+
+    this->format = format;
+    this->memory = cached;
+    this->images = std::move(slices);
+
+    return true;
+}
+
+void CompressedImageData::SaveCache(const std::string& filename) const
+{
+    auto filesystem = Module::GetInstance<Filesystem>(Module::M_FILESYSTEM);
+
+    if (filesystem == nullptr)
+        return;
+
+    filesystem->CreateDirectory(CACHE_DIRECTORY);
+
+    CacheHeader header {};
+
+    memcpy(header.identifier, CACHE_IDENTIFIER, sizeof(CACHE_IDENTIFIER));
+    header.version     = CACHE_VERSION;
+    header.format      = this->format;
+    header.mipmapCount = this->images.size();
+
+    std::vector<uint8_t> contents(sizeof(header) + header.mipmapCount * sizeof(CacheLevel));
+    memcpy(contents.data(), &header, sizeof(header));
+
+    uint8_t* levels = contents.data() + sizeof(header);
+
+    for (const auto& image : this->images)
+    {
+        CacheLevel level { (uint32_t)image->GetWidth(), (uint32_t)image->GetHeight(),
+                           (uint32_t)image->GetSize() };
+
+        memcpy(levels, &level, sizeof(level));
+        levels += sizeof(level);
+    }
+
+    contents.insert(contents.end(), this->memory->data, this->memory->data + this->memory->size);
+
+    filesystem->Write(filename.c_str(), contents.data(), contents.size());
+}
+#endif
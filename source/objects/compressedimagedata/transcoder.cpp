@@ -0,0 +1,847 @@
+#include "objects/compressedimagedata/transcoder.h"
+
+#include "common/exception.h"
+#include "common/lmath.h"
+
+#include <algorithm>
+#include <limits>
+#include <string.h>
+
+using namespace love;
+
+namespace
+{
+    // clang-format off
+    /* intensity modifiers, selector 0 and 1 add a and b, 2 and 3 subtract them */
+    constexpr int etc1Modifiers[8][2] =
+    {
+        { 2,  8   }, { 5,  17  }, { 9,  29  }, { 13, 42  },
+        { 18, 60  }, { 24, 80  }, { 33, 106 }, { 47, 183 }
+    };
+
+    /* T and H mode distances */
+    constexpr int etc2Distances[8] = { 3, 6, 11, 16, 23, 32, 41, 64 };
+
+    constexpr int eacModifiers[16][8] =
+    {
+        { -3, -6, -9,  -15, 2, 5, 8, 14 }, { -3, -7, -10, -13, 2, 6, 9, 12 },
+        { -2, -5, -8,  -13, 1, 4, 7, 12 }, { -2, -4, -6,  -13, 1, 3, 5, 12 },
+        { -3, -6, -8,  -12, 2, 5, 7, 11 }, { -3, -7, -9,  -11, 2, 6, 8, 10 },
+        { -4, -7, -8,  -11, 3, 6, 7, 10 }, { -3, -5, -8,  -11, 2, 4, 7, 10 },
+        { -2, -6, -8,  -10, 1, 5, 7, 9  }, { -2, -5, -8,  -10, 1, 4, 7, 9  },
+        { -2, -4, -8,  -10, 1, 3, 7, 9  }, { -2, -5, -7,  -10, 1, 4, 6, 9  },
+        { -3, -4, -7,  -10, 2, 3, 6, 9  }, { -1, -2, -3,  -10, 0, 1, 2, 9  },
+        { -4, -6, -8,  -9,  3, 5, 7, 8  }, { -3, -5, -7,  -9,  2, 4, 6, 8  }
+    };
+    // clang-format on
+
+    constexpr int BLOCK_PIXELS = transcoder::BLOCK_SIZE * transcoder::BLOCK_SIZE;
+
+    /* 3DS ETC1 blocks, four 4x4 blocks make one 8x8 tile */
+    constexpr size_t ETC1_BYTES = 8;
+    constexpr int TILE_SIZE     = 8;
+
+    inline uint8_t clamp8(int value)
+    {
+        return uint8_t(std::clamp(value, 0, 0xFF));
+    }
+
+    inline int expand4(int value)
+    {
+        return (value << 4) | value;
+    }
+
+    inline int expand5(int value)
+    {
+        return (value << 3) | (value >> 2);
+    }
+
+    inline int expand6(int value)
+    {
+        return (value << 2) | (value >> 4);
+    }
+
+    inline int expand7(int value)
+    {
+        return (value << 1) | (value >> 6);
+    }
+
+    /* 3 bit two's complement */
+    inline int signExtend3(int value)
+    {
+        return (value & 4) ? value - 8 : value;
+    }
+
+    inline uint64_t readBigEndian64(const uint8_t* in)
+    {
+        uint64_t value = 0;
+
+        for (int index = 0; index < 8; index++)
+            value = (value << 8) | in[index];
+
+        return value;
+    }
+
+    inline uint64_t readLittleEndian64(const uint8_t* in)
+    {
+        uint64_t value = 0;
+
+        for (int index = 7; index >= 0; index--)
+            value = (value << 8) | in[index];
+
+        return value;
+    }
+
+    inline void writeLittleEndian64(uint64_t value, uint8_t* out)
+    {
+        for (int index = 0; index < 8; index++, value >>= 8)
+            out[index] = uint8_t(value);
+    }
+
+    inline void setPixel(uint8_t* pixels, int x, int y, int r, int g, int b, int a)
+    {
+        uint8_t* pixel = pixels + (y * transcoder::BLOCK_SIZE + x) * 4;
+
+        pixel[0] = clamp8(r);
+        pixel[1] = clamp8(g);
+        pixel[2] = clamp8(b);
+        pixel[3] = clamp8(a);
+    }
+
+    /* ETC selectors are stored column by column, msb and lsb in separate halves */
+    inline int getSelector(uint32_t low, int x, int y)
+    {
+        int index = x * transcoder::BLOCK_SIZE + y;
+        return (((low >> (16 + index)) & 1) << 1) | ((low >> index) & 1);
+    }
+
+    enum ETCMode
+    {
+        ETC_INDIVIDUAL,
+        ETC_DIFFERENTIAL,
+        ETC_T,
+        ETC_H,
+        ETC_PLANAR
+    };
+
+    /* ETC2 hides its extra modes in differential blocks whose second color overflows */
+    ETCMode getETCMode(uint64_t bits, bool punchthrough)
+    {
+        uint32_t high = uint32_t(bits >> 32);
+
+        if (!punchthrough && !(high & 2))
+            return ETC_INDIVIDUAL;
+
+        int r = ((high >> 27) & 0x1F) + signExtend3((high >> 24) & 7);
+        int g = ((high >> 19) & 0x1F) + signExtend3((high >> 16) & 7);
+        int b = ((high >> 11) & 0x1F) + signExtend3((high >> 8) & 7);
+
+        if (r < 0 || r > 0x1F)
+            return ETC_T;
+        else if (g < 0 || g > 0x1F)
+            return ETC_H;
+        else if (b < 0 || b > 0x1F)
+            return ETC_PLANAR;
+
+        return ETC_DIFFERENTIAL;
+    }
+
+    void decodeETCPlanar(uint64_t bits, uint8_t* pixels)
+    {
+        int ro = expand6((bits >> 57) & 0x3F);
+        int go = expand7((((bits >> 56) & 1) << 6) | ((bits >> 49) & 0x3F));
+        int bo = expand6((((bits >> 48) & 1) << 5) | (((bits >> 43) & 3) << 3) |
+                         ((bits >> 39) & 7));
+
+        int rh = expand6((((bits >> 34) & 0x1F) << 1) | ((bits >> 32) & 1));
+        int gh = expand7((bits >> 25) & 0x7F);
+        int bh = expand6((bits >> 19) & 0x3F);
+
+        int rv = expand6((bits >> 13) & 0x3F);
+        int gv = expand7((bits >> 6) & 0x7F);
+        int bv = expand6(bits & 0x3F);
+
+        for (int y = 0; y < transcoder::BLOCK_SIZE; y++)
+        {
+            for (int x = 0; x < transcoder::BLOCK_SIZE; x++)
+            {
+                int r = (x * (rh - ro) + y * (rv - ro) + 4 * ro + 2) >> 2;
+                int g = (x * (gh - go) + y * (gv - go) + 4 * go + 2) >> 2;
+                int b = (x * (bh - bo) + y * (bv - bo) + 4 * bo + 2) >> 2;
+
+                setPixel(pixels, x, y, r, g, b, 0xFF);
+            }
+        }
+    }
+
+    /* T and H blocks pick one of four paint colors per pixel */
+    void decodeETCPaint(uint64_t bits, ETCMode mode, bool opaque, uint8_t* pixels)
+    {
+        uint32_t high = uint32_t(bits >> 32);
+        uint32_t low  = uint32_t(bits);
+
+        int first[3], second[3];
+        int distance = 0;
+
+        if (mode == ETC_T)
+        {
+            first[0] = (((high >> 27) & 3) << 2) | ((high >> 24) & 3);
+            first[1] = (high >> 20) & 0xF;
+            first[2] = (high >> 16) & 0xF;
+
+            second[0] = (high >> 12) & 0xF;
+            second[1] = (high >> 8) & 0xF;
+            second[2] = (high >> 4) & 0xF;
+
+            distance = etc2Distances[(((high >> 2) & 3) << 1) | (high & 1)];
+        }
+        else
+        {
+            first[0] = (high >> 27) & 0xF;
+            first[1] = (((high >> 24) & 7) << 1) | ((high >> 20) & 1);
+            first[2] = (((high >> 19) & 1) << 3) | ((high >> 15) & 7);
+
+            second[0] = (high >> 11) & 0xF;
+            second[1] = (high >> 7) & 0xF;
+            second[2] = (high >> 3) & 0xF;
+
+            int firstValue  = (first[0] << 8) | (first[1] << 4) | first[2];
+            int secondValue = (second[0] << 8) | (second[1] << 4) | second[2];
+
+            int index = (((high >> 2) & 1) << 2) | ((high & 1) << 1);
+            distance  = etc2Distances[index | (firstValue >= secondValue ? 1 : 0)];
+        }
+
+        int paints[4][3];
+
+        for (int channel = 0; channel < 3; channel++)
+        {
+            int a = expand4(first[channel]);
+            int b = expand4(second[channel]);
+
+            if (mode == ETC_T)
+            {
+                paints[0][channel] = a;
+                paints[1][channel] = b + distance;
+                paints[2][channel] = b;
+                paints[3][channel] = b - distance;
+            }
+            else
+            {
+                paints[0][channel] = a + distance;
+                paints[1][channel] = a - distance;
+                paints[2][channel] = b + distance;
+                paints[3][channel] = b - distance;
+            }
+        }
+
+        for (int y = 0; y < transcoder::BLOCK_SIZE; y++)
+        {
+            for (int x = 0; x < transcoder::BLOCK_SIZE; x++)
+            {
+                int selector = getSelector(low, x, y);
+
+                if (!opaque && selector == 2)
+                    setPixel(pixels, x, y, 0, 0, 0, 0);
+                else
+                {
+                    const int* paint = paints[selector];
+                    setPixel(pixels, x, y, paint[0], paint[1], paint[2], 0xFF);
+                }
+            }
+        }
+    }
+
+    /*
+    ** Any ETC1 or ETC2 color block. With @punchthrough (ETC2 RGBA1) the
+    ** differential bit says whether the block is opaque instead.
+    */
+    void decodeETC(const uint8_t* block, bool punchthrough, uint8_t* pixels)
+    {
+        uint64_t bits = readBigEndian64(block);
+
+        uint32_t high = uint32_t(bits >> 32);
+        uint32_t low  = uint32_t(bits);
+
+        ETCMode mode = getETCMode(bits, punchthrough);
+        bool opaque  = !punchthrough || (high & 2);
+
+        if (mode == ETC_PLANAR)
+            return decodeETCPlanar(bits, pixels);
+        else if (mode == ETC_T || mode == ETC_H)
+            return decodeETCPaint(bits, mode, opaque, pixels);
+
+        int bases[2][3];
+
+        if (mode == ETC_INDIVIDUAL)
+        {
+            for (int channel = 0; channel < 3; channel++)
+            {
+                int shift = 28 - channel * 8;
+
+                bases[0][channel] = expand4((high >> shift) & 0xF);
+                bases[1][channel] = expand4((high >> (shift - 4)) & 0xF);
+            }
+        }
+        else
+        {
+            for (int channel = 0; channel < 3; channel++)
+            {
+                int shift = 27 - channel * 8;
+                int base  = (high >> shift) & 0x1F;
+
+                bases[0][channel] = expand5(base);
+                bases[1][channel] = expand5(base + signExtend3((high >> (shift - 3)) & 7));
+            }
+        }
+
+        const int tables[2] = { int((high >> 5) & 7), int((high >> 2) & 7) };
+        bool flip           = (high & 1);
+
+        for (int y = 0; y < transcoder::BLOCK_SIZE; y++)
+        {
+            for (int x = 0; x < transcoder::BLOCK_SIZE; x++)
+            {
+                int subblock = flip ? (y >= 2) : (x >= 2);
+                int selector = getSelector(low, x, y);
+
+                if (!opaque && selector == 2)
+                {
+                    setPixel(pixels, x, y, 0, 0, 0, 0);
+                    continue;
+                }
+
+                int modifier = etc1Modifiers[tables[subblock]][selector & 1];
+
+                if (selector & 2)
+                    modifier = -modifier;
+                else if (!opaque && selector == 0)
+                    modifier = 0;
+
+                const int* base = bases[subblock];
+                setPixel(pixels, x, y, base[0] + modifier, base[1] + modifier, base[2] + modifier,
+                         0xFF);
+            }
+        }
+    }
+
+    /* ETC2 RGBA alpha, stored column by column like the colors */
+    void decodeEAC(const uint8_t* block, uint8_t* pixels)
+    {
+        uint64_t bits = readBigEndian64(block);
+
+        int base       = block[0];
+        int multiplier = block[1] >> 4;
+
+        const int* modifiers = eacModifiers[block[1] & 0xF];
+
+        for (int x = 0; x < transcoder::BLOCK_SIZE; x++)
+        {
+            for (int y = 0; y < transcoder::BLOCK_SIZE; y++)
+            {
+                int index    = x * transcoder::BLOCK_SIZE + y;
+                int selector = (bits >> (45 - 3 * index)) & 7;
+
+                pixels[(y * transcoder::BLOCK_SIZE + x) * 4 + 3] =
+                    clamp8(base + modifiers[selector] * multiplier);
+            }
+        }
+    }
+
+    void decodeRGB565(uint16_t color, int* out)
+    {
+        out[0] = expand5((color >> 11) & 0x1F);
+        out[1] = expand6((color >> 5) & 0x3F);
+        out[2] = expand5(color & 0x1F);
+        out[3] = 0xFF;
+    }
+
+    /* S3TC colors, @fourColors is forced for DXT3 and DXT5 */
+    void decodeDXTColor(const uint8_t* block, bool fourColors, uint8_t* pixels)
+    {
+        uint16_t color0 = block[0] | (block[1] << 8);
+        uint16_t color1 = block[2] | (block[3] << 8);
+
+        uint32_t selectors = block[4] | (block[5] << 8) | (block[6] << 16) | (block[7] << 24);
+
+        int colors[4][4];
+
+        decodeRGB565(color0, colors[0]);
+        decodeRGB565(color1, colors[1]);
+
+        for (int channel = 0; channel < 3; channel++)
+        {
+            int a = colors[0][channel];
+            int b = colors[1][channel];
+
+            if (fourColors || color0 > color1)
+            {
+                colors[2][channel] = (2 * a + b) / 3;
+                colors[3][channel] = (a + 2 * b) / 3;
+            }
+            else
+            {
+                colors[2][channel] = (a + b) / 2;
+                colors[3][channel] = 0;
+            }
+        }
+
+        colors[2][3] = 0xFF;
+        colors[3][3] = (fourColors || color0 > color1) ? 0xFF : 0;
+
+        for (int index = 0; index < BLOCK_PIXELS; index++, selectors >>= 2)
+        {
+            const int* color = colors[selectors & 3];
+            uint8_t* pixel   = pixels + index * 4;
+
+            for (int channel = 0; channel < 4; channel++)
+                pixel[channel] = uint8_t(color[channel]);
+        }
+    }
+
+    void decodeDXT3Alpha(const uint8_t* block, uint8_t* pixels)
+    {
+        for (int index = 0; index < BLOCK_PIXELS; index++)
+        {
+            int alpha = (block[index / 2] >> ((index & 1) * 4)) & 0xF;
+            pixels[index * 4 + 3] = uint8_t(expand4(alpha));
+        }
+    }
+
+    void decodeDXT5Alpha(const uint8_t* block, uint8_t* pixels)
+    {
+        int alphas[8] = { block[0], block[1] };
+
+        if (alphas[0] > alphas[1])
+        {
+            for (int index = 1; index < 7; index++)
+                alphas[index + 1] = ((7 - index) * alphas[0] + index * alphas[1]) / 7;
+        }
+        else
+        {
+            for (int index = 1; index < 5; index++)
+                alphas[index + 1] = ((5 - index) * alphas[0] + index * alphas[1]) / 5;
+
+            alphas[6] = 0;
+            alphas[7] = 0xFF;
+        }
+
+        uint64_t selectors = readLittleEndian64(block) >> 16;
+
+        for (int index = 0; index < BLOCK_PIXELS; index++, selectors >>= 3)
+            pixels[index * 4 + 3] = uint8_t(alphas[selectors & 7]);
+    }
+
+    /* the color block can be copied over when it only uses ETC1 modes */
+    bool isETC1Compatible(PixelFormat format, const uint8_t* color)
+    {
+        switch (format)
+        {
+            case PIXELFORMAT_ETC1:
+                return true;
+            case PIXELFORMAT_ETC2_RGB:
+            case PIXELFORMAT_ETC2_RGBA:
+                return getETCMode(readBigEndian64(color), false) <= ETC_DIFFERENTIAL;
+            case PIXELFORMAT_ETC2_RGBA1:
+            {
+                uint64_t bits = readBigEndian64(color);
+                return (bits & (uint64_t(2) << 32)) && getETCMode(bits, true) == ETC_DIFFERENTIAL;
+            }
+            default:
+                return false;
+        }
+    }
+
+    /* ETC2 RGBA keeps its alpha block in front of the color block */
+    const uint8_t* getColorBlock(PixelFormat format, const uint8_t* block)
+    {
+        return (format == PIXELFORMAT_ETC2_RGBA) ? block + 8 : block;
+    }
+
+    inline int quantize(int value, int maximum)
+    {
+        return (value * maximum + 127) / 255;
+    }
+
+    /* 4 bit alpha, column by column */
+    uint64_t packAlpha(const uint8_t* pixels)
+    {
+        uint64_t alpha = 0;
+
+        for (int y = 0; y < transcoder::BLOCK_SIZE; y++)
+        {
+            for (int x = 0; x < transcoder::BLOCK_SIZE; x++)
+            {
+                int value = pixels[(y * transcoder::BLOCK_SIZE + x) * 4 + 3];
+                alpha |= uint64_t(quantize(value, 0xF)) << (4 * (x * transcoder::BLOCK_SIZE + y));
+            }
+        }
+
+        return alpha;
+    }
+
+    /* the fitted table and selectors of one half of an ETC1 block */
+    struct SubblockFit
+    {
+        uint32_t error;
+        int table;
+        uint8_t selectors[BLOCK_PIXELS / 2];
+    };
+
+    inline uint32_t colorError(const uint8_t* pixel, const int* base, int modifier)
+    {
+        uint32_t error = 0;
+
+        for (int channel = 0; channel < 3; channel++)
+        {
+            int difference = clamp8(base[channel] + modifier) - pixel[channel];
+            error += difference * difference;
+        }
+
+        return error;
+    }
+
+    /* try every table and keep the one with the least error */
+    SubblockFit fitSubblock(const uint8_t* pixels, const int* indices, const int* base)
+    {
+        SubblockFit best {};
+        best.error = std::numeric_limits<uint32_t>::max();
+
+        for (int table = 0; table < 8; table++)
+        {
+            SubblockFit fit {};
+            fit.table = table;
+
+            for (int pixel = 0; pixel < BLOCK_PIXELS / 2 && fit.error < best.error; pixel++)
+            {
+                const uint8_t* color = pixels + indices[pixel] * 4;
+                uint32_t closest     = std::numeric_limits<uint32_t>::max();
+
+                for (int selector = 0; selector < 4; selector++)
+                {
+                    int modifier = etc1Modifiers[table][selector & 1];
+                    if (selector & 2)
+                        modifier = -modifier;
+
+                    uint32_t error = colorError(color, base, modifier);
+
+                    if (error < closest)
+                    {
+                        closest              = error;
+                        fit.selectors[pixel] = uint8_t(selector);
+                    }
+                }
+
+                fit.error += closest;
+            }
+
+            if (fit.error < best.error)
+                best = fit;
+        }
+
+        return best;
+    }
+
+    /* pixel numbers (row major) of the two halves of a block */
+    void getSubblockIndices(bool flip, int indices[2][BLOCK_PIXELS / 2])
+    {
+        int counts[2] = { 0, 0 };
+
+        for (int y = 0; y < transcoder::BLOCK_SIZE; y++)
+        {
+            for (int x = 0; x < transcoder::BLOCK_SIZE; x++)
+            {
+                int subblock = flip ? (y >= 2) : (x >= 2);
+                indices[subblock][counts[subblock]++] = y * transcoder::BLOCK_SIZE + x;
+            }
+        }
+    }
+} // namespace
+
+bool transcoder::CanDecode(PixelFormat format)
+{
+    switch (format)
+    {
+        case PIXELFORMAT_ETC1:
+        case PIXELFORMAT_ETC2_RGB:
+        case PIXELFORMAT_ETC2_RGBA:
+        case PIXELFORMAT_ETC2_RGBA1:
+        case PIXELFORMAT_DXT1:
+        case PIXELFORMAT_DXT3:
+        case PIXELFORMAT_DXT5:
+            return true;
+        default:
+            return false;
+    }
+}
+
+size_t transcoder::GetBlockBytes(PixelFormat format)
+{
+    switch (format)
+    {
+        case PIXELFORMAT_ETC2_RGBA:
+        case PIXELFORMAT_DXT3:
+        case PIXELFORMAT_DXT5:
+        case PIXELFORMAT_TEX3DS_ETC1A4:
+            return 16;
+        default:
+            return 8;
+    }
+}
+
+void transcoder::DecodeBlock(PixelFormat format, const uint8_t* block, uint8_t* pixels)
+{
+    switch (format)
+    {
+        case PIXELFORMAT_ETC1:
+        case PIXELFORMAT_ETC2_RGB:
+            decodeETC(block, false, pixels);
+            break;
+        case PIXELFORMAT_ETC2_RGBA:
+            decodeETC(block + 8, false, pixels);
+            decodeEAC(block, pixels);
+            break;
+        case PIXELFORMAT_ETC2_RGBA1:
+            decodeETC(block, true, pixels);
+            break;
+        case PIXELFORMAT_DXT1:
+            decodeDXTColor(block, false, pixels);
+            break;
+        case PIXELFORMAT_DXT3:
+            decodeDXTColor(block + 8, true, pixels);
+            decodeDXT3Alpha(block, pixels);
+            break;
+        case PIXELFORMAT_DXT5:
+            decodeDXTColor(block + 8, true, pixels);
+            decodeDXT5Alpha(block, pixels);
+            break;
+        default:
+            throw love::Exception("Cannot decode compressed pixel format %d.", format);
+    }
+}
+
+/*
+** Fast rather than exhaustive: for both flips, the halves get their
+** average color (differential when the two fit, individual otherwise)
+** and the best table per half.
+*/
+uint64_t transcoder::EncodeETC1(const uint8_t* pixels)
+{
+    uint64_t best       = 0;
+    uint32_t leastError = std::numeric_limits<uint32_t>::max();
+
+    for (int flip = 0; flip < 2; flip++)
+    {
+        int indices[2][BLOCK_PIXELS / 2];
+        getSubblockIndices(flip, indices);
+
+        int averages[2][3];
+
+        for (int subblock = 0; subblock < 2; subblock++)
+        {
+            for (int channel = 0; channel < 3; channel++)
+            {
+                int sum = 0;
+
+                for (int pixel = 0; pixel < BLOCK_PIXELS / 2; pixel++)
+                    sum += pixels[indices[subblock][pixel] * 4 + channel];
+
+                averages[subblock][channel] = (sum + 4) / 8;
+            }
+        }
+
+        int quantized[2][3];
+        bool differential = true;
+
+        for (int channel = 0; channel < 3; channel++)
+        {
+            quantized[0][channel] = quantize(averages[0][channel], 0x1F);
+            quantized[1][channel] = quantize(averages[1][channel], 0x1F);
+
+            int delta = quantized[1][channel] - quantized[0][channel];
+            if (delta < -4 || delta > 3)
+                differential = false;
+        }
+
+        int bases[2][3];
+        uint32_t high = (flip ? 1 : 0);
+
+        for (int channel = 0; channel < 3; channel++)
+        {
+            if (differential)
+            {
+                int delta = quantized[1][channel] - quantized[0][channel];
+
+                bases[0][channel] = expand5(quantized[0][channel]);
+                bases[1][channel] = expand5(quantized[1][channel]);
+
+                high |= quantized[0][channel] << (27 - channel * 8);
+                high |= (delta & 7) << (24 - channel * 8);
+            }
+            else
+            {
+                int first  = quantize(averages[0][channel], 0xF);
+                int second = quantize(averages[1][channel], 0xF);
+
+                bases[0][channel] = expand4(first);
+                bases[1][channel] = expand4(second);
+
+                high |= first << (28 - channel * 8);
+                high |= second << (24 - channel * 8);
+            }
+        }
+
+        if (differential)
+            high |= 2;
+
+        SubblockFit fits[2];
+        uint32_t error = 0;
+
+        for (int subblock = 0; subblock < 2; subblock++)
+        {
+            fits[subblock] = fitSubblock(pixels, indices[subblock], bases[subblock]);
+            error += fits[subblock].error;
+        }
+
+        if (error >= leastError)
+            continue;
+
+        high |= (fits[0].table << 5) | (fits[1].table << 2);
+        uint32_t low = 0;
+
+        for (int subblock = 0; subblock < 2; subblock++)
+        {
+            for (int pixel = 0; pixel < BLOCK_PIXELS / 2; pixel++)
+            {
+                int x = indices[subblock][pixel] % BLOCK_SIZE;
+                int y = indices[subblock][pixel] / BLOCK_SIZE;
+
+                int index    = x * BLOCK_SIZE + y;
+                int selector = fits[subblock].selectors[pixel];
+
+                low |= uint32_t(selector >> 1) << (16 + index);
+                low |= uint32_t(selector & 1) << index;
+            }
+        }
+
+        best       = (uint64_t(high) << 32) | low;
+        leastError = error;
+    }
+
+    return best;
+}
+
+PixelFormat transcoder::GetTiledFormat(PixelFormat format, const uint8_t* data, size_t size)
+{
+    switch (format)
+    {
+        case PIXELFORMAT_ETC1:
+        case PIXELFORMAT_ETC2_RGB:
+            return PIXELFORMAT_TEX3DS_ETC1;
+        case PIXELFORMAT_ETC2_RGBA:
+        case PIXELFORMAT_ETC2_RGBA1:
+        case PIXELFORMAT_DXT3:
+        case PIXELFORMAT_DXT5:
+            return PIXELFORMAT_TEX3DS_ETC1A4;
+        case PIXELFORMAT_DXT1:
+        {
+            /* only blocks in three color mode can have transparent pixels */
+            for (size_t offset = 0; offset + 8 <= size; offset += 8)
+            {
+                const uint8_t* block = data + offset;
+
+                uint16_t color0 = block[0] | (block[1] << 8);
+                uint16_t color1 = block[2] | (block[3] << 8);
+
+                if (color0 > color1)
+                    continue;
+
+                for (int index = 4; index < 8; index++)
+                {
+                    for (int shift = 0; shift < 8; shift += 2)
+                    {
+                        if (((block[index] >> shift) & 3) == 3)
+                            return PIXELFORMAT_TEX3DS_ETC1A4;
+                    }
+                }
+            }
+
+            return PIXELFORMAT_TEX3DS_ETC1;
+        }
+        default:
+            return PIXELFORMAT_UNKNOWN;
+    }
+}
+
+static int getPaddedSize(int size)
+{
+    return std::max(TILE_SIZE, NextPO2(size));
+}
+
+size_t transcoder::GetTiledSize(PixelFormat tiledFormat, int width, int height)
+{
+    size_t blocks = (getPaddedSize(width) / BLOCK_SIZE) * (getPaddedSize(height) / BLOCK_SIZE);
+    return blocks * GetBlockBytes(tiledFormat);
+}
+
+void transcoder::Transcode(PixelFormat format, const uint8_t* data, int width, int height,
+                           PixelFormat tiledFormat, uint8_t* output)
+{
+    if (!CanDecode(format))
+        throw love::Exception("Cannot transcode compressed pixel format %d.", format);
+
+    bool hasAlpha = (tiledFormat == PIXELFORMAT_TEX3DS_ETC1A4);
+
+    size_t sourceBytes = GetBlockBytes(format);
+    size_t targetBytes = GetBlockBytes(tiledFormat);
+
+    int sourceColumns = (width + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    int sourceRows    = (height + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+    int columns = getPaddedSize(width) / BLOCK_SIZE;
+    int rows    = getPaddedSize(height) / BLOCK_SIZE;
+
+    /* two blocks across per tile */
+    int tilesPerRow = columns / 2;
+
+    uint8_t pixels[BLOCK_PIXELS * 4];
+
+    for (int row = 0; row < rows; row++)
+    {
+        for (int column = 0; column < columns; column++)
+        {
+            int tile     = (row / 2) * tilesPerRow + (column / 2);
+            int subblock = (column & 1) + ((row & 1) << 1);
+
+            uint8_t* target = output + (tile * 4 + subblock) * targetBytes;
+
+            if (column >= sourceColumns || row >= sourceRows)
+            {
+                memset(target, 0, targetBytes);
+                continue;
+            }
+
+            const uint8_t* block = data + (row * sourceColumns + column) * sourceBytes;
+            const uint8_t* color = getColorBlock(format, block);
+
+            bool repack = isETC1Compatible(format, color);
+            uint64_t etc1;
+
+            if (!repack || hasAlpha)
+                DecodeBlock(format, block, pixels);
+
+            if (repack)
+                etc1 = readBigEndian64(color);
+            else
+                etc1 = EncodeETC1(pixels);
+
+            if (hasAlpha)
+            {
+                writeLittleEndian64(packAlpha(pixels), target);
+                target += ETC1_BYTES;
+            }
+
+            writeLittleEndian64(etc1, target);
+        }
+    }
+}
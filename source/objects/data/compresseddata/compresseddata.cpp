@@ -1,9 +1,13 @@
 #include "objects/data/compressed/compresseddata.h"
 
+#include <atomic>
+
 using namespace love;
 
 love::Type CompressedData::type("CompressedData", &Data::type);
 
+static std::atomic<int64_t> totalBytes(0);
+
 CompressedData::CompressedData(Compressor::Format format, char* cdata, size_t compressedSize,
                                size_t rawSize, bool own) :
     format(format),
@@ -26,6 +30,8 @@ CompressedData::CompressedData(Compressor::Format format, char* cdata, size_t co
 
         memcpy(this->data, cdata, this->dataSize);
     }
+
+    totalBytes += this->dataSize;
 }
 
 CompressedData::CompressedData(const CompressedData& other) :
@@ -44,11 +50,18 @@ CompressedData::CompressedData(const CompressedData& other) :
     }
 
     memcpy(this->data, other.data, this->dataSize);
+    totalBytes += this->dataSize;
 }
 
 CompressedData::~CompressedData()
 {
     delete[] this->data;
+    totalBytes -= this->dataSize;
+}
+
+int64_t CompressedData::GetTotalBytes()
+{
+    return totalBytes;
 }
 
 CompressedData* CompressedData::Clone() const
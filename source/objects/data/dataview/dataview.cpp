@@ -32,6 +32,11 @@ void* DataView::GetData() const
     return (uint8_t*)this->data->GetData() + offset;
 }
 
+const void* DataView::ReadData() const
+{
+    return (const uint8_t*)this->data->ReadData() + offset;
+}
+
 size_t DataView::GetSize() const
 {
     return this->size;
@@ -24,7 +24,7 @@ int Wrap_Data::GetString(lua_State* L)
 {
     Data* self = Wrap_Data::CheckData(L, 1);
 
-    lua_pushlstring(L, (const char*)self->GetData(), self->GetSize());
+    lua_pushlstring(L, (const char*)self->ReadData(), self->GetSize());
 
     return 1;
 }
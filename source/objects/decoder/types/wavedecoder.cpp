@@ -2,6 +2,8 @@
     #include <3ds/types.h>
 #elif defined(__SWITCH__)
     #include <switch/types.h>
+#elif defined(__HOST__)
+    #include "host.h"
 #endif
 
 #include "wavedecoder.h"
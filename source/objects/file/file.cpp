@@ -1,7 +1,11 @@
 #include "objects/file/file.h"
 #include "common/bidirectionalmap.h"
+
+#include "modules/filesystem/entrycache.h"
 #include <sys/stat.h>
 
+#include <algorithm>
+
 using namespace love;
 
 extern bool SetupWriteDirectory();
@@ -12,6 +16,7 @@ File::File(const std::string& filename) :
     filename(filename),
     file(nullptr),
     mode(MODE_CLOSED),
+    cachedPosition(0),
     bufferMode(BUFFER_NONE),
     bufferSize(0)
 {}
@@ -24,6 +29,14 @@ File::~File()
 
 bool File::Close()
 {
+    if (this->cached)
+    {
+        this->cached.Set(nullptr);
+        this->mode = MODE_CLOSED;
+
+        return true;
+    }
+
     if (this->file == nullptr || !PHYSFS_close(file))
         return false;
 
@@ -60,6 +73,9 @@ File::Mode File::GetMode()
 
 int64_t File::GetSize()
 {
+    if (this->cached)
+        return (int64_t)this->cached->GetSize();
+
     if (this->file == nullptr)
     {
         this->Open(MODE_READ);
@@ -73,12 +89,15 @@ int64_t File::GetSize()
 
 bool File::IsEOF()
 {
+    if (this->cached)
+        return this->cachedPosition >= (int64_t)this->cached->GetSize();
+
     return PHYSFS_eof(file);
 }
 
 bool File::IsOpen()
 {
-    return (this->mode != MODE_CLOSED && this->file != nullptr);
+    return (this->mode != MODE_CLOSED && (this->file != nullptr || this->cached));
 }
 
 bool File::Open(File::Mode openMode)
@@ -96,9 +115,17 @@ bool File::Open(File::Mode openMode)
         !SetupWriteDirectory())
         throw love::Exception("Could not set write directory.");
 
-    if (this->file != nullptr)
+    if (this->file != nullptr || this->cached)
         return false;
 
+    if (openMode == MODE_READ && EntryCache::Instance().Get(this->filename, this->cached))
+    {
+        this->mode           = MODE_READ;
+        this->cachedPosition = 0;
+
+        return true;
+    }
+
     PHYSFS_getLastErrorCode();
     PHYSFS_File* handle = nullptr;
 
@@ -141,7 +168,7 @@ bool File::Open(File::Mode openMode)
 
 int64_t File::Read(void* destination, int64_t size)
 {
-    if (!this->file || this->mode != MODE_READ)
+    if (!this->IsOpen() || this->mode != MODE_READ)
         throw love::Exception("File is not opened for reading.");
 
     long selfSize = this->GetSize();
@@ -152,6 +179,18 @@ int64_t File::Read(void* destination, int64_t size)
     if (size < 0)
         throw love::Exception("Invalid read size.");
 
+    if (this->cached)
+    {
+        size = std::min(size, selfSize - this->cachedPosition);
+
+        const char* source = (const char*)this->cached->GetData() + this->cachedPosition;
+        memcpy(destination, source, (size_t)size);
+
+        this->cachedPosition += size;
+
+        return size;
+    }
+
     return PHYSFS_readBytes(this->file, destination, (PHYSFS_uint64)size);
 }
 
@@ -203,6 +242,16 @@ FileData* File::Read(int64_t size)
 
 bool File::Seek(u_int64_t position)
 {
+    if (this->cached)
+    {
+        if (position > this->cached->GetSize())
+            return false;
+
+        this->cachedPosition = (int64_t)position;
+
+        return true;
+    }
+
     return this->file != nullptr && PHYSFS_seek(this->file, (PHYSFS_uint64)position) != 0;
 }
 
@@ -211,7 +260,8 @@ bool File::SetBuffer(BufferMode mode, int64_t size)
     if (size < 0)
         return false;
 
-    if (!this->IsOpen())
+    /* nothing to buffer when the whole entry is already in memory */
+    if (!this->IsOpen() || this->cached)
     {
         this->bufferMode = mode;
         this->bufferSize = size;
@@ -244,6 +294,9 @@ bool File::SetBuffer(BufferMode mode, int64_t size)
 
 int64_t File::Tell()
 {
+    if (this->cached)
+        return this->cachedPosition;
+
     if (!this->file)
         return -1;
 
@@ -252,7 +305,7 @@ int64_t File::Tell()
 
 bool File::Write(Data* data, int64_t size)
 {
-    return this->Write(data->GetData(), (size == ALL) ? data->GetSize() : size);
+    return this->Write(data->ReadData(), (size == ALL) ? data->GetSize() : size);
 }
 
 bool File::Write(const void* data, int64_t size)
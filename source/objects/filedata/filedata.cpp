@@ -1,9 +1,13 @@
 #include "objects/filedata/filedata.h"
 
+#include <atomic>
+
 using namespace love;
 
 love::Type FileData::type("FileData", &Data::type);
 
+static std::atomic<int64_t> totalBytes(0);
+
 FileData::FileData(uint64_t size, const std::string& filename) :
     data(nullptr),
     size((size_t)size),
@@ -18,6 +22,8 @@ FileData::FileData(uint64_t size, const std::string& filename) :
         throw love::Exception("Out of memory.");
     }
 
+    totalBytes += this->size;
+
     size_t extPos = filename.rfind('.');
 
     if (extPos != std::string::npos)
@@ -46,11 +52,18 @@ FileData::FileData(const FileData& content) :
     }
 
     memcpy(this->data, content.data, this->size);
+    totalBytes += this->size;
 }
 
 FileData::~FileData()
 {
     delete[] this->data;
+    totalBytes -= this->size;
+}
+
+int64_t FileData::GetTotalBytes()
+{
+    return totalBytes;
 }
 
 FileData* FileData::Clone() const
@@ -0,0 +1,80 @@
+#include "objects/future/future.h"
+
+#include "modules/timer/timer.h"
+
+using namespace love;
+
+love::Type Future::type("Future", &Object::type);
+
+Future::Future() : done(false)
+{}
+
+Future::~Future()
+{}
+
+void Future::Finish()
+{
+    this->done = true;
+    this->condition->Broadcast();
+}
+
+void Future::SetResults(std::vector<Variant>&& results)
+{
+    thread::Lock lock(this->mutex);
+
+    this->results = std::move(results);
+    this->Finish();
+}
+
+void Future::SetError(const std::string& error)
+{
+    thread::Lock lock(this->mutex);
+
+    this->error = error;
+    this->Finish();
+}
+
+bool Future::IsDone() const
+{
+    thread::Lock lock(this->mutex);
+
+    return this->done;
+}
+
+bool Future::Wait(double timeout)
+{
+    thread::Lock lock(this->mutex);
+
+    if (timeout < 0)
+    {
+        while (!this->done)
+            this->condition->Wait(this->mutex);
+
+        return true;
+    }
+
+    while (!this->done && timeout > 0)
+    {
+        double start = love::Timer::GetTime();
+        this->condition->Wait(this->mutex, (s64)(timeout * 1000000000.0));
+        double stop = love::Timer::GetTime();
+
+        timeout -= (stop - start);
+    }
+
+    return this->done;
+}
+
+std::vector<Variant> Future::GetResults() const
+{
+    thread::Lock lock(this->mutex);
+
+    return this->results;
+}
+
+std::string Future::GetError() const
+{
+    thread::Lock lock(this->mutex);
+
+    return this->error;
+}
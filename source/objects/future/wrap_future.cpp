@@ -0,0 +1,70 @@
+#include "objects/future/wrap_future.h"
+
+using namespace love;
+
+int Wrap_Future::IsDone(lua_State* L)
+{
+    Future* self = Wrap_Future::CheckFuture(L, 1);
+
+    lua_pushboolean(L, self->IsDone());
+
+    return 1;
+}
+
+int Wrap_Future::Wait(lua_State* L)
+{
+    Future* self   = Wrap_Future::CheckFuture(L, 1);
+    double timeout = luaL_optnumber(L, 2, -1.0);
+
+    lua_pushboolean(L, self->Wait(timeout));
+
+    return 1;
+}
+
+int Wrap_Future::GetResults(lua_State* L)
+{
+    Future* self = Wrap_Future::CheckFuture(L, 1);
+
+    std::vector<Variant> results = self->GetResults();
+
+    luaL_checkstack(L, (int)results.size(), nullptr);
+
+    for (const Variant& result : results)
+        result.ToLua(L);
+
+    return (int)results.size();
+}
+
+int Wrap_Future::GetError(lua_State* L)
+{
+    Future* self      = Wrap_Future::CheckFuture(L, 1);
+    std::string error = self->GetError();
+
+    if (error.empty())
+        lua_pushnil(L);
+    else
+        Luax::PushString(L, error);
+
+    return 1;
+}
+
+Future* Wrap_Future::CheckFuture(lua_State* L, int index)
+{
+    return Luax::CheckType<Future>(L, index);
+}
+
+// clang-format off
+static constexpr luaL_Reg functions[] =
+{
+    { "getError",   Wrap_Future::GetError   },
+    { "getResults", Wrap_Future::GetResults },
+    { "isDone",     Wrap_Future::IsDone     },
+    { "wait",       Wrap_Future::Wait       },
+    { 0,            0                       }
+};
+// clang-format on
+
+int Wrap_Future::Register(lua_State* L)
+{
+    return Luax::RegisterType(L, &Future::type, functions, nullptr);
+}
@@ -1,6 +1,9 @@
 #include "objects/image/image.h"
 #include "objects/texture/texture.h"
 
+#include "common/bidirectionalmap.h"
+#include "modules/image/imagemodule.h"
+
 using namespace love;
 
 Image::Slices::Slices(TextureType type) : textureType(type)
@@ -126,3 +129,50 @@ Image::MipmapsType Image::Slices::Validate() const
     else
         return MIPMAPS_NONE;
 }
+
+void Image::SetupMipmaps(const Settings& settings)
+{
+    this->mipmapFilter = settings.mipmapFilter;
+
+    if (settings.mipmaps && this->mipmapsType == MIPMAPS_NONE)
+    {
+        ImageDataBase* base = this->data.Get(0, 0);
+        PixelFormat format  = base->GetFormat();
+
+        if (format != PIXELFORMAT_RGBA8 && format != PIXELFORMAT_TEX3DS_RGBA8)
+        {
+            const char* name = "unknown";
+            ImageModule::GetConstant(format, name);
+
+            throw love::Exception("Automatic mipmap generation is not supported for %s images.",
+                                  name);
+        }
+
+        this->mipmapsType = MIPMAPS_GENERATED;
+    }
+
+    if (this->mipmapsType != MIPMAPS_NONE)
+        this->filter.mipmap = Texture::defaultMipmapFilter;
+}
+
+// clang-format off
+constexpr auto mipmapFilters = BidirectionalMap<>::Create(
+    "box",    mipmaps::FILTER_BOX,
+    "kaiser", mipmaps::FILTER_KAISER
+);
+// clang-format on
+
+bool Image::GetConstant(const char* in, mipmaps::Filter& out)
+{
+    return mipmapFilters.Find(in, out);
+}
+
+bool Image::GetConstant(mipmaps::Filter in, const char*& out)
+{
+    return mipmapFilters.ReverseFind(in, out);
+}
+
+std::vector<const char*> Image::GetConstants(mipmaps::Filter)
+{
+    return mipmapFilters.GetNames();
+}
@@ -0,0 +1,243 @@
+#include "objects/image/mipmaps.h"
+
+#include "modules/thread/types/threadable.h"
+
+#include <algorithm>
+
+#if defined(__ARM_NEON)
+    #include <arm_neon.h>
+#endif
+
+using namespace love;
+
+namespace
+{
+    constexpr int CHANNELS = 4;
+
+    /*
+    ** Kaiser windowed sinc (beta 4, radius 3) sampled at the half pixel
+    ** offsets of a 2:1 reduction. Sums to 1 << 14.
+    */
+    constexpr int KAISER_TAPS             = 6;
+    constexpr int KAISER[KAISER_TAPS]     = { -344, 1548, 6988, 6988, 1548, -344 };
+    constexpr int KAISER_SHIFT            = 14;
+    constexpr int KAISER_VERTICAL_SHIFT   = 7;
+    constexpr int KAISER_HORIZONTAL_SHIFT = KAISER_SHIFT * 2 - KAISER_VERTICAL_SHIFT;
+
+    inline uint8_t clampChannel(int value)
+    {
+        return (uint8_t)std::clamp(value, 0, 255);
+    }
+
+    /* average of 2x2 pixels, rounded. The last column repeats when @width is odd */
+    void boxRow(const uint8_t* top, const uint8_t* bottom, int width, uint8_t* out, int count)
+    {
+        int x = 0;
+
+#if defined(__ARM_NEON)
+        /* pairs of pixels are split into even and odd lanes, four outputs at a time */
+        for (; x + 4 <= count && (x + 4) * 2 <= width; x += 4)
+        {
+            uint32x4x2_t a = vld2q_u32((const uint32_t*)(top + x * 2 * CHANNELS));
+            uint32x4x2_t b = vld2q_u32((const uint32_t*)(bottom + x * 2 * CHANNELS));
+
+            uint8x16_t a0 = vreinterpretq_u8_u32(a.val[0]);
+            uint8x16_t a1 = vreinterpretq_u8_u32(a.val[1]);
+            uint8x16_t b0 = vreinterpretq_u8_u32(b.val[0]);
+            uint8x16_t b1 = vreinterpretq_u8_u32(b.val[1]);
+
+            uint16x8_t low  = vaddl_u8(vget_low_u8(a0), vget_low_u8(a1));
+            uint16x8_t high = vaddl_u8(vget_high_u8(a0), vget_high_u8(a1));
+
+            low  = vaddq_u16(low, vaddl_u8(vget_low_u8(b0), vget_low_u8(b1)));
+            high = vaddq_u16(high, vaddl_u8(vget_high_u8(b0), vget_high_u8(b1)));
+
+            vst1q_u8(out + x * CHANNELS, vcombine_u8(vrshrn_n_u16(low, 2), vrshrn_n_u16(high, 2)));
+        }
+#endif
+
+        for (; x < count; x++)
+        {
+            int left  = x * 2 * CHANNELS;
+            int right = std::min(x * 2 + 1, width - 1) * CHANNELS;
+
+            for (int channel = 0; channel < CHANNELS; channel++)
+            {
+                int sum = top[left + channel] + top[right + channel] + bottom[left + channel] +
+                          bottom[right + channel];
+
+                out[x * CHANNELS + channel] = (uint8_t)((sum + 2) >> 2);
+            }
+        }
+    }
+
+    void boxRows(const uint8_t* src, int width, int height, uint8_t* dst, int first, int last)
+    {
+        const size_t srcPitch = (size_t)width * CHANNELS;
+
+        const int dstWidth    = mipmaps::GetLevelSize(width, 1);
+        const size_t dstPitch = (size_t)dstWidth * CHANNELS;
+
+        for (int y = first; y < last; y++)
+        {
+            const uint8_t* top    = src + std::min(y * 2, height - 1) * srcPitch;
+            const uint8_t* bottom = src + std::min(y * 2 + 1, height - 1) * srcPitch;
+
+            boxRow(top, bottom, width, dst + y * dstPitch, dstWidth);
+        }
+    }
+
+    /*
+    ** Separable: each output row filters six source rows into @column,
+    ** which is then filtered across. Edges are clamped.
+    */
+    void kaiserRows(const uint8_t* src, int width, int height, uint8_t* dst, int first, int last)
+    {
+        const size_t srcPitch = (size_t)width * CHANNELS;
+
+        const int dstWidth    = mipmaps::GetLevelSize(width, 1);
+        const size_t dstPitch = (size_t)dstWidth * CHANNELS;
+
+        std::vector<int> column(srcPitch);
+
+        for (int y = first; y < last; y++)
+        {
+            const uint8_t* rows[KAISER_TAPS];
+
+            for (int tap = 0; tap < KAISER_TAPS; tap++)
+            {
+                int row   = std::clamp(y * 2 - 2 + tap, 0, height - 1);
+                rows[tap] = src + row * srcPitch;
+            }
+
+            for (size_t index = 0; index < srcPitch; index++)
+            {
+                int sum = 0;
+
+                for (int tap = 0; tap < KAISER_TAPS; tap++)
+                    sum += KAISER[tap] * rows[tap][index];
+
+                column[index] = (sum + (1 << (KAISER_VERTICAL_SHIFT - 1))) >> KAISER_VERTICAL_SHIFT;
+            }
+
+            uint8_t* out = dst + y * dstPitch;
+
+            for (int x = 0; x < dstWidth; x++)
+            {
+                int sums[CHANNELS] = { 0 };
+
+                for (int tap = 0; tap < KAISER_TAPS; tap++)
+                {
+                    const int* pixel =
+                        column.data() + std::clamp(x * 2 - 2 + tap, 0, width - 1) * CHANNELS;
+
+                    for (int channel = 0; channel < CHANNELS; channel++)
+                        sums[channel] += KAISER[tap] * pixel[channel];
+                }
+
+                for (int channel = 0; channel < CHANNELS; channel++)
+                {
+                    int value = (sums[channel] + (1 << (KAISER_HORIZONTAL_SHIFT - 1))) >>
+                                KAISER_HORIZONTAL_SHIFT;
+
+                    out[x * CHANNELS + channel] = clampChannel(value);
+                }
+            }
+        }
+    }
+
+    struct Band
+    {
+        mipmaps::Filter filter;
+
+        const uint8_t* src;
+        int width;
+        int height;
+
+        uint8_t* dst;
+        int first;
+        int last;
+    };
+
+    class BandWorker : public Threadable
+    {
+      public:
+        BandWorker(const Band& band) : band(band)
+        {
+            this->threadName = "MipmapBand";
+        }
+
+        void ThreadFunction()
+        {
+            mipmaps::Downsample(band.filter, band.src, band.width, band.height, band.dst,
+                                band.first, band.last);
+        }
+
+      private:
+        Band band;
+    };
+} // namespace
+
+int mipmaps::GetLevelSize(int size, int level)
+{
+    return std::max(size >> level, 1);
+}
+
+void mipmaps::Downsample(Filter filter, const uint8_t* src, int width, int height, uint8_t* dst,
+                         int first, int last)
+{
+    if (filter == FILTER_KAISER)
+        kaiserRows(src, width, height, dst, first, last);
+    else
+        boxRows(src, width, height, dst, first, last);
+}
+
+/*
+** Large levels have their bottom half made on another thread while this
+** one does the top half. Each level needs the whole of the last one, so
+** the threads meet up between levels.
+*/
+void mipmaps::Generate(Filter filter, const uint8_t* src, int width, int height, int count,
+                       std::vector<std::vector<uint8_t>>& levels)
+{
+    levels.clear();
+
+    const uint8_t* previous = src;
+
+    for (int level = 1; level < count && (width > 1 || height > 1); level++)
+    {
+        int levelWidth  = GetLevelSize(width, 1);
+        int levelHeight = GetLevelSize(height, 1);
+
+        levels.emplace_back((size_t)levelWidth * levelHeight * CHANNELS);
+        uint8_t* dst = levels.back().data();
+
+        BandWorker* worker = nullptr;
+        int split          = levelHeight;
+
+        if (levelHeight >= MIN_THREADED_ROWS)
+        {
+            split  = levelHeight / 2;
+            worker = new BandWorker({ filter, previous, width, height, dst, split, levelHeight });
+
+            if (!worker->Start())
+            {
+                worker->Release();
+                worker = nullptr;
+                split  = levelHeight;
+            }
+        }
+
+        Downsample(filter, previous, width, height, dst, 0, split);
+
+        if (worker != nullptr)
+        {
+            worker->Wait();
+            worker->Release();
+        }
+
+        previous = dst;
+        width    = levelWidth;
+        height   = levelHeight;
+    }
+}
@@ -3,10 +3,270 @@
 #include "common/exception.h"
 
 #include "debug/logger.h"
+#include "modules/thread/types/threadable.h"
+
 #include <libpng16/png.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <vector>
 
 using namespace love;
 
+namespace
+{
+    constexpr uint8_t PNG_SIGNATURE[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+    /* deflate looks back at most this far, so that's all a band needs from the last one */
+    constexpr size_t DEFLATE_WINDOW = 0x8000;
+
+    /* smaller bands aren't worth a thread */
+    constexpr size_t MIN_BAND_ROWS = 64;
+
+    enum RowFilter
+    {
+        FILTER_NONE,
+        FILTER_SUB,
+        FILTER_UP,
+        FILTER_AVERAGE,
+        FILTER_PAETH,
+        FILTER_MAX_ENUM
+    };
+
+    inline uint8_t paeth(int left, int up, int upLeft)
+    {
+        int estimate = left + up - upLeft;
+
+        int distanceLeft   = std::abs(estimate - left);
+        int distanceUp     = std::abs(estimate - up);
+        int distanceUpLeft = std::abs(estimate - upLeft);
+
+        if (distanceLeft <= distanceUp && distanceLeft <= distanceUpLeft)
+            return left;
+
+        return (distanceUp <= distanceUpLeft) ? up : upLeft;
+    }
+
+    void applyFilter(int filter, const uint8_t* row, const uint8_t* prior, size_t length,
+                     size_t bpp, uint8_t* out)
+    {
+        switch (filter)
+        {
+            case FILTER_NONE:
+            default:
+                memcpy(out, row, length);
+                break;
+            case FILTER_SUB:
+                memcpy(out, row, bpp);
+
+                for (size_t index = bpp; index < length; index++)
+                    out[index] = row[index] - row[index - bpp];
+
+                break;
+            case FILTER_UP:
+                for (size_t index = 0; index < length; index++)
+                    out[index] = row[index] - prior[index];
+
+                break;
+            case FILTER_AVERAGE:
+                for (size_t index = 0; index < bpp; index++)
+                    out[index] = row[index] - prior[index] / 2;
+
+                for (size_t index = bpp; index < length; index++)
+                    out[index] = row[index] - (row[index - bpp] + prior[index]) / 2;
+
+                break;
+            case FILTER_PAETH:
+                for (size_t index = 0; index < bpp; index++)
+                    out[index] = row[index] - prior[index];
+
+                for (size_t index = bpp; index < length; index++)
+                    out[index] = row[index] - paeth(row[index - bpp], prior[index],
+                                                    prior[index - bpp]);
+
+                break;
+        }
+    }
+
+    /*
+    ** Filter one row into @out (filter type byte first), picking the
+    ** filter with the smallest sum of absolute differences like libpng.
+    */
+    void filterRow(const uint8_t* row, const uint8_t* prior, size_t length, size_t bpp,
+                   uint8_t* out, uint8_t* scratch)
+    {
+        uint64_t bestSum = UINT64_MAX;
+
+        for (int filter = FILTER_NONE; filter < FILTER_MAX_ENUM; filter++)
+        {
+            applyFilter(filter, row, prior, length, bpp, scratch);
+
+            uint64_t sum = 0;
+
+            for (size_t index = 0; index < length; index++)
+                sum += (scratch[index] < 0x80) ? scratch[index] : 0x100 - scratch[index];
+
+            if (sum < bestSum)
+            {
+                bestSum = sum;
+                out[0]  = (uint8_t)filter;
+                memcpy(out + 1, scratch, length);
+            }
+        }
+    }
+
+    /*
+    ** A band filters and deflates its own rows. Bands after the first also
+    ** filter the rows before them again, to prime deflate with the same
+    ** data the previous band ends with.
+    */
+    struct Band
+    {
+        const uint8_t* pixels;
+        size_t rowSize;
+        size_t bpp;
+        bool wide;
+
+        size_t firstRow;
+        size_t rowCount;
+
+        /* where the filtered rows go */
+        uint8_t* filtered;
+        size_t size;
+
+        bool last;
+
+        std::vector<uint8_t> output;
+        uLong adler;
+        bool failed;
+    };
+
+    /* PNG samples are big endian */
+    void loadRow(const Band& band, size_t row, uint8_t* out)
+    {
+        const uint8_t* source = band.pixels + row * band.rowSize;
+
+        if (!band.wide)
+        {
+            memcpy(out, source, band.rowSize);
+            return;
+        }
+
+        for (size_t index = 0; index < band.rowSize; index += 2)
+        {
+            out[index]     = source[index + 1];
+            out[index + 1] = source[index];
+        }
+    }
+
+    /* raw deflate, the zlib header and checksum are written once for all bands */
+    void encodeBand(Band& band)
+    {
+        band.failed = true;
+
+        const size_t filteredRow = band.rowSize + 1;
+
+        size_t dictionaryRows = (DEFLATE_WINDOW + filteredRow - 1) / filteredRow;
+        dictionaryRows        = std::min(dictionaryRows, band.firstRow);
+
+        std::vector<uint8_t> current(band.rowSize);
+        std::vector<uint8_t> prior(band.rowSize, 0);
+        std::vector<uint8_t> scratch(band.rowSize);
+        std::vector<uint8_t> dictionary(dictionaryRows * filteredRow);
+
+        size_t row = band.firstRow - dictionaryRows;
+
+        if (row > 0)
+            loadRow(band, row - 1, prior.data());
+
+        for (; row < band.firstRow + band.rowCount; row++)
+        {
+            uint8_t* out = nullptr;
+
+            if (row < band.firstRow)
+                out = &dictionary[(row + dictionaryRows - band.firstRow) * filteredRow];
+            else
+                out = band.filtered + (row - band.firstRow) * filteredRow;
+
+            loadRow(band, row, current.data());
+            filterRow(current.data(), prior.data(), band.rowSize, band.bpp, out, scratch.data());
+
+            std::swap(current, prior);
+        }
+
+        band.adler = adler32(adler32(0L, Z_NULL, 0), band.filtered, band.size);
+
+        z_stream stream {};
+
+        if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8,
+                         Z_DEFAULT_STRATEGY) != Z_OK)
+            return;
+
+        if (!dictionary.empty())
+        {
+            size_t length = std::min(dictionary.size(), DEFLATE_WINDOW);
+            deflateSetDictionary(&stream, &dictionary[dictionary.size() - length], length);
+        }
+
+        /* a sync flush adds an empty stored block on top of the bound */
+        band.output.resize(deflateBound(&stream, band.size) + 16);
+
+        stream.next_in   = band.filtered;
+        stream.avail_in  = band.size;
+        stream.next_out  = band.output.data();
+        stream.avail_out = band.output.size();
+
+        int result = deflate(&stream, band.last ? Z_FINISH : Z_SYNC_FLUSH);
+
+        if (band.last)
+            band.failed = (result != Z_STREAM_END);
+        else
+            band.failed = (result != Z_OK || stream.avail_in != 0);
+
+        band.output.resize(stream.total_out);
+        deflateEnd(&stream);
+    }
+
+    class BandWorker : public Threadable
+    {
+      public:
+        BandWorker(Band& band) : band(band)
+        {
+            this->threadName = "PNGBand";
+        }
+
+        void ThreadFunction()
+        {
+            encodeBand(this->band);
+        }
+
+      private:
+        Band& band;
+    };
+
+    inline void writeUint32(uint8_t*& out, uint32_t value)
+    {
+        out[0] = value >> 24;
+        out[1] = value >> 16;
+        out[2] = value >> 8;
+        out[3] = value;
+
+        out += 4;
+    }
+
+    /* the chunk data must already be at @out + 8 */
+    inline void writeChunk(uint8_t*& out, const char* type, size_t length)
+    {
+        writeUint32(out, length);
+        memcpy(out, type, 4);
+
+        uLong crc = crc32(crc32(0L, Z_NULL, 0), out, length + 4);
+
+        out += length + 4;
+        writeUint32(out, crc);
+    }
+} // namespace
+
 bool PNGHandler::CanDecode(Data* data)
 {
     png_image image;
@@ -73,6 +333,10 @@ FormatHandler::EncodedImage PNGHandler::Encode(const DecodedImage& decoded,
     if (!this->CanEncode(decoded.format, encodedFormat))
         throw love::Exception("PNG encoder cannot encode to non-PNG format.");
 
+    /* the simplified API only writes 16-bit samples as linear, premultiplied light */
+    if (decoded.format == PIXELFORMAT_RGBA16)
+        return PNGHandler::EncodeBands(decoded, 1);
+
     EncodedImage encoded {};
 
     png_image image;
@@ -83,14 +347,155 @@ FormatHandler::EncodedImage PNGHandler::Encode(const DecodedImage& decoded,
     image.version = PNG_IMAGE_VERSION;
     image.format  = PNG_FORMAT_RGBA;
 
-    png_image_write_get_memory_size(image, encoded.size, 1, decoded.data,
+    /* convert_to_8_bit would read the pixels as 16-bit linear ones */
+    png_image_write_get_memory_size(image, encoded.size, 0, decoded.data,
                                     PNG_IMAGE_ROW_STRIDE(image), NULL);
 
     encoded.data = new uint8_t[encoded.size];
 
-    png_image_write_to_memory(&image, encoded.data, &encoded.size, 1, decoded.data,
+    png_image_write_to_memory(&image, encoded.data, &encoded.size, 0, decoded.data,
                               PNG_IMAGE_ROW_STRIDE(image), NULL);
 
+    if (PNG_IMAGE_FAILED(image))
+    {
+        delete[] encoded.data;
+        throw love::Exception("Could not encode PNG image (%s)", image.message);
+    }
+
+    return encoded;
+}
+
+FormatHandler::EncodedImage PNGHandler::EncodeBands(const DecodedImage& decoded,
+                                                    size_t bandCount)
+{
+    if (decoded.format != PIXELFORMAT_RGBA8 && decoded.format != PIXELFORMAT_RGBA16)
+        throw love::Exception("PNG encoder cannot encode this pixel format.");
+
+    if (decoded.width <= 0 || decoded.height <= 0)
+        throw love::Exception("Cannot encode an empty image.");
+
+    const bool wide          = decoded.format == PIXELFORMAT_RGBA16;
+    const size_t bpp         = wide ? 8 : 4;
+    const size_t rowSize     = decoded.width * bpp;
+    const size_t height      = decoded.height;
+    const size_t filteredRow = rowSize + 1;
+
+    size_t maxBands = std::max<size_t>(height / MIN_BAND_ROWS, 1);
+    bandCount       = std::clamp<size_t>(bandCount, 1, maxBands);
+
+    /* rounding up can leave fewer bands than asked for */
+    size_t rowsPerBand = (height + bandCount - 1) / bandCount;
+    bandCount          = (height + rowsPerBand - 1) / rowsPerBand;
+
+    std::vector<uint8_t> filtered(filteredRow * height);
+    std::vector<Band> bands(bandCount);
+
+    for (size_t index = 0; index < bandCount; index++)
+    {
+        Band& band = bands[index];
+
+        band.pixels  = decoded.data;
+        band.rowSize = rowSize;
+        band.bpp     = bpp;
+        band.wide    = wide;
+
+        band.firstRow = index * rowsPerBand;
+        band.rowCount = std::min(rowsPerBand, height - band.firstRow);
+
+        band.filtered = &filtered[band.firstRow * filteredRow];
+        band.size     = band.rowCount * filteredRow;
+
+        band.last = (index + 1 == bandCount);
+    }
+
+    /* the first band is ours, the rest go to their own threads */
+    std::vector<BandWorker*> workers;
+
+    for (size_t index = 1; index < bandCount; index++)
+    {
+        BandWorker* worker = new BandWorker(bands[index]);
+
+        if (worker->Start())
+            workers.push_back(worker);
+        else
+        {
+            worker->Release();
+            encodeBand(bands[index]);
+        }
+    }
+
+    encodeBand(bands[0]);
+
+    for (BandWorker* worker : workers)
+    {
+        worker->Wait();
+        worker->Release();
+    }
+
+    size_t compressed = 0;
+    uLong adler       = adler32(0L, Z_NULL, 0);
+
+    for (const Band& band : bands)
+    {
+        if (band.failed)
+            throw love::Exception("Could not compress PNG image data.");
+
+        compressed += band.output.size();
+        adler = adler32_combine(adler, band.adler, band.size);
+    }
+
+    /* zlib header + bands + adler32 */
+    size_t idatSize = 2 + compressed + 4;
+
+    EncodedImage encoded {};
+
+    encoded.size = sizeof(PNG_SIGNATURE) + (12 + 13) + (12 + 1) + (12 + idatSize) + 12;
+    encoded.data = new uint8_t[encoded.size];
+
+    uint8_t* out = encoded.data;
+
+    memcpy(out, PNG_SIGNATURE, sizeof(PNG_SIGNATURE));
+    out += sizeof(PNG_SIGNATURE);
+
+    /* IHDR: 8 or 16 bit RGBA, no interlacing */
+    {
+        uint8_t* data = out + 8;
+
+        writeUint32(data, decoded.width);
+        writeUint32(data, decoded.height);
+
+        data[0] = wide ? 16 : 8;
+        data[1] = 6;
+        data[2] = data[3] = data[4] = 0;
+
+        writeChunk(out, "IHDR", 13);
+    }
+
+    /* sRGB, as libpng marks it; without it 16-bit files read back as linear */
+    {
+        out[8] = 0;
+        writeChunk(out, "sRGB", 1);
+    }
+
+    {
+        uint8_t* data = out + 8;
+
+        *data++ = 0x78;
+        *data++ = 0x9C;
+
+        for (const Band& band : bands)
+        {
+            memcpy(data, band.output.data(), band.output.size());
+            data += band.output.size();
+        }
+
+        writeUint32(data, adler);
+
+        writeChunk(out, "IDAT", idatSize);
+    }
+
+    writeChunk(out, "IEND", 0);
+
     return encoded;
 }
 
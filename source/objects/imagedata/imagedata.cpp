@@ -3,6 +3,10 @@
 
 #include "common/bidirectionalmap.h"
 #include "common/lmath.h"
+#include "common/pixelconvert.h"
+#include "common/pixelmap.h"
+#include "common/swizzle.h"
+#include "modules/image/encodeworker.h"
 #include "modules/image/imagemodule.h"
 #include "modules/thread/types/lock.h"
 
@@ -26,7 +30,7 @@ ImageData::ImageData(int width, int height, PixelFormat format) :
         throw love::Exception("Unsupported pixel format for ImageData.");
 
     this->Create(width, height, format);
-    memset(this->data, 0, this->GetSize());
+    memset(this->storage.WriteContiguous(), 0, this->storage.GetSize());
 }
 
 ImageData::ImageData(int width, int height, PixelFormat format, void* data, bool own) :
@@ -37,25 +41,28 @@ ImageData::ImageData(int width, int height, PixelFormat format, void* data, bool
         throw love::Exception("Unsupported pixel format for ImageData");
 
     if (own)
-        this->data = (uint8_t*)data;
+    {
+        this->storage = CowBuffer((uint8_t*)data, this->GetSize(), this->GetBlockSize(), nullptr);
+
+        this->pixelSetFunction = this->GetPixelSetFunction(format);
+        this->pixelGetFunction = this->GetPixelGetFunction(format);
+    }
     else
         this->Create(width, height, format, data);
 }
 
 ImageData::ImageData(const ImageData& other) :
     ImageDataBase(other.format, other.width, other.height),
+    pixelSetFunction(other.pixelSetFunction),
+    pixelGetFunction(other.pixelGetFunction),
     initialized(true)
 {
-    this->Create(width, height, format, other.GetData());
+    Lock lock(other.mutex);
+    this->storage = other.storage;
 }
 
 ImageData::~ImageData()
-{
-    if (this->decodeHandler.Get())
-        decodeHandler->FreeRawPixels(this->data);
-    else
-        delete[] this->data;
-}
+{}
 
 ImageData* ImageData::Clone() const
 {
@@ -71,20 +78,11 @@ void ImageData::Create(int width, int height, PixelFormat format, void* data)
     else
         dataSize = width * height * GetPixelFormatSize(format);
 
-    try
-    {
-        this->data = new uint8_t[dataSize];
-    }
-    catch (std::bad_alloc&)
-    {
-        throw love::Exception("Out of memory");
-    }
+    this->format  = format;
+    this->storage = CowBuffer(dataSize, this->GetBlockSize());
 
     if (data)
-        memcpy(this->data, data, dataSize);
-
-    this->decodeHandler = nullptr;
-    this->format        = format;
+        memcpy(this->storage.WriteContiguous(), data, dataSize);
 
     this->pixelSetFunction = this->GetPixelSetFunction(format);
     this->pixelGetFunction = this->GetPixelGetFunction(format);
@@ -98,6 +96,11 @@ bool ImageData::ValidatePixelFormat(PixelFormat format)
         case PIXELFORMAT_RGBA16:
         case PIXELFORMAT_TEX3DS_RGBA8:
             return true;
+#if not defined(__3DS__)
+        case PIXELFORMAT_RGB8:
+        case PIXELFORMAT_R8:
+            return true;
+#endif
         default:
             return false;
     }
@@ -144,11 +147,6 @@ void ImageData::Decode(Data* data)
         throw love::Exception("Could not decode image!");
     }
 
-    if (decodeHandler)
-        decodeHandler->FreeRawPixels(this->data);
-    else
-        delete[] this->data;
-
 #if not defined(__3DS__)
     this->width  = decoded.width;
     this->height = decoded.height;
@@ -157,10 +155,13 @@ void ImageData::Decode(Data* data)
     this->height = decoded.subHeight;
 #endif
 
-    this->data   = decoded.data;
     this->format = decoded.format;
 
-    this->decodeHandler = decoder;
+    /* the pixels go back to whoever decoded them */
+    StrongReference<FormatHandler> handler(decoder);
+
+    this->storage = CowBuffer(decoded.data, decoded.size, this->GetBlockSize(),
+                              [handler](uint8_t* memory) { handler->FreeRawPixels(memory); });
 
     this->pixelSetFunction = this->GetPixelSetFunction(format);
     this->pixelGetFunction = this->GetPixelGetFunction(format);
@@ -177,7 +178,6 @@ FileData* ImageData::Encode(FormatHandler::EncodedFormat encodedFormat, const ch
     decoded.width  = width;
     decoded.height = height;
     decoded.size   = this->GetSize();
-    decoded.data   = data;
     decoded.format = format;
 
     auto module = Module::GetInstance<ImageModule>(Module::M_IMAGE);
@@ -197,7 +197,9 @@ FileData* ImageData::Encode(FormatHandler::EncodedFormat encodedFormat, const ch
     if (encoder != nullptr)
     {
         thread::Lock lock(this->mutex);
-        encoded = encoder->Encode(decoded, encodedFormat);
+
+        decoded.data = const_cast<uint8_t*>(this->storage.ReadContiguous());
+        encoded      = encoder->Encode(decoded, encodedFormat);
     }
 
     if (encoder == nullptr || encoded.data == nullptr)
@@ -246,6 +248,86 @@ FileData* ImageData::Encode(FormatHandler::EncodedFormat encodedFormat, const ch
     return fileData;
 }
 
+void ImageData::EncodeAsync(FormatHandler::EncodedFormat encodedFormat, const char* filename,
+                            int id)
+{
+    auto module = Module::GetInstance<ImageModule>(Module::M_IMAGE);
+
+    if (module == nullptr)
+        throw love::Exception("love.image must be loaded in order to encode ImageData.");
+
+    /* the encoder wants linear RGBA, so convert while copying */
+    PixelFormat format = PIXELFORMAT_RGBA8;
+    if (this->format == PIXELFORMAT_RGBA16)
+        format = PIXELFORMAT_RGBA16;
+
+    auto convert = GetPixelRowConverter(this->format, format);
+
+    if (convert == nullptr)
+    {
+        const char* formatName = "unknown";
+        ImageModule::GetConstant(this->format, formatName);
+        throw love::Exception("No suitable image encoder for '%s' format.", formatName);
+    }
+
+    EncodeWorker::Job job {};
+
+    job.snapshot.format = format;
+    job.snapshot.width  = this->width;
+    job.snapshot.height = this->height;
+    job.snapshot.size   = this->width * this->height * GetPixelFormatSize(format);
+
+    try
+    {
+        job.snapshot.data = new uint8_t[job.snapshot.size];
+    }
+    catch (std::bad_alloc&)
+    {
+        throw love::Exception("Out of memory");
+    }
+
+    size_t dstPitch = this->width * GetPixelFormatSize(format);
+
+    {
+        Lock lock(this->mutex);
+
+#if defined(__3DS__)
+        size_t srcPitch  = this->width * this->GetPixelSize();
+        unsigned _powTwo = NextPO2(this->width);
+        std::vector<uint8_t> row(srcPitch);
+
+        for (int y = 0; y < this->height; y++)
+        {
+            swizzle::TiledToLinear(this->ReadRows(y), _powTwo, 0, y % BLOCK_ROWS, row.data(),
+                                   srcPitch, this->width, 1, this->GetPixelSize());
+            convert(row.data(), job.snapshot.data + y * dstPitch, this->width);
+        }
+#else
+        for (int y = 0; y < this->height; y++)
+        {
+            const uint8_t* row = this->ReadRows(y) + this->GetPixelOffset(0, y);
+            convert(row, job.snapshot.data + y * dstPitch, this->width);
+        }
+#endif
+    }
+
+    job.source.Set(this);
+
+    job.id       = id;
+    job.format   = encodedFormat;
+    job.filename = filename;
+
+    try
+    {
+        module->GetEncodeWorker()->AddJob(job);
+    }
+    catch (love::Exception&)
+    {
+        delete[] job.snapshot.data;
+        throw;
+    }
+}
+
 static float clamp01(float x)
 {
     return std::clamp(x, 0.0f, 1.0f);
@@ -256,7 +338,7 @@ static float clamp01(float x)
 //     pixel->rgba8[0] = static_cast<uint8_t>(clamp01(color.r) * 0xFF + 0.5f);
 //     pixel->rgba8[1] = static_cast<uint8_t>(clamp01(color.g) * 0xFF + 0.5f);
 // }
-#if defined(__SWITCH__)
+#if not defined(__3DS__)
 static void setPixelRGBA8(const Colorf& color, ImageData::Pixel* pixel)
 {
     pixel->rgba8[0] = static_cast<uint8_t>(clamp01(color.r) * 0xFF);
@@ -264,7 +346,7 @@ static void setPixelRGBA8(const Colorf& color, ImageData::Pixel* pixel)
     pixel->rgba8[2] = static_cast<uint8_t>(clamp01(color.b) * 0xFF);
     pixel->rgba8[3] = static_cast<uint8_t>(clamp01(color.a) * 0xFF);
 }
-#elif defined(__3DS__)
+#else
 static void setPixelRGBA8(const Colorf& color, ImageData::Pixel* pixel)
 {
     uint8_t r = uint8_t(0xFF * clamp01(color.r) + 0.5f);
@@ -279,20 +361,20 @@ static void setPixelRGBA8(const Colorf& color, ImageData::Pixel* pixel)
 static void setPixelRGBA16(const Colorf& color, ImageData::Pixel* pixel)
 {
     pixel->rgba16[0] = static_cast<uint16_t>(clamp01(color.r) * 0xFFFF + 0.5f);
-    pixel->rgba16[1] = static_cast<uint16_t>(clamp01(color.b) * 0xFFFF + 0.5f);
-    pixel->rgba16[2] = static_cast<uint16_t>(clamp01(color.g) * 0xFFFF + 0.5f);
+    pixel->rgba16[1] = static_cast<uint16_t>(clamp01(color.g) * 0xFFFF + 0.5f);
+    pixel->rgba16[2] = static_cast<uint16_t>(clamp01(color.b) * 0xFFFF + 0.5f);
     pixel->rgba16[3] = static_cast<uint16_t>(clamp01(color.a) * 0xFFFF + 0.5f);
 }
 
-#if defined(__SWITCH__)
+#if not defined(__3DS__)
 static void getPixelRGBA8(const ImageData::Pixel* pixel, Colorf& color)
 {
-    color.r = pixel->rgba8[0] / 0xFF;
-    color.g = pixel->rgba8[1] / 0xFF;
-    color.b = pixel->rgba8[2] / 0xFF;
-    color.a = pixel->rgba8[3] / 0xFF;
+    color.r = pixel->rgba8[0] / 255.0f;
+    color.g = pixel->rgba8[1] / 255.0f;
+    color.b = pixel->rgba8[2] / 255.0f;
+    color.a = pixel->rgba8[3] / 255.0f;
 }
-#elif defined(__3DS__)
+#else
 static void getPixelRGBA8(const ImageData::Pixel* pixel, Colorf& color)
 {
     color.r = ((pixel->packed32 & 0xFF000000) >> 0x18) / 255.0f;
@@ -304,33 +386,59 @@ static void getPixelRGBA8(const ImageData::Pixel* pixel, Colorf& color)
 
 static void getPixelRGBA16(const ImageData::Pixel* pixel, Colorf& color)
 {
-    color.r = pixel->rgba16[0] / 0xFFFF;
-    color.g = pixel->rgba16[1] / 0xFFFF;
-    color.b = pixel->rgba16[2] / 0xFFFF;
-    color.a = pixel->rgba16[3] / 0xFFFF;
+    color.r = pixel->rgba16[0] / 65535.0f;
+    color.g = pixel->rgba16[1] / 65535.0f;
+    color.b = pixel->rgba16[2] / 65535.0f;
+    color.a = pixel->rgba16[3] / 65535.0f;
+}
+
+#if not defined(__3DS__)
+static void setPixelRGB8(const Colorf& color, ImageData::Pixel* pixel)
+{
+    pixel->rgba8[0] = static_cast<uint8_t>(clamp01(color.r) * 0xFF + 0.5f);
+    pixel->rgba8[1] = static_cast<uint8_t>(clamp01(color.g) * 0xFF + 0.5f);
+    pixel->rgba8[2] = static_cast<uint8_t>(clamp01(color.b) * 0xFF + 0.5f);
+}
+
+static void getPixelRGB8(const ImageData::Pixel* pixel, Colorf& color)
+{
+    color.r = pixel->rgba8[0] / 255.0f;
+    color.g = pixel->rgba8[1] / 255.0f;
+    color.b = pixel->rgba8[2] / 255.0f;
+    color.a = 1.0f;
+}
+
+static void setPixelR8(const Colorf& color, ImageData::Pixel* pixel)
+{
+    pixel->rgba8[0] = static_cast<uint8_t>(clamp01(color.r) * 0xFF + 0.5f);
 }
 
+static void getPixelR8(const ImageData::Pixel* pixel, Colorf& color)
+{
+    color.r = pixel->rgba8[0] / 255.0f;
+    color.g = 0.0f;
+    color.b = 0.0f;
+    color.a = 1.0f;
+}
+#endif
+
 void ImageData::SetPixel(int x, int y, const Colorf& color)
 {
     if (!this->Inside(x, y))
         throw love::Exception("Attempt to set out-of-range pixel!");
 
 #if not defined(__3DS__)
-    size_t pixelSize = this->GetPixelSize();
-    Pixel* pixel     = (Pixel*)(this->data + ((y * this->width + x) * pixelSize));
-
     if (this->pixelSetFunction == nullptr)
         throw love::Exception("Unhandled pixel format %d in ImageData::setPixel", this->format);
 
     Lock lock(this->mutex);
+
+    Pixel* pixel = (Pixel*)(this->WriteRows(y) + this->GetPixelOffset(x, y));
     this->pixelSetFunction(color, pixel);
 #else
-    unsigned _width = NextPO2(this->width);
-    unsigned index = coordToIndex(_width, x, y);
-
-    Pixel* pixel = reinterpret_cast<Pixel*>((uint32_t*)this->data + index);
-
     Lock lock(this->mutex);
+
+    Pixel* pixel = reinterpret_cast<Pixel*>(this->WriteRows(y) + this->GetPixelOffset(x, y));
     setPixelRGBA8(color, pixel);
 #endif
 }
@@ -341,21 +449,17 @@ void ImageData::GetPixel(int x, int y, Colorf& color) const
         throw love::Exception("Attempt to get out-of-range pixel!");
 
 #if not defined(__3DS__)
-    size_t pixelSize   = this->GetPixelSize();
-    const Pixel* pixel = (const Pixel*)(this->data + ((y * this->width + x) * pixelSize));
-
     if (this->pixelGetFunction == nullptr)
         throw love::Exception("Unhandled pixel format %d in ImageData::setPixel", format);
 
     Lock lock(this->mutex);
+
+    const Pixel* pixel = (const Pixel*)(this->ReadRows(y) + this->GetPixelOffset(x, y));
     this->pixelGetFunction(pixel, color);
 #else
-    unsigned _width = NextPO2(this->width);
-    unsigned index = coordToIndex(_width, x, y);
-
-    const Pixel* pixel = reinterpret_cast<const Pixel*>((uint32_t*)this->data + index);
-
     Lock lock(this->mutex);
+
+    auto* pixel = reinterpret_cast<const Pixel*>(this->ReadRows(y) + this->GetPixelOffset(x, y));
     getPixelRGBA8(pixel, color);
 #endif
 }
@@ -365,13 +469,7 @@ bool ImageData::CanPaste(PixelFormat src, PixelFormat dst)
     if (src == dst)
         return true;
 
-    if (!(src == PIXELFORMAT_RGBA8 || src == PIXELFORMAT_RGBA16))
-        return false;
-
-    if (!(dst == PIXELFORMAT_RGBA8 || dst == PIXELFORMAT_RGBA16))
-        return false;
-
-    return true;
+    return GetPixelRowConverter(src, dst) != nullptr;
 }
 
 void ImageData::Paste(ImageData* src, int dx, int dy, int sx, int sy, int sw, int sh)
@@ -430,69 +528,118 @@ void ImageData::Paste(ImageData* src, int dx, int dy, int sx, int sy, int sw, in
     Lock lock2(src->mutex);
     Lock lock1(this->mutex);
 
+    if (sw <= 0 || sh <= 0)
+        return;
+
 #if defined(__3DS__)
     unsigned _srcPowTwo = NextPO2(src->width);
     unsigned _dstPowTwo = NextPO2(this->width);
 
-    for (int y = 0; y < std::min(sh, dstH - dy); y++)
+    /* copy whatever part of a tile row both sides have in common at once */
+    for (int row = 0; row < sh;)
     {
-        for (int x = 0; x < std::min(sw, dstW - dx); x++)
-        {
-            unsigned srcIndex = coordToIndex(_srcPowTwo, (sx + x), (sy + y));
-            unsigned dstIndex = coordToIndex(_dstPowTwo, (dx + x), (dy + y));
+        int srcRow = (sy + row) % BLOCK_ROWS;
+        int dstRow = (dy + row) % BLOCK_ROWS;
+        int rows   = std::min({ BLOCK_ROWS - srcRow, BLOCK_ROWS - dstRow, sh - row });
 
-            Colorf color {};
+        /* write first, it may copy the block we're about to read from */
+        uint8_t* destination  = this->WriteRows(dy + row);
+        const uint8_t* source = src->ReadRows(sy + row);
 
-            const Pixel* srcPixel = reinterpret_cast<const Pixel*>((uint32_t*)src->data + srcIndex);
-            getPixelRGBA8(srcPixel, color);
+        swizzle::CopyTiled(source, _srcPowTwo, sx, srcRow, destination, _dstPowTwo, dx, dstRow, sw,
+                           rows, sizeof(uint32_t));
 
-            Pixel* dstPixel = reinterpret_cast<Pixel*>((uint32_t*)this->data + dstIndex);
-            setPixelRGBA8(color, dstPixel);
-        }
+        row += rows;
     }
-#elif defined(__SWITCH__)
-    uint8_t* source = (uint8_t*)src->GetData();
-    uint8_t* destination = (uint8_t*)this->GetData();
-
+#else
     size_t srcpixelsize = src->GetPixelSize();
-    size_t dstpixelsize = this->GetPixelSize();
-
-    auto getFunction = src->pixelGetFunction;
-    auto setFunction = this->pixelSetFunction;
 
     PixelFormat dstformat = this->GetFormat();
     PixelFormat srcformat = src->GetFormat();
 
+    auto convert = GetPixelRowConverter(srcformat, dstformat);
+
+    if (srcformat != dstformat && convert == nullptr)
+        throw love::Exception("Cannot paste between these pixel formats.");
+
+    /* pasting all of it over is just sharing the pixels */
     if (srcformat == dstformat && (sw == dstW && dstW == srcW && sh == dstH && dstH == srcH))
-        memcpy(destination, source, srcpixelsize * sw * sh);
-    else if (sw > 0)
     {
-        // Otherwise, copy each row individually.
-        for (int i = 0; i < sh; i++)
-        {
-            Row rowsrc = { source + (sx + (i + sy) * srcW) * srcpixelsize };
-            Row rowdst = { destination + (dx + (i + dy) * dstW) * dstpixelsize };
-
-            if (srcformat == dstformat)
-                memcpy(rowdst.u8, rowsrc.u8, srcpixelsize * sw);
-            else
-            {
-                // Slow path: convert src -> Colorf -> dst.
-                Colorf c;
-                for (int x = 0; x < sw; x++)
-                {
-                    auto srcp = (const Pixel*)(rowsrc.u8 + x * srcpixelsize);
-                    auto dstp = (Pixel*)(rowdst.u8 + x * dstpixelsize);
-
-                    getFunction(srcp, c);
-                    setFunction(c, dstp);
-                }
-            }
-        }
+        if (src != this)
+            this->storage = src->storage;
+
+        return;
+    }
+
+    // Otherwise, copy each row individually.
+    for (int i = 0; i < sh; i++)
+    {
+        uint8_t* rowdst       = this->WriteRows(dy + i) + this->GetPixelOffset(dx, dy + i);
+        const uint8_t* rowsrc = src->ReadRows(sy + i) + src->GetPixelOffset(sx, sy + i);
+
+        if (srcformat == dstformat)
+            memmove(rowdst, rowsrc, srcpixelsize * sw);
+        else
+            convert(rowsrc, rowdst, sw);
     }
 #endif
 }
 
+void ImageData::MapPixels(MapOperation operation, const Colorf& value, int x, int y, int width,
+                          int height)
+{
+    /* a negative size would otherwise pass as long as both corners are inside */
+    if (width <= 0 || height <= 0)
+        throw love::Exception("Invalid rectangle dimensions.");
+
+    if (!(this->Inside(x, y) && this->Inside(x + width - 1, y + height - 1)))
+        throw love::Exception("Invalid rectangle dimensions.");
+
+    auto toWide   = GetPixelRowConverter(this->format, PIXELFORMAT_RGBA16);
+    auto fromWide = GetPixelRowConverter(PIXELFORMAT_RGBA16, this->format);
+
+    if (toWide == nullptr || fromWide == nullptr)
+        throw love::Exception("Unhandled pixel format %d in ImageData::mapPixels", this->format);
+
+    uint16_t params[4] = {
+        uint16_t(clamp01(value.r) * 0xFFFF + 0.5f), uint16_t(clamp01(value.g) * 0xFFFF + 0.5f),
+        uint16_t(clamp01(value.b) * 0xFFFF + 0.5f), uint16_t(clamp01(value.a) * 0xFFFF + 0.5f)
+    };
+
+    std::vector<uint16_t> wide(width * 4);
+
+#if defined(__3DS__)
+    /* rows are gathered out of the tiles and scattered back */
+    size_t pixelSize = this->GetPixelSize();
+    unsigned _powTwo = NextPO2(this->width);
+    std::vector<uint8_t> native(width * pixelSize);
+#endif
+
+    Lock lock(this->mutex);
+
+    for (int row = y; row < y + height; row++)
+    {
+        uint8_t* block = this->WriteRows(row);
+
+#if defined(__3DS__)
+        uint8_t* pixels = native.data();
+        swizzle::TiledToLinear(block, _powTwo, x, row % BLOCK_ROWS, pixels, native.size(), width,
+                               1, pixelSize);
+#else
+        uint8_t* pixels = block + this->GetPixelOffset(x, row);
+#endif
+
+        toWide(pixels, wide.data(), width);
+        pixelmap::MapRow(operation, params, wide.data(), width);
+        fromWide(wide.data(), pixels, width);
+
+#if defined(__3DS__)
+        swizzle::LinearToTiled(pixels, native.size(), block, _powTwo, x, row % BLOCK_ROWS, width,
+                               1, pixelSize);
+#endif
+    }
+}
+
 ImageData::PixelSetFunction ImageData::GetPixelSetFunction(PixelFormat format)
 {
     switch (format)
@@ -502,6 +649,12 @@ ImageData::PixelSetFunction ImageData::GetPixelSetFunction(PixelFormat format)
             return setPixelRGBA8;
         case PIXELFORMAT_RGBA16:
             return setPixelRGBA16;
+#if not defined(__3DS__)
+        case PIXELFORMAT_RGB8:
+            return setPixelRGB8;
+        case PIXELFORMAT_R8:
+            return setPixelR8;
+#endif
         default:
             return nullptr;
     }
@@ -516,6 +669,12 @@ ImageData::PixelGetFunction ImageData::GetPixelGetFunction(PixelFormat format)
             return getPixelRGBA8;
         case PIXELFORMAT_RGBA16:
             return getPixelRGBA16;
+#if not defined(__3DS__)
+        case PIXELFORMAT_RGB8:
+            return getPixelRGB8;
+        case PIXELFORMAT_R8:
+            return getPixelR8;
+#endif
         default:
             return nullptr;
     }
@@ -539,14 +698,65 @@ thread::Mutex* ImageData::GetMutex() const
     return this->mutex;
 }
 
+void ImageData::SetAtomicOwner(const void* owner)
+{
+    this->atomicOwner = owner;
+}
+
+const void* ImageData::GetAtomicOwner() const
+{
+    return this->atomicOwner;
+}
+
 size_t ImageData::GetPixelSize() const
 {
     return love::GetPixelFormatSize(format);
 }
 
+/*
+** Callers write through this, so shared pixels are copied and joined first.
+** Not locked: the pointer outlives any lock taken here, callers hold the
+** ImageData mutex themselves when it matters.
+*/
 void* ImageData::GetData() const
 {
-    return this->data;
+    return this->storage.WriteContiguous();
+}
+
+/* joins the blocks if written to since, but pixels shared with a clone stay shared */
+const void* ImageData::ReadData() const
+{
+    Lock lock(this->mutex);
+    return this->storage.ReadContiguous();
+}
+
+size_t ImageData::GetBlockSize() const
+{
+    size_t pitch = this->width * this->GetPixelSize();
+
+    if (this->format == PIXELFORMAT_TEX3DS_RGBA8)
+        pitch = NextPO2(this->width) * this->GetPixelSize();
+
+    return BLOCK_ROWS * pitch;
+}
+
+const uint8_t* ImageData::ReadRows(int y) const
+{
+    return this->storage.ReadBlock((y / BLOCK_ROWS) * this->storage.GetBlockSize());
+}
+
+uint8_t* ImageData::WriteRows(int y)
+{
+    return this->storage.WriteBlock((y / BLOCK_ROWS) * this->storage.GetBlockSize());
+}
+
+size_t ImageData::GetPixelOffset(int x, int y) const
+{
+#if defined(__3DS__)
+    return coordToIndex(NextPO2(this->width), x, y % BLOCK_ROWS) * this->GetPixelSize();
+#else
+    return ((y % BLOCK_ROWS) * this->width + x) * this->GetPixelSize();
+#endif
 }
 
 bool ImageData::IsSRGB() const
@@ -558,6 +768,13 @@ bool ImageData::IsSRGB() const
 constexpr auto encodedFormats = BidirectionalMap<>::Create(
     "png", FormatHandler::ENCODED_PNG
 );
+
+constexpr auto mapOperations = BidirectionalMap<>::Create(
+    "tint",        ImageData::MAP_TINT,
+    "threshold",   ImageData::MAP_THRESHOLD,
+    "premultiply", ImageData::MAP_PREMULTIPLY,
+    "grayscale",   ImageData::MAP_GRAYSCALE
+);
 // clang-format on
 
 bool ImageData::GetConstant(const char* in, FormatHandler::EncodedFormat& out)
@@ -574,3 +791,18 @@ std::vector<const char*> ImageData::GetConstants(FormatHandler::EncodedFormat)
 {
     return encodedFormats.GetNames();
 }
+
+bool ImageData::GetConstant(const char* in, MapOperation& out)
+{
+    return mapOperations.Find(in, out);
+}
+
+bool ImageData::GetConstant(MapOperation in, const char*& out)
+{
+    return mapOperations.ReverseFind(in, out);
+}
+
+std::vector<const char*> ImageData::GetConstants(MapOperation)
+{
+    return mapOperations.GetNames();
+}
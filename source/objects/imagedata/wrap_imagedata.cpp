@@ -16,11 +16,25 @@
 
 using namespace love;
 
+/* one per Lua state, and so per love.thread, shared by its coroutines */
+static const void* getRegistry(lua_State* L)
+{
+    lua_pushvalue(L, LUA_REGISTRYINDEX);
+    const void* registry = lua_topointer(L, -1);
+    lua_pop(L, 1);
+
+    return registry;
+}
+
 int Wrap_ImageData::Clone(lua_State* L)
 {
     ImageData* self  = Wrap_ImageData::CheckImageData(L, 1);
     ImageData* clone = nullptr;
 
+    /* the mutex is ours already, cloning would wait on it forever */
+    if (self->GetAtomicOwner() == getRegistry(L))
+        return luaL_error(L, "Cannot clone an ImageData from inside its own mapPixel callback.");
+
     Luax::CatchException(L, [&]() { clone = self->Clone(); });
 
     Luax::PushType(L, clone);
@@ -192,12 +206,16 @@ int Wrap_ImageData::_MapPixelUnsafe(lua_State* L)
             if (components > 3)
                 color.a = (float)luaL_optnumber(L, -1, 1.0);
 
+            /* the callback may have cloned us, which shares the pixels again */
+            data  = reinterpret_cast<uint32_t*>(self->GetData());
+            pixel = reinterpret_cast<ImageData::Pixel*>(data + index);
+
             pixelsetfunction(color, pixel);
 
             lua_pop(L, 4); // Pop return values.
         }
     }
-#elif defined(__SWITCH__)
+#else
     uint8_t* data    = (uint8_t*)self->GetData();
     size_t pixelsize = self->GetPixelSize();
 
@@ -230,6 +248,10 @@ int Wrap_ImageData::_MapPixelUnsafe(lua_State* L)
             if (components > 3)
                 color.a = (float)luaL_optnumber(L, -1, 1.0);
 
+            /* the callback may have cloned us, which shares the pixels again */
+            data      = (uint8_t*)self->GetData();
+            pixeldata = (ImageData::Pixel*)(data + (y * imageWidth + x) * pixelsize);
+
             pixelsetfunction(color, pixeldata);
 
             lua_pop(L, 4); // Pop return values.
@@ -239,6 +261,50 @@ int Wrap_ImageData::_MapPixelUnsafe(lua_State* L)
     return 0;
 }
 
+/*
+** ImageData:mapPixels(operation, value, x, y, width, height)
+** @value is a {r, g, b, a} table for "tint", a number for "threshold"
+** and ignored otherwise. The whole image is used when no rectangle is given.
+*/
+int Wrap_ImageData::MapPixels(lua_State* L)
+{
+    ImageData* self = Wrap_ImageData::CheckImageData(L, 1);
+
+    const char* name = luaL_checkstring(L, 2);
+    ImageData::MapOperation operation;
+
+    if (!ImageData::GetConstant(name, operation))
+        return Luax::EnumError(L, "map operation", ImageData::GetConstants(operation), name);
+
+    Colorf value(1.0f, 1.0f, 1.0f, 1.0f);
+
+    if (operation == ImageData::MAP_TINT)
+    {
+        luaL_checktype(L, 3, LUA_TTABLE);
+
+        for (int index = 1; index <= 4; index++)
+            lua_rawgeti(L, 3, index);
+
+        value.r = (float)luaL_checknumber(L, -4);
+        value.g = (float)luaL_checknumber(L, -3);
+        value.b = (float)luaL_checknumber(L, -2);
+        value.a = (float)luaL_optnumber(L, -1, 1.0);
+
+        lua_pop(L, 4);
+    }
+    else if (operation == ImageData::MAP_THRESHOLD)
+        value.r = (float)luaL_checknumber(L, 3);
+
+    int x      = (int)luaL_optinteger(L, 4, 0);
+    int y      = (int)luaL_optinteger(L, 5, 0);
+    int width  = (int)luaL_optinteger(L, 6, self->GetWidth());
+    int height = (int)luaL_optinteger(L, 7, self->GetHeight());
+
+    Luax::CatchException(L, [&]() { self->MapPixels(operation, value, x, y, width, height); });
+
+    return 0;
+}
+
 int Wrap_ImageData::Paste(lua_State* L)
 {
     ImageData* t   = Wrap_ImageData::CheckImageData(L, 1);
@@ -287,6 +353,30 @@ int Wrap_ImageData::Encode(lua_State* L)
     return 1;
 }
 
+/* ImageData:encodeAsync lives in wrap_imagedata.lua, which tracks the callbacks */
+int Wrap_ImageData::_EncodeAsync(lua_State* L)
+{
+    ImageData* self = Wrap_ImageData::CheckImageData(L, 1);
+
+    FormatHandler::EncodedFormat format;
+    const char* formatStr = luaL_checkstring(L, 2);
+
+    if (!ImageData::GetConstant(formatStr, format))
+        return Luax::EnumError(L, "encoded image format", ImageData::GetConstants(format),
+                               formatStr);
+
+    std::string filename = "Image." + std::string(formatStr);
+
+    if (!lua_isnoneornil(L, 3))
+        filename = Luax::CheckString(L, 3);
+
+    int id = (int)luaL_checkinteger(L, 4);
+
+    Luax::CatchException(L, [&]() { self->EncodeAsync(format, filename.c_str(), id); });
+
+    return 0;
+}
+
 int Wrap_ImageData::_PerformAtomic(lua_State* L)
 {
     ImageData* self = Wrap_ImageData::CheckImageData(L, 1);
@@ -294,9 +384,12 @@ int Wrap_ImageData::_PerformAtomic(lua_State* L)
 
     {
         thread::Lock lock(self->GetMutex());
+        self->SetAtomicOwner(getRegistry(L));
 
         // call the function, passing any user-specified arguments.
         error = lua_pcall(L, lua_gettop(L) - 2, LUA_MULTRET, 0);
+
+        self->SetAtomicOwner(nullptr);
     }
 
     if (error != 0)
@@ -322,10 +415,12 @@ static constexpr luaL_Reg functions[] =
     { "getDimensions",   Wrap_ImageData::GetDimensions   },
     { "getPixel",        Wrap_ImageData::GetPixel        },
     { "setPixel",        Wrap_ImageData::SetPixel        },
+    { "mapPixels",       Wrap_ImageData::MapPixels       },
     { "paste",           Wrap_ImageData::Paste           },
     { "encode",          Wrap_ImageData::Encode          },
     { "_mapPixelUnsafe", Wrap_ImageData::_MapPixelUnsafe },
     { "_performAtomic",  Wrap_ImageData::_PerformAtomic  },
+    { "_encodeAsync",    Wrap_ImageData::_EncodeAsync    },
     { 0,                 0                               }
 };
 // clang-format on
@@ -0,0 +1,418 @@
+#include "objects/mesh/meshc.h"
+
+#include "common/bidirectionalmap.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace love::common;
+
+love::Type Mesh::type("Mesh", &Drawable::type);
+
+Mesh::Mesh(const std::vector<AttribFormat>& format, const void* data, size_t size,
+           DrawMode mode, Usage usage) :
+    vertexFormat(format),
+    layout(format),
+    vertexCount(0),
+    useVertexMap(false),
+    drawMode(mode),
+    usage(usage),
+    rangeStart(-1),
+    rangeCount(-1),
+    modifiedStart(0),
+    modifiedEnd(0),
+    vertexMapModified(false)
+{
+    if (size == 0 || (size % this->layout.stride) != 0)
+        throw love::Exception("Data size must be a multiple of the vertex stride (%zu bytes).",
+                              this->layout.stride);
+
+    this->vertexCount = size / this->layout.stride;
+
+    this->vertexData.resize(size);
+    std::memcpy(this->vertexData.data(), data, size);
+
+    this->vertexScratch.resize(this->layout.stride);
+
+    this->MarkModified(0, this->vertexCount);
+}
+
+Mesh::Mesh(const std::vector<AttribFormat>& format, int vertexCount, DrawMode mode,
+           Usage usage) :
+    vertexFormat(format),
+    layout(format),
+    vertexCount(0),
+    useVertexMap(false),
+    drawMode(mode),
+    usage(usage),
+    rangeStart(-1),
+    rangeCount(-1),
+    modifiedStart(0),
+    modifiedEnd(0),
+    vertexMapModified(false)
+{
+    if (vertexCount <= 0)
+        throw love::Exception("Invalid number of vertices (%d).", vertexCount);
+
+    this->vertexCount = (size_t)vertexCount;
+
+    this->vertexData.resize(this->vertexCount * this->layout.stride);
+    vertexformat::FillDefaults(this->layout, this->vertexData.data(), this->vertexCount);
+
+    this->vertexScratch.resize(this->layout.stride);
+
+    this->MarkModified(0, this->vertexCount);
+}
+
+Mesh::~Mesh()
+{}
+
+/* Vertices */
+
+void Mesh::SetVertices(size_t startVertex, const void* data, size_t size)
+{
+    if (startVertex >= this->vertexCount)
+        throw love::Exception("Invalid vertex index: %zu", startVertex + 1);
+
+    size_t count = std::min(size / this->layout.stride, this->vertexCount - startVertex);
+
+    std::memcpy(this->vertexData.data() + (startVertex * this->layout.stride), data,
+                count * this->layout.stride);
+
+    this->MarkModified(startVertex, count);
+}
+
+void Mesh::SetVertex(size_t index, const void* data, size_t size)
+{
+    if (index >= this->vertexCount)
+        throw love::Exception("Invalid vertex index: %zu", index + 1);
+
+    size = std::min(size, this->layout.stride);
+    std::memcpy(this->vertexData.data() + (index * this->layout.stride), data, size);
+
+    this->MarkModified(index, 1);
+}
+
+size_t Mesh::GetVertex(size_t index, void* data, size_t size) const
+{
+    if (index >= this->vertexCount)
+        throw love::Exception("Invalid vertex index: %zu", index + 1);
+
+    size = std::min(size, this->layout.stride);
+    std::memcpy(data, this->vertexData.data() + (index * this->layout.stride), size);
+
+    return size;
+}
+
+void* Mesh::GetVertexScratchBuffer()
+{
+    return this->vertexScratch.data();
+}
+
+void Mesh::SetVertexAttribute(size_t index, int attribIndex, const void* data, size_t size)
+{
+    if (index >= this->vertexCount)
+        throw love::Exception("Invalid vertex index: %zu", index + 1);
+
+    if (attribIndex < 0 || attribIndex >= (int)this->layout.attributes.size())
+        throw love::Exception("Invalid vertex attribute index: %d", attribIndex + 1);
+
+    const AttribInfo& info = this->layout.attributes[attribIndex];
+    size_t attribSize      = vertexformat::GetDataTypeSize(info.type) * info.components;
+
+    uint8_t* dst = this->vertexData.data() + (index * this->layout.stride) + info.offset;
+    std::memcpy(dst, data, std::min(size, attribSize));
+
+    this->MarkModified(index, 1);
+}
+
+size_t Mesh::GetVertexAttribute(size_t index, int attribIndex, void* data, size_t size) const
+{
+    if (index >= this->vertexCount)
+        throw love::Exception("Invalid vertex index: %zu", index + 1);
+
+    if (attribIndex < 0 || attribIndex >= (int)this->layout.attributes.size())
+        throw love::Exception("Invalid vertex attribute index: %d", attribIndex + 1);
+
+    const AttribInfo& info = this->layout.attributes[attribIndex];
+    size_t attribSize      = vertexformat::GetDataTypeSize(info.type) * info.components;
+
+    size = std::min(size, attribSize);
+
+    const uint8_t* src = this->vertexData.data() + (index * this->layout.stride) + info.offset;
+    std::memcpy(data, src, size);
+
+    return size;
+}
+
+size_t Mesh::GetVertexCount() const
+{
+    return this->vertexCount;
+}
+
+size_t Mesh::GetVertexStride() const
+{
+    return this->layout.stride;
+}
+
+const std::vector<Mesh::AttribFormat>& Mesh::GetVertexFormat() const
+{
+    return this->vertexFormat;
+}
+
+const Mesh::AttribInfo& Mesh::GetAttributeInfo(int attribIndex) const
+{
+    if (attribIndex < 0 || attribIndex >= (int)this->layout.attributes.size())
+        throw love::Exception("Invalid vertex attribute index: %d", attribIndex + 1);
+
+    return this->layout.attributes[attribIndex];
+}
+
+/* Vertex Map */
+
+void Mesh::SetVertexMap(const std::vector<uint32_t>& map)
+{
+    for (uint32_t index : map)
+    {
+        if (index >= this->vertexCount)
+            throw love::Exception("Invalid vertex map value: %u", index + 1);
+    }
+
+    this->vertexMap    = map;
+    this->useVertexMap = true;
+
+    this->vertexMapModified = true;
+}
+
+void Mesh::SetVertexMap()
+{
+    this->useVertexMap = false;
+
+    this->vertexMapModified = true;
+}
+
+bool Mesh::GetVertexMap(std::vector<uint32_t>& map) const
+{
+    if (!this->useVertexMap)
+        return false;
+
+    map = this->vertexMap;
+
+    return true;
+}
+
+size_t Mesh::GetIndexCount() const
+{
+    return this->useVertexMap ? this->vertexMap.size() : 0;
+}
+
+/* Draw State */
+
+void Mesh::SetTexture(love::Texture* texture)
+{
+    this->texture.Set(texture);
+}
+
+void Mesh::SetTexture()
+{
+    this->texture.Set(nullptr);
+}
+
+love::Texture* Mesh::GetTexture() const
+{
+    return this->texture.Get();
+}
+
+void Mesh::SetDrawMode(DrawMode mode)
+{
+    this->drawMode = mode;
+}
+
+Mesh::DrawMode Mesh::GetDrawMode() const
+{
+    return this->drawMode;
+}
+
+void Mesh::SetDrawRange(int start, int count)
+{
+    if (start < 0 || count <= 0)
+        throw love::Exception("Invalid draw range.");
+
+    this->rangeStart = start;
+    this->rangeCount = count;
+}
+
+void Mesh::SetDrawRange()
+{
+    this->rangeStart = this->rangeCount = -1;
+}
+
+bool Mesh::GetDrawRange(int& start, int& count) const
+{
+    if (this->rangeStart < 0 || this->rangeCount <= 0)
+        return false;
+
+    start = this->rangeStart;
+    count = this->rangeCount;
+
+    return true;
+}
+
+Mesh::Usage Mesh::GetUsage() const
+{
+    return this->usage;
+}
+
+void Mesh::Flush()
+{
+    this->ClearModified();
+}
+
+/* Modification Tracking */
+
+void Mesh::MarkModified(size_t start, size_t count)
+{
+    if (count == 0)
+        return;
+
+    if (!this->IsModified())
+    {
+        this->modifiedStart = start;
+        this->modifiedEnd   = start + count;
+
+        return;
+    }
+
+    this->modifiedStart = std::min(this->modifiedStart, start);
+    this->modifiedEnd   = std::max(this->modifiedEnd, start + count);
+}
+
+void Mesh::ClearModified()
+{
+    this->modifiedStart = this->modifiedEnd = 0;
+    this->vertexMapModified                 = false;
+}
+
+bool Mesh::IsModified() const
+{
+    return this->modifiedEnd > this->modifiedStart;
+}
+
+/* Attribute Decoding */
+
+void Mesh::GetStandardAttributes(size_t first, size_t count, Vector2* positions,
+                                 Vector2* texCoords, Colorf* colors) const
+{
+    first = std::min(first, this->vertexCount);
+    count = std::min(count, this->vertexCount - first);
+
+    const uint8_t* vertices = this->vertexData.data() + (first * this->layout.stride);
+
+    vertexformat::GetStandardAttributes(this->layout, vertices, count, positions, texCoords,
+                                        colors);
+}
+
+bool Mesh::GetDrawIndices(std::vector<uint32_t>& indices) const
+{
+    size_t total = this->useVertexMap ? this->vertexMap.size() : this->vertexCount;
+
+    size_t start = 0;
+    size_t count = total;
+
+    if (this->rangeStart >= 0 && this->rangeCount > 0)
+    {
+        start = std::min((size_t)this->rangeStart, total);
+        count = std::min((size_t)this->rangeCount, total - start);
+    }
+
+    if (count == 0)
+        return false;
+
+    indices.resize(count);
+
+    if (this->useVertexMap)
+        std::copy_n(this->vertexMap.begin() + start, count, indices.begin());
+    else
+    {
+        for (size_t index = 0; index < count; index++)
+            indices[index] = (uint32_t)(start + index);
+    }
+
+    return true;
+}
+
+/* Vertex Format */
+
+std::vector<Mesh::AttribFormat> Mesh::GetDefaultVertexFormat()
+{
+    return { { "VertexPosition", DATA_FLOAT, 2 },
+             { "VertexTexCoord", DATA_FLOAT, 2 },
+             { "VertexColor", DATA_UNORM8, 4 } };
+}
+
+// clang-format off
+constexpr auto drawModes = BidirectionalMap<>::Create(
+    "fan",       Mesh::DrawMode::DRAWMODE_FAN,
+    "strip",     Mesh::DrawMode::DRAWMODE_STRIP,
+    "triangles", Mesh::DrawMode::DRAWMODE_TRIANGLES,
+    "points",    Mesh::DrawMode::DRAWMODE_POINTS
+);
+
+constexpr auto usages = BidirectionalMap<>::Create(
+    "stream",  Mesh::Usage::USAGE_STREAM,
+    "dynamic", Mesh::Usage::USAGE_DYNAMIC,
+    "static",  Mesh::Usage::USAGE_STATIC
+);
+
+constexpr auto dataTypes = BidirectionalMap<>::Create(
+    "byte",    Mesh::DataType::DATA_UNORM8,
+    "unorm8",  Mesh::DataType::DATA_UNORM8,
+    "unorm16", Mesh::DataType::DATA_UNORM16,
+    "float",   Mesh::DataType::DATA_FLOAT
+);
+// clang-format on
+
+bool Mesh::GetConstant(const char* in, DrawMode& out)
+{
+    return drawModes.Find(in, out);
+}
+
+bool Mesh::GetConstant(DrawMode in, const char*& out)
+{
+    return drawModes.ReverseFind(in, out);
+}
+
+std::vector<const char*> Mesh::GetConstants(DrawMode)
+{
+    return drawModes.GetNames();
+}
+
+bool Mesh::GetConstant(const char* in, Usage& out)
+{
+    return usages.Find(in, out);
+}
+
+bool Mesh::GetConstant(Usage in, const char*& out)
+{
+    return usages.ReverseFind(in, out);
+}
+
+std::vector<const char*> Mesh::GetConstants(Usage)
+{
+    return usages.GetNames();
+}
+
+bool Mesh::GetConstant(const char* in, DataType& out)
+{
+    return dataTypes.Find(in, out);
+}
+
+bool Mesh::GetConstant(DataType in, const char*& out)
+{
+    return dataTypes.ReverseFind(in, out);
+}
+
+std::vector<const char*> Mesh::GetConstants(DataType)
+{
+    return dataTypes.GetNames();
+}
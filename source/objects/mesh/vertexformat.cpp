@@ -0,0 +1,212 @@
+#include "objects/mesh/vertexformat.h"
+
+#include "common/bidirectionalmap.h"
+#include "common/exception.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+using namespace love;
+
+vertexformat::Layout::Layout(const std::vector<AttribFormat>& format) : stride(0)
+{
+    if (format.empty())
+        throw love::Exception("Vertex format cannot be empty.");
+
+    std::fill_n(this->standard, (size_t)ATTRIB_MAX_ENUM, -1);
+
+    for (size_t index = 0; index < format.size(); index++)
+    {
+        const AttribFormat& attrib = format[index];
+
+        if (attrib.components <= 0 || attrib.components > MAX_ATTRIBUTE_COMPONENTS)
+            throw love::Exception("Vertex attributes must have between 1 and %d components.",
+                                  MAX_ATTRIBUTE_COMPONENTS);
+
+        for (size_t other = 0; other < index; other++)
+        {
+            if (format[other].name == attrib.name)
+                throw love::Exception("Duplicate vertex attribute name: %s",
+                                      attrib.name.c_str());
+        }
+
+        StandardAttribute standard;
+        if (vertexformat::GetConstant(attrib.name.c_str(), standard))
+            this->standard[standard] = (int)index;
+
+        this->attributes.push_back({ this->stride, attrib.type, attrib.components });
+        this->stride += GetDataTypeSize(attrib.type) * attrib.components;
+    }
+}
+
+size_t vertexformat::GetDataTypeSize(DataType type)
+{
+    switch (type)
+    {
+        case DATA_UNORM8:
+            return sizeof(uint8_t);
+        case DATA_UNORM16:
+            return sizeof(uint16_t);
+        case DATA_FLOAT:
+        default:
+            return sizeof(float);
+    }
+}
+
+void vertexformat::Pack(DataType type, int components, const float* in, void* out)
+{
+    switch (type)
+    {
+        case DATA_UNORM8:
+        {
+            uint8_t* dst = (uint8_t*)out;
+            for (int index = 0; index < components; index++)
+                dst[index] = (uint8_t)(std::clamp(in[index], 0.0f, 1.0f) * 0xFF + 0.5f);
+
+            break;
+        }
+        case DATA_UNORM16:
+        {
+            /* tightly packed, so this can sit at an odd offset */
+            uint8_t* dst = (uint8_t*)out;
+            for (int index = 0; index < components; index++)
+            {
+                uint16_t value = (uint16_t)(std::clamp(in[index], 0.0f, 1.0f) * 0xFFFF + 0.5f);
+                memcpy(dst + index * sizeof(uint16_t), &value, sizeof(uint16_t));
+            }
+
+            break;
+        }
+        case DATA_FLOAT:
+        default:
+            memcpy(out, in, components * sizeof(float));
+            break;
+    }
+}
+
+void vertexformat::Unpack(DataType type, int components, const void* in, float* out)
+{
+    switch (type)
+    {
+        case DATA_UNORM8:
+        {
+            const uint8_t* src = (const uint8_t*)in;
+            for (int index = 0; index < components; index++)
+                out[index] = src[index] / 255.0f;
+
+            break;
+        }
+        case DATA_UNORM16:
+        {
+            const uint8_t* src = (const uint8_t*)in;
+            for (int index = 0; index < components; index++)
+            {
+                uint16_t value;
+                memcpy(&value, src + index * sizeof(uint16_t), sizeof(uint16_t));
+
+                out[index] = value / 65535.0f;
+            }
+
+            break;
+        }
+        case DATA_FLOAT:
+        default:
+            memcpy(out, in, components * sizeof(float));
+            break;
+    }
+}
+
+void vertexformat::FillDefaults(const Layout& layout, uint8_t* vertices, size_t count)
+{
+    memset(vertices, 0, count * layout.stride);
+
+    int colorIndex = layout.standard[ATTRIB_COLOR];
+
+    if (colorIndex < 0)
+        return;
+
+    const float white[MAX_ATTRIBUTE_COMPONENTS] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    const AttribInfo& info                      = layout.attributes[colorIndex];
+
+    for (size_t index = 0; index < count; index++)
+        Pack(info.type, info.components, white, vertices + index * layout.stride + info.offset);
+}
+
+void vertexformat::GetStandardAttributes(const Layout& layout, const uint8_t* vertices,
+                                         size_t count, Vector2* positions, Vector2* texCoords,
+                                         Colorf* colors)
+{
+    const int posIndex   = layout.standard[ATTRIB_POSITION];
+    const int texIndex   = layout.standard[ATTRIB_TEXCOORD];
+    const int colorIndex = layout.standard[ATTRIB_COLOR];
+
+    float values[MAX_ATTRIBUTE_COMPONENTS];
+
+    for (size_t vertex = 0; vertex < count; vertex++)
+    {
+        const uint8_t* src = vertices + vertex * layout.stride;
+
+        if (positions != nullptr)
+        {
+            positions[vertex] = Vector2(0.0f, 0.0f);
+
+            if (posIndex >= 0)
+            {
+                const AttribInfo& info = layout.attributes[posIndex];
+                Unpack(info.type, info.components, src + info.offset, values);
+
+                positions[vertex].x = values[0];
+                positions[vertex].y = (info.components > 1) ? values[1] : 0.0f;
+            }
+        }
+
+        if (texCoords != nullptr)
+        {
+            texCoords[vertex] = Vector2(0.0f, 0.0f);
+
+            if (texIndex >= 0)
+            {
+                const AttribInfo& info = layout.attributes[texIndex];
+                Unpack(info.type, info.components, src + info.offset, values);
+
+                texCoords[vertex].x = values[0];
+                texCoords[vertex].y = (info.components > 1) ? values[1] : 0.0f;
+            }
+        }
+
+        if (colors != nullptr)
+        {
+            colors[vertex] = Colorf(1.0f, 1.0f, 1.0f, 1.0f);
+
+            if (colorIndex >= 0)
+            {
+                const AttribInfo& info = layout.attributes[colorIndex];
+                Unpack(info.type, info.components, src + info.offset, values);
+
+                colors[vertex].r = values[0];
+                colors[vertex].g = (info.components > 1) ? values[1] : 1.0f;
+                colors[vertex].b = (info.components > 2) ? values[2] : 1.0f;
+                colors[vertex].a = (info.components > 3) ? values[3] : 1.0f;
+            }
+        }
+    }
+}
+
+// clang-format off
+constexpr auto attributeNames = BidirectionalMap<>::Create(
+    "VertexPosition", vertexformat::StandardAttribute::ATTRIB_POSITION,
+    "VertexTexCoord", vertexformat::StandardAttribute::ATTRIB_TEXCOORD,
+    "VertexColor",    vertexformat::StandardAttribute::ATTRIB_COLOR
+);
+// clang-format on
+
+bool vertexformat::GetConstant(const char* in, StandardAttribute& out)
+{
+    return attributeNames.Find(in, out);
+}
+
+bool vertexformat::GetConstant(StandardAttribute in, const char*& out)
+{
+    return attributeNames.ReverseFind(in, out);
+}
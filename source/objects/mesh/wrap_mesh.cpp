@@ -0,0 +1,468 @@
+#include "objects/mesh/wrap_mesh.h"
+
+#include "objects/data/wrap_data.h"
+#include "objects/texture/wrap_texture.h"
+
+using namespace love;
+
+char* Wrap_Mesh::WriteAttributeData(lua_State* L, int startIndex, Mesh::DataType type,
+                                    int components, char* data)
+{
+    float values[Mesh::MAX_ATTRIBUTE_COMPONENTS];
+
+    /* normalized types default to 1 (e.g. opaque white), floats to 0 */
+    lua_Number fallback = (type == Mesh::DATA_FLOAT) ? 0.0 : 1.0;
+
+    for (int index = 0; index < components; index++)
+        values[index] = (float)luaL_optnumber(L, startIndex + index, fallback);
+
+    vertexformat::Pack(type, components, values, data);
+
+    return data + vertexformat::GetDataTypeSize(type) * components;
+}
+
+const char* Wrap_Mesh::ReadAttributeData(lua_State* L, Mesh::DataType type, int components,
+                                         const char* data)
+{
+    float values[Mesh::MAX_ATTRIBUTE_COMPONENTS];
+
+    vertexformat::Unpack(type, components, data, values);
+
+    for (int index = 0; index < components; index++)
+        lua_pushnumber(L, values[index]);
+
+    return data + vertexformat::GetDataTypeSize(type) * components;
+}
+
+int Wrap_Mesh::CheckVertexFormat(lua_State* L, int index, std::vector<Mesh::AttribFormat>& format)
+{
+    luaL_checktype(L, index, LUA_TTABLE);
+
+    int count = (int)lua_objlen(L, index);
+
+    for (int i = 1; i <= count; i++)
+    {
+        lua_rawgeti(L, index, i);
+        luaL_checktype(L, -1, LUA_TTABLE);
+
+        for (int field = 1; field <= 3; field++)
+            lua_rawgeti(L, -field, field);
+
+        Mesh::AttribFormat attrib {};
+
+        attrib.name = luaL_checkstring(L, -3);
+
+        const char* typeName = luaL_checkstring(L, -2);
+        if (!Mesh::GetConstant(typeName, attrib.type))
+            return Luax::EnumError(L, "vertex data type", Mesh::GetConstants(attrib.type),
+                                   typeName);
+
+        attrib.components = (int)luaL_checkinteger(L, -1);
+
+        if (attrib.components <= 0 || attrib.components > Mesh::MAX_ATTRIBUTE_COMPONENTS)
+            return luaL_error(L, "Number of vertex attribute components must be between 1 and %d "
+                                 "(got %d)",
+                              Mesh::MAX_ATTRIBUTE_COMPONENTS, attrib.components);
+
+        lua_pop(L, 4);
+
+        format.push_back(attrib);
+    }
+
+    return 0;
+}
+
+int Wrap_Mesh::SetVertices(lua_State* L)
+{
+    Mesh* self = Wrap_Mesh::CheckMesh(L, 1);
+
+    size_t startVertex = (size_t)luaL_optinteger(L, 3, 1) - 1;
+    size_t vertexCount = self->GetVertexCount();
+
+    if (startVertex >= vertexCount)
+        return luaL_error(L, "Invalid vertex start index (must be between 1 and %d)",
+                          (int)vertexCount);
+
+    size_t stride = self->GetVertexStride();
+
+    if (Luax::IsType(L, 2, Data::type))
+    {
+        Data* data = Wrap_Data::CheckData(L, 2);
+
+        size_t count = std::min(data->GetSize() / stride, vertexCount - startVertex);
+        count        = (size_t)luaL_optinteger(L, 4, count);
+
+        if (count * stride > data->GetSize())
+            return luaL_error(L, "Too many vertices for the given Data.");
+
+        Luax::CatchException(
+            L, [&]() { self->SetVertices(startVertex, data->GetData(), count * stride); });
+
+        return 0;
+    }
+
+    luaL_checktype(L, 2, LUA_TTABLE);
+
+    size_t count = std::min((size_t)lua_objlen(L, 2), vertexCount - startVertex);
+    count        = std::min((size_t)luaL_optinteger(L, 4, count), vertexCount - startVertex);
+
+    const auto& format = self->GetVertexFormat();
+
+    int totalComponents = 0;
+    for (const auto& attrib : format)
+        totalComponents += attrib.components;
+
+    std::vector<char> buffer(count * stride);
+
+    for (size_t vertex = 0; vertex < count; vertex++)
+    {
+        lua_rawgeti(L, 2, (int)vertex + 1);
+        luaL_checktype(L, -1, LUA_TTABLE);
+
+        for (int component = 1; component <= totalComponents; component++)
+            lua_rawgeti(L, -component, component);
+
+        char* dst    = buffer.data() + vertex * stride;
+        int position = -totalComponents;
+
+        for (size_t attrib = 0; attrib < format.size(); attrib++)
+        {
+            const Mesh::AttribInfo& info = self->GetAttributeInfo((int)attrib);
+
+            Wrap_Mesh::WriteAttributeData(L, position, info.type, info.components,
+                                          dst + info.offset);
+
+            position += info.components;
+        }
+
+        lua_pop(L, totalComponents + 1);
+    }
+
+    Luax::CatchException(
+        L, [&]() { self->SetVertices(startVertex, buffer.data(), buffer.size()); });
+
+    return 0;
+}
+
+int Wrap_Mesh::SetVertex(lua_State* L)
+{
+    Mesh* self   = Wrap_Mesh::CheckMesh(L, 1);
+    size_t index = (size_t)luaL_checkinteger(L, 2) - 1;
+
+    bool isTable = lua_istable(L, 3);
+
+    const auto& format = self->GetVertexFormat();
+    char* data         = (char*)self->GetVertexScratchBuffer();
+
+    int position = 1;
+
+    for (size_t attrib = 0; attrib < format.size(); attrib++)
+    {
+        const Mesh::AttribInfo& info = self->GetAttributeInfo((int)attrib);
+
+        if (isTable)
+        {
+            for (int component = 0; component < info.components; component++)
+                lua_rawgeti(L, 3, position + component);
+
+            Wrap_Mesh::WriteAttributeData(L, -info.components, info.type, info.components,
+                                          data + info.offset);
+
+            lua_pop(L, info.components);
+        }
+        else
+            Wrap_Mesh::WriteAttributeData(L, position + 2, info.type, info.components,
+                                          data + info.offset);
+
+        position += info.components;
+    }
+
+    Luax::CatchException(L, [&]() { self->SetVertex(index, data, self->GetVertexStride()); });
+
+    return 0;
+}
+
+int Wrap_Mesh::GetVertex(lua_State* L)
+{
+    Mesh* self   = Wrap_Mesh::CheckMesh(L, 1);
+    size_t index = (size_t)luaL_checkinteger(L, 2) - 1;
+
+    const auto& format = self->GetVertexFormat();
+    char* data         = (char*)self->GetVertexScratchBuffer();
+
+    Luax::CatchException(L, [&]() { self->GetVertex(index, data, self->GetVertexStride()); });
+
+    int count = 0;
+
+    for (size_t attrib = 0; attrib < format.size(); attrib++)
+    {
+        const Mesh::AttribInfo& info = self->GetAttributeInfo((int)attrib);
+
+        Wrap_Mesh::ReadAttributeData(L, info.type, info.components, data + info.offset);
+        count += info.components;
+    }
+
+    return count;
+}
+
+int Wrap_Mesh::SetVertexAttribute(lua_State* L)
+{
+    Mesh* self      = Wrap_Mesh::CheckMesh(L, 1);
+    size_t index    = (size_t)luaL_checkinteger(L, 2) - 1;
+    int attribIndex = (int)luaL_checkinteger(L, 3) - 1;
+
+    Mesh::AttribInfo info {};
+    Luax::CatchException(L, [&]() { info = self->GetAttributeInfo(attribIndex); });
+
+    char data[sizeof(float) * Mesh::MAX_ATTRIBUTE_COMPONENTS];
+    Wrap_Mesh::WriteAttributeData(L, 4, info.type, info.components, data);
+
+    Luax::CatchException(
+        L, [&]() { self->SetVertexAttribute(index, attribIndex, data, sizeof(data)); });
+
+    return 0;
+}
+
+int Wrap_Mesh::GetVertexAttribute(lua_State* L)
+{
+    Mesh* self      = Wrap_Mesh::CheckMesh(L, 1);
+    size_t index    = (size_t)luaL_checkinteger(L, 2) - 1;
+    int attribIndex = (int)luaL_checkinteger(L, 3) - 1;
+
+    Mesh::AttribInfo info {};
+    char data[sizeof(float) * Mesh::MAX_ATTRIBUTE_COMPONENTS];
+
+    Luax::CatchException(L, [&]() {
+        info = self->GetAttributeInfo(attribIndex);
+        self->GetVertexAttribute(index, attribIndex, data, sizeof(data));
+    });
+
+    Wrap_Mesh::ReadAttributeData(L, info.type, info.components, data);
+
+    return info.components;
+}
+
+int Wrap_Mesh::GetVertexCount(lua_State* L)
+{
+    Mesh* self = Wrap_Mesh::CheckMesh(L, 1);
+
+    lua_pushinteger(L, self->GetVertexCount());
+
+    return 1;
+}
+
+int Wrap_Mesh::GetVertexFormat(lua_State* L)
+{
+    Mesh* self = Wrap_Mesh::CheckMesh(L, 1);
+
+    const auto& format = self->GetVertexFormat();
+
+    lua_createtable(L, (int)format.size(), 0);
+
+    for (size_t index = 0; index < format.size(); index++)
+    {
+        const char* typeName = nullptr;
+        if (!Mesh::GetConstant(format[index].type, typeName))
+            return luaL_error(L, "Unknown vertex attribute data type.");
+
+        lua_createtable(L, 3, 0);
+
+        lua_pushstring(L, format[index].name.c_str());
+        lua_rawseti(L, -2, 1);
+
+        lua_pushstring(L, typeName);
+        lua_rawseti(L, -2, 2);
+
+        lua_pushinteger(L, format[index].components);
+        lua_rawseti(L, -2, 3);
+
+        lua_rawseti(L, -2, (int)index + 1);
+    }
+
+    return 1;
+}
+
+int Wrap_Mesh::SetVertexMap(lua_State* L)
+{
+    Mesh* self = Wrap_Mesh::CheckMesh(L, 1);
+
+    if (lua_isnoneornil(L, 2))
+    {
+        self->SetVertexMap();
+        return 0;
+    }
+
+    bool isTable = lua_istable(L, 2);
+    int count    = isTable ? (int)lua_objlen(L, 2) : lua_gettop(L) - 1;
+
+    std::vector<uint32_t> map;
+    map.reserve(count);
+
+    for (int index = 0; index < count; index++)
+    {
+        if (isTable)
+        {
+            lua_rawgeti(L, 2, index + 1);
+            map.push_back((uint32_t)(luaL_checkinteger(L, -1) - 1));
+            lua_pop(L, 1);
+        }
+        else
+            map.push_back((uint32_t)(luaL_checkinteger(L, index + 2) - 1));
+    }
+
+    Luax::CatchException(L, [&]() { self->SetVertexMap(map); });
+
+    return 0;
+}
+
+int Wrap_Mesh::GetVertexMap(lua_State* L)
+{
+    Mesh* self = Wrap_Mesh::CheckMesh(L, 1);
+
+    std::vector<uint32_t> map;
+
+    if (!self->GetVertexMap(map))
+    {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    lua_createtable(L, (int)map.size(), 0);
+
+    for (size_t index = 0; index < map.size(); index++)
+    {
+        lua_pushinteger(L, map[index] + 1);
+        lua_rawseti(L, -2, (int)index + 1);
+    }
+
+    return 1;
+}
+
+int Wrap_Mesh::SetTexture(lua_State* L)
+{
+    Mesh* self = Wrap_Mesh::CheckMesh(L, 1);
+
+    if (lua_isnoneornil(L, 2))
+        self->SetTexture();
+    else
+    {
+        Texture* texture = Wrap_Texture::CheckTexture(L, 2);
+        Luax::CatchException(L, [&]() { self->SetTexture(texture); });
+    }
+
+    return 0;
+}
+
+int Wrap_Mesh::GetTexture(lua_State* L)
+{
+    Mesh* self       = Wrap_Mesh::CheckMesh(L, 1);
+    Texture* texture = self->GetTexture();
+
+    if (texture == nullptr)
+        return 0;
+
+    Luax::PushType(L, texture);
+
+    return 1;
+}
+
+int Wrap_Mesh::SetDrawMode(lua_State* L)
+{
+    Mesh* self       = Wrap_Mesh::CheckMesh(L, 1);
+    const char* name = luaL_checkstring(L, 2);
+
+    Mesh::DrawMode mode;
+    if (!Mesh::GetConstant(name, mode))
+        return Luax::EnumError(L, "mesh draw mode", Mesh::GetConstants(mode), name);
+
+    self->SetDrawMode(mode);
+
+    return 0;
+}
+
+int Wrap_Mesh::GetDrawMode(lua_State* L)
+{
+    Mesh* self = Wrap_Mesh::CheckMesh(L, 1);
+
+    const char* name = nullptr;
+    Mesh::GetConstant(self->GetDrawMode(), name);
+
+    lua_pushstring(L, name);
+
+    return 1;
+}
+
+int Wrap_Mesh::SetDrawRange(lua_State* L)
+{
+    Mesh* self = Wrap_Mesh::CheckMesh(L, 1);
+
+    if (lua_isnoneornil(L, 2))
+        self->SetDrawRange();
+    else
+    {
+        int start = (int)luaL_checkinteger(L, 2) - 1;
+        int count = (int)luaL_checkinteger(L, 3);
+
+        Luax::CatchException(L, [&]() { self->SetDrawRange(start, count); });
+    }
+
+    return 0;
+}
+
+int Wrap_Mesh::GetDrawRange(lua_State* L)
+{
+    Mesh* self = Wrap_Mesh::CheckMesh(L, 1);
+
+    int start = 0;
+    int count = 0;
+
+    if (!self->GetDrawRange(start, count))
+        return 0;
+
+    lua_pushinteger(L, start + 1);
+    lua_pushinteger(L, count);
+
+    return 2;
+}
+
+int Wrap_Mesh::Flush(lua_State* L)
+{
+    Mesh* self = Wrap_Mesh::CheckMesh(L, 1);
+
+    Luax::CatchException(L, [&]() { self->Flush(); });
+
+    return 0;
+}
+
+Mesh* Wrap_Mesh::CheckMesh(lua_State* L, int index)
+{
+    return Luax::CheckType<Mesh>(L, index);
+}
+
+// clang-format off
+static constexpr luaL_Reg functions[] =
+{
+    { "flush",              Wrap_Mesh::Flush              },
+    { "getDrawMode",        Wrap_Mesh::GetDrawMode        },
+    { "getDrawRange",       Wrap_Mesh::GetDrawRange       },
+    { "getTexture",         Wrap_Mesh::GetTexture         },
+    { "getVertex",          Wrap_Mesh::GetVertex          },
+    { "getVertexAttribute", Wrap_Mesh::GetVertexAttribute },
+    { "getVertexCount",     Wrap_Mesh::GetVertexCount     },
+    { "getVertexFormat",    Wrap_Mesh::GetVertexFormat    },
+    { "getVertexMap",       Wrap_Mesh::GetVertexMap       },
+    { "setDrawMode",        Wrap_Mesh::SetDrawMode        },
+    { "setDrawRange",       Wrap_Mesh::SetDrawRange       },
+    { "setTexture",         Wrap_Mesh::SetTexture         },
+    { "setVertex",          Wrap_Mesh::SetVertex          },
+    { "setVertexAttribute", Wrap_Mesh::SetVertexAttribute },
+    { "setVertexMap",       Wrap_Mesh::SetVertexMap       },
+    { "setVertices",        Wrap_Mesh::SetVertices        },
+    { 0,                    0                             }
+};
+// clang-format on
+
+int Wrap_Mesh::Register(lua_State* L)
+{
+    return Luax::RegisterType(L, &Mesh::type, functions, nullptr);
+}
@@ -4,14 +4,38 @@ using namespace love;
 
 love::Type Object::type("Object", nullptr);
 
-Object::Object(const Object& /* other */) : count(1)
-{}
+static std::atomic<int64_t> liveObjects(0);
 
-Object::Object() : count(1)
-{}
+Object::Object(const Object& /* other */) : count(1), liveType(nullptr)
+{
+    liveObjects.fetch_add(1, std::memory_order_relaxed);
+}
+
+Object::Object() : count(1), liveType(nullptr)
+{
+    liveObjects.fetch_add(1, std::memory_order_relaxed);
+}
 
 Object::~Object()
-{}
+{
+    liveObjects.fetch_sub(1, std::memory_order_relaxed);
+
+    if (love::Type* type = this->liveType.load(std::memory_order_relaxed))
+        type->AddLive(-1);
+}
+
+void Object::SetLiveType(love::Type& type)
+{
+    love::Type* expected = nullptr;
+
+    if (this->liveType.compare_exchange_strong(expected, &type, std::memory_order_relaxed))
+        type.AddLive(1);
+}
+
+int64_t Object::GetLiveCount()
+{
+    return liveObjects.load(std::memory_order_relaxed);
+}
 
 int Object::GetReferenceCount() const
 {
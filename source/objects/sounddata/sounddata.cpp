@@ -1,15 +1,26 @@
 #include "objects/sounddata/sounddata.h"
 
+#include "modules/thread/types/lock.h"
+
+#include <atomic>
+
 using namespace love;
+using thread::Lock;
 
 love::Type SoundData::type("SoundData", &Data::type);
 
+uint64_t SoundData::NextContentId()
+{
+    static std::atomic<uint64_t> next = 1;
+    return next++;
+}
+
 SoundData::SoundData(Decoder* decoder) :
-    data(0),
     size(0),
     sampleRate(Decoder::DEFAULT_SAMPLE_RATE),
     bitDepth(0),
-    channels(0)
+    channels(0),
+    contentId(NextContentId())
 {
     if (decoder->GetBitDepth() != 8 && decoder->GetBitDepth() != 16)
         throw love::Exception("Invalid bit depth: %d.", decoder->GetBitDepth());
@@ -17,6 +28,8 @@ SoundData::SoundData(Decoder* decoder) :
     size_t bufferSize = 524288;
     int decoded       = decoder->Decode();
 
+    uint8_t* data = nullptr;
+
     while (decoded > 0)
     {
         if (!data || bufferSize < this->size + decoded)
@@ -45,47 +58,48 @@ SoundData::SoundData(Decoder* decoder) :
     if (data && bufferSize > size)
         data = (uint8_t*)realloc(data, size);
 
+    if (data)
+        this->storage = CowBuffer(data, size, BLOCK_SIZE, [](uint8_t* memory) { free(memory); });
+
     this->channels   = decoder->GetChannelCount();
     this->bitDepth   = decoder->GetBitDepth();
     this->sampleRate = decoder->GetSampleRate();
 }
 
 SoundData::SoundData(const SoundData& other) :
-    data(0),
-    size(0),
-    sampleRate(0),
-    bitDepth(0),
-    channels(0)
+    size(other.size),
+    sampleRate(other.sampleRate),
+    bitDepth(other.bitDepth),
+    channels(other.channels)
 {
-    this->Load(other.GetSampleCount(), other.GetSampleRate(), other.GetBitDepth(),
-               other.GetChannelCount(), other.GetData());
+    Lock lock(other.mutex);
+
+    this->storage   = other.storage;
+    this->contentId = (other.contentId != 0) ? other.contentId : NextContentId();
 }
 
 SoundData::SoundData(int samples, int sampleRate, int bitDepth, int channels) :
-    data(0),
     size(0),
     sampleRate(0),
     bitDepth(0),
-    channels(0)
+    channels(0),
+    contentId(NextContentId())
 {
     this->Load(samples, sampleRate, bitDepth, channels);
 }
 
 SoundData::SoundData(void* data, int samples, int sampleRate, int bitDepth, int channels) :
-    data(0),
     size(0),
     sampleRate(0),
     bitDepth(0),
-    channels(0)
+    channels(0),
+    contentId(NextContentId())
 {
     this->Load(samples, sampleRate, bitDepth, channels, data);
 }
 
 SoundData::~SoundData()
-{
-    if (this->data != 0)
-        free(this->data);
-}
+{}
 
 void SoundData::Load(int samples, int sampleRate, int bitDepth, int channels, void* newData)
 {
@@ -101,13 +115,7 @@ void SoundData::Load(int samples, int sampleRate, int bitDepth, int channels, vo
     if (channels <= 0)
         throw love::Exception("Invalid channel count: %d", channels);
 
-    if (this->data != 0)
-    {
-        free(this->data);
-        this->data = 0;
-    }
-
-    this->size       = samples * (bitDepth * 8) * channels;
+    this->size       = samples * (bitDepth / 8) * channels;
     this->sampleRate = sampleRate;
     this->bitDepth   = bitDepth;
     this->channels   = channels;
@@ -118,15 +126,13 @@ void SoundData::Load(int samples, int sampleRate, int bitDepth, int channels, vo
     if (realSize > std::numeric_limits<size_t>::max())
         throw love::Exception("Data is too big!");
 
-    this->data = (uint8_t*)malloc(size);
-
-    if (!this->data)
-        throw love::Exception("Not enough memory.");
+    this->storage = CowBuffer(size, BLOCK_SIZE);
+    uint8_t* data = this->storage.WriteContiguous();
 
     if (newData)
-        memcpy(this->data, newData, size);
+        memcpy(data, newData, size);
     else
-        memset(this->data, (bitDepth == 8) ? 128 : 0, size);
+        memset(data, (bitDepth == 8) ? 128 : 0, size);
 }
 
 SoundData* SoundData::Clone() const
@@ -136,7 +142,16 @@ SoundData* SoundData::Clone() const
 
 void* SoundData::GetData() const
 {
-    return this->data;
+    Lock lock(this->mutex);
+
+    this->contentId = 0;
+    return this->storage.WriteContiguous();
+}
+
+const void* SoundData::ReadData() const
+{
+    Lock lock(this->mutex);
+    return this->storage.ReadContiguous();
 }
 
 size_t SoundData::GetSize() const
@@ -179,13 +194,21 @@ void SoundData::SetSample(int i, float sample)
     ** 8-bit sample values are unsigned internally.
     */
 
+    size_t offset = i * (this->bitDepth / 8);
+
+    Lock lock(this->mutex);
+    uint8_t* data = this->storage.WriteBlock(offset) + offset % BLOCK_SIZE;
+
+    if (this->contentId != 0)
+        this->contentId = NextContentId();
+
     if (bitDepth == 16)
     {
-        int16_t* ptrSample = (int16_t*)this->data;
-        ptrSample[i]       = (int16_t)(sample * (float)std::numeric_limits<int16_t>::max());
+        int16_t* ptrSample = (int16_t*)data;
+        *ptrSample         = (int16_t)(sample * (float)std::numeric_limits<int16_t>::max());
     }
     else
-        this->data[i] = (uint8_t)((sample * 127.0f) + 128.0f);
+        *data = (uint8_t)((sample * 127.0f) + 128.0f);
 }
 
 void SoundData::SetSample(int i, int channel, float sample)
@@ -201,13 +224,18 @@ float SoundData::GetSample(int i) const
     if (i < 0 || (size_t)i >= this->size / (this->bitDepth / 8))
         throw love::Exception("Attempt to get out-of-range sample!");
 
+    size_t offset = i * (this->bitDepth / 8);
+
+    Lock lock(this->mutex);
+    const uint8_t* data = this->storage.ReadBlock(offset) + offset % BLOCK_SIZE;
+
     if (this->bitDepth == 16)
     {
-        int16_t* ptrSample = (int16_t*)this->data;
-        return (float)ptrSample[i] / (float)std::numeric_limits<int16_t>::max();
+        const int16_t* ptrSample = (const int16_t*)data;
+        return (float)*ptrSample / (float)std::numeric_limits<int16_t>::max();
     }
     else
-        return ((float)this->data[i] - 128.0f) / 127.0f;
+        return ((float)*data - 128.0f) / 127.0f;
 }
 
 float SoundData::GetSample(int i, int channel) const
@@ -217,3 +245,9 @@ float SoundData::GetSample(int i, int channel) const
 
     return this->GetSample(i * this->channels + (channel - 1));
 }
+
+uint64_t SoundData::GetContentId() const
+{
+    Lock lock(this->mutex);
+    return this->contentId;
+}
@@ -0,0 +1,301 @@
+#include "objects/source/resampler.h"
+
+#include "common/bidirectionalmap.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string.h>
+
+#if defined(__ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(__ARM_FEATURE_SIMD32)
+    #include <arm_acle.h>
+#endif
+
+using namespace love;
+
+namespace
+{
+    constexpr int COEFFICIENT_SHIFT = 14;
+
+    struct Kernel
+    {
+        int taps;
+        double beta;
+    };
+
+    /* taps stay a multiple of four for the vector loops */
+    constexpr Kernel KERNELS[Resampler::QUALITY_MAX_ENUM] = {
+        { 4, 4.0 },
+        { 16, 6.0 },
+        { 32, 8.6 },
+    };
+
+    double besselI0(double x)
+    {
+        double sum  = 1.0;
+        double term = 1.0;
+
+        for (int k = 1; term > sum * 1e-12; k++)
+        {
+            double factor = x / (2.0 * k);
+
+            term *= factor * factor;
+            sum += term;
+        }
+
+        return sum;
+    }
+
+    inline int32_t dot(const int16_t* samples, const int16_t* coefficients, int count)
+    {
+#if defined(__ARM_NEON)
+        int32x4_t sum = vdupq_n_s32(0);
+
+        for (int index = 0; index < count; index += 4)
+            sum = vmlal_s16(sum, vld1_s16(samples + index), vld1_s16(coefficients + index));
+
+        int32x2_t half = vadd_s32(vget_low_s32(sum), vget_high_s32(sum));
+
+        return vget_lane_s32(vpadd_s32(half, half), 0);
+#elif defined(__ARM_FEATURE_SIMD32)
+        /* two multiply-adds per instruction on the 3DS's ARM11 */
+        int32_t sum = 0;
+
+        for (int index = 0; index < count; index += 2)
+        {
+            int16x2_t pair, weights;
+
+            memcpy(&pair, samples + index, sizeof(pair));
+            memcpy(&weights, coefficients + index, sizeof(weights));
+
+            sum = __smlad(pair, weights, sum);
+        }
+
+        return sum;
+#else
+        int32_t sum = 0;
+
+        for (int index = 0; index < count; index++)
+            sum += samples[index] * coefficients[index];
+
+        return sum;
+#endif
+    }
+} // namespace
+
+#if defined(__3DS__)
+std::atomic<Resampler::Quality> Resampler::defaultQuality = Resampler::QUALITY_FAST;
+#else
+std::atomic<Resampler::Quality> Resampler::defaultQuality = Resampler::QUALITY_MEDIUM;
+#endif
+
+Resampler::Resampler(int channels, double inputRate, double outputRate, Quality quality) :
+    channels(std::clamp(channels, 1, MAX_CHANNELS)),
+    taps(KERNELS[quality].taps),
+    inputRate(inputRate),
+    outputRate(outputRate),
+    pitch(1.0),
+    cutoff(0.0),
+    quality(quality),
+    flushed(false)
+{
+    this->UpdateStep();
+    this->Reset();
+}
+
+void Resampler::SetPitch(double pitch)
+{
+    this->pitch = pitch;
+    this->UpdateStep();
+}
+
+/*
+** Going down in rate, the kernel's cutoff has to follow or what's above
+** the new Nyquist folds back. It's kept to 1/64 steps so that sliding
+** the pitch doesn't rebuild the table every frame.
+*/
+void Resampler::UpdateStep()
+{
+    double ratio = (this->inputRate * this->pitch) / this->outputRate;
+
+    this->step = (uint64_t)(ratio * 4294967296.0);
+
+    double cutoff = std::round(std::min(1.0, 1.0 / ratio) * 64.0) / 64.0;
+    cutoff        = std::max(cutoff, 1.0 / 64.0);
+
+    if (cutoff != this->cutoff)
+        this->BuildTable(cutoff);
+}
+
+/*
+** Row p holds the weights for an output frame p / PHASES of the way past
+** input frame i, applied to frames i - (taps / 2 - 1) to i + taps / 2.
+** Each row is scaled to sum to exactly 1 << COEFFICIENT_SHIFT.
+*/
+void Resampler::BuildTable(double cutoff)
+{
+    const int half    = this->taps / 2;
+    const double beta = KERNELS[this->quality].beta;
+    const double norm = besselI0(beta);
+
+    this->cutoff = cutoff;
+    this->table.resize(PHASES * this->taps);
+
+    std::vector<double> row(this->taps);
+
+    for (int phase = 0; phase < PHASES; phase++)
+    {
+        double sum = 0.0;
+
+        for (int tap = 0; tap < this->taps; tap++)
+        {
+            double x = tap - (half - 1) - (double)phase / PHASES;
+            double t = x / half;
+
+            double window = besselI0(beta * std::sqrt(std::max(0.0, 1.0 - t * t))) / norm;
+            double sinc   = (x == 0.0) ? 1.0 : std::sin(M_PI * cutoff * x) / (M_PI * cutoff * x);
+
+            row[tap] = cutoff * sinc * window;
+            sum += row[tap];
+        }
+
+        int16_t* weights = this->table.data() + phase * this->taps;
+
+        int total   = 0;
+        int largest = 0;
+
+        for (int tap = 0; tap < this->taps; tap++)
+        {
+            weights[tap] = (int16_t)std::lround(row[tap] / sum * (1 << COEFFICIENT_SHIFT));
+            total += weights[tap];
+
+            if (weights[tap] > weights[largest])
+                largest = tap;
+        }
+
+        weights[largest] += (1 << COEFFICIENT_SHIFT) - total;
+    }
+}
+
+void Resampler::Reset()
+{
+    const int half = this->taps / 2;
+
+    for (int channel = 0; channel < this->channels; channel++)
+        this->history[channel].assign(half - 1, 0);
+
+    this->position = (uint64_t)(half - 1) << 32;
+    this->flushed  = false;
+}
+
+void Resampler::Push(const int16_t* samples, int frames)
+{
+    for (int channel = 0; channel < this->channels; channel++)
+    {
+        std::vector<int16_t>& history = this->history[channel];
+
+        size_t start = history.size();
+        history.resize(start + frames);
+
+        for (int frame = 0; frame < frames; frame++)
+            history[start + frame] = samples[frame * this->channels + channel];
+    }
+}
+
+void Resampler::Flush()
+{
+    if (this->flushed)
+        return;
+
+    this->flushed = true;
+
+    for (int channel = 0; channel < this->channels; channel++)
+        this->history[channel].resize(this->history[channel].size() + this->taps / 2, 0);
+}
+
+int Resampler::Pull(int16_t* out, int frames)
+{
+    const int half   = this->taps / 2;
+    size_t available = this->history[0].size();
+
+    int made = 0;
+
+    for (; made < frames; made++)
+    {
+        size_t index = this->position >> 32;
+
+        if (index + half >= available)
+            break;
+
+        size_t phase           = (this->position >> (32 - 8)) & (PHASES - 1);
+        const int16_t* weights = this->table.data() + phase * this->taps;
+
+        size_t first = index - (half - 1);
+
+        for (int channel = 0; channel < this->channels; channel++)
+        {
+            int32_t sum = dot(this->history[channel].data() + first, weights, this->taps);
+            sum         = (sum + (1 << (COEFFICIENT_SHIFT - 1))) >> COEFFICIENT_SHIFT;
+
+            out[made * this->channels + channel] = (int16_t)std::clamp(sum, -32768, 32767);
+        }
+
+        this->position += this->step;
+    }
+
+    /* keep only what the next output frame still reads */
+    size_t index = std::min<size_t>(this->position >> 32, available);
+    size_t drop  = (index > (size_t)(half - 1)) ? index - (half - 1) : 0;
+
+    if (drop > 0)
+    {
+        for (int channel = 0; channel < this->channels; channel++)
+        {
+            auto& history = this->history[channel];
+            history.erase(history.begin(), history.begin() + drop);
+        }
+
+        this->position -= (uint64_t)drop << 32;
+    }
+
+    return made;
+}
+
+double Resampler::ToInputFrames(double frames) const
+{
+    return frames * (this->inputRate * this->pitch) / this->outputRate;
+}
+
+void Resampler::SetDefaultQuality(Quality quality)
+{
+    defaultQuality = quality;
+}
+
+Resampler::Quality Resampler::GetDefaultQuality()
+{
+    return defaultQuality;
+}
+
+// clang-format off
+constexpr auto qualities = BidirectionalMap<>::Create(
+    "fast",   Resampler::Quality::QUALITY_FAST,
+    "medium", Resampler::Quality::QUALITY_MEDIUM,
+    "best",   Resampler::Quality::QUALITY_BEST
+);
+// clang-format on
+
+bool Resampler::GetConstant(const char* in, Quality& out)
+{
+    return qualities.Find(in, out);
+}
+
+bool Resampler::GetConstant(Quality in, const char*& out)
+{
+    return qualities.ReverseFind(in, out);
+}
+
+std::vector<const char*> Resampler::GetConstants(Quality)
+{
+    return qualities.GetNames();
+}
@@ -4,20 +4,20 @@
 #include "common/bidirectionalmap.h"
 #include "objects/source/source.h"
 
+#include <cmath>
+
 using namespace love::common;
 
 love::Type Source::type("Source", &Object::type);
 
-Source::Source(Pool* pool, SoundData* sound) :
+Source::Source(Pool* pool, SoundData* sound, StaticDataBuffer* buffer) :
     sourceType(Source::TYPE_STATIC),
     sampleRate(sound->GetSampleRate()),
     channels(sound->GetChannelCount()),
     bitDepth(sound->GetBitDepth()),
-    pool(pool)
-{
-    this->staticBuffer.Set(new StaticDataBuffer(sound->GetData(), sound->GetSize()),
-                           Acquire::NORETAIN);
-}
+    pool(pool),
+    staticBuffer(buffer)
+{}
 
 Source::Source(Pool* pool, Decoder* decoder) :
     sourceType(Source::TYPE_STREAM),
@@ -27,7 +27,14 @@ Source::Source(Pool* pool, Decoder* decoder) :
     bitDepth(decoder->GetBitDepth()),
     pool(pool),
     decoder(decoder)
-{}
+{
+    if (this->bitDepth == 16)
+    {
+        this->resampler = std::make_unique<Resampler>(this->channels, this->sampleRate,
+                                                      love::driver::Audrv::OUTPUT_RATE,
+                                                      Resampler::GetDefaultQuality());
+    }
+}
 
 Source::Source(const Source& other) :
     sourceType(other.sourceType),
@@ -41,12 +48,21 @@ Source::Source(const Source& other) :
     sampleRate(other.sampleRate),
     channels(other.channels),
     bitDepth(other.bitDepth),
+    pitch(other.pitch),
     pool(other.pool),
     decoder(nullptr),
     staticBuffer(other.staticBuffer)
 {
     if (this->sourceType == TYPE_STREAM && other.decoder.Get())
         this->decoder.Set(other.decoder->Clone(), Acquire::NORETAIN);
+
+    if (other.resampler)
+    {
+        this->resampler = std::make_unique<Resampler>(this->channels, this->sampleRate,
+                                                      love::driver::Audrv::OUTPUT_RATE,
+                                                      other.resampler->GetQuality());
+        this->resampler->SetPitch(this->pitch);
+    }
 }
 
 void Source::TeardownAtomic()
@@ -60,6 +76,10 @@ void Source::TeardownAtomic()
         case TYPE_STREAM:
             this->decoder->Rewind();
             this->InitializeStreamBuffers(this->decoder.Get());
+
+            if (this->resampler)
+                this->resampler->Reset();
+
             break;
         case TYPE_QUEUE:
         default:
@@ -68,6 +88,8 @@ void Source::TeardownAtomic()
 
     this->valid         = false;
     this->offsetSamples = 0;
+
+    this->pitchOutputFrames = this->pitchInputFrames = 0.0;
 }
 
 bool Source::Play()
@@ -251,7 +273,95 @@ void Source::Seek(double offset, Source::Unit unit)
         return;
     }
 
-    this->offsetSamples = offsetSamples;
+    this->offsetSamples     = offsetSamples;
+    this->pitchOutputFrames = this->pitchInputFrames = 0.0;
+}
+
+void Source::SetPitch(float pitch)
+{
+    if (!std::isfinite(pitch) || pitch <= 0.0f)
+        throw love::Exception("Pitch has to be non-zero, positive, finite number.");
+
+    thread::Lock lock = this->pool->Lock();
+
+    this->pitch = pitch;
+
+    if (this->resampler)
+    {
+        /* what played so far went at the old pitch */
+        if (this->valid)
+        {
+            double played = this->GetSampleOffset();
+            double frames = played - this->pitchOutputFrames;
+
+            this->pitchInputFrames += this->resampler->ToInputFrames(frames);
+            this->pitchOutputFrames = played;
+        }
+
+        this->resampler->SetPitch(pitch);
+    }
+    else if (this->valid)
+        this->ApplyPitch();
+}
+
+float Source::GetPitch() const
+{
+    return this->pitch;
+}
+
+double Source::GetChannelRate() const
+{
+    if (this->resampler)
+        return love::driver::Audrv::OUTPUT_RATE;
+
+    return this->sampleRate;
+}
+
+float Source::GetChannelPitch() const
+{
+    return (this->resampler) ? 1.0f : this->pitch;
+}
+
+/*
+** Pull from the resampler until the buffer is full, feeding it from the
+** decoder as it runs dry. At the end of a looping stream the decoder is
+** rewound, otherwise the resampler is flushed to let its tail out.
+*/
+int Source::DecodeStream(s16* buffer)
+{
+    if (!this->resampler)
+        return this->decoder->Decode(buffer);
+
+    const int frameSize = this->channels * sizeof(s16);
+    const int frames    = this->decoder->GetSize() / frameSize;
+
+    int made     = 0;
+    bool rewound = false;
+
+    while (made < frames)
+    {
+        made += this->resampler->Pull(buffer + made * this->channels, frames - made);
+
+        if (made == frames || this->resampler->IsFlushed())
+            break;
+
+        int decoded = this->decoder->Decode();
+
+        if (decoded > 0)
+        {
+            this->resampler->Push((const int16_t*)this->decoder->GetBuffer(), decoded / frameSize);
+            rewound = false;
+        }
+        else if (this->IsLooping() && !rewound)
+        {
+            this->decoder->Rewind();
+            rewound = true;
+        }
+        else
+            this->resampler->Flush();
+    }
+
+    return made * frameSize;
 }
 
 void Source::SetMinVolume(float volume)
@@ -276,7 +386,18 @@ double Source::Tell(Source::Unit unit)
     double offset = 0;
 
     if (this->valid)
-        offset = this->offsetSamples + this->GetSampleOffset();
+    {
+        double played = this->GetSampleOffset();
+
+        /* the channel plays output frames, only those since the last pitch change are converted */
+        if (this->resampler)
+        {
+            played = this->pitchInputFrames +
+                     this->resampler->ToInputFrames(played - this->pitchOutputFrames);
+        }
+
+        offset = this->offsetSamples + played;
+    }
 
     if (unit == UNIT_SECONDS)
         return offset / (double)this->sampleRate;
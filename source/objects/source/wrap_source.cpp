@@ -48,6 +48,25 @@ int Wrap_Source::GetType(lua_State* L)
     return 1;
 }
 
+int Wrap_Source::GetPitch(lua_State* L)
+{
+    Source* self = Wrap_Source::CheckSource(L, 1);
+
+    lua_pushnumber(L, self->GetPitch());
+
+    return 1;
+}
+
+int Wrap_Source::SetPitch(lua_State* L)
+{
+    Source* self = Wrap_Source::CheckSource(L, 1);
+    float pitch  = luaL_checknumber(L, 2);
+
+    Luax::CatchException(L, [&]() { self->SetPitch(pitch); });
+
+    return 0;
+}
+
 int Wrap_Source::GetVolume(lua_State* L)
 {
     Source* self = Wrap_Source::CheckSource(L, 1);
@@ -209,6 +228,7 @@ static constexpr luaL_Reg functions[] =
     { "getChannelCount",    Wrap_Source::GetChannelCount    },
     { "getDuration",        Wrap_Source::GetDuration        },
     { "getFreeBufferCount", Wrap_Source::GetFreeBufferCount },
+    { "getPitch",           Wrap_Source::GetPitch           },
     { "getType",            Wrap_Source::GetType            },
     { "getVolume",          Wrap_Source::GetVolume          },
     { "getVolumeLimits",    Wrap_Source::GetVolumeLimits    },
@@ -218,6 +238,7 @@ static constexpr luaL_Reg functions[] =
     { "play",               Wrap_Source::Play               },
     { "seek",               Wrap_Source::Seek               },
     { "setLooping",         Wrap_Source::SetLooping         },
+    { "setPitch",           Wrap_Source::SetPitch           },
     { "setVolume",          Wrap_Source::SetVolume          },
     { "setVolumeLimits",    Wrap_Source::SetVolumeLimits    },
     { "stop",               Wrap_Source::Stop               },
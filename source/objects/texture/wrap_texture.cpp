@@ -89,6 +89,59 @@ int Wrap_Texture::GetFilter(lua_State* L)
     return 2;
 }
 
+int Wrap_Texture::SetMipmapFilter(lua_State* L)
+{
+    love::Texture* self = Wrap_Texture::CheckTexture(L, 1);
+
+    love::Texture::Filter filter = self->GetFilter();
+
+    if (lua_isnoneornil(L, 2))
+        filter.mipmap = love::Texture::FILTER_NONE;
+    else
+    {
+        const char* mode = luaL_checkstring(L, 2);
+
+        if (!love::Texture::GetConstant(mode, filter.mipmap))
+            return Luax::EnumError(L, "filter mode", love::Texture::GetConstants(filter.mipmap),
+                                   mode);
+    }
+
+    if (filter.mipmap != love::Texture::FILTER_NONE && self->GetMipmapCount() == 1)
+        return luaL_error(L, "Non-mipmapped textures cannot have mipmap filtering.");
+
+    Luax::CatchException(L, [&]() { self->SetFilter(filter); });
+
+    return 0;
+}
+
+int Wrap_Texture::GetMipmapFilter(lua_State* L)
+{
+    love::Texture* self = Wrap_Texture::CheckTexture(L, 1);
+
+    const love::Texture::Filter filter = self->GetFilter();
+
+    if (filter.mipmap == love::Texture::FILTER_NONE)
+        return 0;
+
+    const char* mode = nullptr;
+
+    if (!love::Texture::GetConstant(filter.mipmap, mode))
+        return luaL_error(L, "Unknown filter mode.");
+
+    lua_pushstring(L, mode);
+
+    return 1;
+}
+
+int Wrap_Texture::GetMipmapCount(lua_State* L)
+{
+    love::Texture* self = Wrap_Texture::CheckTexture(L, 1);
+
+    lua_pushinteger(L, self->GetMipmapCount());
+
+    return 1;
+}
+
 int Wrap_Texture::SetWrap(lua_State* L)
 {
     love::Texture* self = Wrap_Texture::CheckTexture(L, 1);
@@ -145,17 +198,20 @@ love::Texture* Wrap_Texture::CheckTexture(lua_State* L, int index)
 }
 
 // clang-format off
-const luaL_Reg Wrap_Texture::functions[9] =
+const luaL_Reg Wrap_Texture::functions[12] =
 {
-    { "getTextureType", GetTextureType },
-    { "getWidth",       GetWidth       },
-    { "getHeight",      GetHeight      },
-    { "getDimensions",  GetDimensions  },
-    { "setFilter",      SetFilter      },
-    { "getFilter",      GetFilter      },
-    { "setWrap",        SetWrap        },
-    { "getWrap",        GetWrap        },
-    { 0,                0              }
+    { "getTextureType",  GetTextureType  },
+    { "getWidth",        GetWidth        },
+    { "getHeight",       GetHeight       },
+    { "getDimensions",   GetDimensions   },
+    { "setFilter",       SetFilter       },
+    { "getFilter",       GetFilter       },
+    { "setMipmapFilter", SetMipmapFilter },
+    { "getMipmapFilter", GetMipmapFilter },
+    { "getMipmapCount",  GetMipmapCount  },
+    { "setWrap",         SetWrap         },
+    { "getWrap",         GetWrap         },
+    { 0,                 0               }
 };
 // clang-format on
 
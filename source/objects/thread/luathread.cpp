@@ -15,10 +15,8 @@ LuaThread::LuaThread(const std::string& name, love::Data* code) : code(code), na
 LuaThread::~LuaThread()
 {}
 
-void LuaThread::ThreadFunction()
+lua_State* LuaThread::NewState()
 {
-    this->error.clear();
-
     lua_State* L = luaL_newstate();
     luaL_openlibs(L);
 
@@ -38,6 +36,15 @@ void LuaThread::ThreadFunction()
     Luax::Require(L, "love.filesystem");
     lua_pop(L, 1);
 
+    return L;
+}
+
+void LuaThread::ThreadFunction()
+{
+    this->error.clear();
+
+    lua_State* L = LuaThread::NewState();
+
     lua_pushcfunction(L, Luax::Traceback);
     int tracebackIndex = lua_gettop(L);
 
@@ -0,0 +1,240 @@
+#include "objects/threadpool/threadpool.h"
+
+#include "objects/thread/luathread.h"
+
+#include "common/exception.h"
+
+using namespace love;
+
+love::Type ThreadPool::type("ThreadPool", &Object::type);
+
+ThreadPool::ThreadPool(const std::string& name, love::Data* code, int workers) :
+    code(code),
+    name(name),
+    pending(0),
+    nextQueue(0),
+    stopping(false)
+{
+    if (workers < 1 || workers > MAX_WORKERS)
+        throw love::Exception("Invalid worker count %d, expected 1 to %d.", workers, MAX_WORKERS);
+
+    for (int index = 0; index < workers; index++)
+        this->queues.push_back(std::make_unique<Queue>());
+
+    for (int index = 0; index < workers; index++)
+    {
+        Worker* worker = new Worker(this, index);
+        this->workers.emplace_back(worker, Acquire::NORETAIN);
+
+        if (!worker->Start())
+        {
+            this->workers.pop_back();
+            this->Stop();
+
+            throw love::Exception("Could not start thread pool worker %d.", index + 1);
+        }
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    this->Stop();
+}
+
+void ThreadPool::Stop()
+{
+    {
+        thread::Lock lock(this->sleepMutex);
+        this->stopping = true;
+    }
+
+    this->sleepCondition->Broadcast();
+
+    for (auto& worker : this->workers)
+        worker->Wait();
+
+    this->workers.clear();
+
+    /* whatever nobody got to won't run, but whoever waits on it still wakes */
+    for (auto& queue : this->queues)
+    {
+        for (auto& job : queue->jobs)
+            job.future->SetError("The thread pool was released before this job ran.");
+
+        queue->jobs.clear();
+    }
+}
+
+Future* ThreadPool::Submit(const std::vector<Variant>& args)
+{
+    Future* future = new Future();
+
+    Queue& queue = *this->queues[this->nextQueue++ % this->queues.size()];
+
+    /* counted with the push, so a worker can't take it before it's counted */
+    {
+        thread::Lock lock(queue.mutex);
+
+        queue.jobs.push_back(Job { args, StrongReference<Future>(future) });
+        this->pending++;
+    }
+
+    /* under sleepMutex, or a worker between its check and its wait misses it */
+    {
+        thread::Lock lock(this->sleepMutex);
+        this->sleepCondition->Signal();
+    }
+
+    return future;
+}
+
+bool ThreadPool::Take(int index, Job& job)
+{
+    Queue& queue = *this->queues[index];
+    thread::Lock lock(queue.mutex);
+
+    if (queue.jobs.empty())
+        return false;
+
+    job = std::move(queue.jobs.front());
+    queue.jobs.pop_front();
+
+    this->pending--;
+
+    return true;
+}
+
+/* from the back, so the owner and the thief don't fight over the same end */
+bool ThreadPool::Steal(int index, Job& job)
+{
+    int count = (int)this->queues.size();
+
+    for (int offset = 1; offset < count; offset++)
+    {
+        Queue& queue = *this->queues[(index + offset) % count];
+        thread::Lock lock(queue.mutex);
+
+        if (queue.jobs.empty())
+            continue;
+
+        job = std::move(queue.jobs.back());
+        queue.jobs.pop_back();
+
+        this->pending--;
+
+        return true;
+    }
+
+    return false;
+}
+
+bool ThreadPool::WaitForJob()
+{
+    thread::Lock lock(this->sleepMutex);
+
+    while (this->pending <= 0 && !this->stopping)
+        this->sleepCondition->Wait(this->sleepMutex);
+
+    return !this->stopping;
+}
+
+int ThreadPool::GetWorkerCount() const
+{
+    return (int)this->workers.size();
+}
+
+int ThreadPool::GetPendingCount() const
+{
+    return this->pending;
+}
+
+ThreadPool::Worker::Worker(ThreadPool* pool, int index) : pool(pool), index(index)
+{
+    this->threadName = pool->name + " #" + std::to_string(index + 1);
+}
+
+void ThreadPool::Worker::ThreadFunction()
+{
+    lua_State* L = LuaThread::NewState();
+
+    lua_pushcfunction(L, Luax::Traceback);
+    int traceback = lua_gettop(L);
+
+    std::string error;
+
+    Data* code = this->pool->code;
+
+    if (luaL_loadbuffer(L, (const char*)code->GetData(), code->GetSize(),
+                        this->pool->name.c_str()) != 0)
+        error = lua_tostring(L, -1);
+    else if (lua_pcall(L, 0, 1, traceback) != 0)
+        error = lua_tostring(L, -1);
+    else if (!lua_isfunction(L, -1))
+        error = "Thread pool code must return the function jobs call.";
+
+    Job job {};
+
+    while (true)
+    {
+        if (!this->pool->Take(this->index, job) && !this->pool->Steal(this->index, job))
+        {
+            if (!this->pool->WaitForJob())
+                break;
+
+            continue;
+        }
+
+        if (!error.empty())
+            job.future->SetError(error);
+        else
+            this->Run(L, job, traceback);
+
+        job = Job {};
+    }
+
+    lua_close(L);
+}
+
+/* the job function sits just above the traceback handler */
+void ThreadPool::Worker::Run(lua_State* L, Job& job, int traceback)
+{
+    int base = lua_gettop(L);
+
+    lua_pushvalue(L, traceback + 1);
+
+    for (const Variant& arg : job.args)
+        arg.ToLua(L);
+
+    if (lua_pcall(L, (int)job.args.size(), LUA_MULTRET, traceback) != 0)
+    {
+        job.future->SetError(lua_tostring(L, -1));
+        lua_settop(L, base);
+
+        return;
+    }
+
+    std::vector<Variant> results;
+    results.reserve(lua_gettop(L) - base);
+
+    try
+    {
+        for (int index = base + 1; index <= lua_gettop(L); index++)
+        {
+            results.push_back(Variant::FromLua(L, index));
+
+            if (results.back().GetType() == Variant::UNKNOWN)
+            {
+                throw love::Exception("Job result #%d is a %s, which can't leave its thread.",
+                                      index - base, luaL_typename(L, index));
+            }
+        }
+
+        job.future->SetResults(std::move(results));
+    }
+    catch (love::Exception& e)
+    {
+        job.future->SetError(e.what());
+    }
+
+    lua_settop(L, base);
+}
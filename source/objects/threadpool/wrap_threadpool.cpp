@@ -0,0 +1,69 @@
+#include "objects/threadpool/wrap_threadpool.h"
+
+using namespace love;
+
+int Wrap_ThreadPool::Submit(lua_State* L)
+{
+    ThreadPool* self = Wrap_ThreadPool::CheckThreadPool(L, 1);
+    std::vector<Variant> args;
+
+    int nargs = lua_gettop(L) - 1;
+    args.reserve(nargs);
+
+    for (int i = 0; i < nargs; ++i)
+    {
+        Luax::CatchException(L, [&]() { args.push_back(Variant::FromLua(L, i + 2)); });
+
+        if (args.back().GetType() == Variant::UNKNOWN)
+        {
+            args.clear();
+            return luaL_argerror(L, i + 2,
+                                 "boolean, number, string, love type, or flat table expected");
+        }
+    }
+
+    Future* future = self->Submit(args);
+    Luax::PushType(L, future);
+
+    future->Release();
+
+    return 1;
+}
+
+int Wrap_ThreadPool::GetWorkerCount(lua_State* L)
+{
+    ThreadPool* self = Wrap_ThreadPool::CheckThreadPool(L, 1);
+
+    lua_pushinteger(L, self->GetWorkerCount());
+
+    return 1;
+}
+
+int Wrap_ThreadPool::GetPendingCount(lua_State* L)
+{
+    ThreadPool* self = Wrap_ThreadPool::CheckThreadPool(L, 1);
+
+    lua_pushinteger(L, self->GetPendingCount());
+
+    return 1;
+}
+
+ThreadPool* Wrap_ThreadPool::CheckThreadPool(lua_State* L, int index)
+{
+    return Luax::CheckType<ThreadPool>(L, index);
+}
+
+// clang-format off
+static constexpr luaL_Reg functions[] =
+{
+    { "getPendingCount", Wrap_ThreadPool::GetPendingCount },
+    { "getWorkerCount",  Wrap_ThreadPool::GetWorkerCount  },
+    { "submit",          Wrap_ThreadPool::Submit          },
+    { 0,                 0                                }
+};
+// clang-format on
+
+int Wrap_ThreadPool::Register(lua_State* L)
+{
+    return Luax::RegisterType(L, &ThreadPool::type, functions, nullptr);
+}
@@ -132,7 +132,7 @@ int Wrap_Transform::SetTransformation(lua_State* L)
 int Wrap_Transform::SetMatrix(lua_State* L)
 {
 
-#if defined(__SWITCH__)
+#if not defined(__3DS__)
     Transform* self = Wrap_Transform::CheckTransform(L, 1);
 
     bool columnmajor = false;
@@ -249,7 +249,7 @@ int Wrap_Transform::SetMatrix(lua_State* L)
 
 int Wrap_Transform::GetMatrix(lua_State* L)
 {
-#if defined(__SWITCH__)
+#if not defined(__3DS__)
     Transform* self          = Wrap_Transform::CheckTransform(L, 1);
     const Elements& elements = self->GetMatrix().GetElements();
 
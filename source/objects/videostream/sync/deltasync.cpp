@@ -1,10 +1,12 @@
 #include "objects/videostream/sync/deltasync.h"
 #include "modules/thread/types/lock.h"
 
+#include "modules/timer/timer.h"
+
 using namespace love;
 using thread::Lock;
 
-DeltaSync::DeltaSync() : playing(false), position(0), speed(1)
+DeltaSync::DeltaSync() : playing(false), position(0), speed(1), startTime(0)
 {}
 
 DeltaSync::~DeltaSync()
@@ -12,31 +14,42 @@ DeltaSync::~DeltaSync()
 
 double DeltaSync::GetPosition() const
 {
-    return this->position;
+    Lock lock(this->mutex);
+
+    if (!this->playing)
+        return this->position;
+
+    return this->position + (Timer::GetTime() - this->startTime) * this->speed;
 }
 
-void DeltaSync::Update(double dt)
+void DeltaSync::Play()
 {
     Lock lock(this->mutex);
 
     if (this->playing)
-        this->position += this->speed * dt;
-}
+        return;
 
-void DeltaSync::Play()
-{
-    this->playing = true;
+    this->startTime = Timer::GetTime();
+    this->playing   = true;
 }
 
 void DeltaSync::Pause()
 {
+    Lock lock(this->mutex);
+
+    if (!this->playing)
+        return;
+
+    this->position += (Timer::GetTime() - this->startTime) * this->speed;
     this->playing = false;
 }
 
 void DeltaSync::Seek(double time)
 {
     Lock lock(this->mutex);
-    this->position = time;
+
+    this->position  = time;
+    this->startTime = Timer::GetTime();
 }
 
 bool DeltaSync::IsPlaying() const
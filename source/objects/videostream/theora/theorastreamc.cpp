@@ -2,15 +2,25 @@
 #include "objects/videostream/sync/deltasync.h"
 
 #include "modules/thread/types/lock.h"
+#include "modules/video/worker.h"
+
+#include <algorithm>
 
 using namespace love::common;
 using love::thread::Lock;
 
 TheoraStream::TheoraStream(File* file) :
+    frontBuffer(nullptr),
+    frontTime(-1),
+    decodedTime(-1),
+    seekTarget(-1),
+    endOfStream(false),
+    decodedCount(0),
+    droppedCount(0),
+    worker(nullptr),
     demuxer(file),
     headerParsed(false),
     decoder(nullptr),
-    frameReady(false),
     lastFrame(0),
     nextFrame(0),
     quality {}
@@ -26,12 +36,29 @@ TheoraStream::~TheoraStream()
     if (this->decoder)
         th_decode_free(this->decoder);
 
-    delete this->frontBuffer;
-    delete this->backBuffer;
+    this->DeleteFrames();
 
     th_info_clear(&this->info);
 }
 
+void TheoraStream::InitFrames()
+{
+    this->frontBuffer = this->frames[0];
+    this->freeFrames.assign(this->frames.begin() + 1, this->frames.end());
+}
+
+void TheoraStream::DeleteFrames()
+{
+    for (IFrame* frame : this->frames)
+        delete frame;
+
+    this->frames.clear();
+    this->freeFrames.clear();
+    this->decodedFrames.clear();
+
+    this->frontBuffer = nullptr;
+}
+
 void TheoraStream::ParseHeader()
 {
     if (this->headerParsed)
@@ -70,83 +97,117 @@ void TheoraStream::ParseHeader()
     th_decode_packetin(this->decoder, &this->packet, nullptr);
 }
 
-void TheoraStream::ThreadedFillBackBuffer(double dt)
+void TheoraStream::SetWorker(Worker* worker)
 {
-    this->frameSync->Update(dt);
-    double position = this->frameSync->GetPosition();
+    Lock lock(this->bufferMutex);
+    this->worker = worker;
+}
 
-    if (position < lastFrame)
-        this->SeekDecoder(position);
+bool TheoraStream::NeedsDecode() const
+{
+    Lock lock(this->bufferMutex);
 
-    th_ycbcr_buffer bufferInfo;
-    bool hasFrame = false;
+    if (this->seekTarget >= 0)
+        return true;
 
-    /*
-    ** until we are at the end of the stream
-    ** or we are displaying the right frame
-    */
+    return !this->endOfStream && !this->freeFrames.empty();
+}
 
-    size_t framesBehind = 0;
-    bool failedSeek     = false;
+bool TheoraStream::DecodeNext()
+{
+    IFrame* target = nullptr;
+    double seek    = -1;
 
-    while (!this->demuxer.IsEOS() && position >= this->nextFrame)
     {
-        if (framesBehind++ > 5 && !failedSeek)
-        {
-            this->SeekDecoder(position);
-            framesBehind = 0;
-            failedSeek   = true;
-        }
+        Lock lock(this->bufferMutex);
 
-        if (failedSeek)
-            this->quality.offset = std::max(this->quality.current - 1, 0);
-        else
+        seek             = this->seekTarget;
+        this->seekTarget = -1;
+
+        if (seek >= 0)
         {
-            if (framesBehind == 0)
-                this->quality.offset = std::min(this->quality.offset + 1, this->quality.maximum);
+            for (const auto& queued : this->decodedFrames)
+                this->freeFrames.push_back(queued.frame);
+
+            this->decodedFrames.clear();
+            this->endOfStream = false;
         }
 
-        // this->SetPostProcessingLevel();
+        if (this->endOfStream || this->freeFrames.empty())
+            return false;
 
-        th_decode_ycbcr_out(this->decoder, bufferInfo);
-        hasFrame = true;
+        target = this->freeFrames.back();
+        this->freeFrames.pop_back();
+    }
+
+    if (seek >= 0)
+        this->SeekDecoder(seek);
 
-        ogg_int64_t granulePosition = -1;
+    double position = this->frameSync->GetPosition();
+
+    th_ycbcr_buffer bufferInfo;
+    th_decode_ycbcr_out(this->decoder, bufferInfo);
 
-        do
+    /* right after a seek the decoder doesn't know the frame time yet */
+    double time = (this->nextFrame < 0) ? position : this->nextFrame;
+    bool eos    = false;
+
+    ogg_int64_t granulePosition = -1;
+
+    do
+    {
+        if (this->demuxer.ReadPacket(this->packet))
         {
-            if (this->demuxer.ReadPacket(this->packet))
-                return;
-        } while (th_decode_packetin(this->decoder, &this->packet, &granulePosition) != 0);
+            eos = true;
+            break;
+        }
+    } while (th_decode_packetin(this->decoder, &this->packet, &granulePosition) != 0);
 
+    if (!eos)
+    {
         this->lastFrame = this->nextFrame;
         this->nextFrame = th_granule_time(this->decoder, granulePosition);
     }
 
-    /* only swap once, even if we read many frames to get here */
+    /*
+    ** Skip the (expensive) conversion when the next frame is already due,
+    ** this one would never make it to the screen.
+    */
+    bool late = !eos && this->nextFrame <= position;
 
-    if (hasFrame)
-    {
-        /* don't swap whilst we're writing to the backbuffer */
+    bool hasData = bufferInfo[0].data && bufferInfo[1].data && bufferInfo[2].data;
 
-        {
-            thread::Lock lock(this->bufferMutex);
-            this->frameReady = false;
-        }
+    if (!late && hasData)
+        this->FillBufferData(target, bufferInfo);
 
-        if (!bufferInfo[0].data || !bufferInfo[1].data || !bufferInfo[2].data)
-            return;
+    Lock lock(this->bufferMutex);
 
-        /* fill the buffer data, handled in the subclass */
-        this->FillBufferData(bufferInfo);
+    this->endOfStream = eos;
+    this->decodedCount++;
 
-        /* re-enable swapping */
+    /* a seek came in while we were decoding, this frame is stale */
+    if (late || !hasData || this->seekTarget >= 0)
+    {
+        if (late)
+            this->droppedCount++;
 
-        {
-            thread::Lock lock(this->bufferMutex);
-            this->frameReady = true;
-        }
+        this->freeFrames.push_back(target);
+        return true;
     }
+
+    this->decodedFrames.push_back({ target, time });
+    this->decodedTime = time;
+
+    return true;
+}
+
+VideoStream::FrameStats TheoraStream::GetFrameStats() const
+{
+    Lock lock(this->bufferMutex);
+
+    return FrameStats { .decoded = this->decodedCount,
+                        .dropped = this->droppedCount,
+                        .queued  = this->decodedFrames.size() };
 }
 
 int TheoraStream::GetWidth() const
@@ -194,25 +255,61 @@ void TheoraStream::SeekDecoder(double target)
 
 bool TheoraStream::SwapBuffers()
 {
-    if (this->demuxer.IsEOS())
-        return false;
-
     if (!this->frameSync->IsPlaying())
         return false;
 
-    thread::Lock lock(this->bufferMutex);
+    double position = this->frameSync->GetPosition();
 
-    if (!this->frameReady)
-        return false;
+    bool swapped = false;
+    bool notify  = false;
 
-    this->frameReady = false;
+    {
+        Lock lock(this->bufferMutex);
 
-    IFrame* temp = this->frontBuffer;
+        double newest = std::max(this->decodedTime, this->frontTime);
 
-    this->frontBuffer = this->backBuffer;
-    this->backBuffer  = temp;
+        /* the sync jumped back, or too far ahead to decode through */
+        bool behind = position < this->frontTime - SEEK_TOLERANCE;
+        bool ahead  = !this->endOfStream && position > newest + MAX_DECODE_THROUGH;
 
-    return true;
+        if (this->seekTarget < 0 && (behind || ahead))
+        {
+            this->seekTarget  = position;
+            this->frontTime   = -1;
+            this->decodedTime = position;
+
+            for (const auto& queued : this->decodedFrames)
+                this->freeFrames.push_back(queued.frame);
+
+            this->decodedFrames.clear();
+
+            notify = true;
+        }
+        else
+        {
+            /* show the newest frame that is due, anything before it was too late */
+            while (!this->decodedFrames.empty() && this->decodedFrames.front().time <= position)
+            {
+                if (swapped)
+                    this->droppedCount++;
+
+                this->freeFrames.push_back(this->frontBuffer);
+
+                this->frontBuffer = this->decodedFrames.front().frame;
+                this->frontTime   = this->decodedFrames.front().time;
+
+                this->decodedFrames.pop_front();
+
+                swapped = notify = true;
+            }
+        }
+    }
+
+    /* a slot was freed up or a seek is due, wake the worker outside our lock */
+    if (notify && this->worker != nullptr)
+        this->worker->Notify();
+
+    return swapped;
 }
 
 void TheoraStream::SetSync(FrameSync* other)
@@ -223,5 +320,9 @@ void TheoraStream::SetSync(FrameSync* other)
 
 bool TheoraStream::IsPlaying() const
 {
-    return this->frameSync->IsPlaying() && !this->demuxer.IsEOS();
+    if (!this->frameSync->IsPlaying())
+        return false;
+
+    Lock lock(this->bufferMutex);
+    return !this->endOfStream || !this->decodedFrames.empty();
 }
@@ -38,3 +38,8 @@ bool VideoStream::IsPlaying() const
 {
     return this->frameSync->IsPlaying();
 }
+
+VideoStream::FrameStats VideoStream::GetFrameStats() const
+{
+    return FrameStats {};
+}
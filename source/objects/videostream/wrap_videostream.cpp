@@ -102,6 +102,19 @@ int Wrap_VideoStream::IsPlaying(lua_State* L)
     return 1;
 }
 
+int Wrap_VideoStream::GetFrameStats(lua_State* L)
+{
+    VideoStream* self = Wrap_VideoStream::CheckVideoStream(L, 1);
+
+    VideoStream::FrameStats stats = self->GetFrameStats();
+
+    lua_pushinteger(L, stats.decoded);
+    lua_pushinteger(L, stats.dropped);
+    lua_pushinteger(L, stats.queued);
+
+    return 3;
+}
+
 VideoStream* Wrap_VideoStream::CheckVideoStream(lua_State* L, int index)
 {
     return Luax::CheckType<VideoStream>(L, index);
@@ -110,15 +123,16 @@ VideoStream* Wrap_VideoStream::CheckVideoStream(lua_State* L, int index)
 // clang-format off
 static constexpr luaL_Reg functions[] =
 {
-    { "setSync",     Wrap_VideoStream::SetSync     },
-    { "getFilename", Wrap_VideoStream::GetFilename },
-    { "play",        Wrap_VideoStream::Play        },
-    { "pause",       Wrap_VideoStream::Pause       },
-    { "seek",        Wrap_VideoStream::Seek        },
-    { "rewind",      Wrap_VideoStream::Rewind      },
-    { "tell",        Wrap_VideoStream::Tell        },
-    { "isPlaying",   Wrap_VideoStream::IsPlaying   },
-    { 0,             0                             }
+    { "setSync",       Wrap_VideoStream::SetSync       },
+    { "getFilename",   Wrap_VideoStream::GetFilename   },
+    { "play",          Wrap_VideoStream::Play          },
+    { "pause",         Wrap_VideoStream::Pause         },
+    { "seek",          Wrap_VideoStream::Seek          },
+    { "rewind",        Wrap_VideoStream::Rewind        },
+    { "tell",          Wrap_VideoStream::Tell          },
+    { "isPlaying",     Wrap_VideoStream::IsPlaying     },
+    { "getFrameStats", Wrap_VideoStream::GetFrameStats },
+    { 0,               0                               }
 };
 // clang-format on
 
@@ -0,0 +1,60 @@
+local love_filesystem = ...
+
+local type, select, unpack = type, select, unpack
+
+-- Callbacks for the async functions, keyed by the handle each returned. The
+-- result comes back through the "iocomplete" event, see love.handlers.
+local callbacks = {}
+
+-- the callback, if there is one, is always the last argument
+local function queue(func, ...)
+    local args = {...}
+    local count = select("#", ...)
+    local callback = args[count]
+
+    if type(callback) == "function" then
+        args[count] = nil
+        count = count - 1
+    else
+        callback = nil
+    end
+
+    local handle = func(unpack(args, 1, count))
+    callbacks[handle] = callback
+
+    return handle
+end
+
+function love_filesystem.readAsync(...)
+    return queue(love_filesystem._readAsync, ...)
+end
+
+function love_filesystem.writeAsync(...)
+    return queue(love_filesystem._writeAsync, ...)
+end
+
+function love_filesystem.appendAsync(...)
+    return queue(love_filesystem._appendAsync, ...)
+end
+
+function love_filesystem.mountAsync(...)
+    return queue(love_filesystem._mountAsync, ...)
+end
+
+function love_filesystem._ioComplete(handle)
+    local callback = callbacks[handle]
+
+    if callback == nil then
+        return
+    end
+
+    callbacks[handle] = nil
+
+    local err = handle:getError()
+
+    if err then
+        return callback(nil, err)
+    end
+
+    return callback(handle:getResults())
+end
@@ -35,3 +35,49 @@ function ImageData:mapPixel(func, ix, iy, iw, ih)
     -- performAtomic and mapPixelUnsafe have Lua-C API and FFI versions.
     self:_performAtomic(self._mapPixelUnsafe, self, func, ix, iy, iw, ih)
 end
+
+-- Callbacks and filenames for ImageData:encodeAsync, keyed by job id. The
+-- result comes back through the "imageencoded" event, see love.handlers.
+local encodeJobs = {}
+local lastEncodeId = 0
+
+function ImageData:encodeAsync(format, filename, callback)
+    if type(filename) == "function" then
+        filename, callback = nil, filename
+    end
+
+    if callback ~= nil and type(callback) ~= "function" then error("bad argument #3 to ImageData:encodeAsync (expected function)", 2) end
+
+    lastEncodeId = lastEncodeId + 1
+    self:_encodeAsync(format, filename, lastEncodeId)
+
+    encodeJobs[lastEncodeId] = { callback = callback, filename = filename }
+
+    return lastEncodeId
+end
+
+function ImageData:_encodeFinished(id, filedata, err)
+    local job = encodeJobs[id] or {}
+    encodeJobs[id] = nil
+
+    -- written here, since love.filesystem isn't safe to use from the encoder's thread
+    if filedata and job.filename then
+        if not love.filesystem then
+            filedata, err = nil, "love.filesystem must be loaded in order to write encoded ImageData."
+        else
+            local success, message = love.filesystem.write(job.filename, filedata)
+
+            if not success then
+                filedata, err = nil, message
+            end
+        end
+    end
+
+    local callback = job.callback
+
+    if callback then
+        return callback(filedata, err)
+    elseif err then
+        error(err, 0)
+    end
+end